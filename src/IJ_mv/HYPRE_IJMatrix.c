@@ -45,6 +45,11 @@ HYPRE_IJMatrixCreate( MPI_Comm        comm,
    hypre_IJMatrixAssembleFlag(ijmatrix)   = 0;
    hypre_IJMatrixPrintLevel(ijmatrix)     = 0;
    hypre_IJMatrixOMPFlag(ijmatrix)        = 0;
+   hypre_IJMatrixAssemblyMode(ijmatrix)   = 0;
+   hypre_IJMatrixReuseOffProc(ijmatrix)   = 0;
+   hypre_IJMatrixOffProcPlan(ijmatrix)    = NULL;
+   hypre_IJMatrixValueMap(ijmatrix)       = NULL;
+   hypre_IJMatrixElementMap(ijmatrix)     = NULL;
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &myid);
@@ -137,6 +142,9 @@ HYPRE_IJMatrixDestroy( HYPRE_IJMatrix matrix )
       {
          hypre_AssumedPartitionDestroy((hypre_IJAssumedPart*)hypre_IJMatrixAssumedPart(ijmatrix));
       }
+      hypre_IJMatrixOffProcPlanDestroy(ijmatrix);
+      hypre_IJMatrixValueMapDestroy(ijmatrix);
+      hypre_IJMatrixElementMapDestroy(ijmatrix);
       if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
       {
          hypre_IJMatrixDestroyParCSR( ijmatrix );
@@ -1086,6 +1094,245 @@ HYPRE_IJMatrixSetOMPFlag( HYPRE_IJMatrix matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixSetAssemblyMode
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetAssemblyMode( HYPRE_IJMatrix matrix,
+                               HYPRE_Int      mode )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (mode < 0 || mode > 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_IJMatrixAssemblyMode(ijmatrix) = mode;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixSetReuseOffProc
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetReuseOffProc( HYPRE_IJMatrix matrix,
+                               HYPRE_Int      reuse )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_IJMatrixReuseOffProc(ijmatrix) = reuse;
+   if (!reuse)
+   {
+      hypre_IJMatrixOffProcPlanDestroy(ijmatrix);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixBuildValueMap
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixBuildValueMap( HYPRE_IJMatrix      matrix,
+                             HYPRE_Int           nrows,
+                             HYPRE_Int          *ncols,
+                             const HYPRE_BigInt *rows,
+                             const HYPRE_BigInt *cols )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+   HYPRE_Int      *row_indexes;
+   HYPRE_Int      *ncols_tmp = ncols;
+   HYPRE_Int       i;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (nrows < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (nrows && !rows)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (nrows && !cols)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) != HYPRE_PARCSR )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (!hypre_IJMatrixAssembleFlag(ijmatrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Matrix not assembled! Required to build a value map!");
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+   if (hypre_GetExecPolicy1(hypre_IJMatrixMemoryLocation(ijmatrix)) == HYPRE_EXEC_DEVICE)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Value maps are only supported on the host!");
+      return hypre_error_flag;
+   }
+#endif
+
+   if (!ncols_tmp)
+   {
+      ncols_tmp = hypre_TAlloc(HYPRE_Int, nrows, HYPRE_MEMORY_HOST);
+      for (i = 0; i < nrows; i++)
+      {
+         ncols_tmp[i] = 1;
+      }
+   }
+
+   row_indexes = hypre_CTAlloc(HYPRE_Int, nrows, HYPRE_MEMORY_HOST);
+   hypre_PrefixSumInt(nrows, ncols_tmp, row_indexes);
+
+   hypre_IJMatrixBuildValueMapParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes, cols);
+
+   if (!ncols)
+   {
+      hypre_TFree(ncols_tmp, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(row_indexes, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixSetValuesByMap
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetValuesByMap( HYPRE_IJMatrix       matrix,
+                              const HYPRE_Complex *values )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (!hypre_IJMatrixValueMap(ijmatrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "No value map! Call HYPRE_IJMatrixBuildValueMap first!");
+      return hypre_error_flag;
+   }
+
+   if (!values && hypre_IJValueMapNumValues(hypre_IJMatrixValueMap(ijmatrix)))
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_IJMatrixSetValuesByMapParCSR(ijmatrix, values);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixAddElementMatrices
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixAddElementMatrices( HYPRE_IJMatrix       matrix,
+                                  HYPRE_Int            num_elements,
+                                  HYPRE_Int            nodes_per_element,
+                                  const HYPRE_BigInt  *element_nodes,
+                                  const HYPRE_Complex *element_matrices )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) != HYPRE_PARCSR )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (num_elements < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (nodes_per_element < 1)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (num_elements == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   if (!element_nodes)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (!element_matrices)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+   if (hypre_GetExecPolicy1(hypre_IJMatrixMemoryLocation(ijmatrix)) == HYPRE_EXEC_DEVICE)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Element matrices are only supported on the host!");
+      return hypre_error_flag;
+   }
+#endif
+
+   hypre_IJMatrixAddElementMatricesParCSR(ijmatrix, num_elements, nodes_per_element,
+                                          element_nodes, element_matrices);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_IJMatrixTranspose
  *--------------------------------------------------------------------------*/
@@ -323,6 +323,93 @@ HYPRE_Int HYPRE_IJMatrixSetPrintLevel(HYPRE_IJMatrix matrix,
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag(HYPRE_IJMatrix matrix,
                                    HYPRE_Int      omp_flag);
 
+/**
+ * (Optional) Sets the assembly mode of a matrix living on the host.
+ * Must be called before \ref HYPRE_IJMatrixInitialize.
+ *
+ * - 0 : (default) values are inserted row-wise into the matrix or into
+ *       auxiliary row arrays as they are set or added
+ * - 1 : values are appended to per-thread coordinate streams, and
+ *       HYPRE_IJMatrixAssemble sorts, reduces and converts them with all
+ *       threads.  HYPRE_IJMatrixSetValues and HYPRE_IJMatrixAddToValues
+ *       may then be called concurrently by the threads of a parallel
+ *       region, and rows may repeat within a call.  For each entry, the
+ *       values given before its last SetValues are discarded and the
+ *       remaining ones are summed.  Values of rows owned by other
+ *       processors are added there.  The OMP flag is ignored.
+ *
+ * Values cannot be retrieved with HYPRE_IJMatrixGetValues before the
+ * matrix is assembled in mode 1.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetAssemblyMode(HYPRE_IJMatrix matrix,
+                                        HYPRE_Int      mode);
+
+/**
+ * (Optional) If reuse != 0, HYPRE_IJMatrixAssemble keeps the communication
+ * pattern used to send values of rows owned by other processors, together
+ * with the position of each received value in the local matrix.  A later
+ * assemble of a matrix living on the host, in which all processors pass the
+ * same off processor (row, col) sequence to HYPRE_IJMatrixAddToValues as in
+ * the recorded assemble, then only sends the values and adds them in place.
+ * The pattern is discarded when it no longer matches or the sparsity pattern
+ * of the matrix is rebuilt.  Must be set to the same value on all processors.
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetReuseOffProc(HYPRE_IJMatrix matrix,
+                                        HYPRE_Int      reuse);
+
+/**
+ * (Optional) Registers a sequence of (row, col) entries of an assembled
+ * matrix for repeated in-place value updates with
+ * HYPRE_IJMatrixSetValuesByMap.  The sequence is given as in
+ * HYPRE_IJMatrixSetValues; entries may repeat and rows may be owned by other
+ * processors, but every entry must be in the sparsity pattern of the
+ * assembled matrix.  The values of the matrix are not changed.  This is a
+ * collective call, and only matrices living on the host are supported.  A
+ * previous map is replaced; the map is discarded when the sparsity pattern
+ * of the matrix is rebuilt.
+ **/
+HYPRE_Int HYPRE_IJMatrixBuildValueMap(HYPRE_IJMatrix      matrix,
+                                      HYPRE_Int           nrows,
+                                      HYPRE_Int          *ncols,
+                                      const HYPRE_BigInt *rows,
+                                      const HYPRE_BigInt *cols);
+
+/**
+ * (Optional) Sets the entries registered with HYPRE_IJMatrixBuildValueMap
+ * from values, which has one value per entry of the registered
+ * sequence and in the same order.  Values given for the same entry are
+ * summed, also across processors; entries not in the sequence keep their
+ * values.  The matrix stays assembled, and no call to
+ * HYPRE_IJMatrixAssemble is needed.  This is a collective call if any
+ * processor registered entries of rows owned by other processors.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetValuesByMap(HYPRE_IJMatrix       matrix,
+                                       const HYPRE_Complex *values);
+
+/**
+ * Adds a batch of dense element matrices to the matrix.  Element e has the
+ * nodes (global row and column indices) element_nodes[e*n .. e*n+n-1],
+ * with n = nodes_per_element, and its matrix is stored row by row in
+ * element_matrices[e*n*n .. e*n*n+n*n-1]; entry (a, b) is added to row
+ * element_nodes[e*n+a] and column element_nodes[e*n+b].  This is
+ * equivalent to calling HYPRE_IJMatrixAddToValues for every element, and
+ * HYPRE_IJMatrixAssemble must be called afterwards in the same way.
+ *
+ * Once the matrix has been assembled, the positions of the element entries
+ * in the matrix are computed when a connectivity is passed for the first
+ * time and reused, with a thread-parallel scatter, whenever the same
+ * connectivity is passed again.  The positions of the last few
+ * connectivities are kept, so that alternating batches, e.g. of different
+ * element types, are all reused.  Only matrices living on the host are
+ * supported.
+ **/
+HYPRE_Int HYPRE_IJMatrixAddElementMatrices(HYPRE_IJMatrix       matrix,
+                                           HYPRE_Int            num_elements,
+                                           HYPRE_Int            nodes_per_element,
+                                           const HYPRE_BigInt  *element_nodes,
+                                           const HYPRE_Complex *element_matrices);
+
 /**
  * Read the matrix from file.  This is mainly for debugging purposes.
  **/
@@ -279,12 +279,22 @@ hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation m
          hypre_IJMatrixTranslator(matrix) = aux_matrix;
       }
 
+      /* host assembly from per-thread COO streams */
+      if (hypre_IJMatrixAssemblyMode(matrix) == 1 && memory_location_aux == HYPRE_MEMORY_HOST)
+      {
+         hypre_AuxParCSRMatrixNumStreams(aux_matrix) = hypre_NumThreads();
+         hypre_AuxParCSRMatrixNeedAux(aux_matrix) = 1;
+      }
+
       hypre_ParCSRMatrixInitialize_v2(par_matrix, memory_location);
       hypre_AuxParCSRMatrixInitialize_v2(aux_matrix, memory_location_aux);
 
       /* WM: TODO - implement for sycl */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-      if (hypre_GetExecPolicy1(memory_location_aux) == HYPRE_EXEC_HOST)
+      if (hypre_GetExecPolicy1(memory_location_aux) == HYPRE_EXEC_HOST &&
+          !hypre_AuxParCSRMatrixNumStreams(aux_matrix))
+#else
+      if (!hypre_AuxParCSRMatrixNumStreams(aux_matrix))
 #endif
       {
          if (hypre_AuxParCSRMatrixDiagSizes(aux_matrix))
@@ -652,6 +662,14 @@ hypre_IJMatrixSetValuesParCSR( hypre_IJMatrix       *matrix,
    //HYPRE_BigInt *off_proc_j;
    HYPRE_Int print_level = hypre_IJMatrixPrintLevel(matrix);
    /*HYPRE_Complex *off_proc_data;*/
+   /* per-thread COO streams: append to the stream of the calling thread */
+   if (hypre_IJMatrixTranslator(matrix) &&
+       hypre_AuxParCSRMatrixNumStreams((hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix)))
+   {
+      return hypre_IJMatrixSetAddValuesParCSRCOO(matrix, nrows, ncols, rows, row_indexes,
+                                                 cols, values, "set");
+   }
+
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
    par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject( matrix );
@@ -1134,6 +1152,14 @@ hypre_IJMatrixAddToValuesParCSR( hypre_IJMatrix       *matrix,
    HYPRE_Complex *off_proc_data;
    HYPRE_Int print_level = hypre_IJMatrixPrintLevel(matrix);
 
+   /* per-thread COO streams: append to the stream of the calling thread */
+   if (hypre_IJMatrixTranslator(matrix) &&
+       hypre_AuxParCSRMatrixNumStreams((hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix)))
+   {
+      return hypre_IJMatrixSetAddValuesParCSRCOO(matrix, nrows, ncols, rows, row_indexes,
+                                                 cols, values, "add");
+   }
+
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
    par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject( matrix );
@@ -1791,6 +1817,11 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
 
    hypre_IJAssumedPart   *apart;
 
+   /* a plan created by the caller, but not yet set up, is being recorded */
+   HYPRE_Int record_plan = memory_location == HYPRE_MEMORY_HOST &&
+                           hypre_IJMatrixOffProcPlan(matrix) &&
+                           !hypre_IJOffProcPlanSetup(hypre_IJMatrixOffProcPlan(matrix));
+
    hypre_MPI_Comm_rank(comm, &myid);
    global_num_cols = hypre_IJMatrixGlobalNumCols(matrix);
    global_first_col = hypre_IJMatrixGlobalFirstCol(matrix);
@@ -2082,6 +2113,13 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    }
    hypre_TFree(real_proc_id, HYPRE_MEMORY_HOST);
 
+   /* record the send side of a reusable plan */
+   if (record_plan)
+   {
+      hypre_IJMatrixOffProcPlanSetSends(matrix, num_real_procs, ex_contact_procs, num_rows,
+                                        us_real_proc_id, off_proc_i);
+   }
+
    counter = 0; /* index into data arrays */
    prev_id = -1;
    for (i = 0; i < num_rows; i++)
@@ -2297,6 +2335,11 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
 
          if (memory_location == HYPRE_MEMORY_HOST)
          {
+            if (record_plan)
+            {
+               hypre_IJMatrixOffProcPlanAddRecvs(matrix, send_proc_obj.id[i], row,
+                                                 num_elements, col_ptr);
+            }
             hypre_IJMatrixAddToValuesParCSR(matrix, 1, &num_elements, &row, &row_index, col_ptr, col_data_ptr);
          }
          else
@@ -2549,11 +2592,21 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
    //HYPRE_Int row_len;
    HYPRE_Int max_num_threads;
    HYPRE_Int aux_flag, aux_flag_global;
+   HYPRE_Int plan_match;
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    max_num_threads = hypre_NumThreads();
 
+   /* slots of an off processor plan, value map or element map are lost
+      when the pattern is (re)built */
+   if (hypre_IJMatrixAssembleFlag(matrix) == 0)
+   {
+      hypre_IJMatrixOffProcPlanDestroy(matrix);
+      hypre_IJMatrixValueMapDestroy(matrix);
+      hypre_IJMatrixElementMapDestroy(matrix);
+   }
+
    /* first find out if anyone has an aux_matrix, and create one if you don't
     * have one, but other procs do */
    aux_flag = 0;
@@ -2618,6 +2671,12 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
          hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix) = new_off_proc_i_indx;
          hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix) = current_num_elmts;
       }*/
+      if (hypre_AuxParCSRMatrixNumStreams(aux_matrix))
+      {
+         /* move off processor elements of the COO streams into the stash */
+         hypre_IJMatrixStashOffProcValsParCSRCOO(matrix);
+      }
+
       off_proc_i_indx = hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix);
       hypre_MPI_Allreduce(&off_proc_i_indx, &offd_proc_elmts, 1, HYPRE_MPI_INT,
                           hypre_MPI_SUM, comm);
@@ -2628,10 +2687,35 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
          off_proc_i = hypre_AuxParCSRMatrixOffProcI(aux_matrix);
          off_proc_j = hypre_AuxParCSRMatrixOffProcJ(aux_matrix);
          off_proc_data = hypre_AuxParCSRMatrixOffProcData(aux_matrix);
-         hypre_IJMatrixAssembleOffProcValsParCSR(
-            matrix, off_proc_i_indx, max_off_proc_elmts, current_num_elmts,
-            HYPRE_MEMORY_HOST,
-            off_proc_i, off_proc_j, off_proc_data);
+
+         /* reuse the off processor pattern of a previous assemble if it has not changed */
+         plan_match = 0;
+         if (hypre_IJMatrixOffProcPlan(matrix))
+         {
+            hypre_IJMatrixOffProcPlanMatch(matrix, off_proc_i_indx, current_num_elmts,
+                                           off_proc_i, off_proc_j, &plan_match);
+         }
+
+         if (plan_match)
+         {
+            hypre_IJMatrixAssembleOffProcValsPlanParCSR(matrix, off_proc_data);
+         }
+         else
+         {
+            if (hypre_IJMatrixReuseOffProc(matrix))
+            {
+               hypre_IJMatrixOffProcPlanCreate(matrix, off_proc_i_indx, current_num_elmts,
+                                               off_proc_i, off_proc_j);
+            }
+            else
+            {
+               hypre_IJMatrixOffProcPlanDestroy(matrix);
+            }
+            hypre_IJMatrixAssembleOffProcValsParCSR(
+               matrix, off_proc_i_indx, max_off_proc_elmts, current_num_elmts,
+               HYPRE_MEMORY_HOST,
+               off_proc_i, off_proc_j, off_proc_data);
+         }
       }
    }
 
@@ -2643,7 +2727,15 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
       col_0 = col_partitioning[0];
       col_n = col_partitioning[1] - 1;
       /* move data into ParCSRMatrix if not there already */
-      if (hypre_AuxParCSRMatrixNeedAux(aux_matrix))
+      if (hypre_AuxParCSRMatrixNumStreams(aux_matrix))
+      {
+         /* sort and reduce the COO streams into diag and offd */
+         hypre_IJMatrixAssembleParCSRCOO(matrix);
+
+         big_offd_j = hypre_CSRMatrixBigJ(offd);
+         offd_j     = hypre_CSRMatrixJ(offd);
+      }
+      else if (hypre_AuxParCSRMatrixNeedAux(aux_matrix))
       {
          HYPRE_Int  *diag_array;
          HYPRE_Int  *offd_array;
@@ -2916,6 +3008,21 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
       hypre_CSRMatrixSetRownnz(offd);
    }
 
+   /* a plan recorded by this assemble gets the slots of the received values */
+   if (hypre_IJMatrixOffProcPlan(matrix) &&
+       !hypre_IJOffProcPlanSetup(hypre_IJMatrixOffProcPlan(matrix)))
+   {
+      hypre_IJMatrixOffProcPlanSetupParCSR(matrix);
+   }
+
+   /* Values may have changed: drop the SELL-C-sigma copies used by host SpMV */
+   hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixDiag(par_matrix));
+   hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixOffd(par_matrix));
+
+   /* The same holds for the pattern and the 16-bit column deltas */
+   hypre_CSRMatrixShortJDestroy(hypre_ParCSRMatrixDiag(par_matrix));
+   hypre_CSRMatrixShortJDestroy(hypre_ParCSRMatrixOffd(par_matrix));
+
    /* Free memory */
    hypre_AuxParCSRMatrixDestroy(aux_matrix);
    hypre_IJMatrixTranslator(matrix) = NULL;
@@ -2988,6 +3095,14 @@ hypre_IJMatrixSetValuesOMPParCSR( hypre_IJMatrix       *matrix,
    HYPRE_Int error_flag = 0;
 
    /*HYPRE_Complex *off_proc_data;*/
+   /* per-thread COO streams: append to the stream of the calling thread */
+   if (hypre_IJMatrixTranslator(matrix) &&
+       hypre_AuxParCSRMatrixNumStreams((hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix)))
+   {
+      return hypre_IJMatrixSetAddValuesParCSRCOO(matrix, nrows, ncols, rows, row_indexes,
+                                                 cols, values, "set");
+   }
+
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
    //max_num_threads = hypre_NumThreads();
@@ -3622,6 +3737,14 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
    HYPRE_Int error_flag = 0;
    HYPRE_Int i1;
 
+   /* per-thread COO streams: append to the stream of the calling thread */
+   if (hypre_IJMatrixTranslator(matrix) &&
+       hypre_AuxParCSRMatrixNumStreams((hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix)))
+   {
+      return hypre_IJMatrixSetAddValuesParCSRCOO(matrix, nrows, ncols, rows, row_indexes,
+                                                 cols, values, "add");
+   }
+
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
    max_num_threads = hypre_NumThreads();
@@ -0,0 +1,732 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * IJMatrix_ParCSR host assembly from per-thread COO streams
+ *
+ * With assembly mode 1, each thread appends the elements it passes to
+ * SetValues/AddToValues to its own stream (no searches, no shared state).
+ * Assemble then sorts all elements by (row, col) with a threaded LSD radix
+ * sort, reduces duplicates (everything before the last `set' is dropped, the
+ * rest is summed, as in the device assembly) and builds diag and offd in a
+ * single pass over the sorted elements.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixBitWidthCOO
+ *
+ * Number of bits needed to represent x.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixBitWidthCOO( hypre_ulonglongint x )
+{
+   HYPRE_Int num_bits = 0;
+
+   while (x)
+   {
+      num_bits++;
+      x >>= 1;
+   }
+
+   return num_bits;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixRadixSortCOO
+ *
+ * Stable LSD radix sort (8-bit digits) of the lowest num_bits bits of keys,
+ * permuting perm along.  Each pass is threaded: per-thread digit histograms,
+ * a (digit, thread)-ordered scan and a scatter of each thread's block.
+ * The work arrays are swapped with the input arrays as needed, so that on
+ * return *keys_ptr and *perm_ptr hold the sorted sequence.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixRadixSortCOO( HYPRE_Int             n,
+                            HYPRE_Int             num_bits,
+                            hypre_ulonglongint  **keys_ptr,
+                            HYPRE_Int           **perm_ptr,
+                            hypre_ulonglongint  **keys_work_ptr,
+                            HYPRE_Int           **perm_work_ptr )
+{
+   hypre_ulonglongint  *keys      = *keys_ptr;
+   hypre_ulonglongint  *keys_work = *keys_work_ptr;
+   hypre_ulonglongint  *keys_tmp;
+   HYPRE_Int           *perm      = *perm_ptr;
+   HYPRE_Int           *perm_work = *perm_work_ptr;
+   HYPRE_Int           *perm_tmp;
+   HYPRE_Int           *bucket;
+   HYPRE_Int            shift;
+
+   bucket = hypre_TAlloc(HYPRE_Int, 256 * hypre_NumThreads(), HYPRE_MEMORY_HOST);
+
+   for (shift = 0; shift < num_bits; shift += 8)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel
+#endif
+      {
+         HYPRE_Int  num_threads   = hypre_NumActiveThreads();
+         HYPRE_Int  my_thread_num = hypre_GetThreadNum();
+         HYPRE_Int *count         = bucket + 256 * my_thread_num;
+         HYPRE_Int  i, d, t, ns, ne, cnt, total;
+
+         hypre_partition1D(n, num_threads, my_thread_num, &ns, &ne);
+
+         for (d = 0; d < 256; d++)
+         {
+            count[d] = 0;
+         }
+         for (i = ns; i < ne; i++)
+         {
+            count[(keys[i] >> shift) & 255]++;
+         }
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp barrier
+#endif
+         if (my_thread_num == 0)
+         {
+            total = 0;
+            for (d = 0; d < 256; d++)
+            {
+               for (t = 0; t < num_threads; t++)
+               {
+                  cnt = bucket[256 * t + d];
+                  bucket[256 * t + d] = total;
+                  total += cnt;
+               }
+            }
+         }
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp barrier
+#endif
+
+         for (i = ns; i < ne; i++)
+         {
+            cnt = count[(keys[i] >> shift) & 255]++;
+            keys_work[cnt] = keys[i];
+            perm_work[cnt] = perm[i];
+         }
+      }
+
+      keys_tmp  = keys;
+      keys      = keys_work;
+      keys_work = keys_tmp;
+      perm_tmp  = perm;
+      perm      = perm_work;
+      perm_work = perm_tmp;
+   }
+
+   hypre_TFree(bucket, HYPRE_MEMORY_HOST);
+
+   *keys_ptr      = keys;
+   *keys_work_ptr = keys_work;
+   *perm_ptr      = perm;
+   *perm_work_ptr = perm_work;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixSetAddValuesParCSRCOO
+ *
+ * Appends the elements to the COO stream of the calling thread.  May be
+ * called concurrently by the threads of a parallel region.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixSetAddValuesParCSRCOO( hypre_IJMatrix       *matrix,
+                                     HYPRE_Int             nrows,
+                                     HYPRE_Int            *ncols,        /* if NULL, == all ones */
+                                     const HYPRE_BigInt   *rows,
+                                     const HYPRE_Int      *row_indexes,  /* if NULL, == ex_scan of ncols */
+                                     const HYPRE_BigInt   *cols,
+                                     const HYPRE_Complex  *values,
+                                     const char           *action )
+{
+   hypre_AuxParCSRMatrix *aux_matrix    = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_Int              my_thread_num = hypre_GetThreadNum();
+   const char             SorA          = action[0] == 's' ? 1 : 0;
+
+   HYPRE_BigInt          *stream_i;
+   HYPRE_BigInt          *stream_j;
+   HYPRE_Complex         *stream_data;
+   char                  *stream_sora;
+   HYPRE_Int              nelms, size, space, space_new;
+   HYPRE_Int              i, ii, n, indx;
+
+   if (nrows < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (my_thread_num >= hypre_AuxParCSRMatrixNumStreams(aux_matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "More threads than COO streams allocated in HYPRE_IJMatrixInitialize!\n");
+      return hypre_error_flag;
+   }
+
+   nelms = 0;
+   for (ii = 0; ii < nrows; ii++)
+   {
+      nelms += ncols ? ncols[ii] : 1;
+   }
+
+   if (nelms <= 0)
+   {
+      return hypre_error_flag;
+   }
+
+   size        = hypre_AuxParCSRMatrixStreamSize(aux_matrix)[my_thread_num];
+   space       = hypre_AuxParCSRMatrixStreamSpace(aux_matrix)[my_thread_num];
+   stream_i    = hypre_AuxParCSRMatrixStreamI(aux_matrix)[my_thread_num];
+   stream_j    = hypre_AuxParCSRMatrixStreamJ(aux_matrix)[my_thread_num];
+   stream_data = hypre_AuxParCSRMatrixStreamData(aux_matrix)[my_thread_num];
+   stream_sora = hypre_AuxParCSRMatrixStreamSorA(aux_matrix)[my_thread_num];
+
+   /* the first touch is done by the thread owning the stream */
+   if (!stream_i || size + nelms > space)
+   {
+      space_new = stream_i ? 2 * space : space;
+      space_new = hypre_max(size + nelms, space_new);
+
+      stream_i    = hypre_TReAlloc(stream_i,    HYPRE_BigInt,  space_new, HYPRE_MEMORY_HOST);
+      stream_j    = hypre_TReAlloc(stream_j,    HYPRE_BigInt,  space_new, HYPRE_MEMORY_HOST);
+      stream_data = hypre_TReAlloc(stream_data, HYPRE_Complex, space_new, HYPRE_MEMORY_HOST);
+      stream_sora = hypre_TReAlloc(stream_sora, char,          space_new, HYPRE_MEMORY_HOST);
+
+      hypre_AuxParCSRMatrixStreamSpace(aux_matrix)[my_thread_num] = space_new;
+      hypre_AuxParCSRMatrixStreamI(aux_matrix)[my_thread_num]     = stream_i;
+      hypre_AuxParCSRMatrixStreamJ(aux_matrix)[my_thread_num]     = stream_j;
+      hypre_AuxParCSRMatrixStreamData(aux_matrix)[my_thread_num]  = stream_data;
+      hypre_AuxParCSRMatrixStreamSorA(aux_matrix)[my_thread_num]  = stream_sora;
+   }
+
+   indx = 0;
+   for (ii = 0; ii < nrows; ii++)
+   {
+      n = ncols ? ncols[ii] : 1;
+      if (row_indexes)
+      {
+         indx = row_indexes[ii];
+      }
+
+      for (i = 0; i < n; i++)
+      {
+         stream_i[size]    = rows[ii];
+         stream_j[size]    = cols[indx];
+         stream_data[size] = values[indx++];
+         stream_sora[size] = SorA;
+         size++;
+      }
+   }
+
+   hypre_AuxParCSRMatrixStreamSize(aux_matrix)[my_thread_num] = size;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixStashOffProcValsParCSRCOO
+ *
+ * Moves the off processor elements of all streams into the off processor
+ * stash, which is then sent by hypre_IJMatrixAssembleOffProcValsParCSR.
+ * As for the row-wise assembly, the receivers add these values and values
+ * set on other processors are dropped.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixStashOffProcValsParCSRCOO( hypre_IJMatrix *matrix )
+{
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_BigInt          *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt           row_start = row_partitioning[0];
+   HYPRE_BigInt           row_end   = row_partitioning[1];
+
+   HYPRE_Int              num_streams    = hypre_AuxParCSRMatrixNumStreams(aux_matrix);
+   HYPRE_Int             *stream_size    = hypre_AuxParCSRMatrixStreamSize(aux_matrix);
+   HYPRE_BigInt         **stream_i       = hypre_AuxParCSRMatrixStreamI(aux_matrix);
+   HYPRE_BigInt         **stream_j       = hypre_AuxParCSRMatrixStreamJ(aux_matrix);
+   HYPRE_Complex        **stream_data    = hypre_AuxParCSRMatrixStreamData(aux_matrix);
+   char                 **stream_sora    = hypre_AuxParCSRMatrixStreamSorA(aux_matrix);
+
+   HYPRE_Int              current_num_elmts = hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix);
+   HYPRE_Int              max_off_proc_elmts = hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix);
+   HYPRE_Int              off_proc_i_indx = hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix);
+   HYPRE_BigInt          *off_proc_i;
+   HYPRE_BigInt          *off_proc_j;
+   HYPRE_Complex         *off_proc_data;
+
+   HYPRE_Int             *num_elmts;
+   HYPRE_Int             *num_pairs;
+   HYPRE_Int              t, k;
+
+   /* count off processor elements and (row, no. of elmts) pairs per stream */
+   num_elmts = hypre_CTAlloc(HYPRE_Int, num_streams + 1, HYPRE_MEMORY_HOST);
+   num_pairs = hypre_CTAlloc(HYPRE_Int, num_streams + 1, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(t, k) schedule(dynamic, 1)
+#endif
+   for (t = 0; t < num_streams; t++)
+   {
+      HYPRE_BigInt row_prev = row_start;
+
+      for (k = 0; k < stream_size[t]; k++)
+      {
+         if ((stream_i[t][k] < row_start || stream_i[t][k] >= row_end) && !stream_sora[t][k])
+         {
+            num_elmts[t + 1]++;
+            if (num_elmts[t + 1] == 1 || stream_i[t][k] != row_prev)
+            {
+               num_pairs[t + 1]++;
+            }
+            row_prev = stream_i[t][k];
+         }
+      }
+   }
+
+   for (t = 0; t < num_streams; t++)
+   {
+      num_elmts[t + 1] += num_elmts[t];
+      num_pairs[t + 1] += num_pairs[t];
+   }
+
+   /* grow the stash if necessary */
+   off_proc_i    = hypre_AuxParCSRMatrixOffProcI(aux_matrix);
+   off_proc_j    = hypre_AuxParCSRMatrixOffProcJ(aux_matrix);
+   off_proc_data = hypre_AuxParCSRMatrixOffProcData(aux_matrix);
+   if (current_num_elmts + num_elmts[num_streams] > max_off_proc_elmts)
+   {
+      max_off_proc_elmts = current_num_elmts + num_elmts[num_streams];
+      off_proc_i    = hypre_TReAlloc(off_proc_i,    HYPRE_BigInt,  2 * max_off_proc_elmts,
+                                     HYPRE_MEMORY_HOST);
+      off_proc_j    = hypre_TReAlloc(off_proc_j,    HYPRE_BigInt,  max_off_proc_elmts,
+                                     HYPRE_MEMORY_HOST);
+      off_proc_data = hypre_TReAlloc(off_proc_data, HYPRE_Complex, max_off_proc_elmts,
+                                     HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix) = max_off_proc_elmts;
+      hypre_AuxParCSRMatrixOffProcI(aux_matrix)        = off_proc_i;
+      hypre_AuxParCSRMatrixOffProcJ(aux_matrix)        = off_proc_j;
+      hypre_AuxParCSRMatrixOffProcData(aux_matrix)     = off_proc_data;
+   }
+
+   /* copy the off processor elements and compress the streams */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(t, k) schedule(dynamic, 1)
+#endif
+   for (t = 0; t < num_streams; t++)
+   {
+      HYPRE_Int  cnt_on   = 0;
+      HYPRE_Int  cnt_off  = current_num_elmts + num_elmts[t];
+      HYPRE_Int  cnt_pair = off_proc_i_indx + 2 * num_pairs[t];
+      HYPRE_Int  cnt_pair_0 = cnt_pair;
+
+      for (k = 0; k < stream_size[t]; k++)
+      {
+         if (stream_i[t][k] < row_start || stream_i[t][k] >= row_end)
+         {
+            /* values cannot be set on other processors (as for the row-wise assembly) */
+            if (stream_sora[t][k])
+            {
+               continue;
+            }
+            if (cnt_pair == cnt_pair_0 || stream_i[t][k] != off_proc_i[cnt_pair - 2])
+            {
+               off_proc_i[cnt_pair++] = stream_i[t][k];
+               off_proc_i[cnt_pair++] = 0;
+            }
+            off_proc_i[cnt_pair - 1]++;
+            off_proc_j[cnt_off]      = stream_j[t][k];
+            off_proc_data[cnt_off++] = stream_data[t][k];
+         }
+         else
+         {
+            stream_i[t][cnt_on]    = stream_i[t][k];
+            stream_j[t][cnt_on]    = stream_j[t][k];
+            stream_data[t][cnt_on] = stream_data[t][k];
+            stream_sora[t][cnt_on] = stream_sora[t][k];
+            cnt_on++;
+         }
+      }
+      stream_size[t] = cnt_on;
+   }
+
+   hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix) = current_num_elmts + num_elmts[num_streams];
+   hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix) = off_proc_i_indx + 2 * num_pairs[num_streams];
+
+   hypre_TFree(num_elmts, HYPRE_MEMORY_HOST);
+   hypre_TFree(num_pairs, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssembleParCSRCOO
+ *
+ * Builds diag (diagonal first) and offd of the ParCSR matrix from the on
+ * processor elements of the COO streams.  offd is returned with global
+ * column indices in BigJ; col_map_offd is generated by the caller.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAssembleParCSRCOO( hypre_IJMatrix *matrix )
+{
+   hypre_ParCSRMatrix    *par_matrix = (hypre_ParCSRMatrix *)    hypre_IJMatrixObject(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_BigInt          *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt          *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   HYPRE_BigInt           row_0 = row_partitioning[0];
+   HYPRE_BigInt           col_0 = col_partitioning[0];
+   HYPRE_BigInt           col_n = col_partitioning[1] - 1;
+   HYPRE_Int              num_rows = (HYPRE_Int)(row_partitioning[1] - row_0);
+
+   hypre_CSRMatrix       *diag   = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix       *offd   = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int             *diag_i = hypre_CSRMatrixI(diag);
+   HYPRE_Int             *offd_i = hypre_CSRMatrixI(offd);
+   HYPRE_Int             *diag_j = NULL;
+   HYPRE_Complex         *diag_data = NULL;
+   HYPRE_Int             *offd_j = NULL;
+   HYPRE_BigInt          *big_offd_j = NULL;
+   HYPRE_Complex         *offd_data = NULL;
+
+   HYPRE_Int              num_streams = hypre_AuxParCSRMatrixNumStreams(aux_matrix);
+   HYPRE_Int             *stream_size = hypre_AuxParCSRMatrixStreamSize(aux_matrix);
+   HYPRE_BigInt         **stream_i    = hypre_AuxParCSRMatrixStreamI(aux_matrix);
+   HYPRE_BigInt         **stream_j    = hypre_AuxParCSRMatrixStreamJ(aux_matrix);
+   HYPRE_Complex        **stream_data = hypre_AuxParCSRMatrixStreamData(aux_matrix);
+   char                 **stream_sora = hypre_AuxParCSRMatrixStreamSorA(aux_matrix);
+   HYPRE_Int             *stream_offset;
+
+   HYPRE_Int              nelms;
+   HYPRE_Int             *coo_i;
+   HYPRE_BigInt          *coo_j;
+   HYPRE_Complex         *coo_data;
+   char                  *coo_sora;
+   HYPRE_BigInt           col_min, col_max;
+   HYPRE_Int              row_bits, col_bits;
+
+   hypre_ulonglongint    *keys, *keys_work;
+   HYPRE_Int             *perm, *perm_work;
+   HYPRE_Int             *row_ptr;
+   HYPRE_Int             *diag_array, *offd_array;
+   HYPRE_Int              max_num_threads = hypre_NumThreads();
+   HYPRE_Int              i, t;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   stream_offset = hypre_TAlloc(HYPRE_Int, num_streams + 1, HYPRE_MEMORY_HOST);
+   stream_offset[0] = 0;
+   for (t = 0; t < num_streams; t++)
+   {
+      stream_offset[t + 1] = stream_offset[t] + stream_size[t];
+   }
+   nelms = stream_offset[num_streams];
+
+   /*-----------------------------------------------------------------------
+    * Gather the streams into flat arrays with local row numbers
+    *-----------------------------------------------------------------------*/
+
+   coo_i    = hypre_TAlloc(HYPRE_Int,     nelms, HYPRE_MEMORY_HOST);
+   coo_j    = hypre_TAlloc(HYPRE_BigInt,  nelms, HYPRE_MEMORY_HOST);
+   coo_data = hypre_TAlloc(HYPRE_Complex, nelms, HYPRE_MEMORY_HOST);
+   coo_sora = hypre_TAlloc(char,          nelms, HYPRE_MEMORY_HOST);
+
+   col_min = col_0;
+   col_max = col_0;
+   for (t = 0; t < num_streams; t++)
+   {
+      if (stream_size[t])
+      {
+         col_min = col_max = stream_j[t][0];
+         break;
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel reduction(min:col_min) reduction(max:col_max)
+#endif
+   {
+      HYPRE_Int  num_threads   = hypre_NumActiveThreads();
+      HYPRE_Int  my_thread_num = hypre_GetThreadNum();
+      HYPRE_Int  ii, k, s, ns, ne;
+
+      hypre_partition1D(nelms, num_threads, my_thread_num, &ns, &ne);
+
+      /* locate the stream holding element ns */
+      s = 0;
+      while (s < num_streams && stream_offset[s + 1] <= ns)
+      {
+         s++;
+      }
+      k = ns - (s < num_streams ? stream_offset[s] : 0);
+
+      for (ii = ns; ii < ne; ii++)
+      {
+         while (k == stream_size[s])
+         {
+            s++;
+            k = 0;
+         }
+         coo_i[ii]    = (HYPRE_Int)(stream_i[s][k] - row_0);
+         coo_j[ii]    = stream_j[s][k];
+         coo_data[ii] = stream_data[s][k];
+         coo_sora[ii] = stream_sora[s][k];
+         col_min = hypre_min(col_min, coo_j[ii]);
+         col_max = hypre_max(col_max, coo_j[ii]);
+         k++;
+      }
+   }
+
+   for (t = 0; t < num_streams; t++)
+   {
+      hypre_TFree(stream_i[t],    HYPRE_MEMORY_HOST);
+      hypre_TFree(stream_j[t],    HYPRE_MEMORY_HOST);
+      hypre_TFree(stream_data[t], HYPRE_MEMORY_HOST);
+      hypre_TFree(stream_sora[t], HYPRE_MEMORY_HOST);
+      stream_size[t] = 0;
+   }
+   hypre_TFree(stream_offset, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Sort by (row, col).  If both fit into 64 bits, one sort on the packed
+    * key; otherwise sort by col and then (stably) by row.
+    *-----------------------------------------------------------------------*/
+
+   keys      = hypre_TAlloc(hypre_ulonglongint, nelms, HYPRE_MEMORY_HOST);
+   keys_work = hypre_TAlloc(hypre_ulonglongint, nelms, HYPRE_MEMORY_HOST);
+   perm      = hypre_TAlloc(HYPRE_Int,          nelms, HYPRE_MEMORY_HOST);
+   perm_work = hypre_TAlloc(HYPRE_Int,          nelms, HYPRE_MEMORY_HOST);
+
+   row_bits = hypre_IJMatrixBitWidthCOO((hypre_ulonglongint) hypre_max(num_rows - 1, 0));
+   col_bits = hypre_IJMatrixBitWidthCOO((hypre_ulonglongint) (col_max - col_min));
+
+   if (row_bits + col_bits <= 64)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < nelms; i++)
+      {
+         keys[i] = (hypre_ulonglongint) (coo_j[i] - col_min);
+         if (row_bits)
+         {
+            keys[i] |= (hypre_ulonglongint) coo_i[i] << col_bits;
+         }
+         perm[i] = i;
+      }
+      hypre_IJMatrixRadixSortCOO(nelms, row_bits + col_bits, &keys, &perm, &keys_work, &perm_work);
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < nelms; i++)
+      {
+         keys[i] = (hypre_ulonglongint) (coo_j[i] - col_min);
+         perm[i] = i;
+      }
+      hypre_IJMatrixRadixSortCOO(nelms, col_bits, &keys, &perm, &keys_work, &perm_work);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < nelms; i++)
+      {
+         keys[i] = (hypre_ulonglongint) coo_i[perm[i]];
+      }
+      hypre_IJMatrixRadixSortCOO(nelms, row_bits, &keys, &perm, &keys_work, &perm_work);
+   }
+
+   hypre_TFree(keys,      HYPRE_MEMORY_HOST);
+   hypre_TFree(keys_work, HYPRE_MEMORY_HOST);
+   hypre_TFree(perm_work, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * row_ptr[i] = first sorted element of row i
+    *-----------------------------------------------------------------------*/
+
+   row_ptr = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i <= nelms; i++)
+   {
+      HYPRE_Int row_prev = (i > 0)     ? coo_i[perm[i - 1]] : -1;
+      HYPRE_Int row      = (i < nelms) ? coo_i[perm[i]]     : num_rows;
+      HYPRE_Int ii;
+
+      for (ii = row_prev + 1; ii <= row; ii++)
+      {
+         row_ptr[ii] = i;
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Reduce duplicates and fill diag and offd
+    *-----------------------------------------------------------------------*/
+
+   diag_array = hypre_CTAlloc(HYPRE_Int, max_num_threads, HYPRE_MEMORY_HOST);
+   offd_array = hypre_CTAlloc(HYPRE_Int, max_num_threads, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i)
+#endif
+   {
+      HYPRE_Int      num_threads   = hypre_NumActiveThreads();
+      HYPRE_Int      my_thread_num = hypre_GetThreadNum();
+      HYPRE_Int      ns, ne, j, k, e, i_diag, i_offd, i_first;
+      HYPRE_BigInt   col;
+      HYPRE_Complex  value;
+
+      hypre_partition1D(num_rows, num_threads, my_thread_num, &ns, &ne);
+
+      /* count distinct columns */
+      i_diag = i_offd = 0;
+      for (i = ns; i < ne; i++)
+      {
+         for (j = row_ptr[i]; j < row_ptr[i + 1]; j++)
+         {
+            col = coo_j[perm[j]];
+            if (j > row_ptr[i] && col == coo_j[perm[j - 1]])
+            {
+               continue;
+            }
+            if (col < col_0 || col > col_n)
+            {
+               i_offd++;
+            }
+            else
+            {
+               i_diag++;
+            }
+         }
+      }
+      diag_array[my_thread_num] = i_diag;
+      offd_array[my_thread_num] = i_offd;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+      if (my_thread_num == 0)
+      {
+         i_diag = 0;
+         i_offd = 0;
+         for (k = 0; k < num_threads; k++)
+         {
+            i_diag += diag_array[k];
+            i_offd += offd_array[k];
+            diag_array[k] = i_diag;
+            offd_array[k] = i_offd;
+         }
+         diag_i[num_rows] = i_diag;
+         offd_i[num_rows] = i_offd;
+
+         hypre_TFree(hypre_CSRMatrixJ(diag),    hypre_CSRMatrixMemoryLocation(diag));
+         hypre_TFree(hypre_CSRMatrixData(diag), hypre_CSRMatrixMemoryLocation(diag));
+         hypre_TFree(hypre_CSRMatrixJ(offd),    hypre_CSRMatrixMemoryLocation(offd));
+         hypre_TFree(hypre_CSRMatrixData(offd), hypre_CSRMatrixMemoryLocation(offd));
+         hypre_TFree(hypre_CSRMatrixBigJ(offd), hypre_CSRMatrixMemoryLocation(offd));
+
+         diag_j     = hypre_CTAlloc(HYPRE_Int,     i_diag, hypre_CSRMatrixMemoryLocation(diag));
+         diag_data  = hypre_CTAlloc(HYPRE_Complex, i_diag, hypre_CSRMatrixMemoryLocation(diag));
+         offd_j     = hypre_CTAlloc(HYPRE_Int,     i_offd, hypre_CSRMatrixMemoryLocation(offd));
+         offd_data  = hypre_CTAlloc(HYPRE_Complex, i_offd, hypre_CSRMatrixMemoryLocation(offd));
+         big_offd_j = hypre_CTAlloc(HYPRE_BigInt,  i_offd, hypre_CSRMatrixMemoryLocation(offd));
+      }
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
+      i_diag = my_thread_num ? diag_array[my_thread_num - 1] : 0;
+      i_offd = my_thread_num ? offd_array[my_thread_num - 1] : 0;
+
+      for (i = ns; i < ne; i++)
+      {
+         diag_i[i] = i_diag;
+         offd_i[i] = i_offd;
+
+         /* reserve the first space for the diagonal element */
+         i_first = -1;
+         for (j = row_ptr[i]; j < row_ptr[i + 1]; j++)
+         {
+            col = coo_j[perm[j]];
+            if (col - col_0 == (HYPRE_BigInt) i)
+            {
+               i_first = i_diag++;
+               break;
+            }
+            if (col - col_0 > (HYPRE_BigInt) i)
+            {
+               break;
+            }
+         }
+
+         j = row_ptr[i];
+         while (j < row_ptr[i + 1])
+         {
+            /* drop everything before the last set, add the rest */
+            col   = coo_j[perm[j]];
+            value = 0.0;
+            for (; j < row_ptr[i + 1] && coo_j[perm[j]] == col; j++)
+            {
+               e = perm[j];
+               value = coo_sora[e] ? coo_data[e] : value + coo_data[e];
+            }
+
+            if (col < col_0 || col > col_n)
+            {
+               big_offd_j[i_offd]  = col;
+               offd_data[i_offd++] = value;
+            }
+            else if (col - col_0 == (HYPRE_BigInt) i)
+            {
+               diag_j[i_first]    = i;
+               diag_data[i_first] = value;
+            }
+            else
+            {
+               diag_j[i_diag]      = (HYPRE_Int)(col - col_0);
+               diag_data[i_diag++] = value;
+            }
+         }
+      }
+   } /* end parallel region */
+
+   hypre_CSRMatrixJ(diag) = diag_j;
+   hypre_CSRMatrixData(diag) = diag_data;
+   hypre_CSRMatrixNumNonzeros(diag) = diag_i[num_rows];
+   hypre_CSRMatrixJ(offd) = offd_j;
+   hypre_CSRMatrixBigJ(offd) = big_offd_j;
+   hypre_CSRMatrixData(offd) = offd_data;
+   hypre_CSRMatrixNumNonzeros(offd) = offd_i[num_rows];
+
+   hypre_TFree(diag_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_ptr,    HYPRE_MEMORY_HOST);
+   hypre_TFree(perm,       HYPRE_MEMORY_HOST);
+   hypre_TFree(coo_i,      HYPRE_MEMORY_HOST);
+   hypre_TFree(coo_j,      HYPRE_MEMORY_HOST);
+   hypre_TFree(coo_data,   HYPRE_MEMORY_HOST);
+   hypre_TFree(coo_sora,   HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
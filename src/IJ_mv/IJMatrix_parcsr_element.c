@@ -0,0 +1,343 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Batched element matrix assembly for IJMatrix_ParCSR (host)
+ *
+ * Row a of the dense matrix of an element adds to row element_nodes[a] in the
+ * columns element_nodes[0 .. nodes_per_element-1].  Before the first
+ * assemble the batch goes through the AddToValues path in a single call.
+ * Once the matrix is assembled, the slot of every element entry is computed
+ * once per connectivity, with the local column of each element node looked
+ * up only once, and kept in a hypre_IJElementMap.  The matrix keeps a short
+ * list of maps, one per connectivity.  Later batches with a known
+ * connectivity are added with a threaded gather by destination slot, which
+ * needs neither coloring nor atomics.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_IJElementMapListDestroy
+ *
+ * Destroys map and all maps after it in the list.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_IJElementMapListDestroy( hypre_IJElementMap *map )
+{
+   hypre_IJElementMap *next;
+
+   while (map)
+   {
+      next = hypre_IJElementMapNext(map);
+
+      hypre_IJValueMapDestroy(hypre_IJElementMapValueMap(map));
+      hypre_TFree(hypre_IJElementMapElementNodes(map), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJElementMapOffRows(map),      HYPRE_MEMORY_HOST);
+      hypre_TFree(map, HYPRE_MEMORY_HOST);
+
+      map = next;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixElementMapDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixElementMapDestroy( hypre_IJMatrix *matrix )
+{
+   hypre_IJElementMapListDestroy(hypre_IJMatrixElementMap(matrix));
+   hypre_IJMatrixElementMap(matrix) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixElementMapCreateParCSR
+ *
+ * Computes the slots of all element entries of local rows and puts the new
+ * map at the front of the list of the matrix, dropping the least recently
+ * used map if the list is full.  Returns a NULL map, and leaves the list
+ * unchanged, if an entry is not in the pattern of the matrix.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixElementMapCreateParCSR( hypre_IJMatrix      *matrix,
+                                      HYPRE_Int            num_elements,
+                                      HYPRE_Int            nodes_per_element,
+                                      const HYPRE_BigInt  *element_nodes,
+                                      hypre_IJElementMap **map_ptr )
+{
+   hypre_ParCSRMatrix   *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix      *diag       = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix      *offd       = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int            *diag_i     = hypre_CSRMatrixI(diag);
+   HYPRE_Int            *diag_j     = hypre_CSRMatrixJ(diag);
+   HYPRE_Int            *offd_i     = hypre_CSRMatrixI(offd);
+   HYPRE_Int            *offd_j     = hypre_CSRMatrixJ(offd);
+   HYPRE_Int             nnz_diag   = hypre_CSRMatrixNumNonzeros(diag);
+   HYPRE_Int             nnz_offd   = hypre_CSRMatrixNumNonzeros(offd);
+   HYPRE_Int             num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_BigInt         *col_map_offd  = hypre_ParCSRMatrixColMapOffd(par_matrix);
+   HYPRE_BigInt          row_0 = hypre_IJMatrixRowPartitioning(matrix)[0];
+   HYPRE_BigInt          row_n = hypre_IJMatrixRowPartitioning(matrix)[1] - 1;
+   HYPRE_BigInt          col_0 = hypre_IJMatrixColPartitioning(matrix)[0];
+   HYPRE_BigInt          col_n = hypre_IJMatrixColPartitioning(matrix)[1] - 1;
+   HYPRE_BigInt          first = hypre_IJMatrixGlobalFirstCol(matrix);
+
+   HYPRE_Int             npe        = nodes_per_element;
+   HYPRE_Int             num_rows   = num_elements * npe;
+   HYPRE_Int             num_values = num_rows * npe;
+   hypre_IJElementMap   *map, *last;
+   HYPRE_Int            *local_col;
+   HYPRE_Int            *pos;
+   HYPRE_Int            *off_rows;
+   HYPRE_Int             num_off_rows, not_found;
+   HYPRE_Int             ii, k;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   *map_ptr = NULL;
+
+   /* local column of each element node: >= 0 in diag, <= -2 in offd at
+      -c-2, -1 if the column is not in the local matrix */
+   local_col = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ii) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < num_rows; ii++)
+   {
+      HYPRE_BigInt col = element_nodes[ii];
+
+      if (col < col_0 || col > col_n)
+      {
+         local_col[ii] = -hypre_BigBinarySearch(col_map_offd, col - first, num_cols_offd) - 2;
+      }
+      else
+      {
+         local_col[ii] = (HYPRE_Int)(col - col_0);
+      }
+   }
+
+   /* pos[k]: slot of the k-th element value, diag and offd numbered
+      consecutively; -1 for rows owned by other processors */
+   pos = hypre_TAlloc(HYPRE_Int, num_values, HYPRE_MEMORY_HOST);
+
+   num_off_rows = 0;
+   not_found    = 0;
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ii) reduction(+:num_off_rows,not_found) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < num_rows; ii++)
+   {
+      HYPRE_BigInt  row  = element_nodes[ii];
+      HYPRE_Int    *cols = &local_col[(ii / npe) * npe];
+      HYPRE_Int     row_local, b, p, c;
+
+      if (row < row_0 || row > row_n)
+      {
+         for (b = 0; b < npe; b++)
+         {
+            pos[ii * npe + b] = -1;
+         }
+         num_off_rows++;
+         continue;
+      }
+
+      row_local = (HYPRE_Int)(row - row_0);
+      for (b = 0; b < npe; b++)
+      {
+         c = cols[b];
+         pos[ii * npe + b] = -1;
+         if (c >= 0)
+         {
+            for (p = diag_i[row_local]; p < diag_i[row_local + 1]; p++)
+            {
+               if (diag_j[p] == c)
+               {
+                  pos[ii * npe + b] = p;
+                  break;
+               }
+            }
+         }
+         else if (c < -1)
+         {
+            for (p = offd_i[row_local]; p < offd_i[row_local + 1]; p++)
+            {
+               if (offd_j[p] == -c - 2)
+               {
+                  pos[ii * npe + b] = nnz_diag + p;
+                  break;
+               }
+            }
+         }
+         if (pos[ii * npe + b] < 0)
+         {
+            not_found++;
+         }
+      }
+   }
+   hypre_TFree(local_col, HYPRE_MEMORY_HOST);
+
+   if (not_found)
+   {
+      hypre_TFree(pos, HYPRE_MEMORY_HOST);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   off_rows = hypre_TAlloc(HYPRE_Int, num_off_rows, HYPRE_MEMORY_HOST);
+   k = 0;
+   for (ii = 0; ii < num_rows; ii++)
+   {
+      if (element_nodes[ii] < row_0 || element_nodes[ii] > row_n)
+      {
+         off_rows[k++] = ii;
+      }
+   }
+
+   map = hypre_CTAlloc(hypre_IJElementMap, 1, HYPRE_MEMORY_HOST);
+   hypre_IJElementMapNumElements(map)     = num_elements;
+   hypre_IJElementMapNodesPerElement(map) = npe;
+   hypre_IJElementMapElementNodes(map)    = hypre_TAlloc(HYPRE_BigInt, num_rows,
+                                                         HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_IJElementMapElementNodes(map), element_nodes, HYPRE_BigInt, num_rows,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_IJElementMapValueMap(map)        = hypre_IJValueMapCreate(nnz_diag, nnz_offd,
+                                                                   num_values, pos, 0, NULL);
+   hypre_IJElementMapNumOffRows(map)      = num_off_rows;
+   hypre_IJElementMapOffRows(map)         = off_rows;
+
+   hypre_IJElementMapNext(map)      = hypre_IJMatrixElementMap(matrix);
+   hypre_IJMatrixElementMap(matrix) = map;
+   last = map;
+   for (k = 1; k < HYPRE_IJ_ELEMENT_MAPS_PER_MATRIX && hypre_IJElementMapNext(last); k++)
+   {
+      last = hypre_IJElementMapNext(last);
+   }
+   hypre_IJElementMapListDestroy(hypre_IJElementMapNext(last));
+   hypre_IJElementMapNext(last) = NULL;
+
+   *map_ptr = map;
+
+   hypre_TFree(pos, HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAddElementMatricesParCSR
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAddElementMatricesParCSR( hypre_IJMatrix      *matrix,
+                                        HYPRE_Int            num_elements,
+                                        HYPRE_Int            nodes_per_element,
+                                        const HYPRE_BigInt  *element_nodes,
+                                        const HYPRE_Complex *element_matrices )
+{
+   HYPRE_Int            npe      = nodes_per_element;
+   HYPRE_Int            num_rows = num_elements * npe;
+   hypre_IJElementMap  *map      = NULL;
+   hypre_IJElementMap  *prev     = NULL;
+   HYPRE_Int            zero     = 0;
+   HYPRE_Int           *ncols;
+   HYPRE_Int           *row_indexes;
+   HYPRE_BigInt        *cols;
+   HYPRE_Int            ii, k;
+
+   if (hypre_IJMatrixAssembleFlag(matrix))
+   {
+      /* map of this connectivity, if any, is moved to the front of the list */
+      for (map = hypre_IJMatrixElementMap(matrix); map; map = hypre_IJElementMapNext(map))
+      {
+         if (hypre_IJElementMapNumElements(map) == num_elements &&
+             hypre_IJElementMapNodesPerElement(map) == npe &&
+             !memcmp(hypre_IJElementMapElementNodes(map), element_nodes,
+                     num_rows * sizeof(HYPRE_BigInt)))
+         {
+            break;
+         }
+         prev = map;
+      }
+
+      if (map && prev)
+      {
+         hypre_IJElementMapNext(prev)     = hypre_IJElementMapNext(map);
+         hypre_IJElementMapNext(map)      = hypre_IJMatrixElementMap(matrix);
+         hypre_IJMatrixElementMap(matrix) = map;
+      }
+      else if (!map)
+      {
+         hypre_IJMatrixElementMapCreateParCSR(matrix, num_elements, npe, element_nodes, &map);
+      }
+   }
+
+   if (map)
+   {
+      hypre_ParCSRMatrix *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+      HYPRE_Int          *off_rows   = hypre_IJElementMapOffRows(map);
+
+      hypre_IJValueMapScatterParCSR(hypre_IJElementMapValueMap(map), par_matrix,
+                                    element_matrices, NULL, "add");
+
+      /* rows owned by other processors go to the stash */
+      for (k = 0; k < hypre_IJElementMapNumOffRows(map); k++)
+      {
+         ii = off_rows[k];
+         hypre_IJMatrixAddToValuesParCSR(matrix, 1, &npe, &element_nodes[ii], &zero,
+                                         &element_nodes[(ii / npe) * npe],
+                                         &element_matrices[ii * npe]);
+      }
+
+      return hypre_error_flag;
+   }
+
+   /* not assembled yet, or entries outside the pattern: one AddToValues
+      call for the whole batch */
+   ncols       = hypre_TAlloc(HYPRE_Int,    num_rows,       HYPRE_MEMORY_HOST);
+   row_indexes = hypre_TAlloc(HYPRE_Int,    num_rows,       HYPRE_MEMORY_HOST);
+   cols        = hypre_TAlloc(HYPRE_BigInt, num_rows * npe, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ii, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < num_rows; ii++)
+   {
+      ncols[ii]       = npe;
+      row_indexes[ii] = ii * npe;
+      for (k = 0; k < npe; k++)
+      {
+         cols[ii * npe + k] = element_nodes[(ii / npe) * npe + k];
+      }
+   }
+
+   if (hypre_IJMatrixOMPFlag(matrix))
+   {
+      hypre_IJMatrixAddToValuesOMPParCSR(matrix, num_rows, ncols, element_nodes, row_indexes,
+                                         cols, element_matrices);
+   }
+   else
+   {
+      hypre_IJMatrixAddToValuesParCSR(matrix, num_rows, ncols, element_nodes, row_indexes,
+                                      cols, element_matrices);
+   }
+
+   hypre_TFree(ncols,       HYPRE_MEMORY_HOST);
+   hypre_TFree(row_indexes, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols,        HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
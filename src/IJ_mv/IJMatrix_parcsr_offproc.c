@@ -0,0 +1,424 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Reusable off processor assembly pattern for IJMatrix_ParCSR (host)
+ *
+ * hypre_IJMatrixAssembleOffProcValsParCSR finds the owners of stashed rows via
+ * the assumed partition and ships (row, col, value) triples.  If requested
+ * with HYPRE_IJMatrixSetReuseOffProc, the assemble that does so records
+ *  - the send side: owner processors and, per sent value, its stash index,
+ *  - the receive side: source processors and, per received value, its slot
+ *    in the diag or offd data of the assembled ParCSR matrix.
+ * A later assemble that stashes the same (row, col) sequence on all
+ * processors only packs the values, sends them with persistent requests and
+ * adds them into the recorded slots.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixOffProcPlanCreate
+ *
+ * Starts recording a plan for the given stash.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixOffProcPlanCreate( hypre_IJMatrix *matrix,
+                                 HYPRE_Int       off_proc_i_indx,
+                                 HYPRE_Int       num_elmts,
+                                 HYPRE_BigInt   *off_proc_i,
+                                 HYPRE_BigInt   *off_proc_j )
+{
+   hypre_IJOffProcPlan  *plan;
+   hypre_ParCSRCommPkg  *comm_pkg;
+
+   hypre_IJMatrixOffProcPlanDestroy(matrix);
+
+   plan     = hypre_CTAlloc(hypre_IJOffProcPlan, 1, HYPRE_MEMORY_HOST);
+   comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRCommPkgComm(comm_pkg)          = hypre_IJMatrixComm(matrix);
+   hypre_ParCSRCommPkgNumSends(comm_pkg)      = 0;
+   hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = hypre_CTAlloc(HYPRE_Int, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgNumRecvs(comm_pkg)      = 0;
+   hypre_ParCSRCommPkgRecvVecStarts(comm_pkg) = hypre_CTAlloc(HYPRE_Int, 1, HYPRE_MEMORY_HOST);
+
+   hypre_IJOffProcPlanCommPkg(plan)      = comm_pkg;
+   hypre_IJOffProcPlanSetup(plan)        = 0;
+   hypre_IJOffProcPlanOffProcIIndx(plan) = off_proc_i_indx;
+   hypre_IJOffProcPlanNumElmts(plan)     = num_elmts;
+   hypre_IJOffProcPlanOffProcI(plan)     = hypre_TAlloc(HYPRE_BigInt, off_proc_i_indx,
+                                                        HYPRE_MEMORY_HOST);
+   hypre_IJOffProcPlanOffProcJ(plan)     = hypre_TAlloc(HYPRE_BigInt, num_elmts,
+                                                        HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_IJOffProcPlanOffProcI(plan), off_proc_i, HYPRE_BigInt, off_proc_i_indx,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_IJOffProcPlanOffProcJ(plan), off_proc_j, HYPRE_BigInt, num_elmts,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   hypre_IJMatrixOffProcPlan(matrix) = plan;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJOffProcPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJOffProcPlanDestroy( hypre_IJOffProcPlan *plan )
+{
+   if (plan)
+   {
+      hypre_MatvecCommPkgDestroy(hypre_IJOffProcPlanCommPkg(plan));
+      hypre_TFree(hypre_IJOffProcPlanOffProcI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJOffProcPlanOffProcJ(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJOffProcPlanRecvI(plan),    HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJOffProcPlanRecvJ(plan),    HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJOffProcPlanRecvSlots(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixOffProcPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixOffProcPlanDestroy( hypre_IJMatrix *matrix )
+{
+   hypre_IJOffProcPlanDestroy(hypre_IJMatrixOffProcPlan(matrix));
+   hypre_IJMatrixOffProcPlan(matrix) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixOffProcPlanSetSends
+ *
+ * Records the send side: send_procs (sorted) are the owners of the stashed
+ * rows, row_procs[i] is the owner of the i-th (row, no. of elmts) pair of
+ * off_proc_i.  Values are sent to each owner in stash order.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixOffProcPlanSetSends( hypre_IJMatrix *matrix,
+                                   HYPRE_Int       num_sends,
+                                   HYPRE_Int      *send_procs,
+                                   HYPRE_Int       num_rows,
+                                   HYPRE_Int      *row_procs,
+                                   HYPRE_BigInt   *off_proc_i )
+{
+   hypre_IJOffProcPlan  *plan     = hypre_IJMatrixOffProcPlan(matrix);
+   hypre_ParCSRCommPkg  *comm_pkg = hypre_IJOffProcPlanCommPkg(plan);
+   HYPRE_Int            *send_map_starts;
+   HYPRE_Int            *send_map_elmts;
+   HYPRE_Int            *row_indx;
+   HYPRE_Int             i, j, k, n, counter;
+
+   row_indx        = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   send_map_starts = hypre_CTAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_rows; i++)
+   {
+      row_indx[i] = hypre_BinarySearch(send_procs, row_procs[i], num_sends);
+      send_map_starts[row_indx[i] + 1] += (HYPRE_Int) off_proc_i[2 * i + 1];
+   }
+   for (k = 0; k < num_sends; k++)
+   {
+      send_map_starts[k + 1] += send_map_starts[k];
+   }
+
+   send_map_elmts = hypre_TAlloc(HYPRE_Int, send_map_starts[num_sends], HYPRE_MEMORY_HOST);
+
+   counter = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      n = (HYPRE_Int) off_proc_i[2 * i + 1];
+      k = row_indx[i];
+      for (j = 0; j < n; j++)
+      {
+         send_map_elmts[send_map_starts[k]++] = counter++;
+      }
+   }
+   for (k = num_sends; k > 0; k--)
+   {
+      send_map_starts[k] = send_map_starts[k - 1];
+   }
+   send_map_starts[0] = 0;
+
+   hypre_TFree(hypre_ParCSRCommPkgSendMapStarts(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgNumSends(comm_pkg)      = num_sends;
+   hypre_ParCSRCommPkgSendProcs(comm_pkg)     = hypre_TAlloc(HYPRE_Int, num_sends,
+                                                             HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = send_map_starts;
+   hypre_ParCSRCommPkgSendMapElmts(comm_pkg)  = send_map_elmts;
+   hypre_TMemcpy(hypre_ParCSRCommPkgSendProcs(comm_pkg), send_procs, HYPRE_Int, num_sends,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   hypre_TFree(row_indx, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixOffProcPlanAddRecvs
+ *
+ * Records num_elmts values of row received from processor proc.  Must be
+ * called in the order the values are added, with proc non-decreasing.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixOffProcPlanAddRecvs( hypre_IJMatrix *matrix,
+                                   HYPRE_Int       proc,
+                                   HYPRE_BigInt    row,
+                                   HYPRE_Int       num_elmts,
+                                   HYPRE_BigInt   *cols )
+{
+   hypre_IJOffProcPlan  *plan      = hypre_IJMatrixOffProcPlan(matrix);
+   hypre_ParCSRCommPkg  *comm_pkg  = hypre_IJOffProcPlanCommPkg(plan);
+   HYPRE_Int             num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int            *recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+   HYPRE_Int             size = recv_vec_starts[num_recvs];
+   HYPRE_Int             max_size = hypre_IJOffProcPlanMaxRecvElmts(plan);
+   HYPRE_Int             j;
+
+   if (!num_recvs || hypre_ParCSRCommPkgRecvProc(comm_pkg, num_recvs - 1) != proc)
+   {
+      hypre_ParCSRCommPkgRecvProcs(comm_pkg) =
+         hypre_TReAlloc(hypre_ParCSRCommPkgRecvProcs(comm_pkg), HYPRE_Int, num_recvs + 1,
+                        HYPRE_MEMORY_HOST);
+      recv_vec_starts = hypre_TReAlloc(recv_vec_starts, HYPRE_Int, num_recvs + 2,
+                                       HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgRecvProc(comm_pkg, num_recvs) = proc;
+      recv_vec_starts[num_recvs + 1] = size;
+      num_recvs++;
+
+      hypre_ParCSRCommPkgNumRecvs(comm_pkg)      = num_recvs;
+      hypre_ParCSRCommPkgRecvVecStarts(comm_pkg) = recv_vec_starts;
+   }
+
+   if (size + num_elmts > max_size)
+   {
+      max_size = hypre_max(size + num_elmts, 2 * max_size);
+      hypre_IJOffProcPlanRecvI(plan) = hypre_TReAlloc(hypre_IJOffProcPlanRecvI(plan),
+                                                      HYPRE_BigInt, max_size, HYPRE_MEMORY_HOST);
+      hypre_IJOffProcPlanRecvJ(plan) = hypre_TReAlloc(hypre_IJOffProcPlanRecvJ(plan),
+                                                      HYPRE_BigInt, max_size, HYPRE_MEMORY_HOST);
+      hypre_IJOffProcPlanMaxRecvElmts(plan) = max_size;
+   }
+
+   for (j = 0; j < num_elmts; j++)
+   {
+      hypre_IJOffProcPlanRecvI(plan)[size + j] = row;
+      hypre_IJOffProcPlanRecvJ(plan)[size + j] = cols[j];
+   }
+   recv_vec_starts[num_recvs] = size + num_elmts;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixOffProcPlanSetupParCSR
+ *
+ * Completes a recorded plan once the ParCSR matrix is assembled: finds the
+ * slot of every received (row, col).  Collective; if any processor fails to
+ * find a slot, the plan is dropped everywhere.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixOffProcPlanSetupParCSR( hypre_IJMatrix *matrix )
+{
+   MPI_Comm              comm       = hypre_IJMatrixComm(matrix);
+   hypre_IJOffProcPlan  *plan       = hypre_IJMatrixOffProcPlan(matrix);
+   hypre_ParCSRCommPkg  *comm_pkg   = hypre_IJOffProcPlanCommPkg(plan);
+   hypre_ParCSRMatrix   *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix      *diag       = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix      *offd       = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int            *diag_i     = hypre_CSRMatrixI(diag);
+   HYPRE_Int            *diag_j     = hypre_CSRMatrixJ(diag);
+   HYPRE_Int            *offd_i     = hypre_CSRMatrixI(offd);
+   HYPRE_Int            *offd_j     = hypre_CSRMatrixJ(offd);
+   HYPRE_Int             num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_BigInt         *col_map_offd  = hypre_ParCSRMatrixColMapOffd(par_matrix);
+   HYPRE_BigInt          row_0 = hypre_IJMatrixRowPartitioning(matrix)[0];
+   HYPRE_BigInt          col_0 = hypre_IJMatrixColPartitioning(matrix)[0];
+   HYPRE_BigInt          col_n = hypre_IJMatrixColPartitioning(matrix)[1] - 1;
+   HYPRE_BigInt          first = hypre_IJMatrixGlobalFirstCol(matrix);
+
+   HYPRE_Int             num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int             num_elmts = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
+   HYPRE_BigInt         *recv_i    = hypre_IJOffProcPlanRecvI(plan);
+   HYPRE_BigInt         *recv_j    = hypre_IJOffProcPlanRecvJ(plan);
+   HYPRE_Int            *recv_slots;
+   HYPRE_Int             found, found_global;
+   HYPRE_Int             k;
+
+   recv_slots = hypre_TAlloc(HYPRE_Int, num_elmts, HYPRE_MEMORY_HOST);
+
+   found = 1;
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(k) reduction(min:found) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < num_elmts; k++)
+   {
+      HYPRE_Int     row = (HYPRE_Int)(recv_i[k] - row_0);
+      HYPRE_BigInt  col = recv_j[k];
+      HYPRE_Int     j, j_offd, hit = 0;
+
+      if (col < col_0 || col > col_n)
+      {
+         j_offd = hypre_BigBinarySearch(col_map_offd, col - first, num_cols_offd);
+         for (j = offd_i[row]; j < offd_i[row + 1] && j_offd >= 0; j++)
+         {
+            if (offd_j[j] == j_offd)
+            {
+               recv_slots[k] = -j - 1;
+               hit = 1;
+               break;
+            }
+         }
+      }
+      else
+      {
+         for (j = diag_i[row]; j < diag_i[row + 1]; j++)
+         {
+            if (diag_j[j] == (HYPRE_Int)(col - col_0))
+            {
+               recv_slots[k] = j;
+               hit = 1;
+               break;
+            }
+         }
+      }
+      if (!hit)
+      {
+         recv_slots[k] = 0;
+         found = 0;
+      }
+   }
+
+   hypre_TFree(hypre_IJOffProcPlanRecvI(plan), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_IJOffProcPlanRecvJ(plan), HYPRE_MEMORY_HOST);
+   hypre_IJOffProcPlanMaxRecvElmts(plan) = 0;
+   hypre_IJOffProcPlanRecvSlots(plan)    = recv_slots;
+   hypre_IJOffProcPlanSetup(plan)        = 1;
+
+   hypre_MPI_Allreduce(&found, &found_global, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+   if (!found_global)
+   {
+      hypre_IJMatrixOffProcPlanDestroy(matrix);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixOffProcPlanMatch
+ *
+ * Collective check whether the current stash has the (row, col) sequence the
+ * plan was recorded for on all processors.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixOffProcPlanMatch( hypre_IJMatrix *matrix,
+                                HYPRE_Int       off_proc_i_indx,
+                                HYPRE_Int       num_elmts,
+                                HYPRE_BigInt   *off_proc_i,
+                                HYPRE_BigInt   *off_proc_j,
+                                HYPRE_Int      *match_ptr )
+{
+   hypre_IJOffProcPlan  *plan = hypre_IJMatrixOffProcPlan(matrix);
+   HYPRE_Int             match = 0;
+
+   if (plan && hypre_IJOffProcPlanSetup(plan) &&
+       hypre_IJOffProcPlanOffProcIIndx(plan) == off_proc_i_indx &&
+       hypre_IJOffProcPlanNumElmts(plan) == num_elmts)
+   {
+      match = (off_proc_i_indx == 0 ||
+               !memcmp(hypre_IJOffProcPlanOffProcI(plan), off_proc_i,
+                       off_proc_i_indx * sizeof(HYPRE_BigInt))) &&
+              (num_elmts == 0 ||
+               !memcmp(hypre_IJOffProcPlanOffProcJ(plan), off_proc_j,
+                       num_elmts * sizeof(HYPRE_BigInt)));
+   }
+
+   hypre_MPI_Allreduce(&match, match_ptr, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_IJMatrixComm(matrix));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssembleOffProcValsPlanParCSR
+ *
+ * Sends the stashed values along the plan and adds the received ones into
+ * the assembled ParCSR matrix.  Values are added in the same order as by
+ * hypre_IJMatrixAssembleOffProcValsParCSR.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAssembleOffProcValsPlanParCSR( hypre_IJMatrix *matrix,
+                                             HYPRE_Complex  *off_proc_data )
+{
+   hypre_IJOffProcPlan  *plan       = hypre_IJMatrixOffProcPlan(matrix);
+   hypre_ParCSRCommPkg  *comm_pkg   = hypre_IJOffProcPlanCommPkg(plan);
+   hypre_ParCSRMatrix   *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   HYPRE_Complex        *diag_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(par_matrix));
+   HYPRE_Complex        *offd_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(par_matrix));
+   HYPRE_Int            *recv_slots = hypre_IJOffProcPlanRecvSlots(plan);
+   HYPRE_Int             num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int             num_recvs  = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int             send_size  = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   HYPRE_Int             recv_size  = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
+   HYPRE_Int            *send_map_elmts = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
+
+   hypre_ParCSRPersistentCommHandle *comm_handle;
+   HYPRE_Complex        *send_buf;
+   HYPRE_Complex        *recv_buf;
+   HYPRE_Int             k;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+   send_buf    = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(comm_handle);
+   recv_buf    = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(comm_handle);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < send_size; k++)
+   {
+      send_buf[k] = off_proc_data[send_map_elmts[k]];
+   }
+
+   hypre_ParCSRPersistentCommHandleStart(comm_handle, HYPRE_MEMORY_HOST, send_buf);
+   hypre_ParCSRPersistentCommHandleWait(comm_handle, HYPRE_MEMORY_HOST, recv_buf);
+
+   /* sequential: several values may go to the same slot */
+   for (k = 0; k < recv_size; k++)
+   {
+      if (recv_slots[k] >= 0)
+      {
+         diag_data[recv_slots[k]] += recv_buf[k];
+      }
+      else
+      {
+         offd_data[-recv_slots[k] - 1] += recv_buf[k];
+      }
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
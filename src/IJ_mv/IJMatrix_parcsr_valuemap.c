@@ -0,0 +1,467 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * In-place value updates of an assembled IJMatrix_ParCSR (host)
+ *
+ * HYPRE_IJMatrixBuildValueMap registers a (row, col) insertion sequence once:
+ * each local entry of the sequence gets its slot in the diag or offd data,
+ * off processor entries are shipped once along the assumed partition to
+ * record a hypre_IJOffProcPlan.  The sources are then gathered by
+ * destination, so that HYPRE_IJMatrixSetValuesByMap only exchanges the off
+ * processor values and writes every slot once, without searches, allocation
+ * or atomics.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_IJValueMapCreate
+ *
+ * Gathers the sources by destination: pos[k] is the slot of value k, with
+ * diag and offd data numbered consecutively, or -1 if value k is not set
+ * locally; recv_slots[k] (>= 0: diag, < 0: offd at -slot-1) is the slot of
+ * received value k.  Local values come first in sequence order, then
+ * received values in receive order.
+ *--------------------------------------------------------------------------*/
+
+hypre_IJValueMap *
+hypre_IJValueMapCreate( HYPRE_Int   nnz_diag,
+                        HYPRE_Int   nnz_offd,
+                        HYPRE_Int   num_values,
+                        HYPRE_Int  *pos,
+                        HYPRE_Int   recv_size,
+                        HYPRE_Int  *recv_slots )
+{
+   hypre_IJValueMap  *map;
+   HYPRE_Int          num_slots, num_srcs;
+   HYPRE_Int         *count;
+   HYPRE_Int         *slots, *src_starts, *src_elmts;
+   HYPRE_Int          i, k, c;
+
+   count = hypre_CTAlloc(HYPRE_Int, nnz_diag + nnz_offd, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_values; k++)
+   {
+      if (pos[k] >= 0)
+      {
+         count[pos[k]]++;
+      }
+   }
+   for (k = 0; k < recv_size; k++)
+   {
+      c = recv_slots[k] >= 0 ? recv_slots[k] : nnz_diag - recv_slots[k] - 1;
+      count[c]++;
+   }
+
+   num_slots = 0;
+   for (c = 0; c < nnz_diag + nnz_offd; c++)
+   {
+      num_slots += (count[c] > 0);
+   }
+
+   slots      = hypre_TAlloc(HYPRE_Int, num_slots,     HYPRE_MEMORY_HOST);
+   src_starts = hypre_TAlloc(HYPRE_Int, num_slots + 1, HYPRE_MEMORY_HOST);
+
+   i = 0;
+   num_srcs = 0;
+   for (c = 0; c < nnz_diag + nnz_offd; c++)
+   {
+      if (count[c])
+      {
+         slots[i]      = c < nnz_diag ? c : nnz_diag - c - 1;
+         src_starts[i] = num_srcs;
+         num_srcs     += count[c];
+         count[c]      = src_starts[i++];
+      }
+   }
+   src_starts[num_slots] = num_srcs;
+
+   src_elmts = hypre_TAlloc(HYPRE_Int, num_srcs, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_values; k++)
+   {
+      if (pos[k] >= 0)
+      {
+         src_elmts[count[pos[k]]++] = k;
+      }
+   }
+   for (k = 0; k < recv_size; k++)
+   {
+      c = recv_slots[k] >= 0 ? recv_slots[k] : nnz_diag - recv_slots[k] - 1;
+      src_elmts[count[c]++] = -k - 1;
+   }
+
+   hypre_TFree(count, HYPRE_MEMORY_HOST);
+
+   map = hypre_CTAlloc(hypre_IJValueMap, 1, HYPRE_MEMORY_HOST);
+   hypre_IJValueMapNumValues(map)   = num_values;
+   hypre_IJValueMapNumSlots(map)    = num_slots;
+   hypre_IJValueMapSlots(map)       = slots;
+   hypre_IJValueMapSrcStarts(map)   = src_starts;
+   hypre_IJValueMapSrcElmts(map)    = src_elmts;
+   hypre_IJValueMapOffProcPlan(map) = NULL;
+
+   return map;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJValueMapDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJValueMapDestroy( hypre_IJValueMap *map )
+{
+   if (map)
+   {
+      hypre_IJOffProcPlanDestroy(hypre_IJValueMapOffProcPlan(map));
+      hypre_TFree(hypre_IJValueMapSlots(map),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJValueMapSrcStarts(map), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJValueMapSrcElmts(map),  HYPRE_MEMORY_HOST);
+      hypre_TFree(map, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJValueMapScatterParCSR
+ *
+ * Sets ("set") or adds to ("add") every slot of the map the sum of its
+ * sources.  Each slot is written by exactly one iteration.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJValueMapScatterParCSR( hypre_IJValueMap    *map,
+                               hypre_ParCSRMatrix  *par_matrix,
+                               const HYPRE_Complex *values,
+                               const HYPRE_Complex *recv_buf,
+                               const char          *action )
+{
+   HYPRE_Complex  *diag_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(par_matrix));
+   HYPRE_Complex  *offd_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(par_matrix));
+   HYPRE_Int       num_slots  = hypre_IJValueMapNumSlots(map);
+   HYPRE_Int      *slots      = hypre_IJValueMapSlots(map);
+   HYPRE_Int      *src_starts = hypre_IJValueMapSrcStarts(map);
+   HYPRE_Int      *src_elmts  = hypre_IJValueMapSrcElmts(map);
+   HYPRE_Int       add        = (action[0] == 'a');
+   HYPRE_Int       i;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_slots; i++)
+   {
+      HYPRE_Complex  *data = slots[i] >= 0 ? &diag_data[slots[i]] : &offd_data[-slots[i] - 1];
+      HYPRE_Complex   sum  = add ? *data : 0.0;
+      HYPRE_Int       j, src;
+
+      for (j = src_starts[i]; j < src_starts[i + 1]; j++)
+      {
+         src  = src_elmts[j];
+         sum += src >= 0 ? values[src] : recv_buf[-src - 1];
+      }
+      *data = sum;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixValueMapDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixValueMapDestroy( hypre_IJMatrix *matrix )
+{
+   hypre_IJValueMapDestroy(hypre_IJMatrixValueMap(matrix));
+   hypre_IJMatrixValueMap(matrix) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixBuildValueMapParCSR
+ *
+ * Collective.  The matrix must be assembled and contain every (row, col) of
+ * the sequence; the values of the matrix are not changed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixBuildValueMapParCSR( hypre_IJMatrix      *matrix,
+                                   HYPRE_Int            nrows,
+                                   HYPRE_Int           *ncols,
+                                   const HYPRE_BigInt  *rows,
+                                   const HYPRE_Int     *row_indexes,
+                                   const HYPRE_BigInt  *cols )
+{
+   MPI_Comm              comm       = hypre_IJMatrixComm(matrix);
+   hypre_ParCSRMatrix   *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix      *diag       = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix      *offd       = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int            *diag_i     = hypre_CSRMatrixI(diag);
+   HYPRE_Int            *diag_j     = hypre_CSRMatrixJ(diag);
+   HYPRE_Int            *offd_i     = hypre_CSRMatrixI(offd);
+   HYPRE_Int            *offd_j     = hypre_CSRMatrixJ(offd);
+   HYPRE_Int             nnz_diag   = hypre_CSRMatrixNumNonzeros(diag);
+   HYPRE_Int             nnz_offd   = hypre_CSRMatrixNumNonzeros(offd);
+   HYPRE_Int             num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_BigInt         *col_map_offd  = hypre_ParCSRMatrixColMapOffd(par_matrix);
+   HYPRE_BigInt          row_0 = hypre_IJMatrixRowPartitioning(matrix)[0];
+   HYPRE_BigInt          row_n = hypre_IJMatrixRowPartitioning(matrix)[1] - 1;
+   HYPRE_BigInt          col_0 = hypre_IJMatrixColPartitioning(matrix)[0];
+   HYPRE_BigInt          col_n = hypre_IJMatrixColPartitioning(matrix)[1] - 1;
+   HYPRE_BigInt          first = hypre_IJMatrixGlobalFirstCol(matrix);
+
+   hypre_IJValueMap     *map;
+   hypre_IJOffProcPlan  *plan = NULL;
+   hypre_IJOffProcPlan  *saved_plan;
+   hypre_ParCSRCommPkg  *comm_pkg;
+   HYPRE_Int             num_values;
+   HYPRE_Int            *pos;
+   HYPRE_Int             num_off_rows, num_off_elmts;
+   HYPRE_BigInt         *off_proc_i, *off_proc_j;
+   HYPRE_Int            *off_src;
+   HYPRE_Complex        *off_proc_data;
+   HYPRE_Int            *send_map_elmts = NULL;
+   HYPRE_Int            *recv_slots = NULL;
+   HYPRE_Int             send_size = 0, recv_size = 0;
+   HYPRE_Int             not_found;
+   HYPRE_Int             flags[2], flags_global[2];
+   HYPRE_Int             ii, i, j, k, n;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_IJMatrixValueMapDestroy(matrix);
+
+   num_values = 0;
+   for (ii = 0; ii < nrows; ii++)
+   {
+      num_values = hypre_max(num_values, row_indexes[ii] + ncols[ii]);
+   }
+
+   /* pos[k]: slot of value k, diag and offd numbered consecutively;
+      -1 for off processor values and values not referenced */
+   pos = hypre_TAlloc(HYPRE_Int, num_values, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < num_values; k++)
+   {
+      pos[k] = -1;
+   }
+
+   num_off_rows  = 0;
+   num_off_elmts = 0;
+   not_found     = 0;
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ii) reduction(+:num_off_rows,num_off_elmts,not_found) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < nrows; ii++)
+   {
+      HYPRE_BigInt  row = rows[ii];
+      HYPRE_Int     indx = row_indexes[ii];
+      HYPRE_Int     row_local, jj, j_offd, p;
+
+      if (row < row_0 || row > row_n)
+      {
+         num_off_rows++;
+         num_off_elmts += ncols[ii];
+         continue;
+      }
+
+      row_local = (HYPRE_Int)(row - row_0);
+      for (jj = 0; jj < ncols[ii]; jj++)
+      {
+         HYPRE_BigInt col = cols[indx + jj];
+
+         if (col < col_0 || col > col_n)
+         {
+            j_offd = hypre_BigBinarySearch(col_map_offd, col - first, num_cols_offd);
+            for (p = offd_i[row_local]; p < offd_i[row_local + 1] && j_offd >= 0; p++)
+            {
+               if (offd_j[p] == j_offd)
+               {
+                  pos[indx + jj] = nnz_diag + p;
+                  break;
+               }
+            }
+         }
+         else
+         {
+            for (p = diag_i[row_local]; p < diag_i[row_local + 1]; p++)
+            {
+               if (diag_j[p] == (HYPRE_Int)(col - col_0))
+               {
+                  pos[indx + jj] = p;
+                  break;
+               }
+            }
+         }
+         if (pos[indx + jj] < 0)
+         {
+            not_found++;
+         }
+      }
+   }
+
+   flags[0] = (not_found > 0);
+   flags[1] = (num_off_elmts > 0);
+   hypre_MPI_Allreduce(flags, flags_global, 2, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (flags_global[0])
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Value map entry not in the pattern of the assembled matrix!");
+      hypre_TFree(pos, HYPRE_MEMORY_HOST);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   /* Ship the off processor entries once with zero values to record a plan;
+      the plan of the matrix itself, if any, is left untouched */
+   if (flags_global[1])
+   {
+      off_proc_i    = hypre_TAlloc(HYPRE_BigInt,  2 * num_off_rows, HYPRE_MEMORY_HOST);
+      off_proc_j    = hypre_TAlloc(HYPRE_BigInt,  num_off_elmts,    HYPRE_MEMORY_HOST);
+      off_src       = hypre_TAlloc(HYPRE_Int,     num_off_elmts,    HYPRE_MEMORY_HOST);
+      off_proc_data = hypre_CTAlloc(HYPRE_Complex, num_off_elmts,   HYPRE_MEMORY_HOST);
+
+      i = 0;
+      k = 0;
+      for (ii = 0; ii < nrows; ii++)
+      {
+         if (rows[ii] < row_0 || rows[ii] > row_n)
+         {
+            n = ncols[ii];
+            off_proc_i[i++] = rows[ii];
+            off_proc_i[i++] = (HYPRE_BigInt) n;
+            for (j = 0; j < n; j++)
+            {
+               off_proc_j[k] = cols[row_indexes[ii] + j];
+               off_src[k++]  = row_indexes[ii] + j;
+            }
+         }
+      }
+
+      saved_plan = hypre_IJMatrixOffProcPlan(matrix);
+      hypre_IJMatrixOffProcPlan(matrix) = NULL;
+
+      hypre_IJMatrixOffProcPlanCreate(matrix, 2 * num_off_rows, num_off_elmts,
+                                      off_proc_i, off_proc_j);
+      hypre_IJMatrixAssembleOffProcValsParCSR(matrix, 2 * num_off_rows, num_off_elmts,
+                                              num_off_elmts, HYPRE_MEMORY_HOST,
+                                              off_proc_i, off_proc_j, off_proc_data);
+      hypre_IJMatrixOffProcPlanSetupParCSR(matrix);
+
+      plan = hypre_IJMatrixOffProcPlan(matrix);
+      hypre_IJMatrixOffProcPlan(matrix) = saved_plan;
+
+      hypre_TFree(off_proc_i,    HYPRE_MEMORY_HOST);
+      hypre_TFree(off_proc_j,    HYPRE_MEMORY_HOST);
+      hypre_TFree(off_proc_data, HYPRE_MEMORY_HOST);
+
+      if (!plan)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Value map entry not in the pattern of the assembled matrix!");
+         hypre_TFree(off_src, HYPRE_MEMORY_HOST);
+         hypre_TFree(pos, HYPRE_MEMORY_HOST);
+         HYPRE_ANNOTATE_FUNC_END;
+
+         return hypre_error_flag;
+      }
+
+      /* the stash pattern is only needed to match assembles */
+      hypre_TFree(hypre_IJOffProcPlanOffProcI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJOffProcPlanOffProcJ(plan), HYPRE_MEMORY_HOST);
+
+      /* send straight from the value array */
+      comm_pkg       = hypre_IJOffProcPlanCommPkg(plan);
+      send_size      = hypre_ParCSRCommPkgSendMapStart(comm_pkg,
+                                                       hypre_ParCSRCommPkgNumSends(comm_pkg));
+      recv_size      = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,
+                                                       hypre_ParCSRCommPkgNumRecvs(comm_pkg));
+      send_map_elmts = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
+      recv_slots     = hypre_IJOffProcPlanRecvSlots(plan);
+      for (k = 0; k < send_size; k++)
+      {
+         send_map_elmts[k] = off_src[send_map_elmts[k]];
+      }
+
+      hypre_TFree(off_src, HYPRE_MEMORY_HOST);
+   }
+
+   map = hypre_IJValueMapCreate(nnz_diag, nnz_offd, num_values, pos, recv_size, recv_slots);
+   hypre_IJValueMapOffProcPlan(map) = plan;
+   hypre_TFree(pos, HYPRE_MEMORY_HOST);
+
+   hypre_IJMatrixValueMap(matrix) = map;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixSetValuesByMapParCSR
+ *
+ * Every entry of the registered sequence is set to the sum of its values;
+ * entries not in the sequence keep their values.  Collective if any
+ * processor registered off processor entries.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixSetValuesByMapParCSR( hypre_IJMatrix      *matrix,
+                                    const HYPRE_Complex *values )
+{
+   hypre_IJValueMap     *map        = hypre_IJMatrixValueMap(matrix);
+   hypre_IJOffProcPlan  *plan       = hypre_IJValueMapOffProcPlan(map);
+   hypre_ParCSRMatrix   *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   HYPRE_Complex        *recv_buf   = NULL;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   if (plan)
+   {
+      hypre_ParCSRCommPkg              *comm_pkg  = hypre_IJOffProcPlanCommPkg(plan);
+      HYPRE_Int                         num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      HYPRE_Int                         send_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg,
+                                                                                    num_sends);
+      HYPRE_Int                        *send_map_elmts = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
+      hypre_ParCSRPersistentCommHandle *comm_handle;
+      HYPRE_Complex                    *send_buf;
+      HYPRE_Int                         k;
+
+      comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+      send_buf    = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(comm_handle);
+      recv_buf    = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(comm_handle);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+      for (k = 0; k < send_size; k++)
+      {
+         send_buf[k] = values[send_map_elmts[k]];
+      }
+
+      hypre_ParCSRPersistentCommHandleStart(comm_handle, HYPRE_MEMORY_HOST, send_buf);
+      hypre_ParCSRPersistentCommHandleWait(comm_handle, HYPRE_MEMORY_HOST, recv_buf);
+   }
+
+   hypre_IJValueMapScatterParCSR(map, par_matrix, values, recv_buf, "set");
+
+   /* Values have changed: drop the SELL-C-sigma copies used by host SpMV */
+   hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixDiag(par_matrix));
+   hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixOffd(par_matrix));
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
@@ -14,6 +14,104 @@
 #ifndef hypre_IJ_MATRIX_HEADER
 #define hypre_IJ_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_IJOffProcPlan:
+ *
+ * Off processor assembly pattern recorded by one assemble and reused by later
+ * assembles that stash the same (row, col) sequence: the send side of
+ * comm_pkg maps each sent value to its index in the stash, the receive side
+ * delivers values that are added to recv_slots.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRCommPkg  *comm_pkg;
+   HYPRE_Int             setup;             /* 1 once recv_slots are computed */
+
+   HYPRE_Int             off_proc_i_indx;   /* stash pattern of the recording */
+   HYPRE_Int             num_elmts;
+   HYPRE_BigInt         *off_proc_i;
+   HYPRE_BigInt         *off_proc_j;
+
+   HYPRE_Int             max_recv_elmts;    /* received (row, col) while recording */
+   HYPRE_BigInt         *recv_i;
+   HYPRE_BigInt         *recv_j;
+   HYPRE_Int            *recv_slots;        /* >= 0: diag data, < 0: offd data at -slot-1 */
+
+} hypre_IJOffProcPlan;
+
+#define hypre_IJOffProcPlanCommPkg(plan)        ((plan) -> comm_pkg)
+#define hypre_IJOffProcPlanSetup(plan)          ((plan) -> setup)
+#define hypre_IJOffProcPlanOffProcIIndx(plan)   ((plan) -> off_proc_i_indx)
+#define hypre_IJOffProcPlanNumElmts(plan)       ((plan) -> num_elmts)
+#define hypre_IJOffProcPlanOffProcI(plan)       ((plan) -> off_proc_i)
+#define hypre_IJOffProcPlanOffProcJ(plan)       ((plan) -> off_proc_j)
+#define hypre_IJOffProcPlanMaxRecvElmts(plan)   ((plan) -> max_recv_elmts)
+#define hypre_IJOffProcPlanRecvI(plan)          ((plan) -> recv_i)
+#define hypre_IJOffProcPlanRecvJ(plan)          ((plan) -> recv_j)
+#define hypre_IJOffProcPlanRecvSlots(plan)      ((plan) -> recv_slots)
+
+/*--------------------------------------------------------------------------
+ * hypre_IJValueMap:
+ *
+ * Registered (row, col) sequence of an assembled matrix, gathered by
+ * destination: the k-th distinct entry set, slots[k], is the sum of the
+ * sources src_elmts[src_starts[k] .. src_starts[k+1]-1].  Off processor
+ * entries of the sequence are exchanged along off_proc_plan, whose send side
+ * maps directly into the value array.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             num_values;        /* length of the registered sequence */
+   HYPRE_Int             num_slots;         /* distinct local entries */
+   HYPRE_Int            *slots;             /* >= 0: diag data, < 0: offd data at -slot-1 */
+   HYPRE_Int            *src_starts;
+   HYPRE_Int            *src_elmts;         /* >= 0: values, < 0: received value -src-1 */
+   hypre_IJOffProcPlan  *off_proc_plan;     /* NULL if no processor has off processor entries */
+
+} hypre_IJValueMap;
+
+#define hypre_IJValueMapNumValues(map)          ((map) -> num_values)
+#define hypre_IJValueMapNumSlots(map)           ((map) -> num_slots)
+#define hypre_IJValueMapSlots(map)              ((map) -> slots)
+#define hypre_IJValueMapSrcStarts(map)          ((map) -> src_starts)
+#define hypre_IJValueMapSrcElmts(map)           ((map) -> src_elmts)
+#define hypre_IJValueMapOffProcPlan(map)        ((map) -> off_proc_plan)
+
+/*--------------------------------------------------------------------------
+ * hypre_IJElementMap:
+ *
+ * Slots of the element matrices added to an assembled matrix by
+ * HYPRE_IJMatrixAddElementMatrices for one connectivity.  Element rows
+ * owned by other processors go to the stash.  A matrix keeps the maps of
+ * up to HYPRE_IJ_ELEMENT_MAPS_PER_MATRIX connectivities in a list, most
+ * recently used first, so that batches of different connectivities (e.g.
+ * several element types) each reuse their own map.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_IJ_ELEMENT_MAPS_PER_MATRIX 4
+
+typedef struct hypre_IJElementMap_struct
+{
+   HYPRE_Int             num_elements;
+   HYPRE_Int             nodes_per_element;
+   HYPRE_BigInt         *element_nodes;     /* connectivity the map was built for */
+   hypre_IJValueMap     *value_map;         /* values indexed as the element matrices */
+   HYPRE_Int             num_off_rows;
+   HYPRE_Int            *off_rows;          /* element rows owned by other processors */
+   struct hypre_IJElementMap_struct *next;  /* map of the next connectivity */
+
+} hypre_IJElementMap;
+
+#define hypre_IJElementMapNumElements(map)      ((map) -> num_elements)
+#define hypre_IJElementMapNodesPerElement(map)  ((map) -> nodes_per_element)
+#define hypre_IJElementMapElementNodes(map)     ((map) -> element_nodes)
+#define hypre_IJElementMapValueMap(map)         ((map) -> value_map)
+#define hypre_IJElementMapNumOffRows(map)       ((map) -> num_off_rows)
+#define hypre_IJElementMapOffRows(map)          ((map) -> off_rows)
+#define hypre_IJElementMapNext(map)             ((map) -> next)
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrix:
  *--------------------------------------------------------------------------*/
@@ -38,6 +136,12 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_BigInt  global_num_rows;     /* global partition */
    HYPRE_BigInt  global_num_cols;
    HYPRE_Int     omp_flag;
+   HYPRE_Int     assembly_mode;       /* 0: row-wise aux arrays,
+                                         1: per-thread COO streams */
+   HYPRE_Int     reuse_off_proc;      /* keep off_proc_plan between assembles */
+   hypre_IJOffProcPlan *off_proc_plan;
+   hypre_IJValueMap    *value_map;    /* set by HYPRE_IJMatrixBuildValueMap */
+   hypre_IJElementMap  *element_map;  /* list set by HYPRE_IJMatrixAddElementMatrices */
    HYPRE_Int     print_level;
 
 } hypre_IJMatrix;
@@ -62,6 +166,11 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumRows(matrix)    ((matrix) -> global_num_rows)
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
+#define hypre_IJMatrixAssemblyMode(matrix)     ((matrix) -> assembly_mode)
+#define hypre_IJMatrixReuseOffProc(matrix)     ((matrix) -> reuse_off_proc)
+#define hypre_IJMatrixOffProcPlan(matrix)      ((matrix) -> off_proc_plan)
+#define hypre_IJMatrixValueMap(matrix)         ((matrix) -> value_map)
+#define hypre_IJMatrixElementMap(matrix)       ((matrix) -> element_map)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
 
 static inline HYPRE_MemoryLocation
@@ -78,6 +78,16 @@ typedef struct
                                                   * (-global col id. -1) if AddToValues */
    HYPRE_Complex       *off_proc_data;           /* contains corresponding data */
 
+   HYPRE_Int            num_streams;             /* if > 0, SetValues and AddToValues append
+                                                    to a per-thread COO stream instead of
+                                                    aux_j, aux_data (host assembly mode 1) */
+   HYPRE_Int           *stream_size;             /* stream_size[t] no. of elements in stream t */
+   HYPRE_Int           *stream_space;            /* stream_space[t] space allocated to stream t */
+   HYPRE_BigInt       **stream_i;                /* global row indices of stream t */
+   HYPRE_BigInt       **stream_j;                /* global column indices of stream t */
+   HYPRE_Complex      **stream_data;             /* corresponding data */
+   char               **stream_sora;             /* Set (1) or Add (0) */
+
    HYPRE_MemoryLocation memory_location;
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -122,6 +132,14 @@ typedef struct
 #define hypre_AuxParCSRMatrixOffProcJ(matrix)             ((matrix) -> off_proc_j)
 #define hypre_AuxParCSRMatrixOffProcData(matrix)          ((matrix) -> off_proc_data)
 
+#define hypre_AuxParCSRMatrixNumStreams(matrix)           ((matrix) -> num_streams)
+#define hypre_AuxParCSRMatrixStreamSize(matrix)           ((matrix) -> stream_size)
+#define hypre_AuxParCSRMatrixStreamSpace(matrix)          ((matrix) -> stream_space)
+#define hypre_AuxParCSRMatrixStreamI(matrix)              ((matrix) -> stream_i)
+#define hypre_AuxParCSRMatrixStreamJ(matrix)              ((matrix) -> stream_j)
+#define hypre_AuxParCSRMatrixStreamData(matrix)           ((matrix) -> stream_data)
+#define hypre_AuxParCSRMatrixStreamSorA(matrix)           ((matrix) -> stream_sora)
+
 #define hypre_AuxParCSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -223,6 +241,104 @@ typedef struct
 #ifndef hypre_IJ_MATRIX_HEADER
 #define hypre_IJ_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_IJOffProcPlan:
+ *
+ * Off processor assembly pattern recorded by one assemble and reused by later
+ * assembles that stash the same (row, col) sequence: the send side of
+ * comm_pkg maps each sent value to its index in the stash, the receive side
+ * delivers values that are added to recv_slots.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRCommPkg  *comm_pkg;
+   HYPRE_Int             setup;             /* 1 once recv_slots are computed */
+
+   HYPRE_Int             off_proc_i_indx;   /* stash pattern of the recording */
+   HYPRE_Int             num_elmts;
+   HYPRE_BigInt         *off_proc_i;
+   HYPRE_BigInt         *off_proc_j;
+
+   HYPRE_Int             max_recv_elmts;    /* received (row, col) while recording */
+   HYPRE_BigInt         *recv_i;
+   HYPRE_BigInt         *recv_j;
+   HYPRE_Int            *recv_slots;        /* >= 0: diag data, < 0: offd data at -slot-1 */
+
+} hypre_IJOffProcPlan;
+
+#define hypre_IJOffProcPlanCommPkg(plan)        ((plan) -> comm_pkg)
+#define hypre_IJOffProcPlanSetup(plan)          ((plan) -> setup)
+#define hypre_IJOffProcPlanOffProcIIndx(plan)   ((plan) -> off_proc_i_indx)
+#define hypre_IJOffProcPlanNumElmts(plan)       ((plan) -> num_elmts)
+#define hypre_IJOffProcPlanOffProcI(plan)       ((plan) -> off_proc_i)
+#define hypre_IJOffProcPlanOffProcJ(plan)       ((plan) -> off_proc_j)
+#define hypre_IJOffProcPlanMaxRecvElmts(plan)   ((plan) -> max_recv_elmts)
+#define hypre_IJOffProcPlanRecvI(plan)          ((plan) -> recv_i)
+#define hypre_IJOffProcPlanRecvJ(plan)          ((plan) -> recv_j)
+#define hypre_IJOffProcPlanRecvSlots(plan)      ((plan) -> recv_slots)
+
+/*--------------------------------------------------------------------------
+ * hypre_IJValueMap:
+ *
+ * Registered (row, col) sequence of an assembled matrix, gathered by
+ * destination: the k-th distinct entry set, slots[k], is the sum of the
+ * sources src_elmts[src_starts[k] .. src_starts[k+1]-1].  Off processor
+ * entries of the sequence are exchanged along off_proc_plan, whose send side
+ * maps directly into the value array.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             num_values;        /* length of the registered sequence */
+   HYPRE_Int             num_slots;         /* distinct local entries */
+   HYPRE_Int            *slots;             /* >= 0: diag data, < 0: offd data at -slot-1 */
+   HYPRE_Int            *src_starts;
+   HYPRE_Int            *src_elmts;         /* >= 0: values, < 0: received value -src-1 */
+   hypre_IJOffProcPlan  *off_proc_plan;     /* NULL if no processor has off processor entries */
+
+} hypre_IJValueMap;
+
+#define hypre_IJValueMapNumValues(map)          ((map) -> num_values)
+#define hypre_IJValueMapNumSlots(map)           ((map) -> num_slots)
+#define hypre_IJValueMapSlots(map)              ((map) -> slots)
+#define hypre_IJValueMapSrcStarts(map)          ((map) -> src_starts)
+#define hypre_IJValueMapSrcElmts(map)           ((map) -> src_elmts)
+#define hypre_IJValueMapOffProcPlan(map)        ((map) -> off_proc_plan)
+
+/*--------------------------------------------------------------------------
+ * hypre_IJElementMap:
+ *
+ * Slots of the element matrices added to an assembled matrix by
+ * HYPRE_IJMatrixAddElementMatrices for one connectivity.  Element rows
+ * owned by other processors go to the stash.  A matrix keeps the maps of
+ * up to HYPRE_IJ_ELEMENT_MAPS_PER_MATRIX connectivities in a list, most
+ * recently used first, so that batches of different connectivities (e.g.
+ * several element types) each reuse their own map.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_IJ_ELEMENT_MAPS_PER_MATRIX 4
+
+typedef struct hypre_IJElementMap_struct
+{
+   HYPRE_Int             num_elements;
+   HYPRE_Int             nodes_per_element;
+   HYPRE_BigInt         *element_nodes;     /* connectivity the map was built for */
+   hypre_IJValueMap     *value_map;         /* values indexed as the element matrices */
+   HYPRE_Int             num_off_rows;
+   HYPRE_Int            *off_rows;          /* element rows owned by other processors */
+   struct hypre_IJElementMap_struct *next;  /* map of the next connectivity */
+
+} hypre_IJElementMap;
+
+#define hypre_IJElementMapNumElements(map)      ((map) -> num_elements)
+#define hypre_IJElementMapNodesPerElement(map)  ((map) -> nodes_per_element)
+#define hypre_IJElementMapElementNodes(map)     ((map) -> element_nodes)
+#define hypre_IJElementMapValueMap(map)         ((map) -> value_map)
+#define hypre_IJElementMapNumOffRows(map)       ((map) -> num_off_rows)
+#define hypre_IJElementMapOffRows(map)          ((map) -> off_rows)
+#define hypre_IJElementMapNext(map)             ((map) -> next)
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrix:
  *--------------------------------------------------------------------------*/
@@ -247,6 +363,12 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_BigInt  global_num_rows;     /* global partition */
    HYPRE_BigInt  global_num_cols;
    HYPRE_Int     omp_flag;
+   HYPRE_Int     assembly_mode;       /* 0: row-wise aux arrays,
+                                         1: per-thread COO streams */
+   HYPRE_Int     reuse_off_proc;      /* keep off_proc_plan between assembles */
+   hypre_IJOffProcPlan *off_proc_plan;
+   hypre_IJValueMap    *value_map;    /* set by HYPRE_IJMatrixBuildValueMap */
+   hypre_IJElementMap  *element_map;  /* list set by HYPRE_IJMatrixAddElementMatrices */
    HYPRE_Int     print_level;
 
 } hypre_IJMatrix;
@@ -271,6 +393,11 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumRows(matrix)    ((matrix) -> global_num_rows)
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
+#define hypre_IJMatrixAssemblyMode(matrix)     ((matrix) -> assembly_mode)
+#define hypre_IJMatrixReuseOffProc(matrix)     ((matrix) -> reuse_off_proc)
+#define hypre_IJMatrixOffProcPlan(matrix)      ((matrix) -> off_proc_plan)
+#define hypre_IJMatrixValueMap(matrix)         ((matrix) -> value_map)
+#define hypre_IJMatrixElementMap(matrix)       ((matrix) -> element_map)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
 
 static inline HYPRE_MemoryLocation
@@ -500,6 +627,50 @@ HYPRE_Int hypre_IJMatrixApplyPETSc ( hypre_IJMatrix *matrix, hypre_ParVector *x,
 HYPRE_Int hypre_IJMatrixDestroyPETSc ( hypre_IJMatrix *matrix );
 HYPRE_Int hypre_IJMatrixSetTotalSizePETSc ( hypre_IJMatrix *matrix, HYPRE_Int size );
 
+/* IJMatrix_parcsr_coo.c */
+HYPRE_Int hypre_IJMatrixSetAddValuesParCSRCOO ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                                HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes, const HYPRE_BigInt *cols,
+                                                const HYPRE_Complex *values, const char *action );
+HYPRE_Int hypre_IJMatrixStashOffProcValsParCSRCOO ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixAssembleParCSRCOO ( hypre_IJMatrix *matrix );
+
+/* IJMatrix_parcsr_offproc.c */
+HYPRE_Int hypre_IJMatrixOffProcPlanCreate ( hypre_IJMatrix *matrix, HYPRE_Int off_proc_i_indx,
+                                            HYPRE_Int num_elmts, HYPRE_BigInt *off_proc_i, HYPRE_BigInt *off_proc_j );
+HYPRE_Int hypre_IJOffProcPlanDestroy ( hypre_IJOffProcPlan *plan );
+HYPRE_Int hypre_IJMatrixOffProcPlanDestroy ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixOffProcPlanSetSends ( hypre_IJMatrix *matrix, HYPRE_Int num_sends,
+                                              HYPRE_Int *send_procs, HYPRE_Int num_rows, HYPRE_Int *row_procs, HYPRE_BigInt *off_proc_i );
+HYPRE_Int hypre_IJMatrixOffProcPlanAddRecvs ( hypre_IJMatrix *matrix, HYPRE_Int proc,
+                                              HYPRE_BigInt row, HYPRE_Int num_elmts, HYPRE_BigInt *cols );
+HYPRE_Int hypre_IJMatrixOffProcPlanSetupParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixOffProcPlanMatch ( hypre_IJMatrix *matrix, HYPRE_Int off_proc_i_indx,
+                                           HYPRE_Int num_elmts, HYPRE_BigInt *off_proc_i, HYPRE_BigInt *off_proc_j, HYPRE_Int *match_ptr );
+HYPRE_Int hypre_IJMatrixAssembleOffProcValsPlanParCSR ( hypre_IJMatrix *matrix,
+                                                        HYPRE_Complex *off_proc_data );
+
+/* IJMatrix_parcsr_element.c */
+HYPRE_Int hypre_IJMatrixElementMapDestroy ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixElementMapCreateParCSR ( hypre_IJMatrix *matrix, HYPRE_Int num_elements,
+                                                 HYPRE_Int nodes_per_element, const HYPRE_BigInt *element_nodes,
+                                                 hypre_IJElementMap **map_ptr );
+HYPRE_Int hypre_IJMatrixAddElementMatricesParCSR ( hypre_IJMatrix *matrix, HYPRE_Int num_elements,
+                                                   HYPRE_Int nodes_per_element, const HYPRE_BigInt *element_nodes,
+                                                   const HYPRE_Complex *element_matrices );
+
+/* IJMatrix_parcsr_valuemap.c */
+hypre_IJValueMap *hypre_IJValueMapCreate ( HYPRE_Int nnz_diag, HYPRE_Int nnz_offd,
+                                           HYPRE_Int num_values, HYPRE_Int *pos, HYPRE_Int recv_size, HYPRE_Int *recv_slots );
+HYPRE_Int hypre_IJValueMapDestroy ( hypre_IJValueMap *map );
+HYPRE_Int hypre_IJValueMapScatterParCSR ( hypre_IJValueMap *map, hypre_ParCSRMatrix *par_matrix,
+                                          const HYPRE_Complex *values, const HYPRE_Complex *recv_buf, const char *action );
+HYPRE_Int hypre_IJMatrixValueMapDestroy ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixBuildValueMapParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                              HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes,
+                                              const HYPRE_BigInt *cols );
+HYPRE_Int hypre_IJMatrixSetValuesByMapParCSR ( hypre_IJMatrix *matrix,
+                                               const HYPRE_Complex *values );
+
 /* IJVector.c */
 HYPRE_Int hypre_IJVectorDistribute ( HYPRE_IJVector vector, const HYPRE_Int *vec_starts );
 HYPRE_Int hypre_IJVectorZeroValues ( HYPRE_IJVector vector );
@@ -560,6 +731,14 @@ HYPRE_Int HYPRE_IJMatrixReadMM( const char *filename, MPI_Comm comm, HYPRE_Int t
                                 HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixPrint ( HYPRE_IJMatrix matrix, const char *filename );
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag ( HYPRE_IJMatrix matrix, HYPRE_Int omp_flag );
+HYPRE_Int HYPRE_IJMatrixSetAssemblyMode ( HYPRE_IJMatrix matrix, HYPRE_Int mode );
+HYPRE_Int HYPRE_IJMatrixSetReuseOffProc ( HYPRE_IJMatrix matrix, HYPRE_Int reuse );
+HYPRE_Int HYPRE_IJMatrixBuildValueMap ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
+                                        const HYPRE_BigInt *rows, const HYPRE_BigInt *cols );
+HYPRE_Int HYPRE_IJMatrixSetValuesByMap ( HYPRE_IJMatrix matrix, const HYPRE_Complex *values );
+HYPRE_Int HYPRE_IJMatrixAddElementMatrices ( HYPRE_IJMatrix matrix, HYPRE_Int num_elements,
+                                             HYPRE_Int nodes_per_element, const HYPRE_BigInt *element_nodes,
+                                             const HYPRE_Complex *element_matrices );
 HYPRE_Int HYPRE_IJMatrixTranspose ( HYPRE_IJMatrix  matrix_A, HYPRE_IJMatrix *matrix_AT );
 HYPRE_Int HYPRE_IJMatrixNorm ( HYPRE_IJMatrix matrix, HYPRE_Real *norm );
 HYPRE_Int HYPRE_IJMatrixAdd ( HYPRE_Complex alpha, HYPRE_IJMatrix matrix_A, HYPRE_Complex beta,
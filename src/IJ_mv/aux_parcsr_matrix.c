@@ -51,6 +51,14 @@ hypre_AuxParCSRMatrixCreate( hypre_AuxParCSRMatrix **aux_matrix,
    hypre_AuxParCSRMatrixOffProcI(matrix) = NULL;
    hypre_AuxParCSRMatrixOffProcJ(matrix) = NULL;
    hypre_AuxParCSRMatrixOffProcData(matrix) = NULL;
+   /* per-thread COO streams */
+   hypre_AuxParCSRMatrixNumStreams(matrix) = 0;
+   hypre_AuxParCSRMatrixStreamSize(matrix) = NULL;
+   hypre_AuxParCSRMatrixStreamSpace(matrix) = NULL;
+   hypre_AuxParCSRMatrixStreamI(matrix) = NULL;
+   hypre_AuxParCSRMatrixStreamJ(matrix) = NULL;
+   hypre_AuxParCSRMatrixStreamData(matrix) = NULL;
+   hypre_AuxParCSRMatrixStreamSorA(matrix) = NULL;
    hypre_AuxParCSRMatrixMemoryLocation(matrix) = HYPRE_MEMORY_HOST;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    hypre_AuxParCSRMatrixMaxStackElmts(matrix) = 0;
@@ -142,6 +150,23 @@ hypre_AuxParCSRMatrixDestroy( hypre_AuxParCSRMatrix *matrix )
       hypre_TFree(hypre_AuxParCSRMatrixOffProcJ(matrix),    HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_AuxParCSRMatrixOffProcData(matrix), HYPRE_MEMORY_HOST);
 
+      if (hypre_AuxParCSRMatrixStreamI(matrix))
+      {
+         for (i = 0; i < hypre_AuxParCSRMatrixNumStreams(matrix); i++)
+         {
+            hypre_TFree(hypre_AuxParCSRMatrixStreamI(matrix)[i],    HYPRE_MEMORY_HOST);
+            hypre_TFree(hypre_AuxParCSRMatrixStreamJ(matrix)[i],    HYPRE_MEMORY_HOST);
+            hypre_TFree(hypre_AuxParCSRMatrixStreamData(matrix)[i], HYPRE_MEMORY_HOST);
+            hypre_TFree(hypre_AuxParCSRMatrixStreamSorA(matrix)[i], HYPRE_MEMORY_HOST);
+         }
+      }
+      hypre_TFree(hypre_AuxParCSRMatrixStreamSize(matrix),  HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixStreamSpace(matrix), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixStreamI(matrix),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixStreamJ(matrix),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixStreamData(matrix),  HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixStreamSorA(matrix),  HYPRE_MEMORY_HOST);
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
       hypre_TFree(hypre_AuxParCSRMatrixStackI(matrix),    hypre_AuxParCSRMatrixMemoryLocation(matrix));
       hypre_TFree(hypre_AuxParCSRMatrixStackJ(matrix),    hypre_AuxParCSRMatrixMemoryLocation(matrix));
@@ -286,7 +311,44 @@ hypre_AuxParCSRMatrixInitialize_v2( hypre_AuxParCSRMatrix *matrix,
                                                                   HYPRE_MEMORY_HOST);
       }
 
-      if (hypre_AuxParCSRMatrixNeedAux(matrix))
+      if (hypre_AuxParCSRMatrixNumStreams(matrix) > 0)
+      {
+         /* COO streams: only the stream headers are allocated here, the streams
+            themselves are allocated by the threads that fill them */
+         HYPRE_Int   num_streams  = hypre_AuxParCSRMatrixNumStreams(matrix);
+         HYPRE_Int  *row_space    = hypre_AuxParCSRMatrixRowSpace(matrix);
+         HYPRE_Int  *diag_sizes   = hypre_AuxParCSRMatrixDiagSizes(matrix);
+         HYPRE_Int  *offd_sizes   = hypre_AuxParCSRMatrixOffdSizes(matrix);
+         HYPRE_Int  *stream_space = hypre_CTAlloc(HYPRE_Int, num_streams, HYPRE_MEMORY_HOST);
+         HYPRE_Int   i, space;
+
+         /* initial space per stream from the user given row sizes, if any */
+         space = 0;
+         for (i = 0; i < local_num_rows; i++)
+         {
+            space += row_space ? row_space[i] : 0;
+            space += diag_sizes ? diag_sizes[i] : 0;
+            space += offd_sizes ? offd_sizes[i] : 0;
+         }
+         space = hypre_max(space, local_num_rows) / num_streams + 1;
+         for (i = 0; i < num_streams; i++)
+         {
+            stream_space[i] = space;
+         }
+
+         hypre_AuxParCSRMatrixStreamSize(matrix)  = hypre_CTAlloc(HYPRE_Int, num_streams,
+                                                                  HYPRE_MEMORY_HOST);
+         hypre_AuxParCSRMatrixStreamSpace(matrix) = stream_space;
+         hypre_AuxParCSRMatrixStreamI(matrix)     = hypre_CTAlloc(HYPRE_BigInt *, num_streams,
+                                                                  HYPRE_MEMORY_HOST);
+         hypre_AuxParCSRMatrixStreamJ(matrix)     = hypre_CTAlloc(HYPRE_BigInt *, num_streams,
+                                                                  HYPRE_MEMORY_HOST);
+         hypre_AuxParCSRMatrixStreamData(matrix)  = hypre_CTAlloc(HYPRE_Complex *, num_streams,
+                                                                  HYPRE_MEMORY_HOST);
+         hypre_AuxParCSRMatrixStreamSorA(matrix)  = hypre_CTAlloc(char *, num_streams,
+                                                                  HYPRE_MEMORY_HOST);
+      }
+      else if (hypre_AuxParCSRMatrixNeedAux(matrix))
       {
          HYPRE_Int      *row_space = hypre_AuxParCSRMatrixRowSpace(matrix);
          HYPRE_Int      *rownnz    = hypre_AuxParCSRMatrixRownnz(matrix);
@@ -63,6 +63,16 @@ typedef struct
                                                   * (-global col id. -1) if AddToValues */
    HYPRE_Complex       *off_proc_data;           /* contains corresponding data */
 
+   HYPRE_Int            num_streams;             /* if > 0, SetValues and AddToValues append
+                                                    to a per-thread COO stream instead of
+                                                    aux_j, aux_data (host assembly mode 1) */
+   HYPRE_Int           *stream_size;             /* stream_size[t] no. of elements in stream t */
+   HYPRE_Int           *stream_space;            /* stream_space[t] space allocated to stream t */
+   HYPRE_BigInt       **stream_i;                /* global row indices of stream t */
+   HYPRE_BigInt       **stream_j;                /* global column indices of stream t */
+   HYPRE_Complex      **stream_data;             /* corresponding data */
+   char               **stream_sora;             /* Set (1) or Add (0) */
+
    HYPRE_MemoryLocation memory_location;
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -107,6 +117,14 @@ typedef struct
 #define hypre_AuxParCSRMatrixOffProcJ(matrix)             ((matrix) -> off_proc_j)
 #define hypre_AuxParCSRMatrixOffProcData(matrix)          ((matrix) -> off_proc_data)
 
+#define hypre_AuxParCSRMatrixNumStreams(matrix)           ((matrix) -> num_streams)
+#define hypre_AuxParCSRMatrixStreamSize(matrix)           ((matrix) -> stream_size)
+#define hypre_AuxParCSRMatrixStreamSpace(matrix)          ((matrix) -> stream_space)
+#define hypre_AuxParCSRMatrixStreamI(matrix)              ((matrix) -> stream_i)
+#define hypre_AuxParCSRMatrixStreamJ(matrix)              ((matrix) -> stream_j)
+#define hypre_AuxParCSRMatrixStreamData(matrix)           ((matrix) -> stream_data)
+#define hypre_AuxParCSRMatrixStreamSorA(matrix)           ((matrix) -> stream_sora)
+
 #define hypre_AuxParCSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
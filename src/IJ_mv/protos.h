@@ -130,6 +130,50 @@ HYPRE_Int hypre_IJMatrixApplyPETSc ( hypre_IJMatrix *matrix, hypre_ParVector *x,
 HYPRE_Int hypre_IJMatrixDestroyPETSc ( hypre_IJMatrix *matrix );
 HYPRE_Int hypre_IJMatrixSetTotalSizePETSc ( hypre_IJMatrix *matrix, HYPRE_Int size );
 
+/* IJMatrix_parcsr_coo.c */
+HYPRE_Int hypre_IJMatrixSetAddValuesParCSRCOO ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                                HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes, const HYPRE_BigInt *cols,
+                                                const HYPRE_Complex *values, const char *action );
+HYPRE_Int hypre_IJMatrixStashOffProcValsParCSRCOO ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixAssembleParCSRCOO ( hypre_IJMatrix *matrix );
+
+/* IJMatrix_parcsr_offproc.c */
+HYPRE_Int hypre_IJMatrixOffProcPlanCreate ( hypre_IJMatrix *matrix, HYPRE_Int off_proc_i_indx,
+                                            HYPRE_Int num_elmts, HYPRE_BigInt *off_proc_i, HYPRE_BigInt *off_proc_j );
+HYPRE_Int hypre_IJOffProcPlanDestroy ( hypre_IJOffProcPlan *plan );
+HYPRE_Int hypre_IJMatrixOffProcPlanDestroy ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixOffProcPlanSetSends ( hypre_IJMatrix *matrix, HYPRE_Int num_sends,
+                                              HYPRE_Int *send_procs, HYPRE_Int num_rows, HYPRE_Int *row_procs, HYPRE_BigInt *off_proc_i );
+HYPRE_Int hypre_IJMatrixOffProcPlanAddRecvs ( hypre_IJMatrix *matrix, HYPRE_Int proc,
+                                              HYPRE_BigInt row, HYPRE_Int num_elmts, HYPRE_BigInt *cols );
+HYPRE_Int hypre_IJMatrixOffProcPlanSetupParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixOffProcPlanMatch ( hypre_IJMatrix *matrix, HYPRE_Int off_proc_i_indx,
+                                           HYPRE_Int num_elmts, HYPRE_BigInt *off_proc_i, HYPRE_BigInt *off_proc_j, HYPRE_Int *match_ptr );
+HYPRE_Int hypre_IJMatrixAssembleOffProcValsPlanParCSR ( hypre_IJMatrix *matrix,
+                                                        HYPRE_Complex *off_proc_data );
+
+/* IJMatrix_parcsr_element.c */
+HYPRE_Int hypre_IJMatrixElementMapDestroy ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixElementMapCreateParCSR ( hypre_IJMatrix *matrix, HYPRE_Int num_elements,
+                                                 HYPRE_Int nodes_per_element, const HYPRE_BigInt *element_nodes,
+                                                 hypre_IJElementMap **map_ptr );
+HYPRE_Int hypre_IJMatrixAddElementMatricesParCSR ( hypre_IJMatrix *matrix, HYPRE_Int num_elements,
+                                                   HYPRE_Int nodes_per_element, const HYPRE_BigInt *element_nodes,
+                                                   const HYPRE_Complex *element_matrices );
+
+/* IJMatrix_parcsr_valuemap.c */
+hypre_IJValueMap *hypre_IJValueMapCreate ( HYPRE_Int nnz_diag, HYPRE_Int nnz_offd,
+                                           HYPRE_Int num_values, HYPRE_Int *pos, HYPRE_Int recv_size, HYPRE_Int *recv_slots );
+HYPRE_Int hypre_IJValueMapDestroy ( hypre_IJValueMap *map );
+HYPRE_Int hypre_IJValueMapScatterParCSR ( hypre_IJValueMap *map, hypre_ParCSRMatrix *par_matrix,
+                                          const HYPRE_Complex *values, const HYPRE_Complex *recv_buf, const char *action );
+HYPRE_Int hypre_IJMatrixValueMapDestroy ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixBuildValueMapParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                              HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes,
+                                              const HYPRE_BigInt *cols );
+HYPRE_Int hypre_IJMatrixSetValuesByMapParCSR ( hypre_IJMatrix *matrix,
+                                               const HYPRE_Complex *values );
+
 /* IJVector.c */
 HYPRE_Int hypre_IJVectorDistribute ( HYPRE_IJVector vector, const HYPRE_Int *vec_starts );
 HYPRE_Int hypre_IJVectorZeroValues ( HYPRE_IJVector vector );
@@ -190,6 +234,14 @@ HYPRE_Int HYPRE_IJMatrixReadMM( const char *filename, MPI_Comm comm, HYPRE_Int t
                                 HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixPrint ( HYPRE_IJMatrix matrix, const char *filename );
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag ( HYPRE_IJMatrix matrix, HYPRE_Int omp_flag );
+HYPRE_Int HYPRE_IJMatrixSetAssemblyMode ( HYPRE_IJMatrix matrix, HYPRE_Int mode );
+HYPRE_Int HYPRE_IJMatrixSetReuseOffProc ( HYPRE_IJMatrix matrix, HYPRE_Int reuse );
+HYPRE_Int HYPRE_IJMatrixBuildValueMap ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
+                                        const HYPRE_BigInt *rows, const HYPRE_BigInt *cols );
+HYPRE_Int HYPRE_IJMatrixSetValuesByMap ( HYPRE_IJMatrix matrix, const HYPRE_Complex *values );
+HYPRE_Int HYPRE_IJMatrixAddElementMatrices ( HYPRE_IJMatrix matrix, HYPRE_Int num_elements,
+                                             HYPRE_Int nodes_per_element, const HYPRE_BigInt *element_nodes,
+                                             const HYPRE_Complex *element_matrices );
 HYPRE_Int HYPRE_IJMatrixTranspose ( HYPRE_IJMatrix  matrix_A, HYPRE_IJMatrix *matrix_AT );
 HYPRE_Int HYPRE_IJMatrixNorm ( HYPRE_IJMatrix matrix, HYPRE_Real *norm );
 HYPRE_Int HYPRE_IJMatrixAdd ( HYPRE_Complex alpha, HYPRE_IJMatrix matrix_A, HYPRE_Complex beta,
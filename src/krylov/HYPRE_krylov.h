@@ -896,6 +896,27 @@ HYPRE_Int HYPRE_COGMRESSetUnroll(HYPRE_Solver solver,
 HYPRE_Int HYPRE_COGMRESSetCGS(HYPRE_Solver solver,
                               HYPRE_Int    cgs);
 
+/**
+ * (Optional) Use the s-step (communication-avoiding) variant of COGMRES.
+ * Each block of s Krylov basis vectors is generated with s matrix-vector
+ * products and orthogonalized with a single global reduction (two if
+ * reorthogonalization is needed or requested via HYPRE_COGMRESSetCGS).
+ * The first restart cycle runs with s = 1 to estimate the spectral
+ * interval used by the polynomial basis. The relative change stopping
+ * criterion is not supported in this mode. Default: 1 (off).
+ **/
+HYPRE_Int HYPRE_COGMRESSetSStep(HYPRE_Solver solver,
+                                HYPRE_Int    s_step);
+
+/**
+ * (Optional) Set the polynomial basis of the s-step variant:
+ *
+ *    - 0 : Newton basis with Leja-ordered Chebyshev shifts (default)
+ *    - 1 : scaled and shifted Chebyshev basis
+ **/
+HYPRE_Int HYPRE_COGMRESSetSStepBasis(HYPRE_Solver solver,
+                                     HYPRE_Int    s_step_basis);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -977,6 +998,16 @@ HYPRE_Int HYPRE_COGMRESGetUnroll(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_COGMRESGetCGS(HYPRE_Solver  solver,
                               HYPRE_Int    *cgs);
 
+/**
+ **/
+HYPRE_Int HYPRE_COGMRESGetSStep(HYPRE_Solver  solver,
+                                HYPRE_Int    *s_step);
+
+/**
+ **/
+HYPRE_Int HYPRE_COGMRESGetSStepBasis(HYPRE_Solver  solver,
+                                     HYPRE_Int    *s_step_basis);
+
 /**
  **/
 HYPRE_Int HYPRE_COGMRESGetPrecond(HYPRE_Solver  solver,
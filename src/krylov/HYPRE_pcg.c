@@ -44,6 +44,11 @@ HYPRE_PCGSolve( HYPRE_Solver solver,
                 HYPRE_Vector b,
                 HYPRE_Vector x )
 {
+   if (hypre_PCGDataPipelined((hypre_PCGData *) solver))
+   {
+      return ( hypre_PipelinedPCGSolve( solver, A, b, x ) );
+   }
+
    return ( hypre_PCGSolve( solver, A, b, x ) );
 }
 
@@ -0,0 +1,892 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Block (multiple right-hand side) PCG and GMRES
+ *
+ *****************************************************************************/
+
+/* When b and x have several columns (NumVectors > 1), hypre_PCGSolve and
+   hypre_GMRESSolve hand over to the block methods below.  All columns share
+   one Krylov space, so every matvec and preconditioner application works on
+   the whole multivector, and the small dense matrices of inner products are
+   formed with a single global reduction each (MultiInnerProd).
+
+   Both methods orthonormalize blocks with SVQB (Stathopoulos and Wu, "A block
+   orthogonalization procedure with constant synchronization requirements",
+   SIAM J. Sci. Comput. 23, 2002): the Gram matrix of the (column-scaled)
+   block is diagonalized and directions belonging to tiny eigenvalues are
+   dropped.  This deflates linearly dependent right-hand sides and search
+   directions, which is what makes the block PCG the breakdown-free variant of
+   Ji and Li (BIT Numer. Math. 57, 2017).  Dropped directions are kept as zero
+   columns so that all multivectors keep their width.
+
+   The stopping tests are applied to each column separately and the solve
+   ends when all columns pass them.  Norms and relative norms that are logged
+   or returned are the largest over all columns.  The relative change, cf_tol
+   and atolf criteria are not supported by the block methods. */
+
+#include "krylov.h"
+#include "_hypre_utilities.h"
+#include "_hypre_lapack.h"
+
+/* directions whose eigenvalue in the scaled Gram matrix is below this
+   fraction of the largest one are dropped from a block */
+#define HYPRE_BLOCK_KRYLOV_RANK_TOL   1.0e-12
+/* the GMRES basis block is orthonormalized a second time when the smallest
+   kept eigenvalue is below this fraction of the largest one */
+#define HYPRE_BLOCK_KRYLOV_REORTH_TOL 1.0e-8
+
+/*--------------------------------------------------------------------------
+ * hypre_BlockKrylovOrthBasis
+ *
+ * Given the Gram matrix G = W^T W of an n-column block W (column-major,
+ * overwritten), computes T and F (n x n, column-major) such that V = W*T has
+ * orthonormal or zero columns and W = V*F up to the dropped directions. The
+ * columns of W are scaled to unit length before the eigen-decomposition, so
+ * directions are only dropped when W is numerically rank deficient, not when
+ * its columns differ in scale. The kept directions come first in V. work
+ * must hold n*n + 5*n reals. Returns the number of kept directions; ratio is
+ * set to the smallest kept over the largest eigenvalue.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BlockKrylovOrthBasis( HYPRE_Int   n,
+                            HYPRE_Real *G,
+                            HYPRE_Real *T,
+                            HYPRE_Real *F,
+                            HYPRE_Real *work,
+                            HYPRE_Real *ratio )
+{
+   HYPRE_Real  *d      = work;
+   HYPRE_Real  *lambda = work + n;
+   HYPRE_Real  *lwork  = work + 2 * n;
+   HYPRE_Int    lsize  = 3 * n + n * n;
+   HYPRE_Real   lambda_max, sq;
+   HYPRE_Int    rank = 0;
+   HYPRE_Int    i, j, c, e, info;
+
+   for (i = 0; i < n; i++)
+   {
+      d[i] = (G[i * n + i] > 0.0) ? 1.0 / sqrt(G[i * n + i]) : 0.0;
+   }
+   for (j = 0; j < n; j++)
+   {
+      for (i = 0; i < n; i++)
+      {
+         G[j * n + i] *= d[i] * d[j];
+      }
+   }
+
+   hypre_dsyev("V", "L", &n, G, &n, lambda, lwork, &lsize, &info);
+   if (info != 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Eigen-decomposition of a Gram matrix failed\n");
+      return 0;
+   }
+
+   /* eigenvalues are ascending; the kept directions go first in descending order */
+   lambda_max = lambda[n - 1];
+   *ratio = 1.0;
+   for (c = 0; c < n; c++)
+   {
+      e = n - 1 - c;
+      if (lambda_max > 0.0 && lambda[e] > HYPRE_BLOCK_KRYLOV_RANK_TOL * lambda_max)
+      {
+         sq = sqrt(lambda[e]);
+         for (i = 0; i < n; i++)
+         {
+            T[c * n + i] = d[i] * G[e * n + i] / sq;
+            F[i * n + c] = (d[i] > 0.0) ? sq * G[e * n + i] / d[i] : 0.0;
+         }
+         *ratio = lambda[e] / lambda_max;
+         rank++;
+      }
+      else
+      {
+         for (i = 0; i < n; i++)
+         {
+            T[c * n + i] = 0.0;
+            F[i * n + c] = 0.0;
+         }
+      }
+   }
+
+   return rank;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BlockKrylovNumConverged
+ *
+ * Counts the columns with norm2[j] / den[j] < eps[j] (columns with den[j] = 0
+ * count as converged) and returns the largest norm and relative norm.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BlockKrylovNumConverged( HYPRE_Int   nv,
+                               HYPRE_Real *norm2,
+                               HYPRE_Real *den,
+                               HYPRE_Real *eps,
+                               HYPRE_Real *max_norm,
+                               HYPRE_Real *max_rel_norm )
+{
+   HYPRE_Int  num_converged = 0;
+   HYPRE_Int  j;
+
+   *max_norm     = 0.0;
+   *max_rel_norm = 0.0;
+   for (j = 0; j < nv; j++)
+   {
+      *max_norm = hypre_max(*max_norm, sqrt(norm2[j]));
+      if (den[j] > 0.0)
+      {
+         *max_rel_norm = hypre_max(*max_rel_norm, sqrt(norm2[j] / den[j]));
+         if (norm2[j] / den[j] < eps[j]) { num_converged++; }
+      }
+      else
+      {
+         num_converged++;
+      }
+   }
+
+   return num_converged;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BlockPCGSolve
+ *--------------------------------------------------------------------------
+ *
+ * Breakdown-free block CG. With R = B - A*X, Z = C*R and P = orth(Z):
+ *
+ *       Q = A*P,  alpha = (P^T Q)^{-1} P^T R,  X = X + P*alpha,  R = R - Q*alpha
+ *       Z = C*R,  beta = -(P^T Q)^{-1} Q^T Z,  P = orth(Z + P*beta)
+ *
+ * where orth keeps only the numerically independent directions, so that
+ * P^T Q stays symmetric positive definite on them. Each iteration needs the
+ * reductions [Q R]^T P, [Q R]^T Z and the Gram matrix of Z + P*beta (plus
+ * the column norms of R with the 2-norm). The per-column stopping test is
+ * that of hypre_PCGSolve.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BlockPCGSolve( void *pcg_vdata,
+                     void *A,
+                     void *b,
+                     void *x )
+{
+   hypre_PCGData  *pcg_data     =  (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Real      r_tol        = (pcg_data -> tol);
+   HYPRE_Real      a_tol        = (pcg_data -> a_tol);
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       stop_crit    = (pcg_data -> stop_crit);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   void           *p            = (pcg_data -> p);
+   void           *s            = (pcg_data -> s);
+   void           *r            = (pcg_data -> r);
+   void           *q            = (pcg_data -> q);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*, void*, void*, void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+
+   HYPRE_Int       nv           = (*(pcg_functions->NumVectors))(b);
+   HYPRE_Real     *bi_prod, *i_prod, *eps;
+   HYPRE_Real     *dots, *gram, *delta, *sol, *T, *F, *work;
+   HYPRE_Complex  *coef;
+   HYPRE_Real      max_norm, max_rel_norm = 0.0, ratio;
+   HYPRE_Real      sum_prod = 0.0, ieee_check = 0.;
+   HYPRE_Int       num_converged = 0, rank;
+   HYPRE_Int       i = 0, j, c, info;
+   HYPRE_Int       my_id, num_procs;
+   char            uplo = 'L';
+   void           *qr[2];
+
+   if (q == NULL || (*(pcg_functions->NumVectors))(p) != nv ||
+       (*(pcg_functions->NumVectors))(x) != nv)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Block PCG requires hypre_PCGSetup with the same number of vectors\n");
+      return hypre_error_flag;
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (pcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A, &my_id, &num_procs);
+
+   bi_prod = hypre_CTAllocF(HYPRE_Real, nv, pcg_functions, HYPRE_MEMORY_HOST);
+   i_prod  = hypre_CTAllocF(HYPRE_Real, nv, pcg_functions, HYPRE_MEMORY_HOST);
+   eps     = hypre_CTAllocF(HYPRE_Real, nv, pcg_functions, HYPRE_MEMORY_HOST);
+   dots    = hypre_CTAllocF(HYPRE_Real, 2 * nv * nv, pcg_functions, HYPRE_MEMORY_HOST);
+   gram    = hypre_CTAllocF(HYPRE_Real, nv * nv, pcg_functions, HYPRE_MEMORY_HOST);
+   delta   = hypre_CTAllocF(HYPRE_Real, nv * nv, pcg_functions, HYPRE_MEMORY_HOST);
+   sol     = hypre_CTAllocF(HYPRE_Real, nv * nv, pcg_functions, HYPRE_MEMORY_HOST);
+   T       = hypre_CTAllocF(HYPRE_Real, nv * nv, pcg_functions, HYPRE_MEMORY_HOST);
+   F       = hypre_CTAllocF(HYPRE_Real, nv * nv, pcg_functions, HYPRE_MEMORY_HOST);
+   work    = hypre_CTAllocF(HYPRE_Real, nv * nv + 5 * nv, pcg_functions, HYPRE_MEMORY_HOST);
+   coef    = hypre_CTAllocF(HYPRE_Complex, nv * nv, pcg_functions, HYPRE_MEMORY_HOST);
+
+   /* bi_prod[j] = <b_j,b_j> or <C*b_j,b_j> */
+   if (two_norm)
+   {
+      (*(pcg_functions->ColumnInnerProd))(b, b, bi_prod);
+   }
+   else
+   {
+      (*(pcg_functions->ClearVector))(p);
+      precond(precond_data, A, b, p);
+      (*(pcg_functions->ColumnInnerProd))(p, b, bi_prod);
+   }
+   for (j = 0; j < nv; j++)
+   {
+      sum_prod += bi_prod[j];
+   }
+   if (sum_prod != 0.) { ieee_check = sum_prod / sum_prod; } /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      if (print_level > 0 || logging > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+         hypre_printf("ERROR -- hypre_BlockPCGSolve: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied b.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      i = max_iter;
+   }
+
+   /* R = B - A*X, Z = C*R */
+   (*(pcg_functions->CopyVector))(b, r);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+   (*(pcg_functions->ClearVector))(s);
+   precond(precond_data, A, r, s);
+   if (two_norm)
+   {
+      (*(pcg_functions->ColumnInnerProd))(r, r, i_prod);
+   }
+   else
+   {
+      (*(pcg_functions->ColumnInnerProd))(s, r, i_prod);
+   }
+
+   /* per-column tolerances; a zero right-hand side is measured against r_0 */
+   for (j = 0; j < nv; j++)
+   {
+      if (bi_prod[j] <= 0.0)
+      {
+         bi_prod[j] = i_prod[j];
+      }
+      if (bi_prod[j] > 0.0)
+      {
+         eps[j] = stop_crit ? r_tol * r_tol / bi_prod[j] :
+                  hypre_max(r_tol * r_tol, a_tol * a_tol / bi_prod[j]);
+      }
+   }
+
+   num_converged = hypre_BlockKrylovNumConverged(nv, i_prod, bi_prod, eps,
+                                                 &max_norm, &max_rel_norm);
+   if ( logging > 0 || print_level > 0 )
+   {
+      norms[0]     = max_norm;
+      rel_norms[0] = max_rel_norm;
+   }
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+      hypre_printf("Block PCG with %d right-hand sides\n", nv);
+      if (two_norm)
+      {
+         hypre_printf("Iters   max ||r||_2     conv.rate  max ||r||_2/||b||_2\n");
+         hypre_printf("-----   ------------    ---------  ------------ \n");
+      }
+      else
+      {
+         hypre_printf("Iters   max ||r||_C     conv.rate  max ||r||_C/||b||_C\n");
+         hypre_printf("-----   ------------    ---------  ------------ \n");
+      }
+   }
+
+   /* P = orth(Z) */
+   (*(pcg_functions->MultiInnerProd))(1, &s, s, gram);
+   rank = hypre_BlockKrylovOrthBasis(nv, gram, T, F, work, &ratio);
+   for (c = 0; c < nv * nv; c++)
+   {
+      coef[c] = T[c];
+   }
+   (*(pcg_functions->MultiAxpy))(coef, s, 0.0, p);
+
+   qr[0] = q;
+   qr[1] = r;
+   while (num_converged < nv && i < max_iter && rank > 0)
+   {
+      i++;
+
+      /* Q = A*P and [Q R]^T P */
+      (*(pcg_functions->Matvec))(matvec_data, 1.0, A, p, 0.0, q);
+      (*(pcg_functions->MultiInnerProd))(2, qr, p, dots);
+
+      /* Cholesky factor of P^T Q on the kept directions */
+      for (j = 0; j < rank; j++)
+      {
+         for (c = 0; c < rank; c++)
+         {
+            delta[j * rank + c] = dots[c * 2 * nv + j];
+         }
+      }
+      hypre_dpotrf(&uplo, &rank, delta, &rank, &info);
+      if (info != 0)
+      {
+         if (print_level > 0 && my_id == 0)
+         {
+            hypre_printf("Block PCG: P^T A P is not positive definite, stopping at iteration %d\n",
+                         i);
+         }
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Breakdown in block PCG\n");
+         break;
+      }
+
+      /* alpha = (P^T Q)^{-1} P^T R; X = X + P*alpha, R = R - Q*alpha */
+      for (j = 0; j < nv; j++)
+      {
+         for (c = 0; c < rank; c++)
+         {
+            sol[j * rank + c] = dots[c * 2 * nv + nv + j];
+         }
+      }
+      hypre_dpotrs(&uplo, &rank, &nv, delta, &rank, sol, &rank, &info);
+      for (j = 0; j < nv; j++)
+      {
+         for (c = 0; c < nv; c++)
+         {
+            coef[j * nv + c] = (c < rank) ? sol[j * rank + c] : 0.0;
+         }
+      }
+      (*(pcg_functions->MultiAxpy))(coef, p, 1.0, x);
+      for (c = 0; c < nv * nv; c++)
+      {
+         coef[c] = -coef[c];
+      }
+      (*(pcg_functions->MultiAxpy))(coef, q, 1.0, r);
+
+      /* Z = C*R and [Q R]^T Z */
+      (*(pcg_functions->ClearVector))(s);
+      precond(precond_data, A, r, s);
+      (*(pcg_functions->MultiInnerProd))(2, qr, s, dots);
+
+      if (two_norm)
+      {
+         (*(pcg_functions->ColumnInnerProd))(r, r, i_prod);
+      }
+      else
+      {
+         for (j = 0; j < nv; j++)
+         {
+            i_prod[j] = dots[j * 2 * nv + nv + j];
+         }
+      }
+
+      num_converged = hypre_BlockKrylovNumConverged(nv, i_prod, bi_prod, eps,
+                                                    &max_norm, &max_rel_norm);
+      if ( logging > 0 || print_level > 0 )
+      {
+         norms[i]     = max_norm;
+         rel_norms[i] = max_rel_norm;
+      }
+      if ( print_level > 1 && my_id == 0 )
+      {
+         hypre_printf("% 5d    %e    %f   %e\n", i, norms[i],
+                      norms[i - 1] > 0.0 ? norms[i] / norms[i - 1] : 0.0, rel_norms[i]);
+      }
+      if (num_converged == nv)
+      {
+         break;
+      }
+
+      /* beta = -(P^T Q)^{-1} Q^T Z; P = orth(Z + P*beta) */
+      for (j = 0; j < nv; j++)
+      {
+         for (c = 0; c < rank; c++)
+         {
+            sol[j * rank + c] = -dots[j * 2 * nv + c];
+         }
+      }
+      hypre_dpotrs(&uplo, &rank, &nv, delta, &rank, sol, &rank, &info);
+      for (j = 0; j < nv; j++)
+      {
+         for (c = 0; c < nv; c++)
+         {
+            coef[j * nv + c] = (c < rank) ? sol[j * rank + c] : 0.0;
+         }
+      }
+      (*(pcg_functions->MultiAxpy))(coef, p, 1.0, s);
+
+      (*(pcg_functions->MultiInnerProd))(1, &s, s, gram);
+      rank = hypre_BlockKrylovOrthBasis(nv, gram, T, F, work, &ratio);
+      for (c = 0; c < nv * nv; c++)
+      {
+         coef[c] = T[c];
+      }
+      (*(pcg_functions->MultiAxpy))(coef, s, 0.0, p);
+   }
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+   }
+
+   if (num_converged == nv)
+   {
+      (pcg_data -> converged) = 1;
+   }
+   else if (i >= max_iter && hybrid != -1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_CONV, "Reached max iterations in PCG before convergence");
+   }
+
+   (pcg_data -> num_iterations)    = i;
+   (pcg_data -> rel_residual_norm) = max_rel_norm;
+
+   hypre_TFreeF(bi_prod, pcg_functions);
+   hypre_TFreeF(i_prod, pcg_functions);
+   hypre_TFreeF(eps, pcg_functions);
+   hypre_TFreeF(dots, pcg_functions);
+   hypre_TFreeF(gram, pcg_functions);
+   hypre_TFreeF(delta, pcg_functions);
+   hypre_TFreeF(sol, pcg_functions);
+   hypre_TFreeF(T, pcg_functions);
+   hypre_TFreeF(F, pcg_functions);
+   hypre_TFreeF(work, pcg_functions);
+   hypre_TFreeF(coef, pcg_functions);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BlockGMRESSolve
+ *--------------------------------------------------------------------------
+ *
+ * Right-preconditioned block GMRES(m) with block size nv. The Arnoldi basis
+ * V_0, ..., V_m is stored in p[0..k_dim]; the block Hessenberg matrix H and
+ * the right-hand side G = [F_0; 0] of the least-squares problem (where
+ * R = V_0*F_0) are dense with (m+1)*nv rows. W = A*C*V_k is orthogonalized
+ * against V_0..V_k by block classical Gram-Schmidt with two passes (one
+ * reduction each) and then within itself by SVQB, which gives V_{k+1} and
+ * H_{k+1,k}. Givens rotations reduce H to upper triangular form column by
+ * column; the rows of G below the triangle then hold the residual of each
+ * right-hand side. Columns of H that belong to dropped directions vanish and
+ * do not take a row of the triangle, so the triangle may have fewer than k*nv
+ * rows. The true residual is recomputed at every restart.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BlockGMRESSolve( void *gmres_vdata,
+                       void *A,
+                       void *b,
+                       void *x )
+{
+   hypre_GMRESData      *gmres_data      = (hypre_GMRESData *)gmres_vdata;
+   hypre_GMRESFunctions *gmres_functions = gmres_data->functions;
+   HYPRE_Int             k_dim           = (gmres_data -> k_dim);
+   HYPRE_Int             max_iter        = (gmres_data -> max_iter);
+   HYPRE_Int             hybrid          = (gmres_data -> hybrid);
+   HYPRE_Real            r_tol           = (gmres_data -> tol);
+   HYPRE_Real            a_tol           = (gmres_data -> a_tol);
+   void                 *matvec_data     = (gmres_data -> matvec_data);
+   void                 *r               = (gmres_data -> r);
+   void                 *w               = (gmres_data -> w);
+   void                **p               = (gmres_data -> p);
+   HYPRE_Int           (*precond)(void*, void*, void*, void*) = (gmres_functions -> precond);
+   void                 *precond_data    = (gmres_data -> precond_data);
+   HYPRE_Int             print_level     = (gmres_data -> print_level);
+   HYPRE_Int             logging         = (gmres_data -> logging);
+   HYPRE_Real           *norms           = (gmres_data -> norms);
+
+   HYPRE_Int             nv              = (*(gmres_functions->NumVectors))(b);
+   HYPRE_Int             ldh             = (k_dim + 1) * nv;
+   HYPRE_Real           *hh, *gg, *cs, *sn, *yy;
+   HYPRE_Real           *hproj, *gram, *T, *F, *T2, *F2, *work;
+   HYPRE_Real           *b_norm2, *r_norm2, *den, *eps;
+   HYPRE_Int            *lo, *prow, *pcol;
+   HYPRE_Complex        *coef;
+   HYPRE_Real            max_norm, max_rel_norm = 0.0, ratio, ratio2;
+   HYPRE_Real            sum_norm = 0.0, ieee_check = 0.;
+   HYPRE_Real            a, t, v0, v1;
+   HYPRE_Int             num_converged = 0, rank, npiv;
+   HYPRE_Int             iter = 0, k, l, i, j, c, c2, row, pass;
+   HYPRE_Int             my_id, num_procs;
+
+   if (r == NULL || (*(gmres_functions->NumVectors))(r) != nv ||
+       (*(gmres_functions->NumVectors))(p[0]) != nv ||
+       (*(gmres_functions->NumVectors))(x) != nv)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Block GMRES requires hypre_GMRESSetup with the same number of vectors\n");
+      return hypre_error_flag;
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (gmres_data -> converged) = 0;
+
+   (*(gmres_functions->CommInfo))(A, &my_id, &num_procs);
+
+   hh      = hypre_CTAllocF(HYPRE_Real, ldh * k_dim * nv, gmres_functions, HYPRE_MEMORY_HOST);
+   gg      = hypre_CTAllocF(HYPRE_Real, ldh * nv, gmres_functions, HYPRE_MEMORY_HOST);
+   yy      = hypre_CTAllocF(HYPRE_Real, ldh * nv, gmres_functions, HYPRE_MEMORY_HOST);
+   cs      = hypre_CTAllocF(HYPRE_Real, ldh * k_dim * nv, gmres_functions, HYPRE_MEMORY_HOST);
+   sn      = hypre_CTAllocF(HYPRE_Real, ldh * k_dim * nv, gmres_functions, HYPRE_MEMORY_HOST);
+   lo      = hypre_CTAllocF(HYPRE_Int, k_dim * nv, gmres_functions, HYPRE_MEMORY_HOST);
+   prow    = hypre_CTAllocF(HYPRE_Int, k_dim * nv, gmres_functions, HYPRE_MEMORY_HOST);
+   pcol    = hypre_CTAllocF(HYPRE_Int, k_dim * nv, gmres_functions, HYPRE_MEMORY_HOST);
+   hproj   = hypre_CTAllocF(HYPRE_Real, ldh * nv, gmres_functions, HYPRE_MEMORY_HOST);
+   gram    = hypre_CTAllocF(HYPRE_Real, nv * nv, gmres_functions, HYPRE_MEMORY_HOST);
+   T       = hypre_CTAllocF(HYPRE_Real, nv * nv, gmres_functions, HYPRE_MEMORY_HOST);
+   F       = hypre_CTAllocF(HYPRE_Real, nv * nv, gmres_functions, HYPRE_MEMORY_HOST);
+   T2      = hypre_CTAllocF(HYPRE_Real, nv * nv, gmres_functions, HYPRE_MEMORY_HOST);
+   F2      = hypre_CTAllocF(HYPRE_Real, nv * nv, gmres_functions, HYPRE_MEMORY_HOST);
+   work    = hypre_CTAllocF(HYPRE_Real, nv * nv + 5 * nv, gmres_functions, HYPRE_MEMORY_HOST);
+   b_norm2 = hypre_CTAllocF(HYPRE_Real, nv, gmres_functions, HYPRE_MEMORY_HOST);
+   r_norm2 = hypre_CTAllocF(HYPRE_Real, nv, gmres_functions, HYPRE_MEMORY_HOST);
+   den     = hypre_CTAllocF(HYPRE_Real, nv, gmres_functions, HYPRE_MEMORY_HOST);
+   eps     = hypre_CTAllocF(HYPRE_Real, nv, gmres_functions, HYPRE_MEMORY_HOST);
+   coef    = hypre_CTAllocF(HYPRE_Complex, nv * nv, gmres_functions, HYPRE_MEMORY_HOST);
+
+   /* R = B - A*X and the per-column tolerances max(a_tol, r_tol*||b_j||) */
+   (*(gmres_functions->ColumnInnerProd))(b, b, b_norm2);
+   (*(gmres_functions->CopyVector))(b, r);
+   (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+   (*(gmres_functions->ColumnInnerProd))(r, r, r_norm2);
+
+   for (j = 0; j < nv; j++)
+   {
+      sum_norm += r_norm2[j];
+      den[j] = (b_norm2[j] > 0.0) ? b_norm2[j] : r_norm2[j];
+      if (den[j] > 0.0)
+      {
+         eps[j] = hypre_max(r_tol * r_tol, a_tol * a_tol / den[j]);
+      }
+   }
+   if (sum_norm != 0.) { ieee_check = sum_norm / sum_norm; } /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      if (print_level > 0 || logging > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+         hypre_printf("ERROR -- hypre_BlockGMRESSolve: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied b, A or x_0.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      iter = max_iter;
+   }
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("Block GMRES with %d right-hand sides\n", nv);
+      hypre_printf("=============================================\n\n");
+      hypre_printf("Iters   max resid.norm   conv.rate  max rel.res.norm\n");
+      hypre_printf("-----   --------------   ---------  ----------------\n");
+   }
+
+   while (1)
+   {
+      /* test the true residual */
+      num_converged = hypre_BlockKrylovNumConverged(nv, r_norm2, den, eps,
+                                                    &max_norm, &max_rel_norm);
+      if ( logging > 0 || print_level > 0 )
+      {
+         norms[iter] = max_norm;
+      }
+      if ( print_level > 1 && my_id == 0 && iter == 0 )
+      {
+         hypre_printf("    0    %e                %e\n", max_norm, max_rel_norm);
+      }
+      if (num_converged == nv || iter >= max_iter)
+      {
+         break;
+      }
+
+      /* V_0 = orth(R), G = [F_0; 0] */
+      (*(gmres_functions->MultiInnerProd))(1, &r, r, gram);
+      rank = hypre_BlockKrylovOrthBasis(nv, gram, T, F, work, &ratio);
+      if (rank == 0)
+      {
+         break;
+      }
+      for (c = 0; c < nv * nv; c++)
+      {
+         coef[c] = T[c];
+      }
+      (*(gmres_functions->MultiAxpy))(coef, r, 0.0, p[0]);
+      for (c = 0; c < ldh * nv; c++)
+      {
+         gg[c] = 0.0;
+      }
+      for (c = 0; c < ldh * k_dim * nv; c++)
+      {
+         hh[c] = 0.0;
+      }
+      for (j = 0; j < nv; j++)
+      {
+         for (c = 0; c < nv; c++)
+         {
+            gg[j * ldh + c] = F[j * nv + c];
+         }
+      }
+
+      k = 0;
+      npiv = 0;
+      while (k < k_dim && iter < max_iter)
+      {
+         iter++;
+
+         /* W = A*C*V_k */
+         (*(gmres_functions->ClearVector))(r);
+         precond(precond_data, A, p[k], r);
+         (*(gmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[k + 1]);
+
+         /* block classical Gram-Schmidt, two passes */
+         for (pass = 0; pass < 2; pass++)
+         {
+            (*(gmres_functions->MultiInnerProd))(k + 1, p, p[k + 1], hproj);
+            for (l = 0; l <= k; l++)
+            {
+               for (j = 0; j < nv; j++)
+               {
+                  for (c = 0; c < nv; c++)
+                  {
+                     a = hproj[j * (k + 1) * nv + l * nv + c];
+                     coef[j * nv + c] = -a;
+                     hh[(k * nv + j) * ldh + l * nv + c] += a;
+                  }
+               }
+               (*(gmres_functions->MultiAxpy))(coef, p[l], 1.0, p[k + 1]);
+            }
+         }
+
+         /* V_{k+1} = orth(W) and H_{k+1,k}, with a second pass if needed */
+         (*(gmres_functions->MultiInnerProd))(1, &p[k + 1], p[k + 1], gram);
+         rank = hypre_BlockKrylovOrthBasis(nv, gram, T, F, work, &ratio);
+         for (c = 0; c < nv * nv; c++)
+         {
+            coef[c] = T[c];
+         }
+         (*(gmres_functions->MultiAxpy))(coef, p[k + 1], 0.0, w);
+         if (rank > 0 && ratio < HYPRE_BLOCK_KRYLOV_REORTH_TOL)
+         {
+            /* W = V*F = V2*F2*F */
+            (*(gmres_functions->MultiInnerProd))(1, &w, w, gram);
+            hypre_BlockKrylovOrthBasis(nv, gram, T2, F2, work, &ratio2);
+            for (c = 0; c < nv * nv; c++)
+            {
+               coef[c] = T2[c];
+            }
+            (*(gmres_functions->MultiAxpy))(coef, w, 0.0, p[k + 1]);
+            for (j = 0; j < nv; j++)
+            {
+               for (i = 0; i < nv; i++)
+               {
+                  a = 0.0;
+                  for (c = 0; c < nv; c++)
+                  {
+                     a += F2[c * nv + i] * F[j * nv + c];
+                  }
+                  T[j * nv + i] = a;
+               }
+            }
+            for (c = 0; c < nv * nv; c++)
+            {
+               F[c] = T[c];
+            }
+         }
+         else
+         {
+            (*(gmres_functions->CopyVector))(w, p[k + 1]);
+         }
+         for (j = 0; j < nv; j++)
+         {
+            for (c = 0; c < nv; c++)
+            {
+               hh[(k * nv + j) * ldh + (k + 1) * nv + c] = F[j * nv + c];
+            }
+         }
+
+         /* apply the previous rotations to the new columns and eliminate their
+            entries below the next row of the triangle, bottom up with rotations
+            of adjacent rows; column c2 was reduced into row prow[c2] */
+         for (j = 0; j < nv; j++)
+         {
+            c = k * nv + j;
+            for (c2 = 0; c2 < c; c2++)
+            {
+               for (i = 0; i < lo[c2] - prow[c2]; i++)
+               {
+                  row = lo[c2] - i;
+                  v0 = hh[c * ldh + row - 1];
+                  v1 = hh[c * ldh + row];
+                  hh[c * ldh + row - 1] =  cs[c2 * ldh + i] * v0 + sn[c2 * ldh + i] * v1;
+                  hh[c * ldh + row]     = -sn[c2 * ldh + i] * v0 + cs[c2 * ldh + i] * v1;
+               }
+            }
+            lo[c]   = (k + 2) * nv - 1;
+            prow[c] = npiv;
+            for (i = 0; i < lo[c] - prow[c]; i++)
+            {
+               row = lo[c] - i;
+               v0 = hh[c * ldh + row - 1];
+               v1 = hh[c * ldh + row];
+               if (v1 == 0.0)
+               {
+                  cs[c * ldh + i] = 1.0;
+                  sn[c * ldh + i] = 0.0;
+                  continue;
+               }
+               t = sqrt(v0 * v0 + v1 * v1);
+               cs[c * ldh + i] = v0 / t;
+               sn[c * ldh + i] = v1 / t;
+               hh[c * ldh + row - 1] = t;
+               hh[c * ldh + row]     = 0.0;
+               for (l = 0; l < nv; l++)
+               {
+                  v0 = gg[l * ldh + row - 1];
+                  v1 = gg[l * ldh + row];
+                  gg[l * ldh + row - 1] =  cs[c * ldh + i] * v0 + sn[c * ldh + i] * v1;
+                  gg[l * ldh + row]     = -sn[c * ldh + i] * v0 + cs[c * ldh + i] * v1;
+               }
+            }
+            if (hh[c * ldh + npiv] != 0.0)
+            {
+               pcol[npiv++] = c;
+            }
+         }
+         k++;
+
+         /* residual estimates: the rows of G below the triangle */
+         for (j = 0; j < nv; j++)
+         {
+            r_norm2[j] = 0.0;
+            for (row = npiv; row < (k + 1) * nv; row++)
+            {
+               r_norm2[j] += gg[j * ldh + row] * gg[j * ldh + row];
+            }
+         }
+         num_converged = hypre_BlockKrylovNumConverged(nv, r_norm2, den, eps,
+                                                       &max_norm, &max_rel_norm);
+         if ( logging > 0 || print_level > 0 )
+         {
+            norms[iter] = max_norm;
+            if ( print_level > 1 && my_id == 0 )
+            {
+               hypre_printf("% 5d    %e    %f   %e\n", iter, norms[iter],
+                            norms[iter - 1] > 0.0 ? norms[iter] / norms[iter - 1] : 0.0,
+                            max_rel_norm);
+            }
+         }
+         if (num_converged == nv || rank == 0)
+         {
+            break;
+         }
+      }
+
+      /* solve the triangular system H*Y = G; dropped directions get Y = 0 */
+      for (c = 0; c < k * nv; c++)
+      {
+         for (j = 0; j < nv; j++)
+         {
+            yy[j * ldh + c] = 0.0;
+         }
+      }
+      for (row = npiv - 1; row >= 0; row--)
+      {
+         c = pcol[row];
+         for (j = 0; j < nv; j++)
+         {
+            a = gg[j * ldh + row];
+            for (i = row + 1; i < npiv; i++)
+            {
+               a -= hh[pcol[i] * ldh + row] * yy[j * ldh + pcol[i]];
+            }
+            yy[j * ldh + c] = a / hh[c * ldh + row];
+         }
+      }
+
+      /* X = X + C*(V*Y) */
+      for (l = 0; l < k; l++)
+      {
+         for (j = 0; j < nv; j++)
+         {
+            for (c = 0; c < nv; c++)
+            {
+               coef[j * nv + c] = yy[j * ldh + l * nv + c];
+            }
+         }
+         (*(gmres_functions->MultiAxpy))(coef, p[l], (l == 0) ? 0.0 : 1.0, w);
+      }
+      (*(gmres_functions->ClearVector))(r);
+      precond(precond_data, A, w, r);
+      (*(gmres_functions->Axpy))(1.0, r, x);
+
+      /* true residual */
+      (*(gmres_functions->CopyVector))(b, r);
+      (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+      (*(gmres_functions->ColumnInnerProd))(r, r, r_norm2);
+   }
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+   }
+
+   if (num_converged == nv)
+   {
+      (gmres_data -> converged) = 1;
+   }
+   else if (iter >= max_iter && hybrid != -1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_CONV, "Reached max iterations in GMRES before convergence");
+   }
+
+   (gmres_data -> num_iterations)    = iter;
+   (gmres_data -> rel_residual_norm) = max_rel_norm;
+
+   hypre_TFreeF(hh, gmres_functions);
+   hypre_TFreeF(gg, gmres_functions);
+   hypre_TFreeF(yy, gmres_functions);
+   hypre_TFreeF(cs, gmres_functions);
+   hypre_TFreeF(sn, gmres_functions);
+   hypre_TFreeF(lo, gmres_functions);
+   hypre_TFreeF(prow, gmres_functions);
+   hypre_TFreeF(pcol, gmres_functions);
+   hypre_TFreeF(hproj, gmres_functions);
+   hypre_TFreeF(gram, gmres_functions);
+   hypre_TFreeF(T, gmres_functions);
+   hypre_TFreeF(F, gmres_functions);
+   hypre_TFreeF(T2, gmres_functions);
+   hypre_TFreeF(F2, gmres_functions);
+   hypre_TFreeF(work, gmres_functions);
+   hypre_TFreeF(b_norm2, gmres_functions);
+   hypre_TFreeF(r_norm2, gmres_functions);
+   hypre_TFreeF(den, gmres_functions);
+   hypre_TFreeF(eps, gmres_functions);
+   hypre_TFreeF(coef, gmres_functions);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
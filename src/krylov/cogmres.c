@@ -90,6 +90,8 @@ hypre_COGMRESCreate( hypre_COGMRESFunctions *cogmres_functions )
    /* set defaults */
    (cogmres_data -> k_dim)          = 5;
    (cogmres_data -> cgs)            = 1; /* if 2 performs reorthogonalization */
+   (cogmres_data -> s_step)         = 1; /* if > 1 uses the s-step variant */
+   (cogmres_data -> s_step_basis)   = 0; /* Newton basis */
    (cogmres_data -> tol)            = 1.0e-06; /* relative residual tol */
    (cogmres_data -> cf_tol)         = 0.0;
    (cogmres_data -> a_tol)          = 0.0; /* abs. residual tol */
@@ -337,6 +339,11 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
 
    HYPRE_Real real_r_norm_old, real_r_norm_new;
 
+   if ((cogmres_data -> s_step) > 1)
+   {
+      return hypre_COGMRESSStepSolve(cogmres_vdata, A, b, x);
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    (cogmres_data -> converged) = 0;
@@ -980,6 +987,60 @@ hypre_COGMRESGetCGS( void   *cogmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSetSStep, hypre_COGMRESGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSetSStep( void     *cogmres_vdata,
+                       HYPRE_Int   s_step )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   if (s_step < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (cogmres_data -> s_step) = s_step;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_COGMRESGetSStep( void      *cogmres_vdata,
+                       HYPRE_Int  *s_step )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   *s_step = (cogmres_data -> s_step);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSetSStepBasis, hypre_COGMRESGetSStepBasis
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSetSStepBasis( void     *cogmres_vdata,
+                            HYPRE_Int   s_step_basis )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   if (s_step_basis < 0 || s_step_basis > 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (cogmres_data -> s_step_basis) = s_step_basis;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_COGMRESGetSStepBasis( void      *cogmres_vdata,
+                            HYPRE_Int  *s_step_basis )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   *s_step_basis = (cogmres_data -> s_step_basis);
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESSetTol, hypre_COGMRESGetTol
  *--------------------------------------------------------------------------*/
@@ -1256,3 +1317,23 @@ hypre_COGMRESSetModifyPC(void *cogmres_vdata,
    (cogmres_functions -> modify_pc)        = modify_pc;
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESFunctionsSetBlockInnerProd
+ *
+ * Optional block of inner products result[j*kx+i] = <x[i],y[j]> computed
+ * with a single global reduction. Used by the s-step variant; when it is
+ * not set, MassInnerProd is called once per column of y instead.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESFunctionsSetBlockInnerProd( hypre_COGMRESFunctions *cogmres_functions,
+                                         HYPRE_Int (*BlockInnerProd)( void **x, HYPRE_Int kx,
+                                                                      void **y, HYPRE_Int ky,
+                                                                      HYPRE_Int unroll,
+                                                                      void *result ) )
+{
+   cogmres_functions->BlockInnerProd = BlockInnerProd;
+
+   return hypre_error_flag;
+}
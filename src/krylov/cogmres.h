@@ -72,6 +72,9 @@ typedef struct
 
    HYPRE_Int    (*modify_pc)(void *precond_data, HYPRE_Int iteration, HYPRE_Real rel_residual_norm );
 
+   HYPRE_Int    (*BlockInnerProd)( void **x, HYPRE_Int kx, void **y, HYPRE_Int ky,
+                                   HYPRE_Int unroll, void *result );
+
 } hypre_COGMRESFunctions;
 
 /**
@@ -83,6 +86,8 @@ typedef struct
    HYPRE_Int      k_dim;
    HYPRE_Int      unroll;
    HYPRE_Int      cgs;
+   HYPRE_Int      s_step;       /* block size of the s-step variant (1 = off) */
+   HYPRE_Int      s_step_basis; /* 0 = Newton, 1 = Chebyshev */
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
@@ -65,6 +65,49 @@ hypre_GMRESFunctionsCreate(
    return gmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESFunctionsSetResidualNorm
+ *
+ * Optional fused computation of r = b - A*x and <r,r>, see
+ * hypre_PCGFunctionsSetResidualNorm.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESFunctionsSetResidualNorm( hypre_GMRESFunctions *gmres_functions,
+                                     HYPRE_Int (*ResidualNorm)( void *matvec_data, void *A,
+                                                                void *x, void *b, void *r,
+                                                                HYPRE_Real *r_norm2,
+                                                                hypre_MPI_Request *request ) )
+{
+   gmres_functions->ResidualNorm = ResidualNorm;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GMRESFunctionsSetMultiVector
+ *
+ * Optional operations on vectors with more than one column, see
+ * hypre_PCGFunctionsSetMultiVector.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESFunctionsSetMultiVector( hypre_GMRESFunctions *gmres_functions,
+                                   HYPRE_Int (*NumVectors)( void *x ),
+                                   HYPRE_Int (*MultiInnerProd)( HYPRE_Int k, void **x, void *y,
+                                                                HYPRE_Real *result ),
+                                   HYPRE_Int (*ColumnInnerProd)( void *x, void *y, HYPRE_Real *result ),
+                                   HYPRE_Int (*MultiAxpy)( HYPRE_Complex *alpha, void *x,
+                                                           HYPRE_Complex beta, void *y ) )
+{
+   gmres_functions->NumVectors      = NumVectors;
+   gmres_functions->MultiInnerProd  = MultiInnerProd;
+   gmres_functions->ColumnInnerProd = ColumnInnerProd;
+   gmres_functions->MultiAxpy       = MultiAxpy;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESCreate
  *--------------------------------------------------------------------------*/
@@ -327,6 +370,15 @@ hypre_GMRESSolve(void  *gmres_vdata,
 
    HYPRE_Real real_r_norm_old, real_r_norm_new;
 
+   HYPRE_Real        r_norm2;
+   hypre_MPI_Request r_norm2_request;
+   hypre_MPI_Status  r_norm2_status;
+
+   if (gmres_functions->NumVectors && (*(gmres_functions->NumVectors))(b) > 1)
+   {
+      return hypre_BlockGMRESSolve(gmres_vdata, A, b, x);
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    (gmres_data -> converged) = 0;
@@ -358,14 +410,26 @@ hypre_GMRESSolve(void  *gmres_vdata,
       hh[i] = hypre_CTAllocF(HYPRE_Real, k_dim, gmres_functions, HYPRE_MEMORY_HOST);
    }
 
-   (*(gmres_functions->CopyVector))(b, p[0]);
-
    /* compute initial residual */
-   (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, p[0]);
+   if (gmres_functions->ResidualNorm)
+   {
+      /* <r,r> is reduced while <b,b> is computed */
+      (*(gmres_functions->ResidualNorm))(matvec_data, A, x, b, p[0], &r_norm2, &r_norm2_request);
+   }
+   else
+   {
+      (*(gmres_functions->CopyVector))(b, p[0]);
+      (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, p[0]);
+   }
 
    b_norm = sqrt((*(gmres_functions->InnerProd))(b, b));
    real_r_norm_old = b_norm;
 
+   if (gmres_functions->ResidualNorm)
+   {
+      hypre_MPI_Wait(&r_norm2_request, &r_norm2_status);
+   }
+
    /* Since it is does not diminish performance, attempt to return an error flag
       and notify users when they supply bad input. */
    if (b_norm != 0.)
@@ -393,7 +457,14 @@ hypre_GMRESSolve(void  *gmres_vdata,
       return hypre_error_flag;
    }
 
-   r_norm = sqrt((*(gmres_functions->InnerProd))(p[0], p[0]));
+   if (gmres_functions->ResidualNorm)
+   {
+      r_norm = sqrt(r_norm2);
+   }
+   else
+   {
+      r_norm = sqrt((*(gmres_functions->InnerProd))(p[0], p[0]));
+   }
    r_norm_0 = r_norm;
 
    /* Since it is does not diminish performance, attempt to return an error flag
@@ -505,9 +576,17 @@ hypre_GMRESSolve(void  *gmres_vdata,
          if (!rel_change) /* shouldn't exit after no iterations if
                            * relative change is on*/
          {
-            (*(gmres_functions->CopyVector))(b, r);
-            (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
-            r_norm = sqrt((*(gmres_functions->InnerProd))(r, r));
+            if (gmres_functions->ResidualNorm)
+            {
+               (*(gmres_functions->ResidualNorm))(matvec_data, A, x, b, r, &r_norm2, NULL);
+               r_norm = sqrt(r_norm2);
+            }
+            else
+            {
+               (*(gmres_functions->CopyVector))(b, r);
+               (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+               r_norm = sqrt((*(gmres_functions->InnerProd))(r, r));
+            }
             if (r_norm  <= epsilon)
             {
                if ( print_level > 1 && my_id == 0)
@@ -774,9 +853,17 @@ hypre_GMRESSolve(void  *gmres_vdata,
          }
 
          /* calculate actual residual norm*/
-         (*(gmres_functions->CopyVector))(b, r);
-         (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
-         real_r_norm_new = r_norm = sqrt( (*(gmres_functions->InnerProd))(r, r) );
+         if (gmres_functions->ResidualNorm)
+         {
+            (*(gmres_functions->ResidualNorm))(matvec_data, A, x, b, r, &r_norm2, NULL);
+            real_r_norm_new = r_norm = sqrt(r_norm2);
+         }
+         else
+         {
+            (*(gmres_functions->CopyVector))(b, r);
+            (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+            real_r_norm_new = r_norm = sqrt( (*(gmres_functions->InnerProd))(r, r) );
+         }
 
          if (r_norm <= epsilon)
          {
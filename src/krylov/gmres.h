@@ -64,6 +64,14 @@ typedef struct
    HYPRE_Int    (*ClearVector)   ( void *x );
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   /* optional: r = b - A*x and r_norm2 = <r,r> in one pass, see gmres.c */
+   HYPRE_Int    (*ResidualNorm)  ( void *matvec_data, void *A, void *x, void *b, void *r,
+                                   HYPRE_Real *r_norm2, hypre_MPI_Request *request );
+   /* optional: operations on multivectors, used by the block solver in block_krylov.c */
+   HYPRE_Int    (*NumVectors)     ( void *x );
+   HYPRE_Int    (*MultiInnerProd) ( HYPRE_Int k, void **x, void *y, HYPRE_Real *result );
+   HYPRE_Int    (*ColumnInnerProd)( void *x, void *y, HYPRE_Real *result );
+   HYPRE_Int    (*MultiAxpy)      ( HYPRE_Complex *alpha, void *x, HYPRE_Complex beta, void *y );
 
    HYPRE_Int    (*precond)       ();
    HYPRE_Int    (*precond_setup) ();
@@ -411,6 +411,14 @@ typedef struct
    HYPRE_Int    (*ClearVector)   ( void *x );
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   /* optional: r = b - A*x and r_norm2 = <r,r> in one pass, see gmres.c */
+   HYPRE_Int    (*ResidualNorm)  ( void *matvec_data, void *A, void *x, void *b, void *r,
+                                   HYPRE_Real *r_norm2, hypre_MPI_Request *request );
+   /* optional: operations on multivectors, used by the block solver in block_krylov.c */
+   HYPRE_Int    (*NumVectors)     ( void *x );
+   HYPRE_Int    (*MultiInnerProd) ( HYPRE_Int k, void **x, void *y, HYPRE_Real *result );
+   HYPRE_Int    (*ColumnInnerProd)( void *x, void *y, HYPRE_Real *result );
+   HYPRE_Int    (*MultiAxpy)      ( HYPRE_Complex *alpha, void *x, HYPRE_Complex beta, void *y );
 
    HYPRE_Int    (*precond)       (void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup) (void *vdata, void *A, void *b, void *x);
@@ -582,6 +590,9 @@ typedef struct
 
    HYPRE_Int    (*modify_pc)( void *precond_data, HYPRE_Int iteration, HYPRE_Real rel_residual_norm);
 
+   HYPRE_Int    (*BlockInnerProd)( void **x, HYPRE_Int kx, void **y, HYPRE_Int ky,
+                                   HYPRE_Int unroll, void *result );
+
 
 } hypre_COGMRESFunctions;
 
@@ -594,6 +605,8 @@ typedef struct
    HYPRE_Int      k_dim;
    HYPRE_Int      unroll;
    HYPRE_Int      cgs;
+   HYPRE_Int      s_step;       /* block size of the s-step variant (1 = off) */
+   HYPRE_Int      s_step_basis; /* 0 = Newton, 1 = Chebyshev */
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
@@ -1066,6 +1079,17 @@ typedef struct
    HYPRE_Int    (*ClearVector)   ( void *x );
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   /* optional: r = b - A*x and r_norm2 = <r,r> in one pass, see pcg.c */
+   HYPRE_Int    (*ResidualNorm)  ( void *matvec_data, void *A, void *x, void *b, void *r,
+                                   HYPRE_Real *r_norm2, hypre_MPI_Request *request );
+   /* optional: start the reduction of result[j] = <x[j],y[j]>, j < k, see pipelined_pcg.c */
+   HYPRE_Int    (*InnerProdStart)( HYPRE_Int k, void **x, void **y, HYPRE_Real *result,
+                                   hypre_MPI_Request *request );
+   /* optional: operations on multivectors, used by the block solver in block_krylov.c */
+   HYPRE_Int    (*NumVectors)     ( void *x );
+   HYPRE_Int    (*MultiInnerProd) ( HYPRE_Int k, void **x, void *y, HYPRE_Real *result );
+   HYPRE_Int    (*ColumnInnerProd)( void *x, void *y, HYPRE_Real *result );
+   HYPRE_Int    (*MultiAxpy)      ( HYPRE_Complex *alpha, void *x, HYPRE_Complex beta, void *y );
 
    HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x);
@@ -1105,6 +1129,12 @@ typedef struct
    every "recompute_residual_p" iterations.  This can be expensive and degrade the
    convergence. Use it only if you have seen a problem with the regular residual
    computation.
+   - pipelined!=0 means: use the pipelined (Ghysels-Vanroose) variant, with a single
+   non-blocking reduction per iteration overlapped with the preconditioner and matvec.
+   Here recompute_residual_p sets how often the recursive residual is checked against
+   b-Ax; if the gap is too large the solve continues with the classical recurrences.
+   - if the vectors have more than one column (NumVectors>1), the block variant is used
+   and the stopping test above is applied to each column separately.
    */
 
 typedef struct
@@ -1122,12 +1152,20 @@ typedef struct
    HYPRE_Int      stop_crit;
    HYPRE_Int      converged;
    HYPRE_Int      hybrid;
+   HYPRE_Int      pipelined;
 
    void    *A;
    void    *p;
    void    *s;
    void    *r; /* ...contains the residual.  This is currently kept permanently.
                    If that is ever changed, it still must be kept if logging>1 */
+   void    *u; /* u, w, m, n, z, q are only used by the pipelined variant;
+                  q is also used by the block variant */
+   void    *w;
+   void    *m;
+   void    *n;
+   void    *z;
+   void    *q;
 
    HYPRE_Int      owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void    *matvec_data;
@@ -1148,6 +1186,7 @@ typedef struct
 
 #define hypre_PCGDataOwnsMatvecData(pcgdata)  ((pcgdata) -> owns_matvec_data)
 #define hypre_PCGDataHybrid(pcgdata)  ((pcgdata) -> hybrid)
+#define hypre_PCGDataPipelined(pcgdata)  ((pcgdata) -> pipelined)
 
 #ifdef __cplusplus
 extern "C" {
@@ -1251,6 +1290,14 @@ HYPRE_Int hypre_GMRESDestroy ( void *gmres_vdata );
 HYPRE_Int hypre_GMRESGetResidual ( void *gmres_vdata, void **residual );
 HYPRE_Int hypre_GMRESSetup ( void *gmres_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_GMRESSolve ( void *gmres_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_GMRESFunctionsSetResidualNorm ( hypre_GMRESFunctions *gmres_functions,
+                                                HYPRE_Int (*ResidualNorm)( void *matvec_data, void *A, void *x, void *b, void *r,
+                                                                           HYPRE_Real *r_norm2, hypre_MPI_Request *request ) );
+HYPRE_Int hypre_GMRESFunctionsSetMultiVector ( hypre_GMRESFunctions *gmres_functions,
+                                               HYPRE_Int (*NumVectors)( void *x ),
+                                               HYPRE_Int (*MultiInnerProd)( HYPRE_Int k, void **x, void *y, HYPRE_Real *result ),
+                                               HYPRE_Int (*ColumnInnerProd)( void *x, void *y, HYPRE_Real *result ),
+                                               HYPRE_Int (*MultiAxpy)( HYPRE_Complex *alpha, void *x, HYPRE_Complex beta, void *y ) );
 HYPRE_Int hypre_GMRESSetKDim ( void *gmres_vdata, HYPRE_Int k_dim );
 HYPRE_Int hypre_GMRESGetKDim ( void *gmres_vdata, HYPRE_Int *k_dim );
 HYPRE_Int hypre_GMRESSetTol ( void *gmres_vdata, HYPRE_Real tol );
@@ -1295,6 +1342,10 @@ HYPRE_Int hypre_COGMRESSetUnroll ( void *gmres_vdata, HYPRE_Int unroll );
 HYPRE_Int hypre_COGMRESGetUnroll ( void *gmres_vdata, HYPRE_Int *unroll );
 HYPRE_Int hypre_COGMRESSetCGS ( void *gmres_vdata, HYPRE_Int cgs );
 HYPRE_Int hypre_COGMRESGetCGS ( void *gmres_vdata, HYPRE_Int *cgs );
+HYPRE_Int hypre_COGMRESSetSStep ( void *gmres_vdata, HYPRE_Int s_step );
+HYPRE_Int hypre_COGMRESGetSStep ( void *gmres_vdata, HYPRE_Int *s_step );
+HYPRE_Int hypre_COGMRESSetSStepBasis ( void *gmres_vdata, HYPRE_Int s_step_basis );
+HYPRE_Int hypre_COGMRESGetSStepBasis ( void *gmres_vdata, HYPRE_Int *s_step_basis );
 HYPRE_Int hypre_COGMRESSetTol ( void *gmres_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_COGMRESGetTol ( void *gmres_vdata, HYPRE_Real *tol );
 HYPRE_Int hypre_COGMRESSetAbsoluteTol ( void *gmres_vdata, HYPRE_Real a_tol );
@@ -1322,6 +1373,9 @@ HYPRE_Int hypre_COGMRESGetFinalRelativeResidualNorm ( void *gmres_vdata,
                                                       HYPRE_Real *relative_residual_norm );
 HYPRE_Int hypre_COGMRESSetModifyPC ( void *fgmres_vdata, HYPRE_Int (*modify_pc )(void *precond_data,
                                                                                  HYPRE_Int iteration, HYPRE_Real rel_residual_norm));
+HYPRE_Int hypre_COGMRESFunctionsSetBlockInnerProd ( hypre_COGMRESFunctions *cogmres_functions,
+                                                    HYPRE_Int (*BlockInnerProd )(void **x, HYPRE_Int kx, void **y, HYPRE_Int ky,
+                                                                                 HYPRE_Int unroll, void *result));
 
 
 
@@ -1475,6 +1529,10 @@ HYPRE_Int HYPRE_COGMRESSetUnroll ( HYPRE_Solver solver, HYPRE_Int unroll );
 HYPRE_Int HYPRE_COGMRESGetUnroll ( HYPRE_Solver solver, HYPRE_Int *unroll );
 HYPRE_Int HYPRE_COGMRESSetCGS ( HYPRE_Solver solver, HYPRE_Int cgs );
 HYPRE_Int HYPRE_COGMRESGetCGS ( HYPRE_Solver solver, HYPRE_Int *cgs );
+HYPRE_Int HYPRE_COGMRESSetSStep ( HYPRE_Solver solver, HYPRE_Int s_step );
+HYPRE_Int HYPRE_COGMRESGetSStep ( HYPRE_Solver solver, HYPRE_Int *s_step );
+HYPRE_Int HYPRE_COGMRESSetSStepBasis ( HYPRE_Solver solver, HYPRE_Int s_step_basis );
+HYPRE_Int HYPRE_COGMRESGetSStepBasis ( HYPRE_Solver solver, HYPRE_Int *s_step_basis );
 HYPRE_Int HYPRE_COGMRESSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_COGMRESGetTol ( HYPRE_Solver solver, HYPRE_Real *tol );
 HYPRE_Int HYPRE_COGMRESSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
@@ -1603,9 +1661,21 @@ HYPRE_Int HYPRE_PCGGetResidual ( HYPRE_Solver solver, void *residual );
 /* pcg.c */
 void *hypre_PCGCreate ( hypre_PCGFunctions *pcg_functions );
 HYPRE_Int hypre_PCGDestroy ( void *pcg_vdata );
+HYPRE_Int hypre_PCGDestroyPipelinedVectors ( hypre_PCGData *pcg_data );
 HYPRE_Int hypre_PCGGetResidual ( void *pcg_vdata, void **residual );
 HYPRE_Int hypre_PCGSetup ( void *pcg_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_PCGSolve ( void *pcg_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_PCGFunctionsSetResidualNorm ( hypre_PCGFunctions *pcg_functions,
+                                              HYPRE_Int (*ResidualNorm)( void *matvec_data, void *A, void *x, void *b, void *r,
+                                                                         HYPRE_Real *r_norm2, hypre_MPI_Request *request ) );
+HYPRE_Int hypre_PCGFunctionsSetInnerProdStart ( hypre_PCGFunctions *pcg_functions,
+                                                HYPRE_Int (*InnerProdStart)( HYPRE_Int k, void **x, void **y,
+                                                                             HYPRE_Real *result, hypre_MPI_Request *request ) );
+HYPRE_Int hypre_PCGFunctionsSetMultiVector ( hypre_PCGFunctions *pcg_functions,
+                                             HYPRE_Int (*NumVectors)( void *x ),
+                                             HYPRE_Int (*MultiInnerProd)( HYPRE_Int k, void **x, void *y, HYPRE_Real *result ),
+                                             HYPRE_Int (*ColumnInnerProd)( void *x, void *y, HYPRE_Real *result ),
+                                             HYPRE_Int (*MultiAxpy)( HYPRE_Complex *alpha, void *x, HYPRE_Complex beta, void *y ) );
 HYPRE_Int hypre_PCGSetTol ( void *pcg_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_PCGGetTol ( void *pcg_vdata, HYPRE_Real *tol );
 HYPRE_Int hypre_PCGSetAbsoluteTol ( void *pcg_vdata, HYPRE_Real a_tol );
@@ -1636,12 +1706,24 @@ HYPRE_Int hypre_PCGGetPrintLevel ( void *pcg_vdata, HYPRE_Int *level );
 HYPRE_Int hypre_PCGSetLogging ( void *pcg_vdata, HYPRE_Int level );
 HYPRE_Int hypre_PCGGetLogging ( void *pcg_vdata, HYPRE_Int *level );
 HYPRE_Int hypre_PCGSetHybrid ( void *pcg_vdata, HYPRE_Int level );
+HYPRE_Int hypre_PCGSetPipelined ( void *pcg_vdata, HYPRE_Int pipelined );
+HYPRE_Int hypre_PCGGetPipelined ( void *pcg_vdata, HYPRE_Int *pipelined );
 HYPRE_Int hypre_PCGGetNumIterations ( void *pcg_vdata, HYPRE_Int *num_iterations );
 HYPRE_Int hypre_PCGGetConverged ( void *pcg_vdata, HYPRE_Int *converged );
 HYPRE_Int hypre_PCGPrintLogging ( void *pcg_vdata, HYPRE_Int myid );
 HYPRE_Int hypre_PCGGetFinalRelativeResidualNorm ( void *pcg_vdata,
                                                   HYPRE_Real *relative_residual_norm );
 
+/* pipelined_pcg.c */
+HYPRE_Int hypre_PipelinedPCGSolve ( void *pcg_vdata, void *A, void *b, void *x );
+
+/* sstep_gmres.c */
+HYPRE_Int hypre_COGMRESSStepSolve ( void *cogmres_vdata, void *A, void *b, void *x );
+
+/* block_krylov.c */
+HYPRE_Int hypre_BlockPCGSolve ( void *pcg_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_BlockGMRESSolve ( void *gmres_vdata, void *A, void *b, void *x );
+
 #ifdef __cplusplus
 }
 #endif
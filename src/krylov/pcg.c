@@ -72,6 +72,73 @@ hypre_PCGFunctionsCreate(
    return pcg_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetResidualNorm
+ *
+ * Optional fused computation of r = b - A*x and <r,r>. If request is not
+ * NULL, the reduction of <r,r> may still be in flight on return and is
+ * completed with hypre_MPI_Wait. PCG uses it with the 2-norm only.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetResidualNorm( hypre_PCGFunctions *pcg_functions,
+                                   HYPRE_Int (*ResidualNorm)( void *matvec_data, void *A,
+                                                              void *x, void *b, void *r,
+                                                              HYPRE_Real *r_norm2,
+                                                              hypre_MPI_Request *request ) )
+{
+   pcg_functions->ResidualNorm = ResidualNorm;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetInnerProdStart
+ *
+ * Optional batched inner products result[j] = <x[j],y[j]>, j < k, whose
+ * global reduction is started but not completed; the caller finishes it
+ * with hypre_MPI_Wait on request. Required by the pipelined variant.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetInnerProdStart( hypre_PCGFunctions *pcg_functions,
+                                     HYPRE_Int (*InnerProdStart)( HYPRE_Int k, void **x,
+                                                                  void **y, HYPRE_Real *result,
+                                                                  hypre_MPI_Request *request ) )
+{
+   pcg_functions->InnerProdStart = InnerProdStart;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetMultiVector
+ *
+ * Optional operations on vectors with more than one column. When they are
+ * set and the right-hand side has NumVectors(b) > 1, the solve runs the block
+ * variant in block_krylov.c. MultiInnerProd returns the Gram matrix of the
+ * columns of x[0], ..., x[k-1] against those of y, ColumnInnerProd the inner
+ * products of matching columns, and MultiAxpy computes y = beta*y + x*alpha
+ * for a small column-major coefficient matrix alpha.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetMultiVector( hypre_PCGFunctions *pcg_functions,
+                                 HYPRE_Int (*NumVectors)( void *x ),
+                                 HYPRE_Int (*MultiInnerProd)( HYPRE_Int k, void **x, void *y,
+                                                              HYPRE_Real *result ),
+                                 HYPRE_Int (*ColumnInnerProd)( void *x, void *y, HYPRE_Real *result ),
+                                 HYPRE_Int (*MultiAxpy)( HYPRE_Complex *alpha, void *x,
+                                                         HYPRE_Complex beta, void *y ) )
+{
+   pcg_functions->NumVectors      = NumVectors;
+   pcg_functions->MultiInnerProd  = MultiInnerProd;
+   pcg_functions->ColumnInnerProd = ColumnInnerProd;
+   pcg_functions->MultiAxpy       = MultiAxpy;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGCreate
  *--------------------------------------------------------------------------*/
@@ -101,6 +168,7 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> stop_crit)    = 0;
    (pcg_data -> converged)    = 0;
    (pcg_data -> hybrid)       = 0;
+   (pcg_data -> pipelined)    = 0;
    (pcg_data -> owns_matvec_data ) = 1;
    (pcg_data -> matvec_data)  = NULL;
    (pcg_data -> precond_data) = NULL;
@@ -111,6 +179,12 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> p)            = NULL;
    (pcg_data -> s)            = NULL;
    (pcg_data -> r)            = NULL;
+   (pcg_data -> u)            = NULL;
+   (pcg_data -> w)            = NULL;
+   (pcg_data -> m)            = NULL;
+   (pcg_data -> n)            = NULL;
+   (pcg_data -> z)            = NULL;
+   (pcg_data -> q)            = NULL;
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -161,6 +235,7 @@ hypre_PCGDestroy( void *pcg_vdata )
          (*(pcg_functions->DestroyVector))(pcg_data -> r);
          pcg_data -> r = NULL;
       }
+      hypre_PCGDestroyPipelinedVectors(pcg_data);
       hypre_TFreeF( pcg_data, pcg_functions );
       hypre_TFreeF( pcg_functions, pcg_functions );
    }
@@ -170,6 +245,36 @@ hypre_PCGDestroy( void *pcg_vdata )
    return (hypre_error_flag);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGDestroyPipelinedVectors
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGDestroyPipelinedVectors( hypre_PCGData *pcg_data )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   void              **vecs[6];
+   HYPRE_Int           j;
+
+   vecs[0] = &(pcg_data -> u);
+   vecs[1] = &(pcg_data -> w);
+   vecs[2] = &(pcg_data -> m);
+   vecs[3] = &(pcg_data -> n);
+   vecs[4] = &(pcg_data -> z);
+   vecs[5] = &(pcg_data -> q);
+
+   for (j = 0; j < 6; j++)
+   {
+      if ( *vecs[j] != NULL )
+      {
+         (*(pcg_functions->DestroyVector))(*vecs[j]);
+         *vecs[j] = NULL;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGGetResidual
  *--------------------------------------------------------------------------*/
@@ -227,6 +332,23 @@ hypre_PCGSetup( void *pcg_vdata,
    }
    (pcg_data -> r) = (*(pcg_functions->CreateVector))(b);
 
+   /* work vectors of the pipelined variant, see pipelined_pcg.c */
+   hypre_PCGDestroyPipelinedVectors(pcg_data);
+   if (pcg_data -> pipelined)
+   {
+      (pcg_data -> u) = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> w) = (*(pcg_functions->CreateVector))(b);
+      (pcg_data -> m) = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> n) = (*(pcg_functions->CreateVector))(b);
+      (pcg_data -> z) = (*(pcg_functions->CreateVector))(b);
+      (pcg_data -> q) = (*(pcg_functions->CreateVector))(x);
+   }
+   else if (pcg_functions->NumVectors && (*(pcg_functions->NumVectors))(b) > 1)
+   {
+      /* the block variant keeps A*P in q, see block_krylov.c */
+      (pcg_data -> q) = (*(pcg_functions->CreateVector))(x);
+   }
+
    if ( pcg_data -> matvec_data != NULL && pcg_data->owns_matvec_data )
    {
       (*(pcg_functions->MatvecDestroy))(pcg_data -> matvec_data);
@@ -331,9 +453,21 @@ hypre_PCGSolve( void *pcg_vdata,
    HYPRE_Int       tentatively_converged = 0;
    HYPRE_Int       recompute_true_residual = 0;
 
+   /* fused residual and 2-norm with the reduction of r_norm2 in flight */
+   HYPRE_Int       use_residual_norm = (pcg_functions->ResidualNorm != NULL) && two_norm;
+   HYPRE_Int       r_norm2_pending = 0;
+   HYPRE_Real      r_norm2 = 0.0;
+   hypre_MPI_Request  r_norm2_request;
+   hypre_MPI_Status   r_norm2_status;
+
    HYPRE_Int       i = 0;
    HYPRE_Int       my_id, num_procs;
 
+   if (pcg_functions->NumVectors && (*(pcg_functions->NumVectors))(b) > 1)
+   {
+      return hypre_BlockPCGSolve(pcg_vdata, A, b, x);
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    (pcg_data -> converged) = 0;
@@ -441,9 +575,18 @@ hypre_PCGSolve( void *pcg_vdata,
    };
 
    /* r = b - Ax */
-   (*(pcg_functions->CopyVector))(b, r);
+   if (use_residual_norm && (logging > 0 || print_level > 0 || cf_tol > 0.0))
+   {
+      /* <r,r> is reduced while the preconditioner is applied */
+      (*(pcg_functions->ResidualNorm))(matvec_data, A, x, b, r, &r_norm2, &r_norm2_request);
+      r_norm2_pending = 1;
+   }
+   else
+   {
+      (*(pcg_functions->CopyVector))(b, r);
 
-   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+      (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+   }
 
    //hypre_ParVectorUpdateHost(r);
    /* p = C*r */
@@ -453,6 +596,11 @@ hypre_PCGSolve( void *pcg_vdata,
    /* gamma = <r,p> */
    gamma = (*(pcg_functions->InnerProd))(r, p);
 
+   if (r_norm2_pending)
+   {
+      hypre_MPI_Wait(&r_norm2_request, &r_norm2_status);
+   }
+
    /* Since it is does not diminish performance, attempt to return an error flag
       and notify users when they supply bad input. */
    if (gamma != 0.) { ieee_check = gamma / gamma; } /* INF -> NaN conversion */
@@ -480,7 +628,12 @@ hypre_PCGSolve( void *pcg_vdata,
    /* Set initial residual norm */
    if ( logging > 0 || print_level > 0 || cf_tol > 0.0 )
    {
-      if (two_norm)
+      if (r_norm2_pending)
+      {
+         i_prod_0 = r_norm2;
+         r_norm2_pending = 0;
+      }
+      else if (two_norm)
       {
          i_prod_0 = (*(pcg_functions->InnerProd))(r, r);
       }
@@ -563,8 +716,17 @@ hypre_PCGSolve( void *pcg_vdata,
          {
             hypre_printf("Recomputing the residual...\n");
          }
-         (*(pcg_functions->CopyVector))(b, r);
-         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         if (use_residual_norm)
+         {
+            /* <r,r> is reduced while the preconditioner is applied */
+            (*(pcg_functions->ResidualNorm))(matvec_data, A, x, b, r, &r_norm2, &r_norm2_request);
+            r_norm2_pending = 1;
+         }
+         else
+         {
+            (*(pcg_functions->CopyVector))(b, r);
+            (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         }
       }
 
       /* residual-based stopping criteria: ||r_new-r_old|| < rtol ||b|| */
@@ -574,6 +736,11 @@ hypre_PCGSolve( void *pcg_vdata,
          HYPRE_Real drob2 = alpha * alpha * (*(pcg_functions->InnerProd))(s, s) / bi_prod;
          if ( drob2 < rtol * rtol )
          {
+            if (r_norm2_pending)
+            {
+               hypre_MPI_Wait(&r_norm2_request, &r_norm2_status);
+               r_norm2_pending = 0;
+            }
             if (print_level > 1 && my_id == 0)
             {
                hypre_printf("\n\n||r_old-r_new||/||b||: %e\n", sqrt(drob2));
@@ -589,6 +756,11 @@ hypre_PCGSolve( void *pcg_vdata,
       /* gamma = <r,s> */
       gamma = (*(pcg_functions->InnerProd))(r, s);
 
+      if (r_norm2_pending)
+      {
+         hypre_MPI_Wait(&r_norm2_request, &r_norm2_status);
+      }
+
       /* residual-based stopping criteria: ||r_new-r_old||_C < rtol ||b||_C */
       if (rtol && !two_norm)
       {
@@ -605,7 +777,12 @@ hypre_PCGSolve( void *pcg_vdata,
       }
 
       /* set i_prod for convergence test */
-      if (two_norm)
+      if (r_norm2_pending)
+      {
+         i_prod = r_norm2;
+         r_norm2_pending = 0;
+      }
+      else if (two_norm)
       {
          i_prod = (*(pcg_functions->InnerProd))(r, r);
       }
@@ -669,17 +846,22 @@ hypre_PCGSolve( void *pcg_vdata,
             This calculation is coded on the assumption that r's accuracy is only a
             concern for problems where CG takes many iterations. */
       {
-         /* r = b - Ax */
-         (*(pcg_functions->CopyVector))(b, r);
-         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
-
-         /* set i_prod for convergence test */
-         if (two_norm)
+         /* r = b - Ax and set i_prod for convergence test */
+         if (use_residual_norm)
          {
+            (*(pcg_functions->ResidualNorm))(matvec_data, A, x, b, r, &i_prod, NULL);
+         }
+         else if (two_norm)
+         {
+            (*(pcg_functions->CopyVector))(b, r);
+            (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
             i_prod = (*(pcg_functions->InnerProd))(r, r);
          }
          else
          {
+            (*(pcg_functions->CopyVector))(b, r);
+            (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+
             /* s = C*r */
             (*(pcg_functions->ClearVector))(s);
             precond(precond_data, A, r, s);
@@ -1193,6 +1375,34 @@ hypre_PCGSetHybrid( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetPipelined, hypre_PCGGetPipelined
+ *
+ * Must be set before hypre_PCGSetup, which allocates the extra vectors.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetPipelined( void *pcg_vdata,
+                       HYPRE_Int   pipelined )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> pipelined) = pipelined;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetPipelined( void *pcg_vdata,
+                       HYPRE_Int * pipelined )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *pipelined = (pcg_data -> pipelined);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGGetNumIterations
  *--------------------------------------------------------------------------*/
@@ -63,6 +63,17 @@ typedef struct
    HYPRE_Int    (*ClearVector)   ( void *x );
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   /* optional: r = b - A*x and r_norm2 = <r,r> in one pass, see pcg.c */
+   HYPRE_Int    (*ResidualNorm)  ( void *matvec_data, void *A, void *x, void *b, void *r,
+                                   HYPRE_Real *r_norm2, hypre_MPI_Request *request );
+   /* optional: start the reduction of result[j] = <x[j],y[j]>, j < k, see pipelined_pcg.c */
+   HYPRE_Int    (*InnerProdStart)( HYPRE_Int k, void **x, void **y, HYPRE_Real *result,
+                                   hypre_MPI_Request *request );
+   /* optional: operations on multivectors, used by the block solver in block_krylov.c */
+   HYPRE_Int    (*NumVectors)     ( void *x );
+   HYPRE_Int    (*MultiInnerProd) ( HYPRE_Int k, void **x, void *y, HYPRE_Real *result );
+   HYPRE_Int    (*ColumnInnerProd)( void *x, void *y, HYPRE_Real *result );
+   HYPRE_Int    (*MultiAxpy)      ( HYPRE_Complex *alpha, void *x, HYPRE_Complex beta, void *y );
 
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
@@ -102,6 +113,12 @@ typedef struct
  every "recompute_residual_p" iterations.  This can be expensive and degrade the
  convergence. Use it only if you have seen a problem with the regular residual
  computation.
+ - pipelined!=0 means: use the pipelined (Ghysels-Vanroose) variant, with a single
+ non-blocking reduction per iteration overlapped with the preconditioner and matvec.
+ Here recompute_residual_p sets how often the recursive residual is checked against
+ b-Ax; if the gap is too large the solve continues with the classical recurrences.
+ - if the vectors have more than one column (NumVectors>1), the block variant is used
+ and the stopping test above is applied to each column separately.
 */
 
 typedef struct
@@ -119,12 +136,20 @@ typedef struct
    HYPRE_Int    stop_crit;
    HYPRE_Int    converged;
    HYPRE_Int    hybrid;
+   HYPRE_Int    pipelined;
 
    void    *A;
    void    *p;
    void    *s;
    void    *r; /* ...contains the residual.  This is currently kept permanently.
                   If that is ever changed, it still must be kept if logging>1 */
+   void    *u; /* u, w, m, n, z, q are only used by the pipelined variant;
+                  q is also used by the block variant */
+   void    *w;
+   void    *m;
+   void    *n;
+   void    *z;
+   void    *q;
 
    HYPRE_Int  owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void      *matvec_data;
@@ -0,0 +1,581 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Pipelined preconditioned conjugate gradient functions
+ *
+ *****************************************************************************/
+
+/* This is the communication-hiding CG of Ghysels and Vanroose ("Hiding global
+   synchronization latency in the preconditioned Conjugate Gradient algorithm",
+   Parallel Computing 40, 2014).  It shares hypre_PCGData and all parameters with
+   pcg.c.  The classical method needs two blocking reductions per iteration; here
+   all inner products of an iteration are combined into one non-blocking reduction
+   (InnerProdStart) that is overlapped with the preconditioner and the matvec.
+   The price is three extra recurrences (for A*u, C*A*u and A*C*A*u), which let
+   the recursive residual drift from b - A*x. Convergence is therefore always
+   confirmed with the true residual, and when the gap between the two grows too
+   large the solve continues with the classical recurrences of hypre_PCGSolve. */
+
+#include "krylov.h"
+#include "_hypre_utilities.h"
+
+/* the recursive residual is abandoned when ||b-Ax||^2 exceeds it by this factor */
+#define HYPRE_PIPELINED_PCG_GAP_FACTOR 4.0
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSolve
+ *--------------------------------------------------------------------------
+ *
+ * Uses the same convergence test as hypre_PCGSolve.  Iteration i computes
+ *
+ *       x = x + alpha*p,  r = r - alpha*s,  u = u - alpha*q,  w = w - alpha*z
+ *
+ * where u = C*r and w = A*u, then starts the reduction of <r,u>, <w,u> (and
+ * <r,r> with the 2-norm) and computes m = C*w and n = A*m while it is in
+ * flight.  The search directions follow from
+ *
+ *       p = u + beta*p,  s = w + beta*s,  q = m + beta*q,  z = n + beta*z
+ *
+ * so that s = A*p, q = C*s and z = A*q hold in exact arithmetic.
+ *
+ * Every recompute_residual_p iterations, and whenever the recursive residual
+ * passes the convergence test, r is recomputed as b - A*x. If the result
+ * differs too much from the recursive value the solve switches to
+ * hypre_PCGSolve for the remaining iterations; otherwise the pipeline is
+ * restarted from the true residual.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSolve( void *pcg_vdata,
+                         void *A,
+                         void *b,
+                         void *x         )
+{
+   hypre_PCGData  *pcg_data     =  (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Real      r_tol        = (pcg_data -> tol);
+   HYPRE_Real      a_tol        = (pcg_data -> a_tol);
+   HYPRE_Real      atolf        = (pcg_data -> atolf);
+   HYPRE_Real      cf_tol       = (pcg_data -> cf_tol);
+   HYPRE_Real      rtol         = (pcg_data -> rtol);
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       rel_change   = (pcg_data -> rel_change);
+   HYPRE_Int       recompute_residual_p = (pcg_data -> recompute_residual_p);
+   HYPRE_Int       stop_crit    = (pcg_data -> stop_crit);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   void           *p            = (pcg_data -> p);
+   void           *s            = (pcg_data -> s);
+   void           *r            = (pcg_data -> r);
+   void           *u            = (pcg_data -> u);
+   void           *w            = (pcg_data -> w);
+   void           *m            = (pcg_data -> m);
+   void           *n            = (pcg_data -> n);
+   void           *z            = (pcg_data -> z);
+   void           *q            = (pcg_data -> q);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*, void*, void*, void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+
+   HYPRE_Real      alpha = 0.0, beta;
+   HYPRE_Real      gamma = 0.0, gamma_old, delta, denom;
+   HYPRE_Real      bi_prod, eps;
+   HYPRE_Real      ieee_check = 0.;
+
+   HYPRE_Real      i_prod = 0.0;
+   HYPRE_Real      i_prod_0 = 0.0;
+   HYPRE_Real      true_i_prod;
+   HYPRE_Real      cf_ave_0 = 0.0;
+   HYPRE_Real      cf_ave_1 = 0.0;
+   HYPRE_Real      weight;
+   HYPRE_Real      ratio;
+
+   /* the inner products of one iteration, reduced together */
+   void           *dot_x[6], *dot_y[6];
+   HYPRE_Real      dots[6];
+   HYPRE_Int       num_dots;
+   HYPRE_Int       ss_idx = 0, pp_idx = 0, xx_idx = 0;
+   hypre_MPI_Request  dots_request;
+   hypre_MPI_Status   dots_status;
+
+   HYPRE_Int       tentatively_converged;
+   HYPRE_Int       check_true_residual;
+   HYPRE_Int       restart = 1;
+   HYPRE_Int       have_u  = 0;
+   HYPRE_Int       fallback = 0;
+   HYPRE_Int       i = 0;
+   HYPRE_Int       my_id, num_procs;
+
+   if (pcg_functions->InnerProdStart == NULL || u == NULL ||
+       (pcg_functions->NumVectors && (*(pcg_functions->NumVectors))(b) > 1))
+   {
+      /* no non-blocking reductions, no pipelined setup or several right-hand sides:
+         use the classical (or block) solver */
+      return hypre_PCGSolve(pcg_vdata, A, b, x);
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (pcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A, &my_id, &num_procs);
+
+   /*-----------------------------------------------------------------------
+    * Start pipelined pcg solve
+    *-----------------------------------------------------------------------*/
+
+   /* compute eps */
+   if (two_norm)
+   {
+      /* bi_prod = <b,b> */
+      bi_prod = (*(pcg_functions->InnerProd))(b, b);
+      if (print_level > 1 && my_id == 0)
+      {
+         hypre_printf("<b,b>: %e\n", bi_prod);
+      }
+   }
+   else
+   {
+      /* bi_prod = <C*b,b> */
+      (*(pcg_functions->ClearVector))(p);
+      precond(precond_data, A, b, p);
+      bi_prod = (*(pcg_functions->InnerProd))(p, b);
+      if (print_level > 1 && my_id == 0)
+      {
+         hypre_printf("<C*b,b>: %e\n", bi_prod);
+      }
+   };
+
+   if (bi_prod != 0.) { ieee_check = bi_prod / bi_prod; } /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      if (print_level > 0 || logging > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+         hypre_printf("ERROR -- hypre_PipelinedPCGSolve: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied b.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   eps = r_tol * r_tol; /* note: this may be re-assigned below */
+   if ( bi_prod > 0.0 )
+   {
+      if ( stop_crit && !rel_change && atolf <= 0 ) /* pure absolute tolerance */
+      {
+         eps = eps / bi_prod;
+      }
+      else if ( atolf > 0 ) /* mixed relative and absolute tolerance */
+      {
+         bi_prod += atolf;
+      }
+      else /* DEFAULT */
+      {
+         eps = hypre_max(r_tol * r_tol, a_tol * a_tol / bi_prod);
+      }
+   }
+   else    /* bi_prod==0.0: the rhs vector b is zero */
+   {
+      /* Set x equal to zero and return */
+      (*(pcg_functions->CopyVector))(b, x);
+      if (logging > 0 || print_level > 0)
+      {
+         norms[0]     = 0.0;
+         rel_norms[i] = 0.0;
+      }
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   };
+
+   /* r = b - Ax */
+   (*(pcg_functions->CopyVector))(b, r);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+
+   while (1)
+   {
+      if (restart)
+      {
+         /* u = C*r, w = A*u */
+         if (!have_u)
+         {
+            (*(pcg_functions->ClearVector))(u);
+            precond(precond_data, A, r, u);
+         }
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+         have_u = 0;
+      }
+
+      /*--------------------------------------------------------------------
+       * The single reduction of this iteration: gamma = <r,u>, delta = <w,u>
+       * and whatever the stopping tests need, overlapped with m = C*w and
+       * n = A*m.
+       *--------------------------------------------------------------------*/
+
+      num_dots = 0;
+      dot_x[num_dots] = r; dot_y[num_dots] = u; num_dots++;
+      dot_x[num_dots] = w; dot_y[num_dots] = u; num_dots++;
+      if (two_norm)
+      {
+         dot_x[num_dots] = r; dot_y[num_dots] = r; num_dots++;
+      }
+      if (!restart && rtol && two_norm)
+      {
+         ss_idx = num_dots;
+         dot_x[num_dots] = s; dot_y[num_dots] = s; num_dots++;
+      }
+      if (!restart && rel_change)
+      {
+         pp_idx = num_dots;
+         dot_x[num_dots] = p; dot_y[num_dots] = p; num_dots++;
+         xx_idx = num_dots;
+         dot_x[num_dots] = x; dot_y[num_dots] = x; num_dots++;
+      }
+      (*(pcg_functions->InnerProdStart))(num_dots, dot_x, dot_y, dots, &dots_request);
+
+      /* m = C*w */
+      (*(pcg_functions->ClearVector))(m);
+      precond(precond_data, A, w, m);
+
+      /* n = A*m */
+      (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+
+      hypre_MPI_Wait(&dots_request, &dots_status);
+
+      gamma_old = gamma;
+      gamma     = dots[0];
+      delta     = dots[1];
+      i_prod    = two_norm ? dots[2] : gamma;
+
+      if (i == 0)
+      {
+         if (gamma != 0.) { ieee_check = gamma / gamma; } /* INF -> NaN conversion */
+         if (ieee_check != ieee_check)
+         {
+            if (print_level > 0 || logging > 0)
+            {
+               hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+               hypre_printf("ERROR -- hypre_PipelinedPCGSolve: INFs and/or NaNs detected in input.\n");
+               hypre_printf("User probably placed non-numerics in supplied A or x_0.\n");
+               hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+               hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+            }
+            hypre_error(HYPRE_ERROR_GENERIC);
+            HYPRE_ANNOTATE_FUNC_END;
+
+            return hypre_error_flag;
+         }
+
+         /* Set initial residual norm */
+         i_prod_0 = i_prod;
+         if ( logging > 0 || print_level > 0 ) { norms[0] = sqrt(i_prod_0); }
+
+         if ( print_level > 1 && my_id == 0 )
+         {
+            hypre_printf("\n\n");
+            if (two_norm)
+            {
+               if ( stop_crit && !rel_change && atolf == 0 ) /* pure absolute tolerance */
+               {
+                  hypre_printf("Iters       ||r||_2     conv.rate\n");
+                  hypre_printf("-----    ------------   ---------\n");
+               }
+               else
+               {
+                  hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+                  hypre_printf("-----    ------------   ---------  ------------ \n");
+               }
+            }
+            else  /* !two_norm */
+            {
+               hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+               hypre_printf("-----    ------------    ---------  ------------ \n");
+            }
+         }
+      }
+      else if (!restart)
+      {
+         /* residual-based stopping criteria: ||r_new-r_old|| < rtol ||b|| */
+         if (rtol && two_norm)
+         {
+            /* use that r_new-r_old = alpha * s */
+            HYPRE_Real drob2 = alpha * alpha * dots[ss_idx] / bi_prod;
+            if ( drob2 < rtol * rtol )
+            {
+               if (print_level > 1 && my_id == 0)
+               {
+                  hypre_printf("\n\n||r_old-r_new||/||b||: %e\n", sqrt(drob2));
+               }
+               break;
+            }
+         }
+         else if (rtol)
+         {
+            /* use that ||r_new-r_old||_C^2 = (r_new ,C r_new) + (r_old, C r_old) */
+            HYPRE_Real r2ob2 = (gamma + gamma_old) / bi_prod;
+            if ( r2ob2 < rtol * rtol)
+            {
+               if (print_level > 1 && my_id == 0)
+               {
+                  hypre_printf("\n\n||r_old-r_new||_C/||b||_C: %e\n", sqrt(r2ob2));
+               }
+               break;
+            }
+         }
+
+         /*-----------------------------------------------------------------
+          * Residual check: compare the recursive residual with b - A*x
+          *-----------------------------------------------------------------*/
+
+         tentatively_converged = (i_prod / bi_prod < eps);
+         check_true_residual   = tentatively_converged ||
+                                 (recompute_residual_p && !(i % recompute_residual_p));
+         if (check_true_residual)
+         {
+            if (two_norm && pcg_functions->ResidualNorm)
+            {
+               (*(pcg_functions->ResidualNorm))(matvec_data, A, x, b, r, &true_i_prod, NULL);
+            }
+            else
+            {
+               (*(pcg_functions->CopyVector))(b, r);
+               (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+               if (two_norm)
+               {
+                  true_i_prod = (*(pcg_functions->InnerProd))(r, r);
+               }
+               else
+               {
+                  /* u = C*r is reused if the pipeline is restarted */
+                  (*(pcg_functions->ClearVector))(u);
+                  precond(precond_data, A, r, u);
+                  true_i_prod = (*(pcg_functions->InnerProd))(r, u);
+                  have_u = 1;
+               }
+            }
+
+            if (true_i_prod / bi_prod < eps)
+            {
+               tentatively_converged = 1;
+            }
+            else
+            {
+               tentatively_converged = 0;
+               if (true_i_prod > HYPRE_PIPELINED_PCG_GAP_FACTOR * i_prod)
+               {
+                  fallback = 1;
+               }
+            }
+            i_prod  = true_i_prod;
+            restart = 1;
+         }
+
+         /* print norm info */
+         if ( logging > 0 || print_level > 0 )
+         {
+            norms[i]     = sqrt(i_prod);
+            rel_norms[i] = bi_prod ? sqrt(i_prod / bi_prod) : 0;
+         }
+         if ( print_level > 1 && my_id == 0 )
+         {
+            if (two_norm && stop_crit && !rel_change && atolf == 0)  /* pure absolute tolerance */
+            {
+               hypre_printf("% 5d    %e    %f\n", i, norms[i],
+                            norms[i] / norms[i - 1] );
+            }
+            else
+            {
+               hypre_printf("% 5d    %e    %f    %e\n", i, norms[i],
+                            norms[i] / norms[i - 1], rel_norms[i] );
+            }
+         }
+
+         if (fallback)
+         {
+            break;
+         }
+
+         /*-----------------------------------------------------------------
+          * check for convergence
+          *-----------------------------------------------------------------*/
+
+         if ( tentatively_converged && rel_change && (i_prod > 0.0) )
+            /* At user request, don't treat this as converged unless x didn't change
+               much in the last iteration. */
+         {
+            ratio = alpha * alpha * dots[pp_idx] / dots[xx_idx];
+            if (ratio >= eps) { tentatively_converged = 0; }
+         }
+         if ( tentatively_converged )
+            /* we've passed all the convergence tests, it's for real */
+         {
+            (pcg_data -> converged) = 1;
+            break;
+         }
+
+         if (! (gamma > HYPRE_REAL_MIN) )
+         {
+            hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal gamma value in pipelined PCG");
+
+            break;
+         }
+
+         /* Optional test to see if adequate progress is being made, see pcg.c */
+         if (cf_tol > 0.0)
+         {
+            cf_ave_0 = cf_ave_1;
+            if (! (i_prod_0 > HYPRE_REAL_MIN) )
+            {
+               hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal i_prod value in pipelined PCG");
+
+               break;
+            }
+            cf_ave_1 = pow( i_prod / i_prod_0, 1.0 / (2.0 * i) );
+
+            weight   = fabs(cf_ave_1 - cf_ave_0);
+            weight   = weight / hypre_max(cf_ave_1, cf_ave_0);
+            weight   = 1.0 - weight;
+            if (weight * cf_ave_1 > cf_tol) { break; }
+         }
+
+         if (restart)
+         {
+            /* r was replaced by b - A*x: rebuild u, w and the reductions */
+            if (print_level > 1 && my_id == 0)
+            {
+               hypre_printf("Restarting the pipeline from the true residual...\n");
+            }
+            continue;
+         }
+      }
+
+      if (i >= max_iter)
+      {
+         break;
+      }
+
+      /*--------------------------------------------------------------------
+       * the core pipelined CG calculations...
+       *--------------------------------------------------------------------*/
+
+      i++;
+
+      /* alpha = gamma / <A*p,p>, where <A*p,p> = delta - beta*gamma/alpha_old */
+      if (restart)
+      {
+         beta  = 0.0;
+         denom = delta;
+      }
+      else
+      {
+         beta  = gamma / gamma_old;
+         denom = delta - beta * gamma / alpha;
+      }
+      if (! (denom > 0.0) || ! (gamma / denom > HYPRE_REAL_MIN) )
+      {
+         /* the recurrences broke down: let the classical method take over */
+         i--;
+         fallback = 1;
+         break;
+      }
+      alpha = gamma / denom;
+
+      /* z = n + beta*z, q = m + beta*q, s = w + beta*s, p = u + beta*p */
+      if (restart)
+      {
+         (*(pcg_functions->CopyVector))(n, z);
+         (*(pcg_functions->CopyVector))(m, q);
+         (*(pcg_functions->CopyVector))(w, s);
+         (*(pcg_functions->CopyVector))(u, p);
+      }
+      else
+      {
+         (*(pcg_functions->ScaleVector))(beta, z);
+         (*(pcg_functions->Axpy))(1.0, n, z);
+         (*(pcg_functions->ScaleVector))(beta, q);
+         (*(pcg_functions->Axpy))(1.0, m, q);
+         (*(pcg_functions->ScaleVector))(beta, s);
+         (*(pcg_functions->Axpy))(1.0, w, s);
+         (*(pcg_functions->ScaleVector))(beta, p);
+         (*(pcg_functions->Axpy))(1.0, u, p);
+      }
+
+      /* x = x + alpha*p, r = r - alpha*s, u = u - alpha*q, w = w - alpha*z */
+      (*(pcg_functions->Axpy))(alpha, p, x);
+      (*(pcg_functions->Axpy))(-alpha, s, r);
+      (*(pcg_functions->Axpy))(-alpha, q, u);
+      (*(pcg_functions->Axpy))(-alpha, z, w);
+
+      restart = 0;
+   }
+
+   /*--------------------------------------------------------------------
+    * Switch to the classical recurrences for the remaining iterations
+    *--------------------------------------------------------------------*/
+
+   if (fallback && i < max_iter)
+   {
+      HYPRE_Int num_pipelined = i;
+
+      if (print_level > 1 && my_id == 0)
+      {
+         hypre_printf("Switching from pipelined to classical PCG after %d iterations\n",
+                      num_pipelined);
+      }
+
+      (pcg_data -> max_iter) = max_iter - num_pipelined;
+      if (norms)
+      {
+         (pcg_data -> norms)     = norms + num_pipelined;
+         (pcg_data -> rel_norms) = rel_norms + num_pipelined;
+      }
+
+      hypre_PCGSolve(pcg_vdata, A, b, x);
+
+      (pcg_data -> max_iter)        = max_iter;
+      (pcg_data -> norms)           = norms;
+      (pcg_data -> rel_norms)       = rel_norms;
+      (pcg_data -> num_iterations) += num_pipelined;
+
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   /*--------------------------------------------------------------------
+    * Finish up with some outputs.
+    *--------------------------------------------------------------------*/
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+   }
+
+   if (i >= max_iter && (i_prod / bi_prod) >= eps && eps > 0 && hybrid != -1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_CONV, "Reached max iterations in PCG before convergence");
+   }
+
+   (pcg_data -> num_iterations) = i;
+   (pcg_data -> rel_residual_norm) = sqrt(i_prod / bi_prod);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
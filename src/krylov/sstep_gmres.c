@@ -0,0 +1,878 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * s-step (communication-avoiding) COGMRES
+ *
+ *****************************************************************************/
+
+/* This is the s-step variant of hypre_COGMRESSolve (see Hoemmen, "Communication-
+   avoiding Krylov subspace methods", PhD thesis, UC Berkeley, 2010).  It shares
+   hypre_COGMRESData and all parameters with cogmres.c.  Instead of one Arnoldi
+   step at a time, s basis vectors
+
+      v_{k+1} = ((A M^{-1} - theta_k) v_k - gamma_k v_{k-1}) / sigma_k
+
+   are generated from the last orthonormal vector q_j with s preconditioned
+   matvecs and no communication.  The block is then orthogonalized against
+   q_0..q_j and within itself by block classical Gram-Schmidt with a Pythagorean
+   Cholesky QR, which needs the single block of inner products
+   [q_0..q_j, V]^T V, i.e. one global reduction.  A second pass is made when
+   cgs > 1 or when the Cholesky factor indicates loss of orthogonality.  The
+   Hessenberg matrix of the Arnoldi relation is recovered from the
+   three-term change-of-basis matrix of the recurrence and the accumulated
+   triangular factors, after which the Givens rotations, residual norm
+   estimates and stopping tests are exactly those of COGMRES.
+
+   The shifts come from an estimate of the spectral interval of A M^{-1}
+   (eigenvalues of the symmetric part of the Hessenberg matrix), which is
+   computed from the first restart cycle; that cycle therefore runs with s = 1.
+   The relative change stopping criterion is not supported here. */
+
+#include "krylov.h"
+#include "_hypre_utilities.h"
+
+/* a second orthogonalization pass is made when a squared diagonal entry of
+   the Cholesky factor drops below this fraction of the squared column norm */
+#define HYPRE_SSTEP_GMRES_REORTH_TOL 1.0e-2
+/* a basis vector whose orthogonal part is below this fraction (squared) of its
+   norm is considered linearly dependent and the block is truncated there */
+#define HYPRE_SSTEP_GMRES_RANK_TOL   1.0e-20
+/* relative padding of the estimated spectral interval */
+#define HYPRE_SSTEP_GMRES_PAD        0.1
+#define HYPRE_SSTEP_GMRES_PI         3.14159265358979323846
+
+/*--------------------------------------------------------------------------
+ * hypre_SStepGMRESSpectralInterval
+ *
+ * Smallest and largest eigenvalue of the symmetric part of the leading n x n
+ * block of the Hessenberg matrix hh (column-major, leading dimension ldh),
+ * computed with cyclic Jacobi rotations. S is n*n workspace.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_SStepGMRESSpectralInterval( HYPRE_Int   n,
+                                  HYPRE_Real *hh,
+                                  HYPRE_Int   ldh,
+                                  HYPRE_Real *S,
+                                  HYPRE_Real *lmin,
+                                  HYPRE_Real *lmax )
+{
+   HYPRE_Int  i, k, ip, iq, sweep;
+   HYPRE_Real off, diag, theta, t, c, s, spk, sqk;
+
+   for (i = 0; i < n; i++)
+   {
+      for (k = 0; k < n; k++)
+      {
+         S[k * n + i] = 0.5 * (hh[k * ldh + i] + hh[i * ldh + k]);
+      }
+   }
+
+   for (sweep = 0; sweep < 50; sweep++)
+   {
+      off = diag = 0.0;
+      for (iq = 0; iq < n; iq++)
+      {
+         diag += S[iq * n + iq] * S[iq * n + iq];
+         for (ip = 0; ip < iq; ip++)
+         {
+            off += S[iq * n + ip] * S[iq * n + ip];
+         }
+      }
+      if (off <= 1.0e-24 * diag)
+      {
+         break;
+      }
+
+      for (iq = 1; iq < n; iq++)
+      {
+         for (ip = 0; ip < iq; ip++)
+         {
+            if (S[iq * n + ip] == 0.0)
+            {
+               continue;
+            }
+            theta = (S[iq * n + iq] - S[ip * n + ip]) / (2.0 * S[iq * n + ip]);
+            t = 1.0 / (fabs(theta) + sqrt(theta * theta + 1.0));
+            if (theta < 0.0)
+            {
+               t = -t;
+            }
+            c = 1.0 / sqrt(t * t + 1.0);
+            s = t * c;
+
+            S[ip * n + ip] -= t * S[iq * n + ip];
+            S[iq * n + iq] += t * S[iq * n + ip];
+            S[iq * n + ip] = S[ip * n + iq] = 0.0;
+            for (k = 0; k < n; k++)
+            {
+               if (k == ip || k == iq)
+               {
+                  continue;
+               }
+               spk = S[ip * n + k];
+               sqk = S[iq * n + k];
+               S[ip * n + k] = S[k * n + ip] = c * spk - s * sqk;
+               S[iq * n + k] = S[k * n + iq] = s * spk + c * sqk;
+            }
+         }
+      }
+   }
+
+   *lmin = *lmax = S[0];
+   for (i = 1; i < n; i++)
+   {
+      *lmin = hypre_min(*lmin, S[i * n + i]);
+      *lmax = hypre_max(*lmax, S[i * n + i]);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SStepGMRESBasisCoefficients
+ *
+ * Coefficients of the recurrence A M^{-1} v_k = sigma_k v_{k+1} + theta_k v_k
+ * + gamma_k v_{k-1}, k < s, for the interval [lmin, lmax]. basis = 0 gives the
+ * Newton basis with the Chebyshev points of the interval in Leja order as
+ * shifts, basis = 1 the Chebyshev polynomials of the interval.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_SStepGMRESBasisCoefficients( HYPRE_Int   s,
+                                   HYPRE_Int   basis,
+                                   HYPRE_Real  lmin,
+                                   HYPRE_Real  lmax,
+                                   HYPRE_Real *theta,
+                                   HYPRE_Real *sigma,
+                                   HYPRE_Real *gamma )
+{
+   HYPRE_Int  k, l, m, kbest;
+   HYPRE_Real cen, hw, prod, best, tmp;
+
+   hw  = lmax - lmin;
+   if (hw > 0.0)
+   {
+      lmin -= HYPRE_SSTEP_GMRES_PAD * hw;
+      lmax += HYPRE_SSTEP_GMRES_PAD * hw;
+   }
+   else
+   {
+      hw = (lmin != 0.0) ? HYPRE_SSTEP_GMRES_PAD * fabs(lmin) : 1.0;
+      lmin -= hw;
+      lmax += hw;
+   }
+   cen = 0.5 * (lmax + lmin);
+   hw  = 0.5 * (lmax - lmin);
+
+   if (basis == 1)
+   {
+      for (k = 0; k < s; k++)
+      {
+         theta[k] = cen;
+         sigma[k] = (k == 0) ? hw : 0.5 * hw;
+         gamma[k] = (k == 0) ? 0.0 : 0.5 * hw;
+      }
+      return;
+   }
+
+   for (k = 0; k < s; k++)
+   {
+      theta[k] = cen + hw * cos((2 * k + 1) * HYPRE_SSTEP_GMRES_PI / (2 * s));
+      sigma[k] = hw;
+      gamma[k] = 0.0;
+   }
+
+   /* Leja ordering: start with the point of largest modulus, then repeatedly
+      take the point maximizing the product of distances to those chosen */
+   for (k = 0; k < s; k++)
+   {
+      kbest = k;
+      best  = -1.0;
+      for (l = k; l < s; l++)
+      {
+         if (k == 0)
+         {
+            prod = fabs(theta[l]);
+         }
+         else
+         {
+            prod = 1.0;
+            for (m = 0; m < k; m++)
+            {
+               prod *= fabs(theta[l] - theta[m]) / hw;
+            }
+         }
+         if (prod > best)
+         {
+            best  = prod;
+            kbest = l;
+         }
+      }
+      tmp = theta[k];
+      theta[k] = theta[kbest];
+      theta[kbest] = tmp;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSStepSolve
+ *-------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSStepSolve(void  *cogmres_vdata,
+                        void  *A,
+                        void  *b,
+                        void  *x)
+{
+   hypre_COGMRESData      *cogmres_data      = (hypre_COGMRESData *)cogmres_vdata;
+   hypre_COGMRESFunctions *cogmres_functions = cogmres_data->functions;
+   HYPRE_Int     k_dim             = (cogmres_data -> k_dim);
+   HYPRE_Int     unroll            = (cogmres_data -> unroll);
+   HYPRE_Int     cgs               = (cogmres_data -> cgs);
+   HYPRE_Int     s_step            = (cogmres_data -> s_step);
+   HYPRE_Int     s_step_basis      = (cogmres_data -> s_step_basis);
+   HYPRE_Int     min_iter          = (cogmres_data -> min_iter);
+   HYPRE_Int     max_iter          = (cogmres_data -> max_iter);
+   HYPRE_Int     skip_real_r_check = (cogmres_data -> skip_real_r_check);
+   HYPRE_Real    r_tol             = (cogmres_data -> tol);
+   HYPRE_Real    cf_tol            = (cogmres_data -> cf_tol);
+   HYPRE_Real    a_tol             = (cogmres_data -> a_tol);
+   void         *matvec_data       = (cogmres_data -> matvec_data);
+
+   void         *r                 = (cogmres_data -> r);
+   void         *w                 = (cogmres_data -> w);
+   void        **p                 = (cogmres_data -> p);
+
+   HYPRE_Int (*precond)(void*, void*, void*, void*) = (cogmres_functions -> precond);
+   HYPRE_Int  *precond_data       = (HYPRE_Int*)(cogmres_data -> precond_data);
+
+   HYPRE_Int print_level = (cogmres_data -> print_level);
+   HYPRE_Int logging     = (cogmres_data -> logging);
+
+   HYPRE_Real     *norms          = (cogmres_data -> norms);
+
+   HYPRE_Int   ldh = k_dim + 1;
+   HYPRE_Int   s, sb, nq, kx, ncol, nvalid, pass, reorth;
+   HYPRE_Int   break_value = 0, breakdown, done, have_shifts = 0;
+   HYPRE_Int   i, j, k, l, jj;
+   HYPRE_Int   iter;
+   HYPRE_Int   my_id, num_procs;
+
+   /* Hessenberg matrix (hh) and its rotated copy (hr), both column-major */
+   HYPRE_Real *hh, *hr, *rs, *cs, *sn;
+   /* recurrence coefficients of the polynomial basis */
+   HYPRE_Real *theta, *sigma, *gam;
+   /* block inner products and orthogonalization factors */
+   HYPRE_Real *gram, *ctot, *rtot, *rp, *gorig, *alpha, *zz, *work;
+
+   HYPRE_Real epsilon, gamma, t, diag, r_norm, b_norm, den_norm;
+   HYPRE_Real lmin, lmax;
+   HYPRE_Real epsmac = 1.e-16;
+   HYPRE_Real ieee_check = 0.;
+   HYPRE_Real cf_ave_0 = 0.0;
+   HYPRE_Real cf_ave_1 = 0.0;
+   HYPRE_Real weight;
+   HYPRE_Real r_norm_0;
+   HYPRE_Real real_r_norm_old, real_r_norm_new;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (cogmres_data -> converged) = 0;
+   s = hypre_min(s_step, k_dim);
+
+   (*(cogmres_functions->CommInfo))(A, &my_id, &num_procs);
+   if ( logging > 0 || print_level > 0 )
+   {
+      norms = (cogmres_data -> norms);
+   }
+
+   /* initialize work arrays */
+   hh    = hypre_CTAllocF(HYPRE_Real, ldh * k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   hr    = hypre_CTAllocF(HYPRE_Real, ldh * k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   rs    = hypre_CTAllocF(HYPRE_Real, ldh, cogmres_functions, HYPRE_MEMORY_HOST);
+   cs    = hypre_CTAllocF(HYPRE_Real, k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   sn    = hypre_CTAllocF(HYPRE_Real, k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   theta = hypre_CTAllocF(HYPRE_Real, s, cogmres_functions, HYPRE_MEMORY_HOST);
+   sigma = hypre_CTAllocF(HYPRE_Real, s, cogmres_functions, HYPRE_MEMORY_HOST);
+   gam   = hypre_CTAllocF(HYPRE_Real, s, cogmres_functions, HYPRE_MEMORY_HOST);
+   gram  = hypre_CTAllocF(HYPRE_Real, (ldh + s) * s, cogmres_functions, HYPRE_MEMORY_HOST);
+   ctot  = hypre_CTAllocF(HYPRE_Real, ldh * s, cogmres_functions, HYPRE_MEMORY_HOST);
+   rtot  = hypre_CTAllocF(HYPRE_Real, s * s, cogmres_functions, HYPRE_MEMORY_HOST);
+   rp    = hypre_CTAllocF(HYPRE_Real, s * s, cogmres_functions, HYPRE_MEMORY_HOST);
+   gorig = hypre_CTAllocF(HYPRE_Real, s, cogmres_functions, HYPRE_MEMORY_HOST);
+   alpha = hypre_CTAllocF(HYPRE_Real, ldh, cogmres_functions, HYPRE_MEMORY_HOST);
+   zz    = hypre_CTAllocF(HYPRE_Real, ldh * (s + 1), cogmres_functions, HYPRE_MEMORY_HOST);
+   work  = hypre_CTAllocF(HYPRE_Real, k_dim * k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+
+   /* until the spectrum has been estimated, generate plain Arnoldi vectors */
+   theta[0] = 0.0;
+   sigma[0] = 1.0;
+   gam[0]   = 0.0;
+
+   (*(cogmres_functions->CopyVector))(b, p[0]);
+
+   /* compute initial residual */
+   (*(cogmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, p[0]);
+
+   b_norm = sqrt((*(cogmres_functions->InnerProd))(b, b));
+   real_r_norm_old = b_norm;
+
+   /* Since it is does not diminish performance, attempt to return an error flag
+      and notify users when they supply bad input. */
+   if (b_norm != 0.) { ieee_check = b_norm / b_norm; } /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      if (logging > 0 || print_level > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+         hypre_printf("ERROR -- hypre_COGMRESSStepSolve: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied b.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      break_value = 1;
+   }
+
+   r_norm   = sqrt((*(cogmres_functions->InnerProd))(p[0], p[0]));
+   r_norm_0 = r_norm;
+
+   if (r_norm != 0.) { ieee_check = r_norm / r_norm; } /* INF -> NaN conversion */
+   if (!break_value && ieee_check != ieee_check)
+   {
+      if (logging > 0 || print_level > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+         hypre_printf("ERROR -- hypre_COGMRESSStepSolve: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied A or x_0.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      break_value = 1;
+   }
+
+   if ( !break_value && (logging > 0 || print_level > 0) )
+   {
+      norms[0] = r_norm;
+      if ( print_level > 1 && my_id == 0 )
+      {
+         hypre_printf("L2 norm of b: %e\n", b_norm);
+         if (b_norm == 0.0)
+         {
+            hypre_printf("Rel_resid_norm actually contains the residual norm\n");
+         }
+         hypre_printf("Initial L2 norm of residual: %e\n", r_norm);
+      }
+   }
+   iter = 0;
+
+   if (b_norm > 0.0)
+   {
+      /* convergence criterion |r_i|/|b| <= accuracy if |b| > 0 */
+      den_norm = b_norm;
+   }
+   else
+   {
+      /* convergence criterion |r_i|/|r0| <= accuracy if |b| = 0 */
+      den_norm = r_norm;
+   }
+
+   epsilon = hypre_max(a_tol, r_tol * den_norm);
+
+   if ( !break_value && print_level > 1 && my_id == 0 )
+   {
+      if (b_norm > 0.0)
+      {
+         hypre_printf("=============================================\n\n");
+         hypre_printf("Iters     resid.norm     conv.rate  rel.res.norm\n");
+         hypre_printf("-----    ------------    ---------- ------------\n");
+      }
+      else
+      {
+         hypre_printf("=============================================\n\n");
+         hypre_printf("Iters     resid.norm     conv.rate\n");
+         hypre_printf("-----    ------------    ----------\n");
+      }
+   }
+
+   while (!break_value && iter < max_iter)
+   {
+      if (r_norm == 0.0 || (r_norm <= epsilon && iter >= min_iter))
+      {
+         (cogmres_data -> converged) = 1;
+         if ( print_level > 1 && my_id == 0 )
+         {
+            hypre_printf("\n\n");
+            hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+         }
+         break;
+      }
+
+      /* initialize first term of hessenberg system */
+      for (k = 1; k < ldh; k++)
+      {
+         rs[k] = 0.0;
+      }
+      rs[0] = r_norm;
+      (*(cogmres_functions->ScaleVector))(1.0 / r_norm, p[0]);
+
+      j = 0;
+      done = 0;
+      breakdown = 0;
+
+      /***RESTART CYCLE (right-preconditioning) ***/
+      while (!done && !breakdown && j < k_dim && iter < max_iter)
+      {
+         sb = have_shifts ? s : 1;
+         sb = hypre_min(sb, k_dim - j);
+         sb = hypre_min(sb, max_iter - iter);
+         nq = j + 1;
+         kx = nq + sb;
+
+         /* generate the block basis v_1..v_sb from v_0 = q_j (no communication) */
+         for (k = 0; k < sb; k++)
+         {
+            (*(cogmres_functions->ClearVector))(r);
+            precond(precond_data, A, p[j + k], r);
+            (*(cogmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[j + k + 1]);
+            if (theta[k] != 0.0)
+            {
+               (*(cogmres_functions->Axpy))(-theta[k], p[j + k], p[j + k + 1]);
+            }
+            if (k > 0 && gam[k] != 0.0)
+            {
+               (*(cogmres_functions->Axpy))(-gam[k], p[j + k - 1], p[j + k + 1]);
+            }
+            if (sigma[k] != 1.0)
+            {
+               (*(cogmres_functions->ScaleVector))(1.0 / sigma[k], p[j + k + 1]);
+            }
+         }
+
+         /* orthogonalize: V = Q ctot + Q_new rtot, with one reduction per pass */
+         for (k = 0; k < sb; k++)
+         {
+            for (i = 0; i < nq; i++)
+            {
+               ctot[k * ldh + i] = 0.0;
+            }
+            for (i = 0; i < sb; i++)
+            {
+               rtot[k * s + i] = (i == k) ? 1.0 : 0.0;
+            }
+         }
+         nvalid = sb;
+         reorth = (cgs > 1);
+         for (pass = 0; pass < 2; pass++)
+         {
+            if (cogmres_functions->BlockInnerProd)
+            {
+               (*(cogmres_functions->BlockInnerProd))(p, kx, &p[nq], sb, unroll, gram);
+            }
+            else
+            {
+               for (k = 0; k < sb; k++)
+               {
+                  (*(cogmres_functions->MassInnerProd))(p[nq + k], p, kx, unroll, &gram[k * kx]);
+               }
+            }
+
+            /* project out q_0..q_j */
+            for (k = 0; k < sb; k++)
+            {
+               for (i = 0; i < nq; i++)
+               {
+                  alpha[i] = -gram[k * kx + i];
+               }
+               (*(cogmres_functions->MassAxpy))(alpha, p, p[nq + k], nq, unroll);
+            }
+
+            /* Cholesky factor of G - C^T C, column by column */
+            for (k = 0; pass == 0 && k < sb; k++)
+            {
+               gorig[k] = gram[k * kx + nq + k];
+            }
+            for (k = 0; k < sb; k++)
+            {
+               diag = 0.0;
+               for (i = 0; i <= k; i++)
+               {
+                  t = gram[k * kx + nq + i];
+                  for (l = 0; l < nq; l++)
+                  {
+                     t -= gram[i * kx + l] * gram[k * kx + l];
+                  }
+                  for (l = 0; l < i; l++)
+                  {
+                     t -= rp[i * s + l] * rp[k * s + l];
+                  }
+                  if (i < k)
+                  {
+                     rp[k * s + i] = t / rp[i * s + i];
+                  }
+                  else
+                  {
+                     diag = t;
+                  }
+               }
+               if (pass == 0)
+               {
+                  if (!(diag > 0.0))
+                  {
+                     /* not usable: skip the normalization and reorthogonalize */
+                     reorth = 1;
+                     nvalid = 0;
+                     break;
+                  }
+                  if (diag < HYPRE_SSTEP_GMRES_REORTH_TOL * gram[k * kx + nq + k])
+                  {
+                     reorth = 1;
+                  }
+               }
+               else if (!(diag * rtot[k * s + k] * rtot[k * s + k] >
+                          HYPRE_SSTEP_GMRES_RANK_TOL * gorig[k]))
+               {
+                  rp[k * s + k] = 0.0;
+                  nvalid = k;
+                  break;
+               }
+               rp[k * s + k] = sqrt(diag);
+            }
+
+            if (pass == 0 && nvalid == 0)
+            {
+               /* ctot = C, rtot = I */
+               for (k = 0; k < sb; k++)
+               {
+                  for (i = 0; i < nq; i++)
+                  {
+                     ctot[k * ldh + i] = gram[k * kx + i];
+                  }
+               }
+               nvalid = sb;
+               continue;
+            }
+
+            /* Q_new = (V - Q C) R^{-1} for the valid columns */
+            for (k = 0; k < nvalid; k++)
+            {
+               if (k > 0)
+               {
+                  for (i = 0; i < k; i++)
+                  {
+                     alpha[i] = -rp[k * s + i];
+                  }
+                  (*(cogmres_functions->MassAxpy))(alpha, &p[nq], p[nq + k], k, unroll);
+               }
+               (*(cogmres_functions->ScaleVector))(1.0 / rp[k * s + k], p[nq + k]);
+            }
+
+            /* ctot += C rtot, rtot = R rtot (for the failed column as well) */
+            ncol = hypre_min(nvalid + 1, sb);
+            for (k = ncol - 1; k >= 0; k--)
+            {
+               for (i = 0; i < nq; i++)
+               {
+                  t = 0.0;
+                  for (l = 0; l <= k; l++)
+                  {
+                     t += gram[l * kx + i] * rtot[k * s + l];
+                  }
+                  ctot[k * ldh + i] += t;
+               }
+               for (i = 0; i <= k; i++)
+               {
+                  t = 0.0;
+                  for (l = i; l <= k; l++)
+                  {
+                     t += rp[l * s + i] * rtot[k * s + l];
+                  }
+                  work[i] = t;
+               }
+               for (i = 0; i <= k; i++)
+               {
+                  rtot[k * s + i] = work[i];
+               }
+            }
+
+            if (!reorth || nvalid < sb)
+            {
+               break;
+            }
+            reorth = 0;
+         }
+
+         /* nvalid = 0 means A M^{-1} q_j lies in span(q_0..q_j): breakdown */
+         if (nvalid == 0)
+         {
+            breakdown = 1;
+            ncol = 1;
+         }
+         else
+         {
+            ncol = nvalid;
+         }
+
+         /* zz = [e_j, coordinates of v_1..v_ncol in q_0..q_{j+ncol}] */
+         for (k = 0; k <= ncol; k++)
+         {
+            for (i = 0; i <= j + ncol; i++)
+            {
+               zz[k * ldh + i] = 0.0;
+            }
+         }
+         zz[j] = 1.0;
+         for (k = 1; k <= ncol; k++)
+         {
+            for (i = 0; i < nq; i++)
+            {
+               zz[k * ldh + i] = ctot[(k - 1) * ldh + i];
+            }
+            for (i = 0; i < k; i++)
+            {
+               zz[k * ldh + nq + i] = rtot[(k - 1) * s + i];
+            }
+         }
+
+         /* H(:,j:j+ncol-1) = (zz B - H(:,0:j-1) zz(0:j-1,:)) zz(j:j+ncol-1,:)^{-1} */
+         for (k = 0; k < ncol; k++)
+         {
+            HYPRE_Real *hk = &hh[(j + k) * ldh];
+
+            for (i = 0; i <= j + ncol; i++)
+            {
+               t = sigma[k] * zz[(k + 1) * ldh + i] + theta[k] * zz[k * ldh + i];
+               if (k > 0)
+               {
+                  t += gam[k] * zz[(k - 1) * ldh + i];
+               }
+               hk[i] = t;
+            }
+            for (l = 0; l < j; l++)
+            {
+               t = zz[k * ldh + l];
+               if (t != 0.0)
+               {
+                  for (i = 0; i <= l + 1; i++)
+                  {
+                     hk[i] -= t * hh[l * ldh + i];
+                  }
+               }
+            }
+            for (l = 0; l < k; l++)
+            {
+               t = zz[k * ldh + j + l];
+               for (i = 0; i <= j + ncol; i++)
+               {
+                  hk[i] -= t * hh[(j + l) * ldh + i];
+               }
+            }
+            t = 1.0 / zz[k * ldh + j + k];
+            for (i = 0; i <= j + k + 1; i++)
+            {
+               hk[i] *= t;
+            }
+            for (i = j + k + 2; i < ldh; i++)
+            {
+               hk[i] = 0.0;
+            }
+         }
+
+         /* Givens rotations and residual norm estimates, one column at a time */
+         for (k = 0; k < ncol; k++)
+         {
+            HYPRE_Real *hk;
+
+            jj = j + k;
+            hk = &hr[jj * ldh];
+            for (i = 0; i <= jj + 1; i++)
+            {
+               hk[i] = hh[jj * ldh + i];
+            }
+            for (l = 0; l < jj; l++)
+            {
+               t = hk[l];
+               hk[l]     =  cs[l] * t + sn[l] * hk[l + 1];
+               hk[l + 1] = -sn[l] * t + cs[l] * hk[l + 1];
+            }
+            t = hk[jj + 1] * hk[jj + 1];
+            t += hk[jj] * hk[jj];
+            gamma = sqrt(t);
+            if (gamma == 0.0) { gamma = epsmac; }
+            cs[jj] = hk[jj] / gamma;
+            sn[jj] = hk[jj + 1] / gamma;
+            rs[jj + 1] = -hk[jj + 1] * rs[jj];
+            rs[jj + 1] /= gamma;
+            rs[jj] = cs[jj] * rs[jj];
+            hk[jj] = sn[jj] * hk[jj + 1] + cs[jj] * hk[jj];
+            hk[jj + 1] = 0.0;
+
+            iter++;
+            r_norm = fabs(rs[jj + 1]);
+            if ( print_level > 0 )
+            {
+               norms[iter] = r_norm;
+               if ( print_level > 1 && my_id == 0 )
+               {
+                  if (b_norm > 0.0)
+                     hypre_printf("% 5d    %e    %f   %e\n", iter,
+                                  norms[iter], norms[iter] / norms[iter - 1],
+                                  norms[iter] / b_norm);
+                  else
+                     hypre_printf("% 5d    %e    %f\n", iter, norms[iter],
+                                  norms[iter] / norms[iter - 1]);
+               }
+            }
+            /*convergence factor tolerance */
+            if (cf_tol > 0.0)
+            {
+               cf_ave_0 = cf_ave_1;
+               cf_ave_1 = pow( r_norm / r_norm_0, 1.0 / (2.0 * iter));
+
+               weight = fabs(cf_ave_1 - cf_ave_0);
+               weight = weight / hypre_max(cf_ave_1, cf_ave_0);
+
+               weight = 1.0 - weight;
+               if (weight * cf_ave_1 > cf_tol)
+               {
+                  break_value = 1;
+                  done = 1;
+                  break;
+               }
+            }
+            /* should we exit the restart cycle? (conv. check) */
+            if (r_norm <= epsilon && iter >= min_iter)
+            {
+               done = 1;
+               break;
+            }
+         }
+         j += (k < ncol) ? k + 1 : ncol;
+      } /*** end of restart cycle ***/
+
+      if (break_value) { break; }
+
+      /* estimate the spectral interval once for the polynomial basis */
+      if (!have_shifts && s > 1)
+      {
+         hypre_SStepGMRESSpectralInterval(j, hh, ldh, work, &lmin, &lmax);
+         hypre_SStepGMRESBasisCoefficients(s, s_step_basis, lmin, lmax, theta, sigma, gam);
+         have_shifts = 1;
+         if ( print_level > 1 && my_id == 0 )
+         {
+            hypre_printf("s-step basis interval: [%e, %e]\n", lmin, lmax);
+         }
+      }
+
+      /* now compute solution, first solve upper triangular system */
+      i = j;
+      rs[i - 1] = rs[i - 1] / hr[(i - 1) * ldh + i - 1];
+      for (k = i - 2; k >= 0; k--)
+      {
+         t = 0.0;
+         for (l = k + 1; l < i; l++)
+         {
+            t -= hr[l * ldh + k] * rs[l];
+         }
+         t += rs[k];
+         rs[k] = t / hr[k * ldh + k];
+      }
+
+      (*(cogmres_functions->ClearVector))(w);
+      (*(cogmres_functions->MassAxpy))(rs, p, w, i, unroll);
+
+      (*(cogmres_functions->ClearVector))(r);
+      /* find correction (in r) */
+      precond(precond_data, A, w, r);
+
+      /* update current solution x (in x) */
+      (*(cogmres_functions->Axpy))(1.0, r, x);
+
+      if (r_norm <= epsilon && iter >= min_iter && skip_real_r_check)
+      {
+         (cogmres_data -> converged) = 1;
+         break;
+      }
+
+      /* the polynomial basis does not give the residual vector cheaply,
+         so it is always recomputed */
+      (*(cogmres_functions->CopyVector))(b, r);
+      (*(cogmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+      real_r_norm_new = sqrt( (*(cogmres_functions->InnerProd))(r, r) );
+
+      /* check for convergence by evaluating the actual residual */
+      if (r_norm <= epsilon && iter >= min_iter)
+      {
+         r_norm = real_r_norm_new;
+         if (r_norm <= epsilon)
+         {
+            if ( print_level > 1 && my_id == 0 )
+            {
+               hypre_printf("\n\n");
+               hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+            }
+            (cogmres_data -> converged) = 1;
+            break;
+         }
+         /* exit if the real residual norm has not decreased */
+         if (real_r_norm_new >= real_r_norm_old)
+         {
+            if (print_level > 1 && my_id == 0)
+            {
+               hypre_printf("\n\n");
+               hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+            }
+            (cogmres_data -> converged) = 1;
+            break;
+         }
+         /* report discrepancy between real/COGMRES residuals and restart */
+         if ( print_level > 0 && my_id == 0)
+         {
+            hypre_printf("false convergence 2, L2 norm of residual: %e\n", r_norm);
+         }
+      }
+      r_norm = real_r_norm_new;
+      real_r_norm_old = real_r_norm_new;
+      (*(cogmres_functions->CopyVector))(r, p[0]);
+
+   } /* END of iteration while loop */
+
+   (cogmres_data -> num_iterations) = iter;
+   if (b_norm > 0.0)
+   {
+      (cogmres_data -> rel_residual_norm) = r_norm / b_norm;
+   }
+   if (b_norm == 0.0)
+   {
+      (cogmres_data -> rel_residual_norm) = r_norm;
+   }
+
+   if (iter >= max_iter && r_norm > epsilon && epsilon > 0) { hypre_error(HYPRE_ERROR_CONV); }
+
+   hypre_TFreeF(hh, cogmres_functions);
+   hypre_TFreeF(hr, cogmres_functions);
+   hypre_TFreeF(rs, cogmres_functions);
+   hypre_TFreeF(cs, cogmres_functions);
+   hypre_TFreeF(sn, cogmres_functions);
+   hypre_TFreeF(theta, cogmres_functions);
+   hypre_TFreeF(sigma, cogmres_functions);
+   hypre_TFreeF(gam, cogmres_functions);
+   hypre_TFreeF(gram, cogmres_functions);
+   hypre_TFreeF(ctot, cogmres_functions);
+   hypre_TFreeF(rtot, cogmres_functions);
+   hypre_TFreeF(rp, cogmres_functions);
+   hypre_TFreeF(gorig, cogmres_functions);
+   hypre_TFreeF(alpha, cogmres_functions);
+   hypre_TFreeF(zz, cogmres_functions);
+   hypre_TFreeF(work, cogmres_functions);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
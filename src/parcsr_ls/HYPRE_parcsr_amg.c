@@ -209,6 +209,42 @@ HYPRE_BoomerAMGGetRedundant( HYPRE_Solver solver,
    return ( hypre_BoomerAMGGetRedundant( (void *) solver, redundant ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetAgglomThreshold, HYPRE_BoomerAMGGetAgglomThreshold
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetAgglomThreshold( HYPRE_Solver solver,
+                                   HYPRE_Int    agglom_threshold )
+{
+   return ( hypre_BoomerAMGSetAgglomThreshold( (void *) solver, agglom_threshold ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetAgglomThreshold( HYPRE_Solver  solver,
+                                   HYPRE_Int    *agglom_threshold )
+{
+   return ( hypre_BoomerAMGGetAgglomThreshold( (void *) solver, agglom_threshold ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetNeighborColl, HYPRE_BoomerAMGGetNeighborColl
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetNeighborColl( HYPRE_Solver solver,
+                                HYPRE_Int    neighbor_coll )
+{
+   return ( hypre_BoomerAMGSetNeighborColl( (void *) solver, neighbor_coll ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetNeighborColl( HYPRE_Solver  solver,
+                                HYPRE_Int    *neighbor_coll )
+{
+   return ( hypre_BoomerAMGGetNeighborColl( (void *) solver, neighbor_coll ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetRedundant, HYPRE_BoomerAMGGetRedundant
  *--------------------------------------------------------------------------*/
@@ -776,6 +812,17 @@ HYPRE_BoomerAMGSetRelaxOrder( HYPRE_Solver  solver,
    return ( hypre_BoomerAMGSetRelaxOrder( (void *) solver, relax_order ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetRelaxCacheBlock
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetRelaxCacheBlock( HYPRE_Solver  solver,
+                                   HYPRE_Int     relax_cache_block )
+{
+   return ( hypre_BoomerAMGSetRelaxCacheBlock( (void *) solver, relax_cache_block ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetGridRelaxPoints
  * DEPRECATED.  There are memory management problems associated with the
@@ -1712,6 +1759,33 @@ HYPRE_BoomerAMGSetPlotFileName (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetPlotFileName ( (void *) solver, plotfilename ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetProfileFile
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetProfileFile (HYPRE_Solver  solver,
+                               const char   *profile_file_name)
+{
+   return (hypre_BoomerAMGSetProfileFile ( (void *) solver, profile_file_name ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGWriteProfile
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGWriteProfile (HYPRE_Solver solver)
+{
+   if (!solver)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   return (hypre_BoomerAMGProfileWrite ( (void *) solver ) );
+}
+
 /* BM Oct 17, 2006 */
 
 /*--------------------------------------------------------------------------
@@ -1801,6 +1875,17 @@ HYPRE_BoomerAMGSetChebyEigEst( HYPRE_Solver  solver,
    return ( hypre_BoomerAMGSetChebyEigEst( (void *) solver, eig_est ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetChebyEigRefine
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetChebyEigRefine( HYPRE_Solver  solver,
+                                  HYPRE_Int     eig_refine )
+{
+   return ( hypre_BoomerAMGSetChebyEigRefine( (void *) solver, eig_refine ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetInterpVectors
  *--------------------------------------------------------------------------*/
@@ -2007,6 +2092,28 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMixedPrecisionLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetMixedPrecisionLevel (HYPRE_Solver solver,
+                                       HYPRE_Int    mp_level)
+{
+   return (hypre_BoomerAMGSetMixedPrecisionLevel ( (void *) solver, mp_level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetSetupReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetSetupReuse (HYPRE_Solver solver,
+                              HYPRE_Int    setup_reuse)
+{
+   return (hypre_BoomerAMGSetSetupReuse ( (void *) solver, setup_reuse ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
@@ -32,6 +32,11 @@ HYPRE_ParCSRGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_GMRESFunctionsSetResidualNorm(gmres_functions, hypre_ParKrylovResidualNorm);
+   hypre_GMRESFunctionsSetMultiVector(gmres_functions, hypre_ParKrylovNumVectors,
+                                      hypre_ParKrylovMultiInnerProd,
+                                      hypre_ParKrylovColumnInnerProd,
+                                      hypre_ParKrylovMultiAxpy);
    *solver = ( (HYPRE_Solver) hypre_GMRESCreate( gmres_functions ) );
 
    return hypre_error_flag;
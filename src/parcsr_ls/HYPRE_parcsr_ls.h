@@ -107,6 +107,12 @@ HYPRE_Int HYPRE_BoomerAMGSetup(HYPRE_Solver       solver,
  * If used as a preconditioner, this function should be passed
  * to the iterative solver \e SetPrecond function.
  *
+ * If b and x are multivectors, all columns are cycled together: residual,
+ * restriction and interpolation become SpMMs, and Jacobi (0, 7), l1-Jacobi
+ * (18) and Chebyshev (16) smoothing update every column at once. Other
+ * smoothers and the coarse direct solve are applied column by column.
+ * Complex smoothers, additive cycles and block mode are not supported.
+ *
  * @param solver [IN] solver or preconditioner object to be applied.
  * @param A [IN] ParCSR matrix, matrix of the linear system to be solved
  * @param b [IN] right hand side of the linear system to be solved
@@ -296,6 +302,9 @@ HYPRE_Int HYPRE_BoomerAMGSetMaxRowSum(HYPRE_Solver solver,
  *           by PMIS using the interior C-points generated as its first independent set)
  *    - 11 : one-pass Ruge-Stueben coarsening on each processor, no boundary treatment
              (not recommended!)
+ *    - 12 : aggregation coarsening (aggregates around a distance-2 maximal independent
+ *           set of the strength graph, whose points become the C-points; for use
+ *           with interp_type 25 or 26 and agg_num_levels 0)
  *    - 21 : CGC coarsening by M. Griebel, B. Metsch and A. Schweitzer
  *    - 22 : CGC-E coarsening by M. Griebel, B. Metsch and A.Schweitzer
  *
@@ -436,6 +445,9 @@ HYPRE_Int HYPRE_BoomerAMGSetKeepSameSign(HYPRE_Solver solver,
  *    - 16 : extended interpolation in matrix-matrix form
  *    - 17 : extended+i interpolation in matrix-matrix form
  *    - 18 : extended+e interpolation in matrix-matrix form
+ *    - 25 : tentative aggregation interpolation (for use with coarsen_type 12)
+ *    - 26 : smoothed aggregation interpolation, i.e., 25 followed by one
+ *           damped Jacobi step (for use with coarsen_type 12)
  *
  * The default is ext+i interpolation (interp_type 6) trunctated to at most 4
  * elements per row. (see HYPRE_BoomerAMGSetPMaxElmts).
@@ -674,6 +686,29 @@ HYPRE_Int HYPRE_BoomerAMGSetSeqThreshold(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetRedundant(HYPRE_Solver solver,
                                       HYPRE_Int    redundant);
 
+/**
+ * (Optional) Sets the minimal average number of rows per process on
+ * coarse levels. Once a coarse level falls below it, the level is
+ * agglomerated onto about (global size / agglom\_threshold) processes,
+ * which build the remaining levels with a nested BoomerAMG solver while the
+ * other processes are idle during its cycle. This agglomeration is repeated
+ * as the nested hierarchy gets coarser. Not available with the (mult)additive
+ * or simple cycles, with nodal systems in block mode, or with device memory.
+ * The default is 0, i.e. no agglomeration.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetAgglomThreshold(HYPRE_Solver solver,
+                                            HYPRE_Int    agglom_threshold);
+
+/**
+ * (Optional) Uses MPI neighborhood collectives instead of point-to-point
+ * messages for the halo exchanges of the coarse-level matrices and of the
+ * interpolation and restriction operators built in the setup (see
+ * HYPRE\_ParCSRMatrixSetNeighborColl). The fine-level matrix is left as
+ * the user set it. The default is 0, i.e. point-to-point messages.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetNeighborColl(HYPRE_Solver solver,
+                                         HYPRE_Int    neighbor_coll);
+
 /**
  * (Optional) Defines the number of sweeps for the fine and coarse grid,
  * the up and down cycle.
@@ -738,6 +773,15 @@ HYPRE_Int HYPRE_BoomerAMGSetGridRelaxType(HYPRE_Solver  solver,
  *    - 16 : Chebyshev
  *    - 17 : FCF-Jacobi
  *    - 18 : \f$\ell_1\f$-scaled jacobi
+ *    - 31 : multicolor Gauss-Seidel or SOR
+ *    - 32 : multicolor symmetric Gauss-Seidel or SSOR
+ *
+ * The multicolor smoothers color the strength graph at setup, including the
+ * connections to other processes, and relax one color at a time, all points
+ * of a color in parallel; weakly connected points of the same color are
+ * relaxed Jacobi-like. Unlike hybrid Gauss-Seidel, the result does not
+ * depend on the number of processes or threads; each color costs a halo
+ * exchange.
  **/
 HYPRE_Int HYPRE_BoomerAMGSetRelaxType(HYPRE_Solver  solver,
                                       HYPRE_Int     relax_type);
@@ -771,6 +815,20 @@ HYPRE_Int HYPRE_BoomerAMGSetCycleRelaxType(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_BoomerAMGSetRelaxOrder(HYPRE_Solver  solver,
                                        HYPRE_Int     relax_order);
 
+/**
+ * (Optional) Relaxes the rows in blocks of about \e relax_cache_block
+ * kilobytes of matrix data, e.g. the size of the L2 cache, for the hybrid
+ * Gauss-Seidel and SOR smoothers (relaxation types 3, 4, 6, 8, 13 and 14).
+ * The blocks are colored such that blocks of the same color are not coupled,
+ * and threads relax the blocks of one color at a time. Unlike the default
+ * splitting of the rows among threads, the result does not depend on the
+ * number of threads. With OpenMP, the matrix data of each coarse level is also
+ * placed in the memory of the threads that relax it. The default is 0,
+ * i.e. no blocking. Host only.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetRelaxCacheBlock(HYPRE_Solver  solver,
+                                            HYPRE_Int     relax_cache_block);
+
 /**
  * (Optional) Defines in which order the points are relaxed.
  *
@@ -853,7 +911,8 @@ HYPRE_Int HYPRE_BoomerAMGSetLevelOuterWt(HYPRE_Solver  solver,
 
 /**
  * (Optional) Defines the Order for Chebyshev smoother.
- *  The default is 2 (valid options are 1-4).
+ *  The default is 2 (valid options are 1-4, or 1-16 for the fourth-kind
+ *  variants 2 and 3).
  **/
 HYPRE_Int HYPRE_BoomerAMGSetChebyOrder(HYPRE_Solver solver,
                                        HYPRE_Int    order);
@@ -875,6 +934,15 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyScale (HYPRE_Solver solver,
 /**
  * (Optional) Defines which polynomial variant should be used.
  *  The default is 0 (i.e., scaled).
+ *  The following options exist for \e variant:
+ *
+ *    - 0 : standard Chebyshev polynomial
+ *    - 1 : modified Chebyshev polynomial
+ *    - 2 : fourth-kind Chebyshev polynomial (host only)
+ *    - 3 : optimized fourth-kind Chebyshev polynomial (host only)
+ *
+ *  The fourth-kind variants damp the whole spectrum up to the largest
+ *  eigenvalue, so the fraction is not used.
  **/
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant (HYPRE_Solver solver,
                                           HYPRE_Int   variant);
@@ -890,6 +958,18 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyVariant (HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst (HYPRE_Solver solver,
                                          HYPRE_Int   eig_est);
 
+/**
+ * (Optional) Keeps the eigenvalue estimates of the Chebyshev smoother
+ * across setups. On a new setup, a level with the same size and
+ * partitioning as before first checks its matrix for drift with one
+ * product, and keeps the previous estimates unless the Rayleigh quotient of
+ * a cached vector changed by more than 2%. Only then, \e eig_refine power
+ * iterations refine the estimates. The default is 0, i.e. the estimates are
+ * recomputed on every setup. Host only.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetChebyEigRefine (HYPRE_Solver solver,
+                                            HYPRE_Int   eig_refine);
+
 /**
  * (Optional) Enables the use of more complex smoothers.
  * The following options exist for \e smooth_type:
@@ -1264,6 +1344,48 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                           HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) If mp_level > 0, the matrices A, P and R of levels mp_level
+ * and coarser (except the coarsest level) are stored in single precision
+ * after setup: their double-precision values are freed, and smoothing,
+ * restriction and interpolation on these levels read the single-precision
+ * values, which reduces the memory footprint and traffic of the hierarchy.
+ * Vectors and all arithmetic stay in double precision, and the finest level
+ * and outer Krylov solver are unaffected. With print level 1 or 3, setup
+ * reports the bytes of matrix values on these levels before and after the
+ * conversion. This only applies on the host and requires relaxation types
+ * 7, 16 or 18 with relax_order = 0, no smoothers of smooth_type and no
+ * additive cycles; otherwise, setup prints a warning and the option is
+ * ignored. The default is -1 (off).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecisionLevel(HYPRE_Solver solver,
+                                                HYPRE_Int    mp_level);
+
+/**
+ * (Optional) Reuse the hierarchy of the previous setup when the solver is
+ * set up again with a matrix of the same size, e.g., when only the values of
+ * A change between time steps. The C/F splittings are kept on all levels
+ * and strength, coarsening and the comm packages of the coarse matrices are
+ * not recomputed.
+ *
+ *    - 0 : full setup (default)
+ *    - 1 : keep P (and R), recompute the coarse-grid operators only
+ *    - 2 : recompute the values of P on the frozen C/F splitting and pattern
+ *          of P, then the coarse-grid operators
+ *
+ * Coarse matrices whose sparsity pattern is unchanged are updated in place.
+ * Option 2 keeps the pattern of P of the first setup; each row of P takes
+ * the values of the new untruncated interpolation on that pattern, scaled
+ * to keep its row sum. It applies on the host to the interpolation types
+ * 0, 6, 8, 9, 14, 17 and 18 without nodal coarsening or approximate ideal
+ * restriction, outside of aggressive coarsening levels; P is kept
+ * otherwise. Block mode, additive cycles, non-Galerkin coarse grids,
+ * interpolation vectors and single precision levels require a full setup,
+ * which is then done instead.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetSetupReuse(HYPRE_Solver solver,
+                                       HYPRE_Int    setup_reuse);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
@@ -1276,6 +1398,31 @@ HYPRE_Int HYPRE_BoomerAMGSetPlotGrids (HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetPlotFileName (HYPRE_Solver  solver,
                                           const char   *plotfilename);
 
+/**
+ * (Optional) Collects a per-level profile of the setup and the solve and
+ * writes it to the given file, as JSON, or as CSV if the file name ends in
+ * ".csv". For each level, the profile lists the calls, wall time (maximum
+ * and average over the processes), point-to-point messages, bytes sent and
+ * flops of the phases strength, coarsen, interp, rap, comm\_pkg (setup of
+ * communication packages), smooth, restrict and interp\_apply, as well as
+ * the totals of the setup and solve stages. Flops are counted in the matrix
+ * products and matvecs, and estimated for the smoothers that do not use a
+ * matvec. The operations are only counted while a profile is collected.
+ * The file is written by HYPRE_BoomerAMGWriteProfile. A NULL or empty
+ * name (default) turns the profile off.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetProfileFile (HYPRE_Solver  solver,
+                                         const char   *profile_file_name);
+
+/**
+ * (Optional) Writes the profile collected since the last setup, including
+ * the solves done so far, to the file given with
+ * HYPRE_BoomerAMGSetProfileFile. Collective; does nothing if no
+ * profile was collected. The profile is not written when the solver is
+ * destroyed.
+ **/
+HYPRE_Int HYPRE_BoomerAMGWriteProfile (HYPRE_Solver solver);
+
 /**
  * HYPRE_BoomerAMGSetCoordDim
  **/
@@ -2659,6 +2806,40 @@ HYPRE_Int HYPRE_ParCSRPCGGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_ParCSRPCGGetResidual(HYPRE_Solver     solver,
                                      HYPRE_ParVector *residual);
 
+/**
+ * Create a pipelined PCG solver object.
+ *
+ * This variant (Ghysels and Vanroose) combines all inner products of an
+ * iteration into one non-blocking reduction that is overlapped with the
+ * preconditioner and the matvec, at the cost of a few extra vector updates
+ * and one more preconditioner and matvec application per solve.  It accepts
+ * the same parameters as the ParCSR PCG solver, through either the
+ * HYPRE_ParCSRPCGSet* or the generic HYPRE_PCGSet* functions, and can be
+ * set up and solved with HYPRE_PCGSetup and HYPRE_PCGSolve as well.
+ *
+ * Convergence is always confirmed with the true residual b-Ax, which is also
+ * compared with the recursive one every recompute_residual_p
+ * iterations (see HYPRE_PCGSetRecomputeResidualP). If the two differ too
+ * much, the remaining iterations use the classical PCG recurrences.
+ **/
+HYPRE_Int HYPRE_ParCSRPipelinedPCGCreate(MPI_Comm      comm,
+                                         HYPRE_Solver *solver);
+
+/**
+ * Destroy a pipelined PCG solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRPipelinedPCGDestroy(HYPRE_Solver solver);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetup(HYPRE_Solver       solver,
+                                        HYPRE_ParCSRMatrix A,
+                                        HYPRE_ParVector    b,
+                                        HYPRE_ParVector    x);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSolve(HYPRE_Solver       solver,
+                                        HYPRE_ParCSRMatrix A,
+                                        HYPRE_ParVector    b,
+                                        HYPRE_ParVector    x);
+
 /**
  * Setup routine for diagonal preconditioning.
  **/
@@ -2804,6 +2985,20 @@ HYPRE_Int HYPRE_ParCSRCOGMRESSetUnroll(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRCOGMRESSetCGS(HYPRE_Solver solver,
                                     HYPRE_Int    cgs);
 
+/**
+ * (Optional) Use the s-step variant with blocks of s basis vectors, see
+ * HYPRE_COGMRESSetSStep. Default: 1 (off).
+ **/
+HYPRE_Int HYPRE_ParCSRCOGMRESSetSStep(HYPRE_Solver solver,
+                                      HYPRE_Int    s_step);
+
+/**
+ * (Optional) Set the polynomial basis of the s-step variant, see
+ * HYPRE_COGMRESSetSStepBasis. Default: 0 (Newton).
+ **/
+HYPRE_Int HYPRE_ParCSRCOGMRESSetSStepBasis(HYPRE_Solver solver,
+                                           HYPRE_Int    s_step_basis);
+
 HYPRE_Int HYPRE_ParCSRCOGMRESSetTol(HYPRE_Solver solver,
                                     HYPRE_Real   tol);
 
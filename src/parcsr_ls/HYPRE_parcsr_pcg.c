@@ -31,6 +31,11 @@ HYPRE_ParCSRPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_PCGFunctionsSetResidualNorm(pcg_functions, hypre_ParKrylovResidualNorm);
+   hypre_PCGFunctionsSetMultiVector(pcg_functions, hypre_ParKrylovNumVectors,
+                                    hypre_ParKrylovMultiInnerProd,
+                                    hypre_ParKrylovColumnInnerProd,
+                                    hypre_ParKrylovMultiAxpy);
    *solver = ( (HYPRE_Solver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
@@ -78,6 +83,63 @@ HYPRE_ParCSRPCGSolve( HYPRE_Solver solver,
                             (HYPRE_Vector) x ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGCreate
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
+{
+   if (!solver)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   HYPRE_ParCSRPCGCreate(comm, solver);
+   hypre_PCGFunctionsSetInnerProdStart(((hypre_PCGData *) *solver) -> functions,
+                                       hypre_ParKrylovInnerProdStart);
+   hypre_PCGSetPipelined((void *) *solver, 1);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGDestroy( HYPRE_Solver solver )
+{
+   return ( hypre_PCGDestroy( (void *) solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGSetup( HYPRE_Solver solver,
+                               HYPRE_ParCSRMatrix A,
+                               HYPRE_ParVector b,
+                               HYPRE_ParVector x      )
+{
+   return ( hypre_PCGSetup( (void *) solver, (void *) A, (void *) b, (void *) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGSolve( HYPRE_Solver solver,
+                               HYPRE_ParCSRMatrix A,
+                               HYPRE_ParVector b,
+                               HYPRE_ParVector x      )
+{
+   return ( hypre_PipelinedPCGSolve( (void *) solver, (void *) A, (void *) b, (void *) x ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRPCGSetTol
  *--------------------------------------------------------------------------*/
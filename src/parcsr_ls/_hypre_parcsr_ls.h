@@ -30,6 +30,55 @@ typedef struct { HYPRE_Int prev; HYPRE_Int next; } Link;
 
 #include "par_csr_block_matrix.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_AMGProfile
+ *
+ * Per-level, per-phase profile of BoomerAMG setup and solve (see
+ * par_amg_profile.c).  Each record holds the number of calls, wall time,
+ * point-to-point messages, bytes sent and flops of one phase on one level.
+ * Messages, bytes and flops are differences of the global operation counters
+ * (hypre_OpCounts) around the phase, and the communication package setup done
+ * inside a phase is moved to the COMMPKG phase of the same level.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_AMG_PROFILE_STRENGTH      0
+#define HYPRE_AMG_PROFILE_COARSEN       1
+#define HYPRE_AMG_PROFILE_INTERP        2
+#define HYPRE_AMG_PROFILE_RAP           3
+#define HYPRE_AMG_PROFILE_COMMPKG       4
+#define HYPRE_AMG_PROFILE_SMOOTH        5
+#define HYPRE_AMG_PROFILE_RESTRICT      6
+#define HYPRE_AMG_PROFILE_INTERP_APPLY  7
+#define HYPRE_AMG_PROFILE_NUM_PHASES    8
+
+#define HYPRE_AMG_PROFILE_SETUP         0
+#define HYPRE_AMG_PROFILE_SOLVE         1
+
+/* calls, time, messages, bytes, flops */
+#define HYPRE_AMG_PROFILE_NUM_COUNTS    5
+
+typedef struct
+{
+   MPI_Comm       comm;
+   HYPRE_Int      num_levels;      /* levels of the last setup */
+   HYPRE_Int      max_levels;      /* levels allocated in counts */
+   HYPRE_Real    *counts;          /* [level][phase][count] */
+   HYPRE_Real     stage_counts[2][HYPRE_AMG_PROFILE_NUM_COUNTS];
+   HYPRE_BigInt  *level_rows;
+   HYPRE_Real    *level_nonzeros;  /* local, summed when written */
+
+   /* open stage and phase (phase < 0 if none), with the operation counters
+      at their start: time, messages, bytes, flops, comm pkg time, comm pkg
+      messages, comm pkg bytes, comm pkg calls */
+   HYPRE_Int      stage;
+   HYPRE_Int      stage_depth;     /* a solve may be nested in the setup */
+   HYPRE_Int      level;
+   HYPRE_Int      phase;
+   HYPRE_Real     stage_start[8];
+   HYPRE_Real     phase_start[8];
+
+} hypre_AMGProfile;
+
 /*--------------------------------------------------------------------------
  * hypre_ParAMGData
  *--------------------------------------------------------------------------*/
@@ -78,6 +127,8 @@ typedef struct
    HYPRE_Int      seq_threshold;
    HYPRE_Int      redundant;
    HYPRE_Int      participate;
+   HYPRE_Int      agglom_threshold;
+   HYPRE_Int      neighbor_coll;
    HYPRE_Int      Sabs;
 
    /* solve params */
@@ -89,6 +140,9 @@ typedef struct
    HYPRE_Int     *grid_relax_type;
    HYPRE_Int    **grid_relax_points;
    HYPRE_Int      relax_order;
+   HYPRE_Int      relax_cache_block;
+   /* relax blocks of the fine level, kept off the user's matrix between solves */
+   HYPRE_Int     *relax_blocks;
    HYPRE_Int      user_coarse_relax_type;
    HYPRE_Int      user_relax_type;
    HYPRE_Int      user_num_sweeps;
@@ -179,6 +233,12 @@ typedef struct
    HYPRE_Real           cheby_fraction;
    hypre_Vector       **cheby_ds;
    HYPRE_Real         **cheby_coefs;
+   HYPRE_Int            cheby_eig_refine;
+   /* spectral bounds kept across setups: max, min and the Rayleigh quotient
+      of the cached vector, per level */
+   HYPRE_Int            cheby_num_eig_cache;
+   HYPRE_Real          *cheby_eig_cache;
+   hypre_ParVector    **cheby_eig_vecs;
 
    /* data needed for non-Galerkin option */
    HYPRE_Int           nongalerk_num_tol;
@@ -195,6 +255,13 @@ typedef struct
    hypre_ParVector   *Ptemp;
    hypre_ParVector   *Ztemp;
 
+   /* work vectors with mv_num_vectors columns for multivector solves,
+    * swapped in for the single-column ones while mv_active is set */
+   hypre_ParVector  **mv_work;
+   HYPRE_Int          mv_work_size;
+   HYPRE_Int          mv_num_vectors;
+   HYPRE_Int          mv_active;
+
    /* fields used by GSMG and LS interpolation */
    HYPRE_Int          gsmg;        /* nonzero indicates use of GSMG */
    HYPRE_Int          num_samples; /* number of sample vectors */
@@ -217,6 +284,10 @@ typedef struct
    HYPRE_Int      plot_grids;
    char           plot_filename[251];
 
+   /* per-level profile, written to profile_file_name if it is not empty */
+   char               profile_file_name[256];
+   hypre_AMGProfile  *profile;
+
    /* coordinate data BM Oct 17, 2006 */
    HYPRE_Int      coorddim;
    float         *coordinates;
@@ -241,6 +312,12 @@ typedef struct
    hypre_ParVector     *u_coarse;
    MPI_Comm             new_comm;
 
+   /* coarse-level agglomeration: communicator of the group of ranks whose
+      rows were merged onto its first rank, row counts/offsets (on that rank) */
+   MPI_Comm             agglom_comm;
+   HYPRE_Int           *agglom_counts;
+   HYPRE_Int           *agglom_displs;
+
    /* store matrix, vector and communication info for Gaussian elimination */
    HYPRE_Int   gs_setup;
    HYPRE_Real *A_mat, *A_inv;
@@ -267,6 +344,13 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* store A, P and R in single precision from this level on */
+   HYPRE_Int mp_level;
+
+   /* on a new setup, keep the coarsening (and P) of the previous one */
+   HYPRE_Int setup_reuse;
+   hypre_ParCSRRAPPlan **rap_plan_array;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -335,6 +419,8 @@ typedef struct
 #define hypre_ParAMGDataMaxCoarseSize(amg_data)        ((amg_data) -> max_coarse_size)
 #define hypre_ParAMGDataMinCoarseSize(amg_data)        ((amg_data) -> min_coarse_size)
 #define hypre_ParAMGDataSeqThreshold(amg_data)         ((amg_data) -> seq_threshold)
+#define hypre_ParAMGDataAgglomThreshold(amg_data)      ((amg_data) -> agglom_threshold)
+#define hypre_ParAMGDataNeighborColl(amg_data)         ((amg_data) -> neighbor_coll)
 
 /* solve params */
 
@@ -354,6 +440,8 @@ typedef struct
 #define hypre_ParAMGDataGridRelaxType(amg_data) ((amg_data)->grid_relax_type)
 #define hypre_ParAMGDataGridRelaxPoints(amg_data) ((amg_data)->grid_relax_points)
 #define hypre_ParAMGDataRelaxOrder(amg_data) ((amg_data)->relax_order)
+#define hypre_ParAMGDataRelaxCacheBlock(amg_data) ((amg_data)->relax_cache_block)
+#define hypre_ParAMGDataRelaxBlocks(amg_data) ((amg_data)->relax_blocks)
 #define hypre_ParAMGDataRelaxWeight(amg_data) ((amg_data)->relax_weight)
 #define hypre_ParAMGDataOmega(amg_data) ((amg_data)->omega)
 #define hypre_ParAMGDataOuterWt(amg_data) ((amg_data)->outer_wt)
@@ -428,6 +516,10 @@ typedef struct
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
+#define hypre_ParAMGDataChebyEigRefine(amg_data) ((amg_data)->cheby_eig_refine)
+#define hypre_ParAMGDataChebyNumEigCache(amg_data) ((amg_data)->cheby_num_eig_cache)
+#define hypre_ParAMGDataChebyEigCache(amg_data) ((amg_data)->cheby_eig_cache)
+#define hypre_ParAMGDataChebyEigVecs(amg_data) ((amg_data)->cheby_eig_vecs)
 
 /* block */
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
@@ -445,6 +537,10 @@ typedef struct
 #define hypre_ParAMGDataRtemp(amg_data) ((amg_data)->Rtemp)
 #define hypre_ParAMGDataPtemp(amg_data) ((amg_data)->Ptemp)
 #define hypre_ParAMGDataZtemp(amg_data) ((amg_data)->Ztemp)
+#define hypre_ParAMGDataMVWork(amg_data) ((amg_data)->mv_work)
+#define hypre_ParAMGDataMVWorkSize(amg_data) ((amg_data)->mv_work_size)
+#define hypre_ParAMGDataMVNumVectors(amg_data) ((amg_data)->mv_num_vectors)
+#define hypre_ParAMGDataMVActive(amg_data) ((amg_data)->mv_active)
 
 /* fields used by GSMG */
 #define hypre_ParAMGDataGSMG(amg_data) ((amg_data)->gsmg)
@@ -467,6 +563,8 @@ typedef struct
 /* BM Oct 22, 2006 */
 #define hypre_ParAMGDataPlotGrids(amg_data) ((amg_data)->plot_grids)
 #define hypre_ParAMGDataPlotFileName(amg_data) ((amg_data)->plot_filename)
+#define hypre_ParAMGDataProfileFileName(amg_data) ((amg_data)->profile_file_name)
+#define hypre_ParAMGDataProfile(amg_data) ((amg_data)->profile)
 
 /* coordinates BM Oct 17, 2006 */
 #define hypre_ParAMGDataCoordDim(amg_data) ((amg_data)->coorddim)
@@ -492,6 +590,9 @@ typedef struct
 #define hypre_ParAMGDataNewComm(amg_data) ((amg_data)->new_comm)
 #define hypre_ParAMGDataRedundant(amg_data) ((amg_data)->redundant)
 #define hypre_ParAMGDataParticipate(amg_data) ((amg_data)->participate)
+#define hypre_ParAMGDataAgglomComm(amg_data) ((amg_data)->agglom_comm)
+#define hypre_ParAMGDataAgglomCounts(amg_data) ((amg_data)->agglom_counts)
+#define hypre_ParAMGDataAgglomDispls(amg_data) ((amg_data)->agglom_displs)
 
 #define hypre_ParAMGDataGSSetup(amg_data) ((amg_data)->gs_setup)
 #define hypre_ParAMGDataAMat(amg_data) ((amg_data)->A_mat)
@@ -523,6 +624,9 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataMixedPrecisionLevel(amg_data) ((amg_data)->mp_level)
+#define hypre_ParAMGDataSetupReuse(amg_data) ((amg_data)->setup_reuse)
+#define hypre_ParAMGDataRAPPlanArray(amg_data) ((amg_data)->rap_plan_array)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
@@ -1145,6 +1249,10 @@ HYPRE_Int hypre_seqAMGSetup ( hypre_ParAMGData *amg_data, HYPRE_Int p_level,
                               HYPRE_Int coarse_threshold );
 HYPRE_Int hypre_seqAMGCycle ( hypre_ParAMGData *amg_data, HYPRE_Int p_level,
                               hypre_ParVector **Par_F_array, hypre_ParVector **Par_U_array );
+HYPRE_Int hypre_BoomerAMGAgglomerateSetup ( hypre_ParAMGData *amg_data, HYPRE_Int p_level );
+HYPRE_Int hypre_BoomerAMGAgglomerateCycle ( hypre_ParAMGData *amg_data, HYPRE_Int p_level,
+                                            hypre_ParVector **F_array,
+                                            hypre_ParVector **U_array );
 HYPRE_Int hypre_GenerateSubComm ( MPI_Comm comm, HYPRE_Int participate, MPI_Comm *new_comm_ptr );
 void hypre_merge_lists ( HYPRE_Int *list1, HYPRE_Int *list2, hypre_int *np1,
                          hypre_MPI_Datatype *dptr );
@@ -1265,6 +1373,11 @@ HYPRE_Int HYPRE_BoomerAMGSetSeqThreshold ( HYPRE_Solver solver, HYPRE_Int seq_th
 HYPRE_Int HYPRE_BoomerAMGGetSeqThreshold ( HYPRE_Solver solver, HYPRE_Int *seq_threshold );
 HYPRE_Int HYPRE_BoomerAMGSetRedundant ( HYPRE_Solver solver, HYPRE_Int redundant );
 HYPRE_Int HYPRE_BoomerAMGGetRedundant ( HYPRE_Solver solver, HYPRE_Int *redundant );
+HYPRE_Int HYPRE_BoomerAMGSetAgglomThreshold ( HYPRE_Solver solver, HYPRE_Int agglom_threshold );
+HYPRE_Int HYPRE_BoomerAMGGetAgglomThreshold ( HYPRE_Solver solver,
+                                              HYPRE_Int *agglom_threshold );
+HYPRE_Int HYPRE_BoomerAMGSetNeighborColl ( HYPRE_Solver solver, HYPRE_Int neighbor_coll );
+HYPRE_Int HYPRE_BoomerAMGGetNeighborColl ( HYPRE_Solver solver, HYPRE_Int *neighbor_coll );
 HYPRE_Int HYPRE_BoomerAMGSetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int coarsen_cut_factor );
 HYPRE_Int HYPRE_BoomerAMGGetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int *coarsen_cut_factor );
 HYPRE_Int HYPRE_BoomerAMGSetStrongThreshold ( HYPRE_Solver solver, HYPRE_Real strong_threshold );
@@ -1323,6 +1436,7 @@ HYPRE_Int HYPRE_BoomerAMGSetCycleRelaxType ( HYPRE_Solver solver, HYPRE_Int rela
 HYPRE_Int HYPRE_BoomerAMGGetCycleRelaxType ( HYPRE_Solver solver, HYPRE_Int *relax_type,
                                              HYPRE_Int k );
 HYPRE_Int HYPRE_BoomerAMGSetRelaxOrder ( HYPRE_Solver solver, HYPRE_Int relax_order );
+HYPRE_Int HYPRE_BoomerAMGSetRelaxCacheBlock ( HYPRE_Solver solver, HYPRE_Int relax_cache_block );
 HYPRE_Int HYPRE_BoomerAMGSetGridRelaxPoints ( HYPRE_Solver solver, HYPRE_Int **grid_relax_points );
 HYPRE_Int HYPRE_BoomerAMGSetRelaxWeight ( HYPRE_Solver solver, HYPRE_Real *relax_weight );
 HYPRE_Int HYPRE_BoomerAMGSetRelaxWt ( HYPRE_Solver solver, HYPRE_Real relax_wt );
@@ -1424,6 +1538,7 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyFraction ( HYPRE_Solver solver, HYPRE_Real rati
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst ( HYPRE_Solver solver, HYPRE_Int eig_est );
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant ( HYPRE_Solver solver, HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGSetChebyScale ( HYPRE_Solver solver, HYPRE_Int scale );
+HYPRE_Int HYPRE_BoomerAMGSetChebyEigRefine ( HYPRE_Solver solver, HYPRE_Int eig_refine );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVectors ( HYPRE_Solver solver, HYPRE_Int num_vectors,
                                             HYPRE_ParVector *vectors );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVecVariant ( HYPRE_Solver solver, HYPRE_Int num );
@@ -1448,6 +1563,8 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongal
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecisionLevel ( HYPRE_Solver solver, HYPRE_Int mp_level );
+HYPRE_Int HYPRE_BoomerAMGSetSetupReuse ( HYPRE_Solver solver, HYPRE_Int setup_reuse );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -1612,6 +1729,8 @@ HYPRE_Int HYPRE_ParCSRCOGMRESSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A,
                                      HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetKDim ( HYPRE_Solver solver, HYPRE_Int k_dim );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetCGS2 ( HYPRE_Solver solver, HYPRE_Int cgs2 );
+HYPRE_Int HYPRE_ParCSRCOGMRESSetSStep ( HYPRE_Solver solver, HYPRE_Int s_step );
+HYPRE_Int HYPRE_ParCSRCOGMRESSetSStepBasis ( HYPRE_Solver solver, HYPRE_Int s_step_basis );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetMinIter ( HYPRE_Solver solver, HYPRE_Int min_iter );
@@ -1803,6 +1922,12 @@ HYPRE_Int HYPRE_ParCSRPCGSetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPR
                                  HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRPCGSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
                                  HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGCreate ( MPI_Comm comm, HYPRE_Solver *solver );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGDestroy ( HYPRE_Solver solver );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A,
+                                          HYPRE_ParVector b, HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A,
+                                          HYPRE_ParVector b, HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRPCGSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRPCGSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
 HYPRE_Int HYPRE_ParCSRPCGSetMaxIter ( HYPRE_Solver solver, HYPRE_Int max_iter );
@@ -1858,6 +1983,16 @@ HYPRE_Int hypre_BoomerAMGAdditiveCycle ( void *amg_vdata );
 HYPRE_Int hypre_CreateLambda ( void *amg_vdata );
 HYPRE_Int hypre_CreateDinv ( void *amg_vdata );
 
+/* par_aggregate.c */
+HYPRE_Int hypre_BoomerAMGCoarsenAggregates ( hypre_ParCSRMatrix *S, HYPRE_Int debug_flag,
+                                             hypre_IntArray **CF_marker_ptr,
+                                             HYPRE_BigInt **aggregates_ptr );
+HYPRE_Int hypre_BoomerAMGBuildAggInterp ( hypre_ParCSRMatrix *A, HYPRE_BigInt *aggregates,
+                                          HYPRE_BigInt *num_cpts_global, HYPRE_Int block_size,
+                                          HYPRE_Int smooth, HYPRE_Int debug_flag,
+                                          HYPRE_Real trunc_factor, HYPRE_Int max_elmts,
+                                          hypre_ParCSRMatrix **P_ptr );
+
 /* par_amg.c */
 void *hypre_BoomerAMGCreate ( void );
 HYPRE_Int hypre_BoomerAMGDestroy ( void *data );
@@ -1876,6 +2011,10 @@ HYPRE_Int hypre_BoomerAMGSetCoarsenCutFactor( void *data, HYPRE_Int coarsen_cut_
 HYPRE_Int hypre_BoomerAMGGetCoarsenCutFactor( void *data, HYPRE_Int *coarsen_cut_factor );
 HYPRE_Int hypre_BoomerAMGSetRedundant ( void *data, HYPRE_Int redundant );
 HYPRE_Int hypre_BoomerAMGGetRedundant ( void *data, HYPRE_Int *redundant );
+HYPRE_Int hypre_BoomerAMGSetAgglomThreshold ( void *data, HYPRE_Int agglom_threshold );
+HYPRE_Int hypre_BoomerAMGGetAgglomThreshold ( void *data, HYPRE_Int *agglom_threshold );
+HYPRE_Int hypre_BoomerAMGSetNeighborColl ( void *data, HYPRE_Int neighbor_coll );
+HYPRE_Int hypre_BoomerAMGGetNeighborColl ( void *data, HYPRE_Int *neighbor_coll );
 HYPRE_Int hypre_BoomerAMGSetStrongThreshold ( void *data, HYPRE_Real strong_threshold );
 HYPRE_Int hypre_BoomerAMGGetStrongThreshold ( void *data, HYPRE_Real *strong_threshold );
 HYPRE_Int hypre_BoomerAMGSetStrongThresholdR ( void *data, HYPRE_Real strong_threshold );
@@ -1923,6 +2062,7 @@ HYPRE_Int hypre_BoomerAMGSetRelaxType ( void *data, HYPRE_Int relax_type );
 HYPRE_Int hypre_BoomerAMGSetCycleRelaxType ( void *data, HYPRE_Int relax_type, HYPRE_Int k );
 HYPRE_Int hypre_BoomerAMGGetCycleRelaxType ( void *data, HYPRE_Int *relax_type, HYPRE_Int k );
 HYPRE_Int hypre_BoomerAMGSetRelaxOrder ( void *data, HYPRE_Int relax_order );
+HYPRE_Int hypre_BoomerAMGSetRelaxCacheBlock ( void *data, HYPRE_Int relax_cache_block );
 HYPRE_Int hypre_BoomerAMGGetRelaxOrder ( void *data, HYPRE_Int *relax_order );
 HYPRE_Int hypre_BoomerAMGSetGridRelaxType ( void *data, HYPRE_Int *grid_relax_type );
 HYPRE_Int hypre_BoomerAMGGetGridRelaxType ( void *data, HYPRE_Int **grid_relax_type );
@@ -1958,6 +2098,7 @@ HYPRE_Int hypre_BoomerAMGSetNumSamples ( void *data, HYPRE_Int par );
 HYPRE_Int hypre_BoomerAMGSetCGCIts ( void *data, HYPRE_Int its );
 HYPRE_Int hypre_BoomerAMGSetPlotGrids ( void *data, HYPRE_Int plotgrids );
 HYPRE_Int hypre_BoomerAMGSetPlotFileName ( void *data, const char *plot_file_name );
+HYPRE_Int hypre_BoomerAMGSetProfileFile ( void *data, const char *profile_file_name );
 HYPRE_Int hypre_BoomerAMGSetCoordDim ( void *data, HYPRE_Int coorddim );
 HYPRE_Int hypre_BoomerAMGSetCoordinates ( void *data, float *coordinates );
 HYPRE_Int hypre_BoomerAMGGetGridHierarchy(void *data, HYPRE_Int *cgrid );
@@ -2030,6 +2171,7 @@ HYPRE_Int hypre_BoomerAMGSetChebyFraction ( void *data, HYPRE_Real ratio );
 HYPRE_Int hypre_BoomerAMGSetChebyEigEst ( void *data, HYPRE_Int eig_est );
 HYPRE_Int hypre_BoomerAMGSetChebyVariant ( void *data, HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGSetChebyScale ( void *data, HYPRE_Int scale );
+HYPRE_Int hypre_BoomerAMGSetChebyEigRefine ( void *data, HYPRE_Int eig_refine );
 HYPRE_Int hypre_BoomerAMGSetInterpVectors ( void *solver, HYPRE_Int num_vectors,
                                             hypre_ParVector **interp_vectors );
 HYPRE_Int hypre_BoomerAMGSetInterpVecVariant ( void *solver, HYPRE_Int var );
@@ -2053,6 +2195,8 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_t
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetMixedPrecisionLevel ( void *data, HYPRE_Int mp_level );
+HYPRE_Int hypre_BoomerAMGSetSetupReuse ( void *data, HYPRE_Int setup_reuse );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -2061,11 +2205,30 @@ HYPRE_Int hypre_BoomerAMGSetCPoints( void *data, HYPRE_Int cpt_coarse_level,
 HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int num_points,
                                      HYPRE_BigInt *indices );
 
+/* par_amg_profile.c */
+HYPRE_Int hypre_BoomerAMGProfileStageBegin( void *data, HYPRE_Int stage );
+HYPRE_Int hypre_BoomerAMGProfileStageEnd( void *data );
+HYPRE_Int hypre_BoomerAMGProfileBegin( void *data, HYPRE_Int level, HYPRE_Int phase );
+HYPRE_Int hypre_BoomerAMGProfileEnd( void *data );
+HYPRE_Int hypre_BoomerAMGProfileWrite( void *data );
+HYPRE_Int hypre_BoomerAMGProfileDestroy( void *data );
+
+/* par_amg_reuse.c */
+HYPRE_Int hypre_BoomerAMGSetupReuseCheck ( void *amg_vdata, hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGSetupReuseLevels ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGSetupReuseDestroy ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGChebyEigCacheLookup ( void *amg_vdata, HYPRE_Int level, HYPRE_Int scale,
+                                               HYPRE_Real *max_eig, HYPRE_Real *min_eig );
+HYPRE_Int hypre_BoomerAMGChebyEigCacheStore ( void *amg_vdata, HYPRE_Int level, HYPRE_Int scale,
+                                              HYPRE_Real max_eig, HYPRE_Real min_eig );
+
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                  hypre_ParVector *u );
 
 /* par_amg_solve.c */
+HYPRE_Int hypre_BoomerAMGSetSolveNumVectors ( hypre_ParAMGData *amg_data, HYPRE_Int num_vectors );
+HYPRE_Int hypre_BoomerAMGSolveWorkDestroy ( hypre_ParAMGData *amg_data );
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                  hypre_ParVector *u );
 
@@ -2502,6 +2665,14 @@ HYPRE_Int hypre_GenerateSendMapAndCommPkg ( MPI_Comm comm, HYPRE_Int num_sends,
 HYPRE_Int hypre_BoomerAMGRelax ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker,
                                  HYPRE_Int relax_type, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
                                  HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxMultiVector ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                            HYPRE_Int *cf_marker, HYPRE_Int relax_type, HYPRE_Int relax_points,
+                                            HYPRE_Real relax_weight, HYPRE_Real omega, HYPRE_Real *l1_norms,
+                                            hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxJacobiMultiVector ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                  HYPRE_Int *cf_marker, HYPRE_Int relax_points,
+                                                  HYPRE_Real relax_weight, HYPRE_Real *l1_norms,
+                                                  hypre_ParVector *u, hypre_ParVector *Vtemp );
 HYPRE_Int hypre_GaussElimSetup ( hypre_ParAMGData *amg_data, HYPRE_Int level,
                                  HYPRE_Int relax_type );
 HYPRE_Int hypre_GaussElimSolve ( hypre_ParAMGData *amg_data, HYPRE_Int level,
@@ -2511,6 +2682,8 @@ HYPRE_Int hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A, hyp
                                                       HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp,
                                                       HYPRE_Int GS_order, HYPRE_Int Symm, HYPRE_Int Skip_diag, HYPRE_Int forced_seq,
                                                       HYPRE_Int Topo_order );
+HYPRE_Int hypre_BoomerAMGRelaxBlocksSetup( hypre_ParCSRMatrix *A, HYPRE_Int block_kbytes,
+                                           HYPRE_Int first_touch );
 HYPRE_Int hypre_BoomerAMGRelax0WeightedJacobi( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                                HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, hypre_ParVector *u,
                                                hypre_ParVector *Vtemp );
@@ -2591,6 +2764,15 @@ HYPRE_Int hypre_BoomerAMGRelaxHybridGaussSeidelDevice( hypre_ParCSRMatrix *A, hy
                                                        HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp,
                                                        HYPRE_Int GS_order, HYPRE_Int Symm );
 
+/* par_relax_color.c */
+HYPRE_Int hypre_BoomerAMGRelaxColorsSetup( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *S );
+HYPRE_Int hypre_BoomerAMGRelax31MulticolorGaussSeidel( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                       HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
+                                                       hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelax32MulticolorSSOR( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
+                                                hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
+
 /* par_relax_interface.c */
 HYPRE_Int hypre_BoomerAMGRelaxIF ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker,
                                    HYPRE_Int relax_type, HYPRE_Int relax_order, HYPRE_Int cycle_type, HYPRE_Real relax_weight,
@@ -2606,6 +2788,8 @@ HYPRE_Int hypre_ParCSRMaxEigEstimateCG ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
                                          HYPRE_Real *max_eig, HYPRE_Real *min_eig );
 HYPRE_Int hypre_ParCSRMaxEigEstimateCGHost ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
                                              HYPRE_Int max_iter, HYPRE_Real *max_eig, HYPRE_Real *min_eig );
+HYPRE_Int hypre_ParCSRMaxEigEstimatePower ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
+                                             HYPRE_Int max_iter, hypre_ParVector *x, HYPRE_Real *eig );
 HYPRE_Int hypre_ParCSRRelax_Cheby ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Real max_eig,
                                     HYPRE_Real min_eig, HYPRE_Real fraction, HYPRE_Int order, HYPRE_Int scale, HYPRE_Int variant,
                                     hypre_ParVector *u, hypre_ParVector *v, hypre_ParVector *r );
@@ -2665,6 +2849,7 @@ HYPRE_Int hypre_BoomerAMGCreateSabs ( hypre_ParCSRMatrix *A, HYPRE_Real strength
                                       HYPRE_Real max_row_sum, HYPRE_Int num_functions, HYPRE_Int *dof_func, hypre_ParCSRMatrix **S_ptr );
 HYPRE_Int hypre_BoomerAMGCreateSCommPkg ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *S,
                                           HYPRE_Int **col_offd_S_to_A_ptr );
+HYPRE_Int hypre_BoomerAMGSymmetrizeS ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix **G_ptr );
 HYPRE_Int hypre_BoomerAMGCreate2ndS ( hypre_ParCSRMatrix *S, HYPRE_Int *CF_marker,
                                       HYPRE_Int num_paths, HYPRE_BigInt *coarse_row_starts, hypre_ParCSRMatrix **C_ptr );
 HYPRE_Int hypre_BoomerAMGCorrectCFMarker ( hypre_IntArray *CF_marker,
@@ -2773,13 +2958,23 @@ HYPRE_Int hypre_ParKrylovMatvec ( void *matvec_data, HYPRE_Complex alpha, void *
 HYPRE_Int hypre_ParKrylovMatvecT ( void *matvec_data, HYPRE_Complex alpha, void *A, void *x,
                                    HYPRE_Complex beta, void *y );
 HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
+HYPRE_Int hypre_ParKrylovResidualNorm ( void *matvec_data, void *A, void *x, void *b, void *r,
+                                        HYPRE_Real *r_norm2, hypre_MPI_Request *request );
 HYPRE_Real hypre_ParKrylovInnerProd ( void *x, void *y );
+HYPRE_Int hypre_ParKrylovInnerProdStart ( HYPRE_Int k, void **x, void **y, HYPRE_Real *result,
+                                         hypre_MPI_Request *request );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
                                          void *result );
+HYPRE_Int hypre_ParKrylovBlockInnerProd ( void **x, HYPRE_Int kx, void **y, HYPRE_Int ky,
+                                         HYPRE_Int unroll, void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll,
                                        void *result_x, void *result_y );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
                                    HYPRE_Int unroll);
+HYPRE_Int hypre_ParKrylovNumVectors ( void *x );
+HYPRE_Int hypre_ParKrylovMultiInnerProd ( HYPRE_Int k, void **x, void *y, HYPRE_Real *result );
+HYPRE_Int hypre_ParKrylovColumnInnerProd ( void *x, void *y, HYPRE_Real *result );
+HYPRE_Int hypre_ParKrylovMultiAxpy ( HYPRE_Complex *alpha, void *x, HYPRE_Complex beta, void *y );
 HYPRE_Int hypre_ParKrylovCopyVector ( void *x, void *y );
 HYPRE_Int hypre_ParKrylovClearVector ( void *x );
 HYPRE_Int hypre_ParKrylovScaleVector ( HYPRE_Complex alpha, void *x );
@@ -3030,10 +3225,10 @@ HYPRE_Int hypre_ILUSetDropThreshold( void *ilu_vdata, HYPRE_Real threshold );
 HYPRE_Int hypre_ILUSetDropThresholdArray( void *ilu_vdata, HYPRE_Real *threshold );
 HYPRE_Int hypre_ILUSetType( void *ilu_vdata, HYPRE_Int ilu_type );
 HYPRE_Int hypre_ILUSetMaxIter( void *ilu_vdata, HYPRE_Int max_iter );
+HYPRE_Int hypre_ILUSetTol( void *ilu_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_ILUSetTriSolve( void *ilu_vdata, HYPRE_Int tri_solve );
 HYPRE_Int hypre_ILUSetLowerJacobiIters( void *ilu_vdata, HYPRE_Int lower_jacobi_iters );
 HYPRE_Int hypre_ILUSetUpperJacobiIters( void *ilu_vdata, HYPRE_Int upper_jacobi_iters );
-HYPRE_Int hypre_ILUSetTol( void *ilu_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_ILUSetup( void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVector    *f,
                           hypre_ParVector    *u );
 HYPRE_Int hypre_ILUSolve( void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
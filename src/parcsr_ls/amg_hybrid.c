@@ -1884,6 +1884,7 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+            hypre_PCGFunctionsSetResidualNorm(pcg_functions, hypre_ParKrylovResidualNorm);
             pcg_solver = hypre_PCGCreate( pcg_functions );
 
             hypre_PCGSetTol(pcg_solver, tol);
@@ -1951,6 +1952,7 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+            hypre_GMRESFunctionsSetResidualNorm(gmres_functions, hypre_ParKrylovResidualNorm);
             pcg_solver = hypre_GMRESCreate( gmres_functions );
 
             hypre_GMRESSetTol(pcg_solver, tol);
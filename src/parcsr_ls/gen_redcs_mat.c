@@ -490,6 +490,198 @@ hypre_seqAMGCycle( hypre_ParAMGData *amg_data,
    return (Solve_err_flag);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAgglomerateSetup
+ *
+ * Agglomerates the matrix on level p_level onto about
+ * global_num_rows / agglom_threshold ranks and sets up a nested BoomerAMG
+ * solver there, which continues the hierarchy. Groups of consecutive ranks
+ * send their rows to the group leader; the other ranks stay idle in the
+ * coarse solve. The nested solver may agglomerate again on its own levels.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGAgglomerateSetup( hypre_ParAMGData *amg_data,
+                                 HYPRE_Int         p_level )
+{
+   hypre_ParCSRMatrix  *A = hypre_ParAMGDataAArray(amg_data)[p_level];
+   MPI_Comm             comm = hypre_ParCSRMatrixComm(A);
+   HYPRE_BigInt         global_num_rows = hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_Int            agglom_threshold = hypre_ParAMGDataAgglomThreshold(amg_data);
+   HYPRE_Int            num_functions = hypre_ParAMGDataNumFunctions(amg_data);
+   hypre_IntArray     **dof_func_array = hypre_ParAMGDataDofFuncArray(amg_data);
+
+   MPI_Comm             group_comm;
+   hypre_ParCSRMatrix  *A_new = NULL;
+   hypre_ParVector     *F_new, *U_new;
+   HYPRE_Solver         coarse_solver;
+
+   HYPRE_Int           *counts = NULL;
+   HYPRE_Int           *displs = NULL;
+   HYPRE_Int           *new_dof_func = NULL;
+   HYPRE_Int           *dof_func = NULL;
+   HYPRE_Int            num_procs, new_num_procs, group_size, group_nprocs;
+   HYPRE_Int            num_rows, i;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   new_num_procs = (HYPRE_Int) hypre_max(global_num_rows / (HYPRE_BigInt) agglom_threshold, 1);
+   group_size    = hypre_max((num_procs + new_num_procs - 1) / new_num_procs, 2);
+
+   hypre_ParCSRMatrixRedistribute(A, group_size, &group_comm, &A_new);
+   hypre_MPI_Comm_size(group_comm, &group_nprocs);
+
+   /* row counts of the group members, needed to gather and scatter vectors */
+   num_rows = hypre_ParCSRMatrixNumRows(A);
+   if (A_new)
+   {
+      counts = hypre_CTAlloc(HYPRE_Int, group_nprocs, HYPRE_MEMORY_HOST);
+      displs = hypre_CTAlloc(HYPRE_Int, group_nprocs + 1, HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gather(&num_rows, 1, HYPRE_MPI_INT, counts, 1, HYPRE_MPI_INT, 0, group_comm);
+   if (A_new)
+   {
+      for (i = 0; i < group_nprocs; i++)
+      {
+         displs[i + 1] = displs[i] + counts[i];
+      }
+   }
+
+   if (num_functions > 1)
+   {
+      if (A_new)
+      {
+         new_dof_func = hypre_CTAlloc(HYPRE_Int, displs[group_nprocs], HYPRE_MEMORY_DEVICE);
+      }
+      if (dof_func_array[p_level])
+      {
+         dof_func = hypre_IntArrayData(dof_func_array[p_level]);
+      }
+      hypre_MPI_Gatherv(dof_func, num_rows, HYPRE_MPI_INT, new_dof_func, counts, displs,
+                        HYPRE_MPI_INT, 0, group_comm);
+   }
+
+   if (A_new)
+   {
+      HYPRE_BoomerAMGCreate(&coarse_solver);
+      HYPRE_BoomerAMGSetMaxRowSum(coarse_solver,
+                                  hypre_ParAMGDataMaxRowSum(amg_data));
+      HYPRE_BoomerAMGSetStrongThreshold(coarse_solver,
+                                        hypre_ParAMGDataStrongThreshold(amg_data));
+      HYPRE_BoomerAMGSetCoarsenType(coarse_solver,
+                                    hypre_ParAMGDataCoarsenType(amg_data));
+      HYPRE_BoomerAMGSetInterpType(coarse_solver,
+                                   hypre_ParAMGDataInterpType(amg_data));
+      HYPRE_BoomerAMGSetTruncFactor(coarse_solver,
+                                    hypre_ParAMGDataTruncFactor(amg_data));
+      HYPRE_BoomerAMGSetPMaxElmts(coarse_solver,
+                                  hypre_ParAMGDataPMaxElmts(amg_data));
+      if (hypre_ParAMGDataUserRelaxType(amg_data) > -1)
+      {
+         HYPRE_BoomerAMGSetRelaxType(coarse_solver,
+                                     hypre_ParAMGDataUserRelaxType(amg_data));
+      }
+      HYPRE_BoomerAMGSetRelaxOrder(coarse_solver,
+                                   hypre_ParAMGDataRelaxOrder(amg_data));
+      HYPRE_BoomerAMGSetRelaxWt(coarse_solver,
+                                hypre_ParAMGDataUserRelaxWeight(amg_data));
+      if (hypre_ParAMGDataUserNumSweeps(amg_data) > -1)
+      {
+         HYPRE_BoomerAMGSetNumSweeps(coarse_solver,
+                                     hypre_ParAMGDataUserNumSweeps(amg_data));
+      }
+      HYPRE_BoomerAMGSetNumFunctions(coarse_solver, num_functions);
+      if (new_dof_func)
+      {
+         HYPRE_BoomerAMGSetDofFunc(coarse_solver, new_dof_func);
+      }
+      HYPRE_BoomerAMGSetMaxLevels(coarse_solver,
+                                  hypre_ParAMGDataMaxLevels(amg_data) - p_level);
+      HYPRE_BoomerAMGSetMaxCoarseSize(coarse_solver,
+                                      hypre_ParAMGDataMaxCoarseSize(amg_data));
+      HYPRE_BoomerAMGSetAgglomThreshold(coarse_solver, agglom_threshold);
+      HYPRE_BoomerAMGSetMaxIter(coarse_solver, 1);
+      HYPRE_BoomerAMGSetTol(coarse_solver, 0);
+      HYPRE_BoomerAMGSetNeighborColl(coarse_solver,
+                                     hypre_ParAMGDataNeighborColl(amg_data));
+      if (hypre_ParAMGDataNeighborColl(amg_data))
+      {
+         hypre_ParCSRMatrixSetNeighborColl(A_new, 1);
+      }
+
+      F_new = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_new), global_num_rows,
+                                    hypre_ParCSRMatrixRowStarts(A_new));
+      U_new = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_new), global_num_rows,
+                                    hypre_ParCSRMatrixRowStarts(A_new));
+      hypre_ParVectorInitialize(F_new);
+      hypre_ParVectorInitialize(U_new);
+
+      hypre_BoomerAMGSetup(coarse_solver, A_new, F_new, U_new);
+
+      hypre_ParAMGDataCoarseSolver(amg_data) = coarse_solver;
+      hypre_ParAMGDataACoarse(amg_data) = A_new;
+      hypre_ParAMGDataFCoarse(amg_data) = F_new;
+      hypre_ParAMGDataUCoarse(amg_data) = U_new;
+      hypre_ParAMGDataNewComm(amg_data) = hypre_ParCSRMatrixComm(A_new);
+   }
+
+   hypre_ParAMGDataAgglomComm(amg_data) = group_comm;
+   hypre_ParAMGDataAgglomCounts(amg_data) = counts;
+   hypre_ParAMGDataAgglomDispls(amg_data) = displs;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAgglomerateCycle
+ *
+ * Coarse solve on an agglomerated level: f and u are gathered on the group
+ * leaders, which run one cycle of the nested solver, and u is scattered
+ * back to the group members.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGAgglomerateCycle( hypre_ParAMGData *amg_data,
+                                 HYPRE_Int         p_level,
+                                 hypre_ParVector **F_array,
+                                 hypre_ParVector **U_array )
+{
+   MPI_Comm            group_comm = hypre_ParAMGDataAgglomComm(amg_data);
+   HYPRE_Int          *counts = hypre_ParAMGDataAgglomCounts(amg_data);
+   HYPRE_Int          *displs = hypre_ParAMGDataAgglomDispls(amg_data);
+   HYPRE_Solver        coarse_solver = hypre_ParAMGDataCoarseSolver(amg_data);
+   hypre_ParCSRMatrix *A_coarse = hypre_ParAMGDataACoarse(amg_data);
+   hypre_ParVector    *F_coarse = hypre_ParAMGDataFCoarse(amg_data);
+   hypre_ParVector    *U_coarse = hypre_ParAMGDataUCoarse(amg_data);
+
+   HYPRE_Real         *f_data = hypre_VectorData(hypre_ParVectorLocalVector(F_array[p_level]));
+   HYPRE_Real         *u_data = hypre_VectorData(hypre_ParVectorLocalVector(U_array[p_level]));
+   HYPRE_Int           n = hypre_VectorSize(hypre_ParVectorLocalVector(U_array[p_level]));
+   HYPRE_Real         *f_coarse_data = NULL;
+   HYPRE_Real         *u_coarse_data = NULL;
+
+   if (A_coarse)
+   {
+      f_coarse_data = hypre_VectorData(hypre_ParVectorLocalVector(F_coarse));
+      u_coarse_data = hypre_VectorData(hypre_ParVectorLocalVector(U_coarse));
+   }
+
+   hypre_MPI_Gatherv(f_data, n, HYPRE_MPI_REAL, f_coarse_data, counts, displs,
+                     HYPRE_MPI_REAL, 0, group_comm);
+   hypre_MPI_Gatherv(u_data, n, HYPRE_MPI_REAL, u_coarse_data, counts, displs,
+                     HYPRE_MPI_REAL, 0, group_comm);
+
+   if (A_coarse)
+   {
+      hypre_BoomerAMGSolve(coarse_solver, A_coarse, F_coarse, U_coarse);
+   }
+
+   hypre_MPI_Scatterv(u_coarse_data, counts, displs, HYPRE_MPI_REAL,
+                      u_data, n, HYPRE_MPI_REAL, 0, group_comm);
+
+   return hypre_error_flag;
+}
+
 /* generate sub communicator, which contains no idle processors */
 
 HYPRE_Int hypre_GenerateSubComm(MPI_Comm comm, HYPRE_Int participate, MPI_Comm *new_comm_ptr)
@@ -0,0 +1,633 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Aggregation coarsening for BoomerAMG (coarsen_type 12) and the tentative
+ * and smoothed aggregation prolongators built from it (interp_type 25, 26).
+ *
+ * The roots of the aggregates are a distance-2 maximal independent set of
+ * the symmetrized strength graph. Every other point with a strong
+ * connection joins the aggregate of a neighboring root, or else of a
+ * neighbor that did. The roots are marked as C-points, so the coarse
+ * numbering, coarse_dof_func etc. are the ones of any other coarsening.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+#define AGG_UNDECIDED  0
+#define AGG_ROOT       1
+#define AGG_REMOVED   -1
+#define AGG_ISOLATED  -2
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAggregateKey
+ *
+ * Random-looking but unique priority of a point, computed from its global
+ * index only, so that the independent set does not depend on the number
+ * of processes.
+ *--------------------------------------------------------------------------*/
+
+static inline hypre_ulonglongint
+hypre_BoomerAMGAggregateKey( HYPRE_BigInt gid )
+{
+   return ((hypre_ulonglongint) gid + 1) * 0x9E3779B97F4A7C15ULL;
+}
+
+/*--------------------------------------------------------------------------
+ * Exchange of the values of the local points to the ghost points of G
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGAggregateSendInt( hypre_ParCSRCommPkg *comm_pkg,
+                                 HYPRE_Int           *local,
+                                 HYPRE_Int           *int_buf,
+                                 HYPRE_Int           *offd )
+{
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int               num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int               i;
+
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+   {
+      int_buf[i] = local[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf, offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+}
+
+static void
+hypre_BoomerAMGAggregateSendBigInt( hypre_ParCSRCommPkg *comm_pkg,
+                                    HYPRE_BigInt        *local,
+                                    HYPRE_BigInt        *big_buf,
+                                    HYPRE_BigInt        *offd )
+{
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int               num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int               i;
+
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+   {
+      big_buf[i] = local[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(21, comm_pkg, big_buf, offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+}
+
+/* keeps in *best the candidate with the larger key (-1 = none) */
+static inline void
+hypre_BoomerAMGAggregateMax( HYPRE_BigInt *best,
+                             HYPRE_BigInt  cand )
+{
+   if (cand >= 0 &&
+       (*best < 0 || hypre_BoomerAMGAggregateKey(cand) > hypre_BoomerAMGAggregateKey(*best)))
+   {
+      *best = cand;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCoarsenAggregates
+ *
+ * Aggregation coarsening on the strength matrix S. On return, CF_marker is
+ * 1 at the roots of the aggregates and -1 elsewhere, and aggregates[i] is
+ * the global coarse index of the aggregate of point i, or -1 for points
+ * without strong connections (and points preset to -3 in CF_marker), which
+ * belong to no aggregate.
+ *
+ * The roots are chosen by a Luby-type iteration: an undecided point becomes
+ * a root if it has the largest key among the undecided points within
+ * distance two, and the undecided points within distance two of a root are
+ * removed. The remaining points are then aggregated in two passes, first
+ * the neighbors of the roots and then the neighbors of those.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGCoarsenAggregates( hypre_ParCSRMatrix    *S,
+                                  HYPRE_Int              debug_flag,
+                                  hypre_IntArray       **CF_marker_ptr,
+                                  HYPRE_BigInt         **aggregates_ptr )
+{
+   MPI_Comm             comm = hypre_ParCSRMatrixComm(S);
+   hypre_ParCSRMatrix  *G;
+   hypre_ParCSRCommPkg *comm_pkg;
+
+   HYPRE_Int           *G_diag_i, *G_diag_j, *G_offd_i, *G_offd_j;
+   HYPRE_BigInt        *col_map_offd;
+   HYPRE_Int            num_variables = hypre_ParCSRMatrixNumRows(S);
+   HYPRE_Int            num_cols_offd, num_sends;
+   HYPRE_BigInt         first_row = hypre_ParCSRMatrixFirstRowIndex(S);
+
+   HYPRE_Int           *CF_marker;
+   HYPRE_Int           *status, *status_offd, *near, *near_offd, *int_buf;
+   HYPRE_BigInt        *best, *best_offd, *aggregates, *agg_offd, *big_buf;
+   HYPRE_BigInt         cand, num_roots, first_root, num_left, global_left;
+   HYPRE_Int            i, j, jj, my_id, iter = 0;
+   HYPRE_Real           wall_time = 0.0;
+
+   if (debug_flag == 3)
+   {
+      wall_time = time_getWallclockSeconds();
+   }
+
+   hypre_BoomerAMGSymmetrizeS(S, &G);
+
+   comm_pkg      = hypre_ParCSRMatrixCommPkg(G);
+   num_sends     = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   G_diag_i      = hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(G));
+   G_diag_j      = hypre_CSRMatrixJ(hypre_ParCSRMatrixDiag(G));
+   G_offd_i      = hypre_CSRMatrixI(hypre_ParCSRMatrixOffd(G));
+   G_offd_j      = hypre_CSRMatrixJ(hypre_ParCSRMatrixOffd(G));
+   num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(G));
+   col_map_offd  = hypre_ParCSRMatrixColMapOffd(G);
+
+   if (*CF_marker_ptr == NULL)
+   {
+      *CF_marker_ptr = hypre_IntArrayCreate(num_variables);
+      hypre_IntArrayInitialize(*CF_marker_ptr);
+   }
+   CF_marker = hypre_IntArrayData(*CF_marker_ptr);
+
+   status      = hypre_CTAlloc(HYPRE_Int, num_variables, HYPRE_MEMORY_HOST);
+   near        = hypre_CTAlloc(HYPRE_Int, num_variables, HYPRE_MEMORY_HOST);
+   best        = hypre_CTAlloc(HYPRE_BigInt, num_variables, HYPRE_MEMORY_HOST);
+   aggregates  = hypre_CTAlloc(HYPRE_BigInt, num_variables, HYPRE_MEMORY_HOST);
+   status_offd = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+   near_offd   = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+   best_offd   = hypre_CTAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+   agg_offd    = hypre_CTAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+   int_buf     = hypre_CTAlloc(HYPRE_Int, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                               HYPRE_MEMORY_HOST);
+   big_buf     = hypre_CTAlloc(HYPRE_BigInt, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                               HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_variables; i++)
+   {
+      if (CF_marker[i] == -3 ||
+          (G_diag_i[i + 1] == G_diag_i[i] && G_offd_i[i + 1] == G_offd_i[i]))
+      {
+         status[i] = AGG_ISOLATED;
+      }
+      else
+      {
+         status[i] = AGG_UNDECIDED;
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Distance-2 maximal independent set
+    *-----------------------------------------------------------------------*/
+
+   while (1)
+   {
+      hypre_BoomerAMGAggregateSendInt(comm_pkg, status, int_buf, status_offd);
+
+      num_left = 0;
+      for (i = 0; i < num_variables; i++)
+      {
+         if (status[i] == AGG_UNDECIDED)
+         {
+            num_left++;
+         }
+      }
+      hypre_MPI_Allreduce(&num_left, &global_left, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+
+      if (debug_flag == 3)
+      {
+         hypre_printf("Aggregation iteration %d: %b undecided points\n", iter, global_left);
+      }
+      if (global_left == 0)
+      {
+         break;
+      }
+      iter++;
+
+      /* largest undecided key within distance one */
+      for (i = 0; i < num_variables; i++)
+      {
+         best[i] = (status[i] == AGG_UNDECIDED) ? first_row + i : -1;
+         for (jj = G_diag_i[i]; jj < G_diag_i[i + 1]; jj++)
+         {
+            j = G_diag_j[jj];
+            if (status[j] == AGG_UNDECIDED)
+            {
+               hypre_BoomerAMGAggregateMax(&best[i], first_row + j);
+            }
+         }
+         for (jj = G_offd_i[i]; jj < G_offd_i[i + 1]; jj++)
+         {
+            j = G_offd_j[jj];
+            if (status_offd[j] == AGG_UNDECIDED)
+            {
+               hypre_BoomerAMGAggregateMax(&best[i], col_map_offd[j]);
+            }
+         }
+      }
+      hypre_BoomerAMGAggregateSendBigInt(comm_pkg, best, big_buf, best_offd);
+
+      /* new roots: largest undecided key within distance two */
+      for (i = 0; i < num_variables; i++)
+      {
+         if (status[i] != AGG_UNDECIDED)
+         {
+            continue;
+         }
+         cand = best[i];
+         for (jj = G_diag_i[i]; jj < G_diag_i[i + 1]; jj++)
+         {
+            hypre_BoomerAMGAggregateMax(&cand, best[G_diag_j[jj]]);
+         }
+         for (jj = G_offd_i[i]; jj < G_offd_i[i + 1]; jj++)
+         {
+            hypre_BoomerAMGAggregateMax(&cand, best_offd[G_offd_j[jj]]);
+         }
+         if (cand == first_row + i)
+         {
+            status[i] = AGG_ROOT;
+         }
+      }
+      hypre_BoomerAMGAggregateSendInt(comm_pkg, status, int_buf, status_offd);
+
+      /* remove the undecided points within distance two of a root */
+      for (i = 0; i < num_variables; i++)
+      {
+         near[i] = (status[i] == AGG_ROOT);
+         for (jj = G_diag_i[i]; jj < G_diag_i[i + 1] && !near[i]; jj++)
+         {
+            near[i] = (status[G_diag_j[jj]] == AGG_ROOT);
+         }
+         for (jj = G_offd_i[i]; jj < G_offd_i[i + 1] && !near[i]; jj++)
+         {
+            near[i] = (status_offd[G_offd_j[jj]] == AGG_ROOT);
+         }
+      }
+      hypre_BoomerAMGAggregateSendInt(comm_pkg, near, int_buf, near_offd);
+
+      for (i = 0; i < num_variables; i++)
+      {
+         if (status[i] != AGG_UNDECIDED)
+         {
+            continue;
+         }
+         if (near[i])
+         {
+            status[i] = AGG_REMOVED;
+            continue;
+         }
+         for (jj = G_diag_i[i]; jj < G_diag_i[i + 1]; jj++)
+         {
+            if (near[G_diag_j[jj]])
+            {
+               status[i] = AGG_REMOVED;
+               break;
+            }
+         }
+         for (jj = G_offd_i[i]; jj < G_offd_i[i + 1] && status[i] == AGG_UNDECIDED; jj++)
+         {
+            if (near_offd[G_offd_j[jj]])
+            {
+               status[i] = AGG_REMOVED;
+            }
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Number the roots as the coarse points and build the aggregates
+    *-----------------------------------------------------------------------*/
+
+   num_roots = 0;
+   for (i = 0; i < num_variables; i++)
+   {
+      if (status[i] == AGG_ROOT)
+      {
+         num_roots++;
+      }
+   }
+   hypre_MPI_Scan(&num_roots, &first_root, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+   first_root -= num_roots;
+
+   for (i = 0; i < num_variables; i++)
+   {
+      if (status[i] == AGG_ROOT)
+      {
+         CF_marker[i]  = 1;
+         aggregates[i] = first_root++;
+      }
+      else
+      {
+         CF_marker[i]  = (CF_marker[i] == -3) ? -3 : -1;
+         aggregates[i] = -1;
+      }
+   }
+
+   /* first pass: the neighbors of the roots; a point is next to one root at
+    * most, since the roots are at distance three or more of each other */
+   hypre_BoomerAMGAggregateSendBigInt(comm_pkg, aggregates, big_buf, agg_offd);
+   for (i = 0; i < num_variables; i++)
+   {
+      if (status[i] != AGG_REMOVED)
+      {
+         continue;
+      }
+      for (jj = G_diag_i[i]; jj < G_diag_i[i + 1]; jj++)
+      {
+         j = G_diag_j[jj];
+         if (status[j] == AGG_ROOT)
+         {
+            aggregates[i] = aggregates[j];
+         }
+      }
+      for (jj = G_offd_i[i]; jj < G_offd_i[i + 1]; jj++)
+      {
+         j = G_offd_j[jj];
+         if (status_offd[j] == AGG_ROOT)
+         {
+            aggregates[i] = agg_offd[j];
+         }
+      }
+   }
+
+   /* second pass: join the aggregate of the neighbor with the largest key
+    * that was aggregated in the first pass */
+   hypre_BoomerAMGAggregateSendBigInt(comm_pkg, aggregates, big_buf, agg_offd);
+   for (i = 0; i < num_variables; i++)
+   {
+      best[i] = -1;
+      if (status[i] != AGG_REMOVED || aggregates[i] >= 0)
+      {
+         continue;
+      }
+      cand = -1;
+      for (jj = G_diag_i[i]; jj < G_diag_i[i + 1]; jj++)
+      {
+         j = G_diag_j[jj];
+         if (aggregates[j] >= 0 && (cand < 0 || hypre_BoomerAMGAggregateKey(first_row + j) >
+                                    hypre_BoomerAMGAggregateKey(cand)))
+         {
+            cand    = first_row + j;
+            best[i] = aggregates[j];
+         }
+      }
+      for (jj = G_offd_i[i]; jj < G_offd_i[i + 1]; jj++)
+      {
+         j = G_offd_j[jj];
+         if (agg_offd[j] >= 0 && (cand < 0 || hypre_BoomerAMGAggregateKey(col_map_offd[j]) >
+                                  hypre_BoomerAMGAggregateKey(cand)))
+         {
+            cand    = col_map_offd[j];
+            best[i] = agg_offd[j];
+         }
+      }
+   }
+   for (i = 0; i < num_variables; i++)
+   {
+      if (best[i] >= 0)
+      {
+         aggregates[i] = best[i];
+      }
+   }
+
+   if (debug_flag == 3)
+   {
+      wall_time = time_getWallclockSeconds() - wall_time;
+      hypre_MPI_Comm_rank(comm, &my_id);
+      hypre_printf("Proc = %d    Coarsen Aggregates = %f\n", my_id, wall_time);
+   }
+
+   hypre_ParCSRMatrixDestroy(G);
+   hypre_TFree(status, HYPRE_MEMORY_HOST);
+   hypre_TFree(near, HYPRE_MEMORY_HOST);
+   hypre_TFree(best, HYPRE_MEMORY_HOST);
+   hypre_TFree(status_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(near_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(best_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(agg_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(int_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(big_buf, HYPRE_MEMORY_HOST);
+
+   *aggregates_ptr = aggregates;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGBuildAggInterp
+ *
+ * Builds the tentative prolongator of the aggregates computed by
+ * hypre_BoomerAMGCoarsenAggregates: row i of P has a single 1 in the column
+ * of the aggregate of i, or no entry if i is in no aggregate. With
+ * block_size > 1 the aggregates are given per node of block_size
+ * consecutive unknowns, and unknown k of a node interpolates from unknown
+ * k of the coarse node.
+ *
+ * If smooth is nonzero, P is improved by one damped Jacobi step,
+ * P = (I - omega D^{-1} A) P, with omega = 4 / (3 rho), rho being the
+ * Gershgorin bound of the spectral radius of D^{-1} A, and is then
+ * truncated with trunc_factor and max_elmts.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGBuildAggInterp( hypre_ParCSRMatrix  *A,
+                               HYPRE_BigInt        *aggregates,
+                               HYPRE_BigInt        *num_cpts_global,
+                               HYPRE_Int            block_size,
+                               HYPRE_Int            smooth,
+                               HYPRE_Int            debug_flag,
+                               HYPRE_Real           trunc_factor,
+                               HYPRE_Int            max_elmts,
+                               hypre_ParCSRMatrix **P_ptr )
+{
+   MPI_Comm            comm   = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int           n_fine = hypre_ParCSRMatrixNumRows(A);
+
+   hypre_ParCSRMatrix *P, *AP, *P_smooth;
+   hypre_CSRMatrix    *AP_diag, *AP_offd;
+   HYPRE_Int          *P_diag_i, *P_diag_j, *P_offd_i, *P_offd_j;
+   HYPRE_Real         *P_diag_data, *P_offd_data;
+   HYPRE_BigInt       *col_map_offd_P = NULL;
+   HYPRE_Int           num_cols_offd_P = 0;
+   HYPRE_Int           nnz_diag = 0, nnz_offd = 0;
+
+   HYPRE_Int          *A_diag_i    = hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int          *A_diag_j    = hypre_CSRMatrixJ(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Real         *A_diag_data = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(A));
+
+   HYPRE_BigInt        total_global_cpts, my_first_cpt, col;
+   HYPRE_Int           my_id, num_procs, i, j, k;
+   HYPRE_Real          max_eig, min_eig, omega, scale;
+   HYPRE_Real          wall_time = 0.0;
+
+   if (debug_flag == 4)
+   {
+      wall_time = time_getWallclockSeconds();
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   my_first_cpt = num_cpts_global[0];
+   if (my_id == (num_procs - 1)) { total_global_cpts = num_cpts_global[1]; }
+   hypre_MPI_Bcast(&total_global_cpts, 1, HYPRE_MPI_BIG_INT, num_procs - 1, comm);
+
+   /*-----------------------------------------------------------------------
+    * Tentative prolongator
+    *-----------------------------------------------------------------------*/
+
+   P_diag_i = hypre_CTAlloc(HYPRE_Int, n_fine + 1, HYPRE_MEMORY_HOST);
+   P_offd_i = hypre_CTAlloc(HYPRE_Int, n_fine + 1, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < n_fine; i++)
+   {
+      col = aggregates[i / block_size];
+      if (col >= 0)
+      {
+         col = col * block_size + i % block_size;
+         if (col >= my_first_cpt && col < num_cpts_global[1])
+         {
+            nnz_diag++;
+         }
+         else
+         {
+            nnz_offd++;
+         }
+      }
+      P_diag_i[i + 1] = nnz_diag;
+      P_offd_i[i + 1] = nnz_offd;
+   }
+
+   /* sorted, unique off-processor coarse columns */
+   if (nnz_offd)
+   {
+      col_map_offd_P = hypre_TAlloc(HYPRE_BigInt, nnz_offd, HYPRE_MEMORY_HOST);
+      for (i = 0; i < n_fine; i++)
+      {
+         if (P_offd_i[i + 1] > P_offd_i[i])
+         {
+            col = aggregates[i / block_size] * block_size + i % block_size;
+            col_map_offd_P[P_offd_i[i]] = col;
+         }
+      }
+
+      hypre_BigQsort0(col_map_offd_P, 0, nnz_offd - 1);
+      num_cols_offd_P = 1;
+      for (i = 1; i < nnz_offd; i++)
+      {
+         if (col_map_offd_P[i] != col_map_offd_P[num_cols_offd_P - 1])
+         {
+            col_map_offd_P[num_cols_offd_P++] = col_map_offd_P[i];
+         }
+      }
+   }
+
+   P_diag_j    = hypre_CTAlloc(HYPRE_Int, nnz_diag, HYPRE_MEMORY_HOST);
+   P_diag_data = hypre_CTAlloc(HYPRE_Real, nnz_diag, HYPRE_MEMORY_HOST);
+   P_offd_j    = hypre_CTAlloc(HYPRE_Int, nnz_offd, HYPRE_MEMORY_HOST);
+   P_offd_data = hypre_CTAlloc(HYPRE_Real, nnz_offd, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < n_fine; i++)
+   {
+      col = aggregates[i / block_size];
+      if (col < 0)
+      {
+         continue;
+      }
+      col = col * block_size + i % block_size;
+      if (P_diag_i[i + 1] > P_diag_i[i])
+      {
+         P_diag_j[P_diag_i[i]]    = (HYPRE_Int) (col - my_first_cpt);
+         P_diag_data[P_diag_i[i]] = 1.0;
+      }
+      else
+      {
+         P_offd_j[P_offd_i[i]]    = hypre_BigBinarySearch(col_map_offd_P, col, num_cols_offd_P);
+         P_offd_data[P_offd_i[i]] = 1.0;
+      }
+   }
+
+   P = hypre_ParCSRMatrixCreate(comm,
+                                hypre_ParCSRMatrixGlobalNumRows(A),
+                                total_global_cpts,
+                                hypre_ParCSRMatrixRowStarts(A),
+                                num_cpts_global,
+                                num_cols_offd_P,
+                                nnz_diag,
+                                nnz_offd);
+
+   hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(P))    = P_diag_i;
+   hypre_CSRMatrixJ(hypre_ParCSRMatrixDiag(P))    = P_diag_j;
+   hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(P)) = P_diag_data;
+   hypre_CSRMatrixI(hypre_ParCSRMatrixOffd(P))    = P_offd_i;
+   hypre_CSRMatrixJ(hypre_ParCSRMatrixOffd(P))    = P_offd_j;
+   hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(P)) = P_offd_data;
+   hypre_ParCSRMatrixColMapOffd(P) = col_map_offd_P;
+
+   hypre_MatvecCommPkgCreate(P);
+
+   /*-----------------------------------------------------------------------
+    * Jacobi smoothing
+    *-----------------------------------------------------------------------*/
+
+   if (smooth)
+   {
+      hypre_ParCSRMaxEigEstimate(A, 1, &max_eig, &min_eig);
+      omega = (max_eig > 0.0) ? 4.0 / (3.0 * max_eig) : 0.0;
+
+      AP      = hypre_ParCSRMatMat(A, P);
+      AP_diag = hypre_ParCSRMatrixDiag(AP);
+      AP_offd = hypre_ParCSRMatrixOffd(AP);
+
+      for (i = 0; i < n_fine; i++)
+      {
+         scale = 0.0;
+         for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+         {
+            if (A_diag_j[j] == i && A_diag_data[j] != 0.0)
+            {
+               scale = -omega / A_diag_data[j];
+               break;
+            }
+         }
+         for (k = hypre_CSRMatrixI(AP_diag)[i]; k < hypre_CSRMatrixI(AP_diag)[i + 1]; k++)
+         {
+            hypre_CSRMatrixData(AP_diag)[k] *= scale;
+         }
+         for (k = hypre_CSRMatrixI(AP_offd)[i]; k < hypre_CSRMatrixI(AP_offd)[i + 1]; k++)
+         {
+            hypre_CSRMatrixData(AP_offd)[k] *= scale;
+         }
+      }
+
+      hypre_ParCSRMatrixAdd(1.0, P, 1.0, AP, &P_smooth);
+      hypre_ParCSRMatrixDestroy(AP);
+      hypre_ParCSRMatrixDestroy(P);
+      P = P_smooth;
+
+      if (trunc_factor != 0.0 || max_elmts > 0)
+      {
+         hypre_BoomerAMGInterpTruncation(P, trunc_factor, max_elmts);
+      }
+
+      if (!hypre_ParCSRMatrixCommPkg(P))
+      {
+         hypre_MatvecCommPkgCreate(P);
+      }
+   }
+
+   if (debug_flag == 4)
+   {
+      wall_time = time_getWallclockSeconds() - wall_time;
+      hypre_printf("Proc = %d    Aggregation interp = %f\n", my_id, wall_time);
+   }
+
+   *P_ptr = P;
+
+   return hypre_error_flag;
+}
@@ -65,6 +65,7 @@ hypre_BoomerAMGCreate()
    HYPRE_Int    cgc_its;
    HYPRE_Int    seq_threshold;
    HYPRE_Int    redundant;
+   HYPRE_Int    agglom_threshold;
    HYPRE_Int    rap2;
    HYPRE_Int    keepT;
    HYPRE_Int    modu_rap;
@@ -83,6 +84,7 @@ hypre_BoomerAMGCreate()
    HYPRE_Int    relax_up;
    HYPRE_Int    relax_coarse;
    HYPRE_Int    relax_order;
+   HYPRE_Int    relax_cache_block;
    HYPRE_Real   relax_wt;
    HYPRE_Real   outer_wt;
    HYPRE_Real   nongalerkin_tol;
@@ -119,6 +121,7 @@ hypre_BoomerAMGCreate()
    HYPRE_Int cheby_variant;
    HYPRE_Int cheby_scale;
    HYPRE_Real cheby_eig_ratio;
+   HYPRE_Int cheby_eig_refine;
 
    HYPRE_Int block_mode;
 
@@ -143,6 +146,7 @@ hypre_BoomerAMGCreate()
    HYPRE_Int    debug_flag;
 
    char     plot_file_name[251] = {0};
+   char     profile_file_name[256] = {0};
 
    /*-----------------------------------------------------------------------
     * Setup default values for parameters
@@ -154,6 +158,7 @@ hypre_BoomerAMGCreate()
    min_coarse_size = 0;
    seq_threshold = 0;
    redundant = 0;
+   agglom_threshold = 0;
    coarsen_cut_factor = 0;
    strong_threshold = 0.25;
    strong_threshold_R = 0.25;
@@ -238,6 +243,7 @@ hypre_BoomerAMGCreate()
    relax_up = 14;
    relax_coarse = 9;
    relax_order = 0;
+   relax_cache_block = 0;
    relax_wt = 1.0;
    outer_wt = 1.0;
 
@@ -246,6 +252,7 @@ hypre_BoomerAMGCreate()
    cheby_scale = 1;
    cheby_eig_est = 10;
    cheby_eig_ratio = .3;
+   cheby_eig_refine = 0;
 
    block_mode = 0;
 
@@ -379,6 +386,7 @@ hypre_BoomerAMGCreate()
    hypre_BoomerAMGSetCycleRelaxType(amg_data, relax_up, 2);
    hypre_BoomerAMGSetCycleRelaxType(amg_data, relax_coarse, 3);
    hypre_BoomerAMGSetRelaxOrder(amg_data, relax_order);
+   hypre_BoomerAMGSetRelaxCacheBlock(amg_data, relax_cache_block);
    hypre_BoomerAMGSetRelaxWt(amg_data, relax_wt);
    hypre_BoomerAMGSetOuterWt(amg_data, outer_wt);
    hypre_BoomerAMGSetSmoothType(amg_data, smooth_type);
@@ -390,6 +398,7 @@ hypre_BoomerAMGCreate()
    hypre_BoomerAMGSetChebyEigEst(amg_data, cheby_eig_est);
    hypre_BoomerAMGSetChebyVariant(amg_data, cheby_variant);
    hypre_BoomerAMGSetChebyScale(amg_data, cheby_scale);
+   hypre_BoomerAMGSetChebyEigRefine(amg_data, cheby_eig_refine);
 
    hypre_BoomerAMGSetNumIterations(amg_data, num_iterations);
 
@@ -424,10 +433,15 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataPArray(amg_data) = NULL;
    hypre_ParAMGDataRArray(amg_data) = NULL;
    hypre_ParAMGDataCFMarkerArray(amg_data) = NULL;
+   hypre_ParAMGDataRelaxBlocks(amg_data) = NULL;
    hypre_ParAMGDataVtemp(amg_data)  = NULL;
    hypre_ParAMGDataRtemp(amg_data)  = NULL;
    hypre_ParAMGDataPtemp(amg_data)  = NULL;
    hypre_ParAMGDataZtemp(amg_data)  = NULL;
+   hypre_ParAMGDataMVWork(amg_data) = NULL;
+   hypre_ParAMGDataMVWorkSize(amg_data)     = 0;
+   hypre_ParAMGDataMVNumVectors(amg_data)   = 0;
+   hypre_ParAMGDataMVActive(amg_data)       = 0;
    hypre_ParAMGDataFArray(amg_data) = NULL;
    hypre_ParAMGDataUArray(amg_data) = NULL;
    hypre_ParAMGDataDofFunc(amg_data) = NULL;
@@ -450,11 +464,17 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataMinEigEst(amg_data) = NULL;
    hypre_ParAMGDataChebyDS(amg_data) = NULL;
    hypre_ParAMGDataChebyCoefs(amg_data) = NULL;
+   hypre_ParAMGDataChebyNumEigCache(amg_data) = 0;
+   hypre_ParAMGDataChebyEigCache(amg_data) = NULL;
+   hypre_ParAMGDataChebyEigVecs(amg_data) = NULL;
 
    /* BM Oct 22, 2006 */
    hypre_ParAMGDataPlotGrids(amg_data) = 0;
    hypre_BoomerAMGSetPlotFileName (amg_data, plot_file_name);
 
+   hypre_ParAMGDataProfile(amg_data) = NULL;
+   hypre_BoomerAMGSetProfileFile(amg_data, profile_file_name);
+
    /* BM Oct 17, 2006 */
    hypre_ParAMGDataCoordDim(amg_data) = 0;
    hypre_ParAMGDataCoordinates(amg_data) = NULL;
@@ -481,6 +501,13 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataUCoarse(amg_data) = NULL;
    hypre_ParAMGDataNewComm(amg_data) = hypre_MPI_COMM_NULL;
 
+   /* for coarse-level agglomeration */
+   hypre_ParAMGDataAgglomThreshold(amg_data) = agglom_threshold;
+   hypre_ParAMGDataNeighborColl(amg_data) = 0;
+   hypre_ParAMGDataAgglomComm(amg_data) = hypre_MPI_COMM_NULL;
+   hypre_ParAMGDataAgglomCounts(amg_data) = NULL;
+   hypre_ParAMGDataAgglomDispls(amg_data) = NULL;
+
    /* for Gaussian elimination coarse grid solve */
    hypre_ParAMGDataGSSetup(amg_data) = 0;
    hypre_ParAMGDataAMat(amg_data) = NULL;
@@ -494,6 +521,9 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataRAP2(amg_data)              = rap2;
    hypre_ParAMGDataKeepTranspose(amg_data)     = keepT;
    hypre_ParAMGDataModularizedMatMat(amg_data) = modu_rap;
+   hypre_ParAMGDataMixedPrecisionLevel(amg_data) = -1;
+   hypre_ParAMGDataSetupReuse(amg_data)          = 0;
+   hypre_ParAMGDataRAPPlanArray(amg_data)        = NULL;
 
    /* information for preserving indices as coarse grid points */
    hypre_ParAMGDataCPointsMarker(amg_data)      = NULL;
@@ -533,6 +563,9 @@ hypre_BoomerAMGDestroy( void *data )
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
+   hypre_BoomerAMGProfileDestroy(amg_data);
+   hypre_BoomerAMGSolveWorkDestroy(amg_data);
+
 #ifdef HYPRE_USING_DSUPERLU
    //   if (hypre_ParAMGDataDSLUThreshold(amg_data) > 0)
    if (hypre_ParAMGDataDSLUSolver(amg_data) != NULL)
@@ -597,6 +630,8 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_IntArrayDestroy(hypre_ParAMGDataDofFunc(amg_data));
       hypre_ParAMGDataDofFunc(amg_data) = NULL;
    }
+   hypre_BoomerAMGSetupReuseDestroy(amg_data);
+
    for (i = 1; i < num_levels; i++)
    {
       hypre_ParVectorDestroy(hypre_ParAMGDataFArray(amg_data)[i]);
@@ -703,6 +738,16 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataChebyDS(amg_data), HYPRE_MEMORY_HOST);
    }
 
+   if (hypre_ParAMGDataChebyEigVecs(amg_data))
+   {
+      for (i = 0; i < hypre_ParAMGDataChebyNumEigCache(amg_data); i++)
+      {
+         hypre_ParVectorDestroy(hypre_ParAMGDataChebyEigVecs(amg_data)[i]);
+      }
+      hypre_TFree(hypre_ParAMGDataChebyEigVecs(amg_data), HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(hypre_ParAMGDataChebyEigCache(amg_data), HYPRE_MEMORY_HOST);
+
    if (hypre_ParAMGDataDinv(amg_data))
    {
       hypre_TFree(hypre_ParAMGDataDinv(amg_data), HYPRE_MEMORY_HOST);
@@ -876,6 +921,8 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_ParVectorDestroy(hypre_ParAMGDataFCoarse(amg_data));
    }
 
+   hypre_TFree(hypre_ParAMGDataRelaxBlocks(amg_data), HYPRE_MEMORY_HOST);
+
    /* destroy input CF_marker data */
    hypre_TFree(hypre_ParAMGDataCPointsMarker(amg_data), HYPRE_MEMORY_DEVICE);
    hypre_TFree(hypre_ParAMGDataCPointsLocalMarker(amg_data), HYPRE_MEMORY_DEVICE);
@@ -891,6 +938,13 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_MPI_Comm_free (&new_comm);
    }
 
+   if (hypre_ParAMGDataAgglomComm(amg_data) != hypre_MPI_COMM_NULL)
+   {
+      hypre_MPI_Comm_free(&hypre_ParAMGDataAgglomComm(amg_data));
+   }
+   hypre_TFree(hypre_ParAMGDataAgglomCounts(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataAgglomDispls(amg_data), HYPRE_MEMORY_HOST);
+
    hypre_TFree(amg_data, HYPRE_MEMORY_HOST);
 
    HYPRE_ANNOTATE_FUNC_END;
@@ -1205,6 +1259,94 @@ hypre_BoomerAMGGetRedundant( void *data,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetAgglomThreshold
+ *
+ * Once a coarse level has fewer than agglom_threshold rows per rank on
+ * average, the rest of the hierarchy is built on a subset of the ranks.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetAgglomThreshold( void      *data,
+                                   HYPRE_Int  agglom_threshold )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (agglom_threshold < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataAgglomThreshold(amg_data) = agglom_threshold;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetAgglomThreshold( void      *data,
+                                   HYPRE_Int *agglom_threshold )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *agglom_threshold = hypre_ParAMGDataAgglomThreshold(amg_data);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetNeighborColl
+ *
+ * Selects neighborhood collectives (1) or point-to-point messages (0) for
+ * the halo exchanges of the coarse levels, P and R built in the setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetNeighborColl( void      *data,
+                                HYPRE_Int  neighbor_coll )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataNeighborColl(amg_data) = neighbor_coll;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetNeighborColl( void      *data,
+                                HYPRE_Int *neighbor_coll )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *neighbor_coll = hypre_ParAMGDataNeighborColl(amg_data);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetCoarsenCutFactor( void       *data,
                                     HYPRE_Int   coarsen_cut_factor )
@@ -1595,7 +1737,7 @@ hypre_BoomerAMGSetInterpType( void     *data,
    }
 
 
-   if ((interp_type < 0 || interp_type > 25) && interp_type != 100)
+   if ((interp_type < 0 || interp_type > 26) && interp_type != 100)
 
    {
       hypre_error_in_arg(2);
@@ -2255,6 +2397,27 @@ hypre_BoomerAMGSetRelaxOrder( void     *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetRelaxCacheBlock( void     *data,
+                                   HYPRE_Int       relax_cache_block)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (relax_cache_block < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataRelaxCacheBlock(amg_data) = relax_cache_block;
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGGetRelaxOrder( void     *data,
                               HYPRE_Int     * relax_order)
@@ -2977,6 +3140,36 @@ hypre_BoomerAMGSetPlotFileName( void       *data,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetProfileFile
+ *
+ * A NULL or empty file name turns the profile off.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetProfileFile( void       *data,
+                               const char *profile_file_name )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (profile_file_name && strlen(profile_file_name) > 255)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_sprintf(hypre_ParAMGDataProfileFileName(amg_data), "%s",
+                 profile_file_name ? profile_file_name : "");
+
+   return hypre_error_flag;
+}
+
 /* Get the coarse grid hierarchy. Assumes cgrid is preallocated to the size of the local matrix.
  * Adapted from par_amg_setup.c, and simplified by ignoring printing in block mode.
  * We do a memcpy on the final grid hierarchy to avoid modifying user allocated data.
@@ -4441,6 +4634,35 @@ hypre_BoomerAMGSetChebyScale( void     *data,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetChebyEigRefine
+ *
+ * Number of power iterations that refine the cached Chebyshev eigenvalue
+ * estimates of a level whose matrix drifted between setups. 0 disables
+ * the cache and re-estimates on every setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetChebyEigRefine( void     *data,
+                                  HYPRE_Int     cheby_eig_refine)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (cheby_eig_refine < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataChebyEigRefine(amg_data) = cheby_eig_refine;
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  * hypre_BoomerAMGSetInterpVectors
@@ -4835,6 +5057,44 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetMixedPrecisionLevel( void       *data,
+                                       HYPRE_Int   mp_level)
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataMixedPrecisionLevel(amg_data) = mp_level;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetSetupReuse( void       *data,
+                              HYPRE_Int   setup_reuse)
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (setup_reuse < 0 || setup_reuse > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataSetupReuse(amg_data) = setup_reuse;
+   return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
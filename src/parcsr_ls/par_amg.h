@@ -12,6 +12,55 @@
 
 #include "par_csr_block_matrix.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_AMGProfile
+ *
+ * Per-level, per-phase profile of BoomerAMG setup and solve (see
+ * par_amg_profile.c).  Each record holds the number of calls, wall time,
+ * point-to-point messages, bytes sent and flops of one phase on one level.
+ * Messages, bytes and flops are differences of the global operation counters
+ * (hypre_OpCounts) around the phase, and the communication package setup done
+ * inside a phase is moved to the COMMPKG phase of the same level.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_AMG_PROFILE_STRENGTH      0
+#define HYPRE_AMG_PROFILE_COARSEN       1
+#define HYPRE_AMG_PROFILE_INTERP        2
+#define HYPRE_AMG_PROFILE_RAP           3
+#define HYPRE_AMG_PROFILE_COMMPKG       4
+#define HYPRE_AMG_PROFILE_SMOOTH        5
+#define HYPRE_AMG_PROFILE_RESTRICT      6
+#define HYPRE_AMG_PROFILE_INTERP_APPLY  7
+#define HYPRE_AMG_PROFILE_NUM_PHASES    8
+
+#define HYPRE_AMG_PROFILE_SETUP         0
+#define HYPRE_AMG_PROFILE_SOLVE         1
+
+/* calls, time, messages, bytes, flops */
+#define HYPRE_AMG_PROFILE_NUM_COUNTS    5
+
+typedef struct
+{
+   MPI_Comm       comm;
+   HYPRE_Int      num_levels;      /* levels of the last setup */
+   HYPRE_Int      max_levels;      /* levels allocated in counts */
+   HYPRE_Real    *counts;          /* [level][phase][count] */
+   HYPRE_Real     stage_counts[2][HYPRE_AMG_PROFILE_NUM_COUNTS];
+   HYPRE_BigInt  *level_rows;
+   HYPRE_Real    *level_nonzeros;  /* local, summed when written */
+
+   /* open stage and phase (phase < 0 if none), with the operation counters
+      at their start: time, messages, bytes, flops, comm pkg time, comm pkg
+      messages, comm pkg bytes, comm pkg calls */
+   HYPRE_Int      stage;
+   HYPRE_Int      stage_depth;     /* a solve may be nested in the setup */
+   HYPRE_Int      level;
+   HYPRE_Int      phase;
+   HYPRE_Real     stage_start[8];
+   HYPRE_Real     phase_start[8];
+
+} hypre_AMGProfile;
+
 /*--------------------------------------------------------------------------
  * hypre_ParAMGData
  *--------------------------------------------------------------------------*/
@@ -60,6 +109,8 @@ typedef struct
    HYPRE_Int      seq_threshold;
    HYPRE_Int      redundant;
    HYPRE_Int      participate;
+   HYPRE_Int      agglom_threshold;
+   HYPRE_Int      neighbor_coll;
    HYPRE_Int      Sabs;
 
    /* solve params */
@@ -71,6 +122,9 @@ typedef struct
    HYPRE_Int     *grid_relax_type;
    HYPRE_Int    **grid_relax_points;
    HYPRE_Int      relax_order;
+   HYPRE_Int      relax_cache_block;
+   /* relax blocks of the fine level, kept off the user's matrix between solves */
+   HYPRE_Int     *relax_blocks;
    HYPRE_Int      user_coarse_relax_type;
    HYPRE_Int      user_relax_type;
    HYPRE_Int      user_num_sweeps;
@@ -161,6 +215,12 @@ typedef struct
    HYPRE_Real           cheby_fraction;
    hypre_Vector       **cheby_ds;
    HYPRE_Real         **cheby_coefs;
+   HYPRE_Int            cheby_eig_refine;
+   /* spectral bounds kept across setups: max, min and the Rayleigh quotient
+      of the cached vector, per level */
+   HYPRE_Int            cheby_num_eig_cache;
+   HYPRE_Real          *cheby_eig_cache;
+   hypre_ParVector    **cheby_eig_vecs;
 
    /* data needed for non-Galerkin option */
    HYPRE_Int           nongalerk_num_tol;
@@ -177,6 +237,13 @@ typedef struct
    hypre_ParVector   *Ptemp;
    hypre_ParVector   *Ztemp;
 
+   /* work vectors with mv_num_vectors columns for multivector solves,
+    * swapped in for the single-column ones while mv_active is set */
+   hypre_ParVector  **mv_work;
+   HYPRE_Int          mv_work_size;
+   HYPRE_Int          mv_num_vectors;
+   HYPRE_Int          mv_active;
+
    /* fields used by GSMG and LS interpolation */
    HYPRE_Int          gsmg;        /* nonzero indicates use of GSMG */
    HYPRE_Int          num_samples; /* number of sample vectors */
@@ -199,6 +266,10 @@ typedef struct
    HYPRE_Int      plot_grids;
    char           plot_filename[251];
 
+   /* per-level profile, written to profile_file_name if it is not empty */
+   char               profile_file_name[256];
+   hypre_AMGProfile  *profile;
+
    /* coordinate data BM Oct 17, 2006 */
    HYPRE_Int      coorddim;
    float         *coordinates;
@@ -223,6 +294,12 @@ typedef struct
    hypre_ParVector     *u_coarse;
    MPI_Comm             new_comm;
 
+   /* coarse-level agglomeration: communicator of the group of ranks whose
+      rows were merged onto its first rank, row counts/offsets (on that rank) */
+   MPI_Comm             agglom_comm;
+   HYPRE_Int           *agglom_counts;
+   HYPRE_Int           *agglom_displs;
+
    /* store matrix, vector and communication info for Gaussian elimination */
    HYPRE_Int   gs_setup;
    HYPRE_Real *A_mat, *A_inv;
@@ -249,6 +326,13 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* store A, P and R in single precision from this level on */
+   HYPRE_Int mp_level;
+
+   /* on a new setup, keep the coarsening (and P) of the previous one */
+   HYPRE_Int setup_reuse;
+   hypre_ParCSRRAPPlan **rap_plan_array;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -317,6 +401,8 @@ typedef struct
 #define hypre_ParAMGDataMaxCoarseSize(amg_data)        ((amg_data) -> max_coarse_size)
 #define hypre_ParAMGDataMinCoarseSize(amg_data)        ((amg_data) -> min_coarse_size)
 #define hypre_ParAMGDataSeqThreshold(amg_data)         ((amg_data) -> seq_threshold)
+#define hypre_ParAMGDataAgglomThreshold(amg_data)      ((amg_data) -> agglom_threshold)
+#define hypre_ParAMGDataNeighborColl(amg_data)         ((amg_data) -> neighbor_coll)
 
 /* solve params */
 
@@ -336,6 +422,8 @@ typedef struct
 #define hypre_ParAMGDataGridRelaxType(amg_data) ((amg_data)->grid_relax_type)
 #define hypre_ParAMGDataGridRelaxPoints(amg_data) ((amg_data)->grid_relax_points)
 #define hypre_ParAMGDataRelaxOrder(amg_data) ((amg_data)->relax_order)
+#define hypre_ParAMGDataRelaxCacheBlock(amg_data) ((amg_data)->relax_cache_block)
+#define hypre_ParAMGDataRelaxBlocks(amg_data) ((amg_data)->relax_blocks)
 #define hypre_ParAMGDataRelaxWeight(amg_data) ((amg_data)->relax_weight)
 #define hypre_ParAMGDataOmega(amg_data) ((amg_data)->omega)
 #define hypre_ParAMGDataOuterWt(amg_data) ((amg_data)->outer_wt)
@@ -410,6 +498,10 @@ typedef struct
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
+#define hypre_ParAMGDataChebyEigRefine(amg_data) ((amg_data)->cheby_eig_refine)
+#define hypre_ParAMGDataChebyNumEigCache(amg_data) ((amg_data)->cheby_num_eig_cache)
+#define hypre_ParAMGDataChebyEigCache(amg_data) ((amg_data)->cheby_eig_cache)
+#define hypre_ParAMGDataChebyEigVecs(amg_data) ((amg_data)->cheby_eig_vecs)
 
 /* block */
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
@@ -427,6 +519,10 @@ typedef struct
 #define hypre_ParAMGDataRtemp(amg_data) ((amg_data)->Rtemp)
 #define hypre_ParAMGDataPtemp(amg_data) ((amg_data)->Ptemp)
 #define hypre_ParAMGDataZtemp(amg_data) ((amg_data)->Ztemp)
+#define hypre_ParAMGDataMVWork(amg_data) ((amg_data)->mv_work)
+#define hypre_ParAMGDataMVWorkSize(amg_data) ((amg_data)->mv_work_size)
+#define hypre_ParAMGDataMVNumVectors(amg_data) ((amg_data)->mv_num_vectors)
+#define hypre_ParAMGDataMVActive(amg_data) ((amg_data)->mv_active)
 
 /* fields used by GSMG */
 #define hypre_ParAMGDataGSMG(amg_data) ((amg_data)->gsmg)
@@ -449,6 +545,8 @@ typedef struct
 /* BM Oct 22, 2006 */
 #define hypre_ParAMGDataPlotGrids(amg_data) ((amg_data)->plot_grids)
 #define hypre_ParAMGDataPlotFileName(amg_data) ((amg_data)->plot_filename)
+#define hypre_ParAMGDataProfileFileName(amg_data) ((amg_data)->profile_file_name)
+#define hypre_ParAMGDataProfile(amg_data) ((amg_data)->profile)
 
 /* coordinates BM Oct 17, 2006 */
 #define hypre_ParAMGDataCoordDim(amg_data) ((amg_data)->coorddim)
@@ -474,6 +572,9 @@ typedef struct
 #define hypre_ParAMGDataNewComm(amg_data) ((amg_data)->new_comm)
 #define hypre_ParAMGDataRedundant(amg_data) ((amg_data)->redundant)
 #define hypre_ParAMGDataParticipate(amg_data) ((amg_data)->participate)
+#define hypre_ParAMGDataAgglomComm(amg_data) ((amg_data)->agglom_comm)
+#define hypre_ParAMGDataAgglomCounts(amg_data) ((amg_data)->agglom_counts)
+#define hypre_ParAMGDataAgglomDispls(amg_data) ((amg_data)->agglom_displs)
 
 #define hypre_ParAMGDataGSSetup(amg_data) ((amg_data)->gs_setup)
 #define hypre_ParAMGDataAMat(amg_data) ((amg_data)->A_mat)
@@ -505,6 +606,9 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataMixedPrecisionLevel(amg_data) ((amg_data)->mp_level)
+#define hypre_ParAMGDataSetupReuse(amg_data) ((amg_data)->setup_reuse)
+#define hypre_ParAMGDataRAPPlanArray(amg_data) ((amg_data)->rap_plan_array)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
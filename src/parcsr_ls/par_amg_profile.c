@@ -0,0 +1,445 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Per-level profile of BoomerAMG setup and solve.
+ *
+ * The setup and the cycle mark the phases of each level (strength,
+ * coarsening, interpolation, RAP, smoothing, restriction and interpolation
+ * apply) with hypre_BoomerAMGProfileBegin. A phase lasts until the next
+ * phase begins or hypre_BoomerAMGProfileEnd is called, so that every moment
+ * is charged to at most one phase. For each phase, the wall time and the
+ * differences of the global operation counters (messages, bytes, flops) are
+ * accumulated, and the communication package setup done inside the phase is
+ * moved to the comm_pkg phase of the same level.
+ *
+ * The profile is collected only if a file name was given with
+ * HYPRE_BoomerAMGSetProfileFile; the global operation counters are turned on
+ * while such a profile exists. It is written (JSON, or CSV if the file name
+ * ends in ".csv") by HYPRE_BoomerAMGWriteProfile, which is collective.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+static const char *hypre_AMGProfilePhaseNames[HYPRE_AMG_PROFILE_NUM_PHASES] =
+{
+   "strength", "coarsen", "interp", "rap", "comm_pkg", "smooth", "restrict", "interp_apply"
+};
+
+static const char *hypre_AMGProfileStageNames[2] = { "setup", "solve" };
+
+#define hypre_AMGProfileRecord(profile, level, phase) \
+   ((profile) -> counts + ((level) * HYPRE_AMG_PROFILE_NUM_PHASES + (phase)) * \
+    HYPRE_AMG_PROFILE_NUM_COUNTS)
+
+/*--------------------------------------------------------------------------
+ * Current values of the quantities a profile record is made of
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_AMGProfileSnapshot( HYPRE_Real *values )
+{
+   values[0] = hypre_MPI_Wtime();
+   values[1] = hypre_OpCountsMessages();
+   values[2] = hypre_OpCountsBytes();
+   values[3] = hypre_OpCountsFlops();
+   values[4] = hypre_OpCountsCommPkgTime();
+   values[5] = hypre_OpCountsCommPkgMessages();
+   values[6] = hypre_OpCountsCommPkgBytes();
+   values[7] = hypre_OpCountsCommPkgCalls();
+}
+
+/*--------------------------------------------------------------------------
+ * Makes room for the records of levels [0, num_levels)
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_AMGProfileResize( hypre_AMGProfile *profile,
+                        HYPRE_Int         num_levels )
+{
+   HYPRE_Int old_size, new_size;
+
+   if (num_levels <= (profile -> max_levels))
+   {
+      return;
+   }
+
+   old_size = (profile -> max_levels) * HYPRE_AMG_PROFILE_NUM_PHASES * HYPRE_AMG_PROFILE_NUM_COUNTS;
+   new_size = num_levels * HYPRE_AMG_PROFILE_NUM_PHASES * HYPRE_AMG_PROFILE_NUM_COUNTS;
+
+   profile -> counts = hypre_TReAlloc(profile -> counts, HYPRE_Real, new_size, HYPRE_MEMORY_HOST);
+   hypre_Memset(profile -> counts + old_size, 0, (new_size - old_size) * sizeof(HYPRE_Real),
+                HYPRE_MEMORY_HOST);
+   profile -> max_levels = num_levels;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGProfileStageBegin
+ *
+ * Starts the setup or a solve. A new setup clears the profile.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGProfileStageBegin( void      *data,
+                                  HYPRE_Int  stage )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+   hypre_AMGProfile  *profile  = hypre_ParAMGDataProfile(amg_data);
+   HYPRE_Int          size;
+
+   if (!hypre_ParAMGDataProfileFileName(amg_data)[0])
+   {
+      return hypre_error_flag;
+   }
+
+   if (!profile)
+   {
+      profile = hypre_CTAlloc(hypre_AMGProfile, 1, HYPRE_MEMORY_HOST);
+      profile -> comm  = hypre_MPI_COMM_NULL;
+      profile -> phase = -1;
+      hypre_ParAMGDataProfile(amg_data) = profile;
+      hypre_OpCountsActivate(1);
+   }
+
+   if ((profile -> stage_depth)++ > 0)
+   {
+      return hypre_error_flag;
+   }
+
+   if (stage == HYPRE_AMG_PROFILE_SETUP)
+   {
+      hypre_AMGProfileResize(profile, hypre_ParAMGDataMaxLevels(amg_data));
+      size = (profile -> max_levels) * HYPRE_AMG_PROFILE_NUM_PHASES * HYPRE_AMG_PROFILE_NUM_COUNTS;
+      hypre_Memset(profile -> counts, 0, size * sizeof(HYPRE_Real), HYPRE_MEMORY_HOST);
+      hypre_Memset(profile -> stage_counts, 0, sizeof(profile -> stage_counts), HYPRE_MEMORY_HOST);
+   }
+
+   profile -> stage = stage;
+   profile -> phase = -1;
+   hypre_AMGProfileSnapshot(profile -> stage_start);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGProfileStageEnd
+ *
+ * Ends the setup or a solve. At the end of the setup, the sizes of the
+ * levels are recorded.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGProfileStageEnd( void *data )
+{
+   hypre_ParAMGData    *amg_data = (hypre_ParAMGData*) data;
+   hypre_AMGProfile    *profile  = hypre_ParAMGDataProfile(amg_data);
+   hypre_ParCSRMatrix **A_array  = hypre_ParAMGDataAArray(amg_data);
+   HYPRE_Real           now[8];
+   HYPRE_Real          *record;
+   HYPRE_Int            num_levels, j, k;
+
+   if (!profile || profile -> stage_depth == 0 || --(profile -> stage_depth) > 0)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_BoomerAMGProfileEnd(data);
+
+   hypre_AMGProfileSnapshot(now);
+   record = profile -> stage_counts[profile -> stage];
+   record[0] += 1.0;
+   for (k = 1; k < HYPRE_AMG_PROFILE_NUM_COUNTS; k++)
+   {
+      record[k] += now[k - 1] - profile -> stage_start[k - 1];
+   }
+
+   if (profile -> stage == HYPRE_AMG_PROFILE_SOLVE)
+   {
+      return hypre_error_flag;
+   }
+
+   num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_AMGProfileResize(profile, num_levels);
+   profile -> num_levels = num_levels;
+
+   hypre_TFree(profile -> level_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(profile -> level_nonzeros, HYPRE_MEMORY_HOST);
+   profile -> level_rows     = hypre_CTAlloc(HYPRE_BigInt, num_levels, HYPRE_MEMORY_HOST);
+   profile -> level_nonzeros = hypre_CTAlloc(HYPRE_Real, num_levels, HYPRE_MEMORY_HOST);
+   for (j = 0; j < num_levels; j++)
+   {
+      if (A_array && A_array[j])
+      {
+         profile -> level_rows[j]     = hypre_ParCSRMatrixGlobalNumRows(A_array[j]);
+         profile -> level_nonzeros[j] =
+            (HYPRE_Real) (hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A_array[j])) +
+                          hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A_array[j])));
+      }
+   }
+   if (A_array && A_array[0])
+   {
+      profile -> comm = hypre_ParCSRMatrixComm(A_array[0]);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGProfileBegin
+ *
+ * Ends the open phase, if any, and starts the given phase of a level.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGProfileBegin( void      *data,
+                             HYPRE_Int  level,
+                             HYPRE_Int  phase )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+   hypre_AMGProfile  *profile  = hypre_ParAMGDataProfile(amg_data);
+
+   if (!profile || profile -> stage_depth == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_BoomerAMGProfileEnd(data);
+
+   hypre_AMGProfileResize(profile, level + 1);
+   profile -> level = level;
+   profile -> phase = phase;
+   hypre_AMGProfileSnapshot(profile -> phase_start);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGProfileEnd
+ *
+ * Ends the open phase, if any.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGProfileEnd( void *data )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+   hypre_AMGProfile  *profile  = hypre_ParAMGDataProfile(amg_data);
+   HYPRE_Real         delta[8];
+   HYPRE_Real        *record;
+   HYPRE_Int          k;
+
+   if (!profile || profile -> phase < 0)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_AMGProfileSnapshot(delta);
+   for (k = 0; k < 8; k++)
+   {
+      delta[k] -= profile -> phase_start[k];
+   }
+
+   /* the phase itself, without the comm pkg setup done inside it */
+   record = hypre_AMGProfileRecord(profile, profile -> level, profile -> phase);
+   record[0] += 1.0;
+   record[1] += delta[0] - delta[4];
+   record[2] += delta[1] - delta[5];
+   record[3] += delta[2] - delta[6];
+   record[4] += delta[3];
+
+   if (delta[7] > 0.0)
+   {
+      record = hypre_AMGProfileRecord(profile, profile -> level, HYPRE_AMG_PROFILE_COMMPKG);
+      record[0] += delta[7];
+      record[1] += delta[4];
+      record[2] += delta[5];
+      record[3] += delta[6];
+   }
+
+   profile -> phase = -1;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGProfileWrite
+ *
+ * Reduces the profile over the processes and writes it from process 0:
+ * calls and time are the maximum over the processes (time_avg is the mean),
+ * messages, bytes and flops are summed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGProfileWrite( void *data )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+   hypre_AMGProfile  *profile  = hypre_ParAMGDataProfile(amg_data);
+   const char        *file_name;
+   MPI_Comm           comm;
+   HYPRE_Int          num_levels, num_records, size;
+   HYPRE_Int          my_id, num_procs, csv;
+   HYPRE_Int          j, p, s, k;
+   HYPRE_Real        *local, *sum, *max, *rec_sum, *rec_max;
+   FILE              *fp;
+
+   if (!profile || profile -> comm == hypre_MPI_COMM_NULL)
+   {
+      return hypre_error_flag;
+   }
+
+   comm       = profile -> comm;
+   file_name  = hypre_ParAMGDataProfileFileName(amg_data);
+   num_levels = profile -> num_levels;
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /* stage records, level records, level nonzeros */
+   num_records = 2 + num_levels * HYPRE_AMG_PROFILE_NUM_PHASES;
+   size        = num_records * HYPRE_AMG_PROFILE_NUM_COUNTS + num_levels;
+   local = hypre_CTAlloc(HYPRE_Real, 3 * size, HYPRE_MEMORY_HOST);
+   sum   = local + size;
+   max   = sum + size;
+
+   hypre_TMemcpy(local, profile -> stage_counts, HYPRE_Real, 2 * HYPRE_AMG_PROFILE_NUM_COUNTS,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(local + 2 * HYPRE_AMG_PROFILE_NUM_COUNTS, profile -> counts, HYPRE_Real,
+                 num_levels * HYPRE_AMG_PROFILE_NUM_PHASES * HYPRE_AMG_PROFILE_NUM_COUNTS,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(local + num_records * HYPRE_AMG_PROFILE_NUM_COUNTS, profile -> level_nonzeros,
+                 HYPRE_Real, num_levels, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   hypre_MPI_Reduce(local, sum, size, hypre_MPI_REAL, hypre_MPI_SUM, 0, comm);
+   hypre_MPI_Reduce(local, max, size, hypre_MPI_REAL, hypre_MPI_MAX, 0, comm);
+
+
+   if (my_id != 0)
+   {
+      hypre_TFree(local, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   if ((fp = fopen(file_name, "w")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open profile file\n");
+      hypre_TFree(local, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   k   = (HYPRE_Int) strlen(file_name);
+   csv = (k >= 4 && !strcmp(file_name + k - 4, ".csv"));
+
+   if (csv)
+   {
+      hypre_fprintf(fp, "level,phase,rows,nonzeros,calls,time_max,time_avg,messages,bytes,flops\n");
+   }
+   else
+   {
+      hypre_fprintf(fp, "{\n  \"num_procs\": %d,\n  \"num_levels\": %d,\n  \"stages\": {\n",
+                    num_procs, num_levels);
+   }
+
+   for (s = 0; s < 2; s++)
+   {
+      rec_sum = sum + s * HYPRE_AMG_PROFILE_NUM_COUNTS;
+      rec_max = max + s * HYPRE_AMG_PROFILE_NUM_COUNTS;
+      if (csv)
+      {
+         hypre_fprintf(fp, "-1,%s,,,%.0f,%e,%e,%.0f,%.0f,%.0f\n",
+                       hypre_AMGProfileStageNames[s], rec_max[0], rec_max[1],
+                       rec_sum[1] / num_procs, rec_sum[2], rec_sum[3], rec_sum[4]);
+      }
+      else
+      {
+         hypre_fprintf(fp, "    \"%s\": {\"calls\": %.0f, \"time_max\": %e, \"time_avg\": %e, "
+                       "\"messages\": %.0f, \"bytes\": %.0f, \"flops\": %.0f}%s\n",
+                       hypre_AMGProfileStageNames[s], rec_max[0], rec_max[1],
+                       rec_sum[1] / num_procs, rec_sum[2], rec_sum[3], rec_sum[4],
+                       s == 0 ? "," : "");
+      }
+   }
+
+   if (!csv)
+   {
+      hypre_fprintf(fp, "  },\n  \"levels\": [\n");
+   }
+
+   for (j = 0; j < num_levels; j++)
+   {
+      HYPRE_Real nonzeros = sum[num_records * HYPRE_AMG_PROFILE_NUM_COUNTS + j];
+
+      if (!csv)
+      {
+         hypre_fprintf(fp, "    {\"level\": %d, \"rows\": %b, \"nonzeros\": %.0f, \"phases\": {\n",
+                       j, profile -> level_rows[j], nonzeros);
+      }
+      for (p = 0; p < HYPRE_AMG_PROFILE_NUM_PHASES; p++)
+      {
+         k = (2 + j * HYPRE_AMG_PROFILE_NUM_PHASES + p) * HYPRE_AMG_PROFILE_NUM_COUNTS;
+         rec_sum = sum + k;
+         rec_max = max + k;
+         if (csv)
+         {
+            hypre_fprintf(fp, "%d,%s,%b,%.0f,%.0f,%e,%e,%.0f,%.0f,%.0f\n",
+                          j, hypre_AMGProfilePhaseNames[p], profile -> level_rows[j], nonzeros,
+                          rec_max[0], rec_max[1], rec_sum[1] / num_procs,
+                          rec_sum[2], rec_sum[3], rec_sum[4]);
+         }
+         else
+         {
+            hypre_fprintf(fp, "      \"%s\": {\"calls\": %.0f, \"time_max\": %e, \"time_avg\": %e, "
+                          "\"messages\": %.0f, \"bytes\": %.0f, \"flops\": %.0f}%s\n",
+                          hypre_AMGProfilePhaseNames[p], rec_max[0], rec_max[1],
+                          rec_sum[1] / num_procs, rec_sum[2], rec_sum[3], rec_sum[4],
+                          p < HYPRE_AMG_PROFILE_NUM_PHASES - 1 ? "," : "");
+         }
+      }
+      if (!csv)
+      {
+         hypre_fprintf(fp, "    }}%s\n", j < num_levels - 1 ? "," : "");
+      }
+   }
+
+   if (!csv)
+   {
+      hypre_fprintf(fp, "  ]\n}\n");
+   }
+
+   fclose(fp);
+   hypre_TFree(local, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGProfileDestroy
+ *
+ * Frees the profile without writing it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGProfileDestroy( void *data )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+   hypre_AMGProfile  *profile  = hypre_ParAMGDataProfile(amg_data);
+
+   if (!profile)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_OpCountsActivate(-1);
+
+   hypre_TFree(profile -> counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(profile -> level_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(profile -> level_nonzeros, HYPRE_MEMORY_HOST);
+   hypre_TFree(profile, HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataProfile(amg_data) = NULL;
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,757 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Re-setup of BoomerAMG for a matrix whose values changed (setup_reuse > 0):
+ * the C/F splittings of the previous setup are kept, P is either kept or
+ * its values are recomputed on them, and the coarse-grid operators are recomputed and
+ * copied into the existing coarse matrices when their pattern is unchanged.
+ * The spectral bounds of the Chebyshev smoother can also be kept across
+ * setups (cheby_eig_refine > 0).
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseSamePattern
+ *
+ * Returns 1 if the host matrices A and B have the same local sparsity
+ * pattern (including the ordering of the entries within the rows).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGReuseSamePattern( hypre_ParCSRMatrix *A,
+                                 hypre_ParCSRMatrix *B )
+{
+   hypre_CSRMatrix *A_diag        = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *A_offd        = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix *B_diag        = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix *B_offd        = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int        num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Int        diag_nnz      = hypre_CSRMatrixNumNonzeros(A_diag);
+   HYPRE_Int        offd_nnz      = hypre_CSRMatrixNumNonzeros(A_offd);
+   HYPRE_BigInt    *A_cmap        = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_BigInt    *B_cmap        = hypre_ParCSRMatrixColMapOffd(B);
+   HYPRE_Int        i;
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST ||
+       hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(B)) != hypre_MEMORY_HOST)
+   {
+      return 0;
+   }
+
+   if (hypre_CSRMatrixNumRows(B_diag) != num_rows ||
+       hypre_CSRMatrixNumCols(A_diag) != hypre_CSRMatrixNumCols(B_diag) ||
+       hypre_CSRMatrixNumCols(B_offd) != num_cols_offd ||
+       hypre_CSRMatrixNumNonzeros(B_diag) != diag_nnz ||
+       hypre_CSRMatrixNumNonzeros(B_offd) != offd_nnz ||
+       hypre_CSRMatrixDataFloat(B_diag) || hypre_CSRMatrixDataFloat(B_offd))
+   {
+      return 0;
+   }
+
+   for (i = 0; i <= num_rows; i++)
+   {
+      if (hypre_CSRMatrixI(A_diag)[i] != hypre_CSRMatrixI(B_diag)[i] ||
+          hypre_CSRMatrixI(A_offd)[i] != hypre_CSRMatrixI(B_offd)[i])
+      {
+         return 0;
+      }
+   }
+
+   for (i = 0; i < diag_nnz; i++)
+   {
+      if (hypre_CSRMatrixJ(A_diag)[i] != hypre_CSRMatrixJ(B_diag)[i])
+      {
+         return 0;
+      }
+   }
+
+   for (i = 0; i < offd_nnz; i++)
+   {
+      if (hypre_CSRMatrixJ(A_offd)[i] != hypre_CSRMatrixJ(B_offd)[i])
+      {
+         return 0;
+      }
+   }
+
+   for (i = 0; i < num_cols_offd; i++)
+   {
+      if (A_cmap[i] != B_cmap[i])
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseNewValues
+ *
+ * Drops everything derived from the old values of the level matrix M after
+ * its values were overwritten.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGReuseNewValues( hypre_ParCSRMatrix *M )
+{
+   hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixDiag(M));
+   hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixOffd(M));
+   hypre_CSRMatrixFloatDestroy(hypre_ParCSRMatrixDiag(M));
+   hypre_CSRMatrixFloatDestroy(hypre_ParCSRMatrixOffd(M));
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiagT(M));
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffdT(M));
+   hypre_ParCSRMatrixDiagT(M) = NULL;
+   hypre_ParCSRMatrixOffdT(M) = NULL;
+   hypre_TFree(M->bdiaginv, HYPRE_MEMORY_HOST);
+   if (M->bdiaginv_comm_pkg)
+   {
+      hypre_MatvecCommPkgDestroy(M->bdiaginv_comm_pkg);
+      M->bdiaginv_comm_pkg = NULL;
+   }
+   M->bdiag_size = -1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseRefillP
+ *
+ * Overwrites the values of the host matrix P, whose pattern stays fixed,
+ * with those of the untruncated interpolation P_full built on the same C/F
+ * splitting. Entries of P_full outside the pattern of P are dropped, and
+ * each row is scaled to keep the row sum of P_full, as the truncation of
+ * the first setup did.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGReuseRefillP( hypre_ParCSRMatrix *P,
+                             hypre_ParCSRMatrix *P_full )
+{
+   hypre_CSRMatrix *P_diag        = hypre_ParCSRMatrixDiag(P);
+   hypre_CSRMatrix *P_offd        = hypre_ParCSRMatrixOffd(P);
+   hypre_CSRMatrix *F_diag        = hypre_ParCSRMatrixDiag(P_full);
+   hypre_CSRMatrix *F_offd        = hypre_ParCSRMatrixOffd(P_full);
+   HYPRE_Int       *P_diag_i      = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int       *P_diag_j      = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Complex   *P_diag_data   = hypre_CSRMatrixData(P_diag);
+   HYPRE_Int       *P_offd_i      = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int       *P_offd_j      = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Complex   *P_offd_data   = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int       *F_diag_i      = hypre_CSRMatrixI(F_diag);
+   HYPRE_Int       *F_diag_j      = hypre_CSRMatrixJ(F_diag);
+   HYPRE_Complex   *F_diag_data   = hypre_CSRMatrixData(F_diag);
+   HYPRE_Int       *F_offd_i      = hypre_CSRMatrixI(F_offd);
+   HYPRE_Int       *F_offd_j      = hypre_CSRMatrixJ(F_offd);
+   HYPRE_Complex   *F_offd_data   = hypre_CSRMatrixData(F_offd);
+   HYPRE_Int        num_rows      = hypre_CSRMatrixNumRows(P_diag);
+   HYPRE_Int        num_cols_diag = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(P_offd);
+   HYPRE_Int        num_cols_F    = hypre_CSRMatrixNumCols(F_offd);
+   HYPRE_BigInt    *col_map       = hypre_ParCSRMatrixColMapOffd(P);
+   HYPRE_BigInt    *col_map_F     = hypre_ParCSRMatrixColMapOffd(P_full);
+   HYPRE_Int       *offd_map, *marker_diag, *marker_offd;
+   HYPRE_Complex    full_sum, sum, scale;
+   HYPRE_Int        i, k, c;
+
+   /* off-processor column of P_full of each off-processor column of P */
+   offd_map = hypre_TAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+   for (c = 0; c < num_cols_offd; c++)
+   {
+      offd_map[c] = hypre_BigBinarySearch(col_map_F, col_map[c], num_cols_F);
+   }
+
+   /* position of each column in the current row of P_full; positions of
+      earlier rows are below the start of the current row */
+   marker_diag = hypre_TAlloc(HYPRE_Int, num_cols_diag, HYPRE_MEMORY_HOST);
+   marker_offd = hypre_TAlloc(HYPRE_Int, num_cols_F, HYPRE_MEMORY_HOST);
+   for (c = 0; c < num_cols_diag; c++)
+   {
+      marker_diag[c] = -1;
+   }
+   for (c = 0; c < num_cols_F; c++)
+   {
+      marker_offd[c] = -1;
+   }
+
+   for (i = 0; i < num_rows; i++)
+   {
+      full_sum = 0.0;
+      for (k = F_diag_i[i]; k < F_diag_i[i + 1]; k++)
+      {
+         marker_diag[F_diag_j[k]] = k;
+         full_sum += F_diag_data[k];
+      }
+      for (k = F_offd_i[i]; k < F_offd_i[i + 1]; k++)
+      {
+         marker_offd[F_offd_j[k]] = k;
+         full_sum += F_offd_data[k];
+      }
+
+      sum = 0.0;
+      for (k = P_diag_i[i]; k < P_diag_i[i + 1]; k++)
+      {
+         c = marker_diag[P_diag_j[k]];
+         P_diag_data[k] = (c >= F_diag_i[i]) ? F_diag_data[c] : 0.0;
+         sum += P_diag_data[k];
+      }
+      for (k = P_offd_i[i]; k < P_offd_i[i + 1]; k++)
+      {
+         c = offd_map[P_offd_j[k]];
+         c = (c >= 0) ? marker_offd[c] : -1;
+         P_offd_data[k] = (c >= F_offd_i[i]) ? F_offd_data[c] : 0.0;
+         sum += P_offd_data[k];
+      }
+
+      scale = (sum != 0.0) ? full_sum / sum : 1.0;
+      for (k = P_diag_i[i]; k < P_diag_i[i + 1]; k++)
+      {
+         P_diag_data[k] *= scale;
+      }
+      for (k = P_offd_i[i]; k < P_offd_i[i + 1]; k++)
+      {
+         P_offd_data[k] *= scale;
+      }
+   }
+
+   hypre_TFree(offd_map, HYPRE_MEMORY_HOST);
+   hypre_TFree(marker_diag, HYPRE_MEMORY_HOST);
+   hypre_TFree(marker_offd, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseUpdateMatrix
+ *
+ * Replaces the level matrix *M_ptr by M_new. If both have the same pattern
+ * on all ranks, the values of M_new are copied into *M_ptr, which keeps its
+ * comm package, and M_new is destroyed. Returns 1 in that case, 0 otherwise.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGReuseUpdateMatrix( hypre_ParCSRMatrix **M_ptr,
+                                  hypre_ParCSRMatrix  *M_new )
+{
+   hypre_ParCSRMatrix *M = *M_ptr;
+   hypre_CSRMatrix    *M_diag, *M_offd;
+   HYPRE_Int           same, same_global;
+
+   /* the comm package depends on the patterns of all ranks */
+   same = M && hypre_BoomerAMGReuseSamePattern(M_new, M);
+   hypre_MPI_Allreduce(&same, &same_global, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_ParCSRMatrixComm(M_new));
+
+   if (!same_global)
+   {
+      hypre_ParCSRMatrixDestroy(M);
+      *M_ptr = M_new;
+
+      return 0;
+   }
+
+   M_diag = hypre_ParCSRMatrixDiag(M);
+   M_offd = hypre_ParCSRMatrixOffd(M);
+
+   hypre_TMemcpy(hypre_CSRMatrixData(M_diag),
+                 hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(M_new)),
+                 HYPRE_Complex, hypre_CSRMatrixNumNonzeros(M_diag),
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_CSRMatrixData(M_offd),
+                 hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(M_new)),
+                 HYPRE_Complex, hypre_CSRMatrixNumNonzeros(M_offd),
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatrixDestroy(M_new);
+
+   hypre_BoomerAMGReuseNewValues(M);
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupReuseCheck
+ *
+ * Returns 1 if hypre_BoomerAMGSetup may keep the hierarchy of the previous
+ * setup for the matrix A, i.e., setup_reuse is set, a previous hierarchy of
+ * at least two levels exists, A has the same row partitioning as its fine
+ * level, and no option changing the structure of the hierarchy is used.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupReuseCheck( void               *amg_vdata,
+                                hypre_ParCSRMatrix *A )
+{
+   hypre_ParAMGData    *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix **A_array    = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array    = hypre_ParAMGDataPArray(amg_data);
+   HYPRE_Int            level, reuse, reuse_global;
+
+   if (!hypre_ParAMGDataSetupReuse(amg_data) || num_levels < 2 ||
+       !A_array || !P_array || !P_array[0] ||
+       !hypre_ParAMGDataCFMarkerArray(amg_data))
+   {
+      return 0;
+   }
+
+   if (hypre_ParAMGDataBlockMode(amg_data) ||
+       hypre_ParAMGDataAdditive(amg_data) > -1 ||
+       hypre_ParAMGDataMultAdditive(amg_data) > -1 ||
+       hypre_ParAMGDataSimple(amg_data) > -1 ||
+       hypre_ParAMGDataAgglomComm(amg_data) != hypre_MPI_COMM_NULL ||
+       hypre_ParAMGDataNonGalerkNumTol(amg_data) > 0 ||
+       hypre_ParAMGDataNonGalTolArray(amg_data) ||
+       hypre_ParAMGInterpVecVariant(amg_data) > 0)
+   {
+      return 0;
+   }
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      if (!P_array[level] || !A_array[level + 1] ||
+          hypre_CSRMatrixDataFloat(hypre_ParCSRMatrixDiag(P_array[level])))
+      {
+         return 0;
+      }
+   }
+
+   /* all ranks have to take the same path through the setup */
+   reuse = (hypre_ParCSRMatrixGlobalNumRows(A) == hypre_ParCSRMatrixGlobalNumRows(P_array[0]) &&
+            hypre_ParCSRMatrixRowStarts(A)[0] == hypre_ParCSRMatrixRowStarts(P_array[0])[0] &&
+            hypre_ParCSRMatrixRowStarts(A)[1] == hypre_ParCSRMatrixRowStarts(P_array[0])[1]);
+   hypre_MPI_Allreduce(&reuse, &reuse_global, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_ParCSRMatrixComm(A));
+
+   return reuse_global;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupReuseLevels
+ *
+ * Recomputes the levels of the kept hierarchy for the new fine matrix
+ * A_array[0]. With setup_reuse = 2, the values of P are recomputed on the
+ * kept C/F splitting and the kept pattern of P, on the host levels where
+ * the interpolation allows it: the strength matrix and the untruncated
+ * interpolation are rebuilt, and their values refill P. Otherwise P (and R)
+ * are kept. The coarse-grid operators are then recomputed with the same
+ * product as in hypre_BoomerAMGSetup, except on levels where R = P: there,
+ * the product P^T*A*P is done with a hypre_ParCSRRAPPlan, built on the
+ * first reuse, so that later reuses only recompute its values.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupReuseLevels( void *amg_vdata )
+{
+   hypre_ParAMGData    *amg_data        = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int            setup_reuse     = hypre_ParAMGDataSetupReuse(amg_data);
+   HYPRE_Int            num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array         = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array         = hypre_ParAMGDataRArray(amg_data);
+   hypre_IntArray     **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   hypre_IntArray     **dof_func_array  = hypre_ParAMGDataDofFuncArray(amg_data);
+   HYPRE_Int            restri_type     = hypre_ParAMGDataRestriction(amg_data);
+   HYPRE_Int            rap2            = hypre_ParAMGDataRAP2(amg_data);
+   HYPRE_Int            keepTranspose   = hypre_ParAMGDataKeepTranspose(amg_data);
+   HYPRE_Int            modularized     = hypre_ParAMGDataModularizedMatMat(amg_data);
+   HYPRE_Int            interp_type     = hypre_ParAMGDataInterpType(amg_data);
+   HYPRE_Int            sep_weight      = hypre_ParAMGDataSepWeight(amg_data);
+   HYPRE_Int            agg_num_levels  = hypre_ParAMGDataAggNumLevels(amg_data);
+   HYPRE_Int            post_interp_type = hypre_ParAMGDataPostInterpType(amg_data);
+   HYPRE_Int            num_functions   = hypre_ParAMGDataNumFunctions(amg_data);
+   HYPRE_Int            debug_flag      = hypre_ParAMGDataDebugFlag(amg_data);
+   HYPRE_Int            print_level     = hypre_ParAMGDataPrintLevel(amg_data);
+   HYPRE_Real           strong_threshold = hypre_ParAMGDataStrongThreshold(amg_data);
+   HYPRE_Real           max_row_sum     = hypre_ParAMGDataMaxRowSum(amg_data);
+   HYPRE_Real           jacobi_trunc_threshold = hypre_ParAMGDataJacobiTruncThreshold(amg_data);
+   hypre_ParCSRRAPPlan **rap_plan_array = hypre_ParAMGDataRAPPlanArray(amg_data);
+   HYPRE_Int            num_procs;
+
+   hypre_ParCSRMatrix  *S, *P, *A_H, *Q;
+   HYPRE_Int           *CF_marker, *dof_func_data;
+   HYPRE_BigInt         coarse_pnts_global[2];
+   HYPRE_Int            level, i, recompute_P, use_plans, plan_ok;
+   HYPRE_Int            num_P_updated = 0, num_A_updated = 0;
+
+   hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A_array[0]), &num_procs);
+
+   if (interp_type == 9)
+   {
+      interp_type = 8;
+      sep_weight  = 1;
+   }
+
+   recompute_P = (setup_reuse == 2 &&
+                  restri_type == 0 &&
+                  hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A_array[0])) ==
+                  HYPRE_EXEC_HOST &&
+                  hypre_ParAMGDataNodal(amg_data) == 0 &&
+                  hypre_ParAMGDataGSMG(amg_data) == 0 &&
+                  hypre_ParAMGInterpRefine(amg_data) == 0 &&
+                  (interp_type == 0 || interp_type == 6 || interp_type == 8 ||
+                   interp_type == 14 || interp_type == 17 || interp_type == 18));
+
+   /* Galerkin products with a fixed P are recomputed from plans (host only) */
+   use_plans = (restri_type == 0 &&
+                hypre_ParAMGDataADropTol(amg_data) <= 0.0 &&
+                hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A_array[0])) ==
+                HYPRE_EXEC_HOST);
+   if (use_plans && !rap_plan_array)
+   {
+      rap_plan_array = hypre_CTAlloc(hypre_ParCSRRAPPlan *, num_levels, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataRAPPlanArray(amg_data) = rap_plan_array;
+   }
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      CF_marker     = hypre_IntArrayData(CF_marker_array[level]);
+      dof_func_data = dof_func_array[level] ? hypre_IntArrayData(dof_func_array[level]) : NULL;
+
+      /*-----------------------------------------------------------------
+       * Recompute the values of P on the kept C/F splitting and pattern
+       *-----------------------------------------------------------------*/
+
+      if (recompute_P && level >= agg_num_levels)
+      {
+         S = NULL;
+         P = NULL;
+         coarse_pnts_global[0] = hypre_ParCSRMatrixColStarts(P_array[level])[0];
+         coarse_pnts_global[1] = hypre_ParCSRMatrixColStarts(P_array[level])[1];
+
+         if (!hypre_ParAMGDataSabs(amg_data))
+         {
+            hypre_BoomerAMGCreateS(A_array[level], strong_threshold, max_row_sum,
+                                   num_functions, dof_func_data, &S);
+         }
+         else
+         {
+            hypre_BoomerAMGCreateSabs(A_array[level], strong_threshold, 1.0,
+                                      1, NULL, &S);
+         }
+
+         if (interp_type == 6)
+         {
+            hypre_BoomerAMGBuildExtPIInterp(A_array[level], CF_marker,
+                                            S, coarse_pnts_global, num_functions, dof_func_data,
+                                            debug_flag, 0.0, 0, &P);
+         }
+         else if (interp_type == 14)
+         {
+            hypre_BoomerAMGBuildExtInterp(A_array[level], CF_marker,
+                                          S, coarse_pnts_global, num_functions, dof_func_data,
+                                          debug_flag, 0.0, 0, &P);
+         }
+         else if (interp_type == 17)
+         {
+            hypre_BoomerAMGBuildModExtPIInterp(A_array[level], CF_marker,
+                                               S, coarse_pnts_global,
+                                               num_functions, dof_func_data,
+                                               debug_flag, 0.0, 0, &P);
+         }
+         else if (interp_type == 18)
+         {
+            hypre_BoomerAMGBuildModExtPEInterp(A_array[level], CF_marker,
+                                               S, coarse_pnts_global,
+                                               num_functions, dof_func_data,
+                                               debug_flag, 0.0, 0, &P);
+         }
+         else if (interp_type == 8)
+         {
+            hypre_BoomerAMGBuildStdInterp(A_array[level], CF_marker,
+                                          S, coarse_pnts_global, num_functions, dof_func_data,
+                                          debug_flag, 0.0, 0, sep_weight, &P);
+         }
+         else
+         {
+            hypre_BoomerAMGBuildInterp(A_array[level], CF_marker,
+                                       S, coarse_pnts_global, num_functions, dof_func_data,
+                                       print_level ? -debug_flag : debug_flag,
+                                       0.0, 0, &P);
+         }
+
+         for (i = 0; i < post_interp_type; i++)
+         {
+            hypre_BoomerAMGJacobiInterp(A_array[level], &P, S,
+                                        num_functions, dof_func_data, CF_marker,
+                                        level, jacobi_trunc_threshold,
+                                        0.5 * jacobi_trunc_threshold);
+         }
+
+         hypre_ParCSRMatrixDestroy(S);
+
+         /* the pattern of P, and with it the comm package and the plan of
+            the coarse-grid operator, stays fixed */
+         hypre_BoomerAMGReuseRefillP(P_array[level], P);
+         hypre_ParCSRMatrixDestroy(P);
+         hypre_BoomerAMGReuseNewValues(P_array[level]);
+         num_P_updated++;
+
+         /* the plan keeps P^T */
+         if (rap_plan_array && rap_plan_array[level])
+         {
+            hypre_ParCSRRAPPlanUpdateR(rap_plan_array[level], P_array[level]);
+         }
+      }
+
+      /*-----------------------------------------------------------------
+       * Coarse-grid operator
+       *-----------------------------------------------------------------*/
+
+      A_H = NULL;
+      if (use_plans)
+      {
+         /* all ranks have to agree on the plan being valid */
+         i = (rap_plan_array[level] &&
+              hypre_ParCSRRAPPlanMatches(rap_plan_array[level], A_array[level],
+                                         P_array[level], A_array[level + 1]));
+         hypre_MPI_Allreduce(&i, &plan_ok, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                             hypre_ParCSRMatrixComm(A_array[level]));
+
+         if (plan_ok)
+         {
+            hypre_ParCSRRAPPlanExecute(rap_plan_array[level], A_array[level],
+                                       P_array[level], A_array[level + 1]);
+            hypre_BoomerAMGReuseNewValues(A_array[level + 1]);
+            num_A_updated++;
+            continue;
+         }
+
+         hypre_ParCSRRAPPlanDestroy(rap_plan_array[level]);
+         hypre_ParCSRRAPPlanCreate(P_array[level], A_array[level], P_array[level],
+                                   &rap_plan_array[level], &A_H);
+      }
+      else
+      {
+         /* the local transposes of P are rebuilt by the products below */
+         hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiagT(P_array[level]));
+         hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffdT(P_array[level]));
+         hypre_ParCSRMatrixDiagT(P_array[level]) = NULL;
+         hypre_ParCSRMatrixOffdT(P_array[level]) = NULL;
+
+         if (restri_type)
+         {
+            if (modularized)
+            {
+               Q   = hypre_ParCSRMatMat(A_array[level], P_array[level]);
+               A_H = hypre_ParCSRMatMat(R_array[level], Q);
+               hypre_CSRMatrixReorder(hypre_ParCSRMatrixDiag(A_H));
+            }
+            else
+            {
+               Q   = hypre_ParMatmul(A_array[level], P_array[level]);
+               A_H = hypre_ParMatmul(R_array[level], Q);
+            }
+            hypre_ParCSRMatrixDestroy(Q);
+         }
+         else if (rap2)
+         {
+            if (modularized)
+            {
+               Q   = hypre_ParCSRMatMat(A_array[level], P_array[level]);
+               A_H = hypre_ParCSRTMatMatKT(P_array[level], Q, keepTranspose);
+            }
+            else
+            {
+               Q   = hypre_ParMatmul(A_array[level], P_array[level]);
+               A_H = hypre_ParTMatmul(P_array[level], Q);
+            }
+            hypre_ParCSRMatrixDestroy(Q);
+         }
+         else if (modularized)
+         {
+            A_H = hypre_ParCSRMatrixRAPKT(P_array[level], A_array[level],
+                                          P_array[level], keepTranspose);
+         }
+         else
+         {
+            hypre_BoomerAMGBuildCoarseOperatorKT(P_array[level], A_array[level],
+                                                 P_array[level], keepTranspose, &A_H);
+         }
+      }
+
+      hypre_ParCSRMatrixDropSmallEntries(A_H, hypre_ParAMGDataADropTol(amg_data),
+                                         hypre_ParAMGDataADropType(amg_data));
+
+      if (hypre_BoomerAMGReuseUpdateMatrix(&A_array[level + 1], A_H))
+      {
+         num_A_updated++;
+      }
+      else
+      {
+         if (num_procs > 1 && hypre_ParCSRMatrixCommPkg(A_H) == NULL)
+         {
+            hypre_MatvecCommPkgCreate(A_H);
+         }
+         if (hypre_ParAMGDataADropTol(amg_data) <= 0.0)
+         {
+            hypre_ParCSRMatrixSetNumNonzeros(A_H);
+            hypre_ParCSRMatrixSetDNumNonzeros(A_H);
+         }
+      }
+   }
+
+   if (print_level > 0)
+   {
+      HYPRE_Int my_id;
+
+      hypre_MPI_Comm_rank(hypre_ParCSRMatrixComm(A_array[0]), &my_id);
+      if (my_id == 0)
+      {
+         hypre_printf("BoomerAMG setup reuse: %d P and %d coarse A of %d levels updated in place\n",
+                      num_P_updated, num_A_updated, num_levels - 1);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupReuseDestroy
+ *
+ * Frees the Galerkin product plans kept for the levels of the hierarchy.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupReuseDestroy( void *amg_vdata )
+{
+   hypre_ParAMGData     *amg_data       = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRRAPPlan **rap_plan_array = hypre_ParAMGDataRAPPlanArray(amg_data);
+   HYPRE_Int             level;
+
+   if (rap_plan_array)
+   {
+      for (level = 0; level < hypre_ParAMGDataNumLevels(amg_data); level++)
+      {
+         hypre_ParCSRRAPPlanDestroy(rap_plan_array[level]);
+      }
+      hypre_TFree(rap_plan_array, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataRAPPlanArray(amg_data) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGChebyEigCacheLookup
+ *
+ * Returns 1 and the spectral bounds of the Chebyshev smoother on the given
+ * level if they can be taken from a previous setup (cheby_eig_refine > 0).
+ * This requires a cached vector with the same row partitioning as the level.
+ * The Rayleigh quotient of this vector is compared with its value at caching
+ * time: the bounds are kept as they are unless it drifted by more than
+ * hypre_CHEBY_EIG_DRIFT_TOL, in which case they are scaled by the drift and
+ * refined with cheby_eig_refine power iterations.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_CHEBY_EIG_DRIFT_TOL 0.02
+
+HYPRE_Int
+hypre_BoomerAMGChebyEigCacheLookup( void       *amg_vdata,
+                                    HYPRE_Int   level,
+                                    HYPRE_Int   scale,
+                                    HYPRE_Real *max_eig,
+                                    HYPRE_Real *min_eig )
+{
+   hypre_ParAMGData   *amg_data = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix *A        = hypre_ParAMGDataAArray(amg_data)[level];
+   hypre_ParVector    *x;
+   HYPRE_Real         *cache;
+   HYPRE_Real          eig, ratio;
+   HYPRE_Int           valid, valid_global;
+
+   if (level >= hypre_ParAMGDataChebyNumEigCache(amg_data))
+   {
+      return 0;
+   }
+   x     = hypre_ParAMGDataChebyEigVecs(amg_data)[level];
+   cache = hypre_ParAMGDataChebyEigCache(amg_data) + 3 * level;
+
+   /* all ranks have to agree, the checks below are collective */
+   valid = (x != NULL &&
+            hypre_ParVectorGlobalSize(x) == hypre_ParCSRMatrixGlobalNumRows(A) &&
+            hypre_ParVectorFirstIndex(x) == hypre_ParCSRMatrixFirstRowIndex(A) &&
+            hypre_VectorSize(hypre_ParVectorLocalVector(x)) == hypre_ParCSRMatrixNumRows(A));
+   hypre_MPI_Allreduce(&valid, &valid_global, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_ParCSRMatrixComm(A));
+   if (!valid_global || cache[2] == 0.0)
+   {
+      return 0;
+   }
+
+   hypre_ParCSRMaxEigEstimatePower(A, scale, 0, x, &eig);
+   if (hypre_abs(eig - cache[2]) > hypre_CHEBY_EIG_DRIFT_TOL * hypre_abs(cache[2]))
+   {
+      ratio = eig / cache[2];
+      if (ratio <= 0.0)
+      {
+         return 0;
+      }
+
+      hypre_ParCSRMaxEigEstimatePower(A, scale, hypre_ParAMGDataChebyEigRefine(amg_data),
+                                      x, &eig);
+
+      /* power iterations bound the eigenvalue of largest magnitude from below */
+      cache[0] *= ratio;
+      cache[1] *= ratio;
+      if (cache[0] > 0.0)
+      {
+         cache[0] = hypre_max(cache[0], eig);
+      }
+      else
+      {
+         cache[1] = hypre_min(cache[1], eig);
+      }
+      cache[2] = eig;
+   }
+
+   *max_eig = cache[0];
+   *min_eig = cache[1];
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGChebyEigCacheStore
+ *
+ * Keeps freshly estimated spectral bounds of the given level for later
+ * setups, together with a vector for the drift checks. The vector starts
+ * from random values and gets cheby_eig_refine power iterations.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGChebyEigCacheStore( void       *amg_vdata,
+                                   HYPRE_Int   level,
+                                   HYPRE_Int   scale,
+                                   HYPRE_Real  max_eig,
+                                   HYPRE_Real  min_eig )
+{
+   hypre_ParAMGData   *amg_data = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix *A        = hypre_ParAMGDataAArray(amg_data)[level];
+   hypre_ParVector   **x_array  = hypre_ParAMGDataChebyEigVecs(amg_data);
+   HYPRE_Real         *cache;
+
+   if (level >= hypre_ParAMGDataChebyNumEigCache(amg_data))
+   {
+      return hypre_error_flag;
+   }
+   cache = hypre_ParAMGDataChebyEigCache(amg_data) + 3 * level;
+
+   hypre_ParVectorDestroy(x_array[level]);
+   x_array[level] = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
+                                          hypre_ParCSRMatrixGlobalNumRows(A),
+                                          hypre_ParCSRMatrixRowStarts(A));
+   hypre_ParVectorInitialize(x_array[level]);
+   hypre_ParVectorSetRandomValues(x_array[level], level + 1);
+
+   cache[0] = max_eig;
+   cache[1] = min_eig;
+   hypre_ParCSRMaxEigEstimatePower(A, scale, hypre_ParAMGDataChebyEigRefine(amg_data),
+                                   x_array[level], &cache[2]);
+
+   return hypre_error_flag;
+}
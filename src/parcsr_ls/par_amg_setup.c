@@ -20,6 +20,64 @@
  *
  *****************************************************************************/
 
+/*****************************************************************************
+ * hypre_BoomerAMGComputeL1Norms
+ *
+ * l1 norms for the hybrid Gauss-Seidel smoothers. On levels with relax
+ * blocks the smoother does not depend on the thread partitioning, so the
+ * norms are computed as for a single thread.
+ *****************************************************************************/
+
+static HYPRE_Int
+hypre_BoomerAMGComputeL1Norms( hypre_ParCSRMatrix  *A,
+                               HYPRE_Int            option,
+                               HYPRE_Int           *cf_marker,
+                               HYPRE_Real         **l1_norm_ptr )
+{
+   if (hypre_ParCSRMatrixRelaxBlocks(A))
+   {
+      return hypre_ParCSRComputeL1NormsThreads(A, option, 1, cf_marker, l1_norm_ptr);
+   }
+
+   return hypre_ParCSRComputeL1Norms(A, option, cf_marker, l1_norm_ptr);
+}
+
+/*****************************************************************************
+ * hypre_BoomerAMGValueBytes
+ *
+ * Local number of bytes taken by the values (double and single precision)
+ * of M and of its local transposes, for the mixed precision report.
+ *****************************************************************************/
+
+static HYPRE_Real
+hypre_BoomerAMGValueBytes( hypre_ParCSRMatrix *M )
+{
+   hypre_CSRMatrix *blocks[4];
+   HYPRE_Real       bytes = 0.0;
+   HYPRE_Int        k;
+
+   if (!M)
+   {
+      return bytes;
+   }
+
+   blocks[0] = hypre_ParCSRMatrixDiag(M);
+   blocks[1] = hypre_ParCSRMatrixOffd(M);
+   blocks[2] = hypre_ParCSRMatrixDiagT(M);
+   blocks[3] = hypre_ParCSRMatrixOffdT(M);
+   for (k = 0; k < 4; k++)
+   {
+      if (blocks[k])
+      {
+         bytes += (HYPRE_Real) hypre_CSRMatrixNumNonzeros(blocks[k]) *
+                  ((hypre_CSRMatrixData(blocks[k]) ? sizeof(HYPRE_Complex) : 0) +
+                   (hypre_CSRMatrixDataFloat(blocks[k]) ? sizeof(float) : 0));
+      }
+   }
+
+   return bytes;
+}
+
 /*****************************************************************************
  * hypre_BoomerAMGSetup
  *****************************************************************************/
@@ -123,6 +181,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int       coarse_threshold = hypre_ParAMGDataMaxCoarseSize(amg_data);
    HYPRE_Int       min_coarse_size = hypre_ParAMGDataMinCoarseSize(amg_data);
    HYPRE_Int       seq_threshold = hypre_ParAMGDataSeqThreshold(amg_data);
+   HYPRE_Int       agglom_threshold = hypre_ParAMGDataAgglomThreshold(amg_data);
+   HYPRE_Int       agglomerate = 0;
    HYPRE_Int       j, k;
    HYPRE_Int       num_procs, my_id;
 #if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_HIP)
@@ -140,6 +200,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_IntArray *coarse_dof_func = NULL;
    HYPRE_BigInt    coarse_pnts_global[2];
    HYPRE_BigInt    coarse_pnts_global1[2];
+   HYPRE_BigInt   *aggregates = NULL;
    HYPRE_Int       num_cg_sweeps;
 
    HYPRE_Real *max_eig_est = NULL;
@@ -199,6 +260,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_ParCSRBlockMatrix *A_H_block;
 
    HYPRE_Int       block_mode = 0;
+   HYPRE_Int       reuse_setup = 0;
 
    HYPRE_Int       mult_addlvl = hypre_max(mult_additive, simple);
    HYPRE_Int       addlvl = hypre_max(mult_addlvl, additive);
@@ -232,6 +294,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    /*A_new = hypre_CSRMatrixDeleteZeros(hypre_ParCSRMatrixDiag(A), 1.e-16);
    hypre_CSRMatrixPrint(A_new, "Atestnew"); */
+   /* the multivector work vectors follow the hierarchy of the previous setup */
+   hypre_BoomerAMGSolveWorkDestroy(amg_data);
+
    old_num_levels = hypre_ParAMGDataNumLevels(amg_data);
    max_levels = hypre_ParAMGDataMaxLevels(amg_data);
    add_end = hypre_min(add_last_lvl, max_levels - 1);
@@ -283,6 +348,11 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_ParAMGDataNumVariables(amg_data) = hypre_ParCSRMatrixNumRows(A);
 
    if (num_procs == 1) { seq_threshold = 0; }
+   if (num_procs == 1 || addlvl > -1 ||
+       hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      agglom_threshold = 0;
+   }
    if (setup_type == 0) { return hypre_error_flag; }
 
    S = NULL;
@@ -309,6 +379,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    grid_relax_type[3] = hypre_ParAMGDataUserCoarseRelaxType(amg_data);
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
+   hypre_BoomerAMGProfileStageBegin(amg_data, HYPRE_AMG_PROFILE_SETUP);
 
    /* change in definition of standard and multipass interpolation, by
       eliminating interp_type 9 and 5 and setting sep_weight instead
@@ -343,10 +414,11 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    /* probably should disable stuff like smooth num levels at some point */
 
 
-   if (grid_relax_type[0] >= 20) /* block relaxation choosen */
+   /* block relaxation choosen; 31 and 32 are the (point) multicolor smoothers */
+   if (grid_relax_type[0] >= 20 && grid_relax_type[0] != 31 && grid_relax_type[0] != 32)
    {
 
-      if (!((interp_type >= 20 && interp_type != 100) || interp_type == 11 || interp_type == 10 ) )
+      if (!((interp_type >= 20 && interp_type < 25) || interp_type == 11 || interp_type == 10 ) )
       {
          hypre_ParAMGDataInterpType(amg_data) = 20;
          interp_type = hypre_ParAMGDataInterpType(amg_data) ;
@@ -365,7 +437,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       block_mode = 1;
    }
 
-   if ((interp_type >= 20 && interp_type != 100) || interp_type == 11 ||
+   if ((interp_type >= 20 && interp_type < 25) || interp_type == 11 ||
        interp_type == 10 ) /* block interp choosen */
    {
       if (!(nodal))
@@ -389,13 +461,56 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    hypre_ParAMGDataBlockMode(amg_data) = block_mode;
 
+   /* check the aggregation options before any level is built, so that an
+      error leaves through the same end of setup as a successful one */
+   if ((coarsen_type == 12 && (block_mode || agg_num_levels > 0)) ||
+       ((interp_type == 25 || interp_type == 26) && coarsen_type != 12))
+   {
+      if (coarsen_type == 12 && block_mode)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Aggregation coarsening is not available in block mode!");
+      }
+      else if (coarsen_type == 12)
+      {
+         /* aggregation coarsening is aggressive by itself: no second stage */
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Aggregation coarsening cannot be combined with agg_num_levels > 0!");
+      }
+      else
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Aggregation interpolation requires coarsen_type 12!");
+      }
+      hypre_BoomerAMGProfileStageEnd(amg_data);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   /* keep the hierarchy of the previous setup if requested (setup_reuse) */
+   if (hypre_ParAMGDataSetupReuse(amg_data) && A_array)
+   {
+      reuse_setup = hypre_BoomerAMGSetupReuseCheck(amg_data, A);
+      if (!reuse_setup && amg_print_level > 0 && my_id == 0)
+      {
+         hypre_printf("Note: the previous AMG hierarchy cannot be reused, doing a full setup\n");
+      }
+   }
+
 
    /* end of systems checks */
 
+   if (!reuse_setup)
+   {
+      hypre_BoomerAMGSetupReuseDestroy(amg_data);
+   }
+
    /* free up storage in case of new setup without previous destroy */
 
-   if (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
-       dof_func_array || R_array || R_block_array)
+   if (!reuse_setup &&
+       (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
+        dof_func_array || R_array || R_block_array))
    {
       for (j = 1; j < old_num_levels; j++)
       {
@@ -496,17 +611,25 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_TFree(hypre_ParAMGDataBVec(amg_data), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
 
+      if (amg)
+      {
+         hypre_BoomerAMGDestroy (amg);
+         hypre_ParAMGDataCoarseSolver(amg_data) = NULL;
+      }
+
       if (new_comm != hypre_MPI_COMM_NULL)
       {
          hypre_MPI_Comm_free (&new_comm);
          hypre_ParAMGDataNewComm(amg_data) = hypre_MPI_COMM_NULL;
       }
 
-      if (amg)
+      if (hypre_ParAMGDataAgglomComm(amg_data) != hypre_MPI_COMM_NULL)
       {
-         hypre_BoomerAMGDestroy (amg);
-         hypre_ParAMGDataCoarseSolver(amg_data) = NULL;
+         hypre_MPI_Comm_free(&hypre_ParAMGDataAgglomComm(amg_data));
+         hypre_ParAMGDataAgglomComm(amg_data) = hypre_MPI_COMM_NULL;
       }
+      hypre_TFree(hypre_ParAMGDataAgglomCounts(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataAgglomDispls(amg_data), HYPRE_MEMORY_HOST);
 
       hypre_TFree(hypre_ParAMGDataMaxEigEst(amg_data), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParAMGDataMinEigEst(amg_data), HYPRE_MEMORY_HOST);
@@ -830,7 +953,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    F_array = hypre_ParAMGDataFArray(amg_data);
    U_array = hypre_ParAMGDataUArray(amg_data);
 
-   if (F_array != NULL || U_array != NULL)
+   if (!reuse_setup && (F_array != NULL || U_array != NULL))
    {
       for (j = 1; j < old_num_levels; j++)
       {
@@ -892,6 +1015,29 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataSmoother(amg_data) = smoother;
    }
 
+   /*-----------------------------------------------------
+    *  With setup reuse, the levels of the previous setup
+    *  are only updated and the coarsening loop is skipped
+    *-----------------------------------------------------*/
+
+   if (reuse_setup)
+   {
+      hypre_BoomerAMGSetupReuseLevels(amg_data);
+
+      HYPRE_ANNOTATE_MGLEVEL_END(level);
+#if defined(HYPRE_USING_NVTX)
+      hypre_GpuProfilingPopRange();
+#endif
+      level = old_num_levels - 1;
+      HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
+#if defined(HYPRE_USING_NVTX)
+      hypre_sprintf(nvtx_name, "%s-%d", "AMG Level", level);
+      hypre_GpuProfilingPushRange(nvtx_name);
+#endif
+      coarse_size = hypre_ParCSRMatrixGlobalNumRows(A_array[level]);
+      not_finished_coarsening = 0;
+   }
+
    /*-----------------------------------------------------
     *  Enter Coarsening Loop
     *-----------------------------------------------------*/
@@ -997,6 +1143,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
 
          /**** Get the Strength Matrix ****/
+         hypre_BoomerAMGProfileBegin(amg_data, level, HYPRE_AMG_PROFILE_STRENGTH);
          if (hypre_ParAMGDataGSMG(amg_data) == 0)
          {
             if (nodal) /* if we are solving systems and
@@ -1112,6 +1259,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          /**** Do the appropriate coarsening ****/
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarsening");
+         hypre_BoomerAMGProfileBegin(amg_data, level, HYPRE_AMG_PROFILE_COARSEN);
 
          if (nodal == 0) /* no nodal coarsening */
          {
@@ -1139,6 +1287,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                hypre_BoomerAMGCoarsenCGCb(S, A_array[level], measure_type, coarsen_type,
                                           cgc_its, debug_flag, &(CF_marker_array[level]));
             }
+            else if (coarsen_type == 12)
+               hypre_BoomerAMGCoarsenAggregates(S, debug_flag, &(CF_marker_array[level]),
+                                                &aggregates);
             else if (coarsen_type == 98)
                hypre_BoomerAMGCoarsenCR1(A_array[level], &(CF_marker_array[level]),
                                          &coarse_size, num_CR_relax_steps, IS_type, 0);
@@ -1290,6 +1441,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             else if (coarsen_type == 21 || coarsen_type == 22)
                hypre_BoomerAMGCoarsenCGCb(SN, SN, measure_type,
                                           coarsen_type, cgc_its, debug_flag, &CFN_marker);
+            else if (coarsen_type == 12)
+               hypre_BoomerAMGCoarsenAggregates(SN, debug_flag, &CFN_marker, &aggregates);
             else if (coarsen_type)
                hypre_BoomerAMGCoarsenRuge(SN, SN, measure_type, coarsen_type,
                                           coarsen_cut_factor, debug_flag, &CFN_marker);
@@ -1572,6 +1725,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          /*****xxxxxxxxxxxxx changes for min_coarse_size  end */
          HYPRE_ANNOTATE_REGION_END("%s", "Coarsening");
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Interpolation");
+         hypre_BoomerAMGProfileBegin(amg_data, level, HYPRE_AMG_PROFILE_INTERP);
 
          if (level < agg_num_levels)
          {
@@ -2114,6 +2268,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                                              S, coarse_pnts_global, num_functions, dof_func_data,
                                              debug_flag, trunc_factor, P_max_elmts, sep_weight, &P);
             }
+            else if (interp_type == 25 || interp_type == 26) /* (smoothed) aggregation */
+            {
+               hypre_BoomerAMGBuildAggInterp(A_array[level], aggregates, coarse_pnts_global,
+                                             (nodal > 0) ? num_functions : 1, interp_type == 26,
+                                             debug_flag, trunc_factor, P_max_elmts, &P);
+            }
             else if (interp_type == 100) /* 1pt interpolation */
             {
                hypre_BoomerAMGBuildInterpOnePnt(A_array[level], CF_marker, S,
@@ -2323,6 +2483,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          {
             dof_func_array[level + 1] = coarse_dof_func;
          }
+         hypre_TFree(aggregates, HYPRE_MEMORY_HOST);
 
          HYPRE_ANNOTATE_REGION_END("%s", "Interpolation");
       } /* end of if max_levels > 1 */
@@ -2591,6 +2752,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             }
 
             HYPRE_ANNOTATE_REGION_BEGIN("%s", "RAP");
+            hypre_BoomerAMGProfileBegin(amg_data, level, HYPRE_AMG_PROFILE_RAP);
             if (ns == 1)
             {
                hypre_ParCSRMatrix *Q = NULL;
@@ -2790,6 +2952,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
        *--------------------------------------------------------------*/
 
       HYPRE_ANNOTATE_REGION_BEGIN("%s", "RAP");
+      hypre_BoomerAMGProfileBegin(amg_data, level, HYPRE_AMG_PROFILE_RAP);
       if (debug_flag == 1) { wall_time = time_getWallclockSeconds(); }
 
       if (block_mode)
@@ -2962,7 +3125,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
 
       size = ((HYPRE_Real) fine_size ) * .75;
-      if (coarsen_type > 0 && coarse_size >= (HYPRE_BigInt) size)
+      /* aggregation interpolation needs the aggregates of coarsen_type 12 */
+      if (coarsen_type > 0 && coarsen_type != 12 && coarse_size >= (HYPRE_BigInt) size)
       {
          coarsen_type = 0;
       }
@@ -2976,13 +3140,44 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          {
             not_finished_coarsening = 0;
          }
+         else if (agglom_threshold > 0 && !block_mode &&
+                  coarse_size < (HYPRE_BigInt) agglom_threshold * (HYPRE_BigInt) num_procs)
+         {
+            /* too few rows per rank: continue the hierarchy on fewer ranks */
+            agglomerate = 1;
+            not_finished_coarsening = 0;
+         }
       }
    }  /* end of coarsening loop: while (not_finished_coarsening) */
 
+   /* halo exchanges on the operators built here use neighborhood
+      collectives; A_array[0] belongs to the user and is left alone */
+   if (hypre_ParAMGDataNeighborColl(amg_data))
+   {
+      for (j = 0; j < level; j++)
+      {
+         hypre_ParCSRMatrixSetNeighborColl(A_array[j + 1], 1);
+         hypre_ParCSRMatrixSetNeighborColl(P_array[j], 1);
+         if (restri_type)
+         {
+            hypre_ParCSRMatrixSetNeighborColl(R_array[j], 1);
+         }
+      }
+   }
+
+   hypre_BoomerAMGProfileEnd(amg_data);
+
+   hypre_TFree(aggregates, HYPRE_MEMORY_HOST);
+
    HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
 
+   /* agglomerated coarse levels */
+   if (agglomerate)
+   {
+      hypre_BoomerAMGAgglomerateSetup(amg_data, level);
+   }
    /* redundant coarse grid solve */
-   if ((seq_threshold >= coarse_threshold) &&
+   else if ((seq_threshold >= coarse_threshold) &&
        (coarse_size > (HYPRE_BigInt) coarse_threshold) &&
        (level != max_levels - 1))
    {
@@ -3025,7 +3220,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_GpuProfilingPopRange();
 #endif
 
-   if (level > 0)
+   if (level > 0 && !reuse_setup)
    {
       if (block_mode)
       {
@@ -3100,6 +3295,25 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       cheby_coefs = hypre_CTAlloc(HYPRE_Real *, num_levels, HYPRE_MEMORY_HOST);
       hypre_ParAMGDataChebyDS(amg_data) = cheby_ds;
       hypre_ParAMGDataChebyCoefs(amg_data) = cheby_coefs;
+
+      /* room for the eigenvalue estimates kept across setups */
+      if (hypre_ParAMGDataChebyEigRefine(amg_data) > 0 &&
+          hypre_ParAMGDataChebyNumEigCache(amg_data) < num_levels)
+      {
+         HYPRE_Int num_cache = hypre_ParAMGDataChebyNumEigCache(amg_data);
+
+         hypre_ParAMGDataChebyEigVecs(amg_data) =
+            hypre_TReAlloc(hypre_ParAMGDataChebyEigVecs(amg_data), hypre_ParVector *,
+                           num_levels, HYPRE_MEMORY_HOST);
+         hypre_ParAMGDataChebyEigCache(amg_data) =
+            hypre_TReAlloc(hypre_ParAMGDataChebyEigCache(amg_data), HYPRE_Real,
+                           3 * num_levels, HYPRE_MEMORY_HOST);
+         for (j = num_cache; j < num_levels; j++)
+         {
+            hypre_ParAMGDataChebyEigVecs(amg_data)[j] = NULL;
+         }
+         hypre_ParAMGDataChebyNumEigCache(amg_data) = num_levels;
+      }
    }
 
    /* CG */
@@ -3110,6 +3324,53 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataSmoother(amg_data) = smoother;
    }
 
+   /* cache-sized blocks for the hybrid Gauss-Seidel smoothers, set up before the l1 norms
+      so that these see the blocked layout, and colors for the multicolor ones; not used
+      in block mode, where A_array holds only the finest level */
+   if (!block_mode)
+   {
+      hypre_TFree(hypre_ParAMGDataRelaxBlocks(amg_data), HYPRE_MEMORY_HOST);
+      for (j = 0; j < num_levels; j++)
+      {
+         HYPRE_Int rlx_down = (j < num_levels - 1) ? grid_relax_type[1] : grid_relax_type[3];
+         HYPRE_Int rlx_up   = (j < num_levels - 1) ? grid_relax_type[2] : grid_relax_type[3];
+
+         if (rlx_down == 31 || rlx_down == 32 || rlx_up == 31 || rlx_up == 32)
+         {
+            hypre_ParCSRMatrix *S_color = NULL;
+
+            hypre_BoomerAMGCreateS(A_array[j], strong_threshold, max_row_sum, num_functions,
+                                   dof_func_array[j] ? hypre_IntArrayData(dof_func_array[j]) : NULL,
+                                   &S_color);
+            hypre_BoomerAMGRelaxColorsSetup(A_array[j], S_color);
+            hypre_ParCSRMatrixDestroy(S_color);
+         }
+         else if (hypre_ParCSRMatrixRelaxColors(A_array[j]))
+         {
+            hypre_BoomerAMGRelaxColorsSetup(A_array[j], NULL);
+         }
+
+         if (hypre_ParAMGDataRelaxCacheBlock(amg_data) > 0 ||
+             hypre_ParCSRMatrixRelaxBlocks(A_array[j]))
+         {
+            HYPRE_Int rlx_types[2], block_kbytes = 0;
+
+            rlx_types[0] = rlx_down;
+            rlx_types[1] = rlx_up;
+            for (k = 0; k < 2; k++)
+            {
+               if (rlx_types[k] == 3 || rlx_types[k] == 4 || rlx_types[k] == 6 ||
+                   rlx_types[k] == 8 || rlx_types[k] == 13 || rlx_types[k] == 14)
+               {
+                  block_kbytes = hypre_ParAMGDataRelaxCacheBlock(amg_data);
+               }
+            }
+            /* level 0 is the user's matrix, whose arrays must stay in place */
+            hypre_BoomerAMGRelaxBlocksSetup(A_array[j], block_kbytes, j > 0);
+         }
+      }
+   }
+
    if (addlvl == -1)
    {
       addlvl = num_levels;
@@ -3132,17 +3393,17 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       {
          if (relax_order)
          {
-            hypre_ParCSRComputeL1Norms(A_array[j], 4, hypre_IntArrayData(CF_marker_array[j]), &l1_norm_data);
+            hypre_BoomerAMGComputeL1Norms(A_array[j], 4, hypre_IntArrayData(CF_marker_array[j]), &l1_norm_data);
          }
          else
          {
-            hypre_ParCSRComputeL1Norms(A_array[j], 4, NULL, &l1_norm_data);
+            hypre_BoomerAMGComputeL1Norms(A_array[j], 4, NULL, &l1_norm_data);
          }
       }
       else if (j == num_levels - 1 &&
                (grid_relax_type[3] == 8 || grid_relax_type[3] == 13 || grid_relax_type[3] == 14))
       {
-         hypre_ParCSRComputeL1Norms(A_array[j], 4, NULL, &l1_norm_data);
+         hypre_BoomerAMGComputeL1Norms(A_array[j], 4, NULL, &l1_norm_data);
       }
 
       if (j < num_levels - 1 && (grid_relax_type[1] == 18 || grid_relax_type[2] == 18))
@@ -3219,17 +3480,17 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       {
          if (relax_order)
          {
-            hypre_ParCSRComputeL1Norms(A_array[j], 4, hypre_IntArrayData(CF_marker_array[j]), &l1_norm_data);
+            hypre_BoomerAMGComputeL1Norms(A_array[j], 4, hypre_IntArrayData(CF_marker_array[j]), &l1_norm_data);
          }
          else
          {
-            hypre_ParCSRComputeL1Norms(A_array[j], 4, NULL, &l1_norm_data);
+            hypre_BoomerAMGComputeL1Norms(A_array[j], 4, NULL, &l1_norm_data);
          }
       }
       else if ((grid_relax_type[3] == 8 || grid_relax_type[3] == 13 || grid_relax_type[3] == 14) &&
                j == num_levels - 1)
       {
-         hypre_ParCSRComputeL1Norms(A_array[j], 4, NULL, &l1_norm_data);
+         hypre_BoomerAMGComputeL1Norms(A_array[j], 4, NULL, &l1_norm_data);
       }
       if ((grid_relax_type[1] == 18 || grid_relax_type[2] == 18) && j < num_levels - 1)
       {
@@ -3293,14 +3554,36 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          HYPRE_Int cheby_order = hypre_ParAMGDataChebyOrder(amg_data);
          HYPRE_Int cheby_eig_est = hypre_ParAMGDataChebyEigEst(amg_data);
          HYPRE_Real cheby_fraction = hypre_ParAMGDataChebyFraction(amg_data);
-         if (cheby_eig_est)
+         HYPRE_Int cheby_eig_refine = hypre_ParAMGDataChebyEigRefine(amg_data);
+         HYPRE_Int cached = 0;
+
+         if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
          {
-            hypre_ParCSRMaxEigEstimateCG(A_array[j], scale, cheby_eig_est,
-                                         &max_eig, &min_eig);
+            cheby_eig_refine = 0;
          }
-         else
+
+         if (cheby_eig_refine > 0)
+         {
+            cached = hypre_BoomerAMGChebyEigCacheLookup(amg_data, j, scale,
+                                                        &max_eig, &min_eig);
+         }
+
+         if (!cached)
          {
-            hypre_ParCSRMaxEigEstimate(A_array[j], scale, &max_eig, &min_eig);
+            if (cheby_eig_est)
+            {
+               hypre_ParCSRMaxEigEstimateCG(A_array[j], scale, cheby_eig_est,
+                                            &max_eig, &min_eig);
+            }
+            else
+            {
+               hypre_ParCSRMaxEigEstimate(A_array[j], scale, &max_eig, &min_eig);
+            }
+
+            if (cheby_eig_refine > 0)
+            {
+               hypre_BoomerAMGChebyEigCacheStore(amg_data, j, scale, max_eig, min_eig);
+            }
          }
          max_eig_est[j] = max_eig;
          min_eig_est[j] = min_eig;
@@ -3731,6 +4014,83 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    }
 #endif
 
+   /*-----------------------------------------------------------------------
+    * Store the matrices of the coarser levels in single precision. This has
+    * to come last, since only the matvecs and the smoothers checked below
+    * can be applied to them afterwards. The coarsest level is kept in
+    * double precision for the direct solve.
+    *-----------------------------------------------------------------------*/
+
+   {
+      HYPRE_Int mp_level = hypre_ParAMGDataMixedPrecisionLevel(amg_data);
+
+      if (mp_level > 0 && mp_level < num_levels - 1)
+      {
+         HYPRE_Int mp_ok = 1;
+
+         for (j = 1; j < 3; j++)
+         {
+            if (grid_relax_type[j] != 7 && grid_relax_type[j] != 16 && grid_relax_type[j] != 18)
+            {
+               mp_ok = 0;
+            }
+         }
+
+         if (relax_order || block_mode || additive >= 0 || mult_additive >= 0 || simple >= 0 ||
+             smooth_num_levels > mp_level ||
+             hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) != HYPRE_EXEC_HOST)
+         {
+            mp_ok = 0;
+         }
+
+         if (mp_ok)
+         {
+            HYPRE_Real bytes[2] = {0.0, 0.0}, bytes_global[2];
+
+            for (level = mp_level; level < num_levels - 1; level++)
+            {
+               bytes[0] += hypre_BoomerAMGValueBytes(A_array[level]) +
+                           hypre_BoomerAMGValueBytes(P_array[level]) +
+                           (restri_type ? hypre_BoomerAMGValueBytes(R_array[level]) : 0.0);
+
+               hypre_ParCSRMatrixConvertToFloat(A_array[level]);
+               hypre_ParCSRMatrixConvertToFloat(P_array[level]);
+               if (restri_type)
+               {
+                  hypre_ParCSRMatrixConvertToFloat(R_array[level]);
+               }
+
+               bytes[1] += hypre_BoomerAMGValueBytes(A_array[level]) +
+                           hypre_BoomerAMGValueBytes(P_array[level]) +
+                           (restri_type ? hypre_BoomerAMGValueBytes(R_array[level]) : 0.0);
+            }
+
+            if (amg_print_level == 1 || amg_print_level == 3)
+            {
+               hypre_MPI_Allreduce(bytes, bytes_global, 2, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+               if (my_id == 0)
+               {
+                  hypre_printf("Mixed precision levels %d-%d: matrix values %.0f -> %.0f bytes\n",
+                               mp_level, num_levels - 2, bytes_global[0], bytes_global[1]);
+               }
+            }
+         }
+         else if (my_id == 0)
+         {
+            hypre_printf("Warning: mixed precision levels need relaxation 7, 16 or 18 "
+                         "with relax_order 0 on the host, ignored\n");
+         }
+      }
+   }
+
+   /* the fine-level relax blocks are only lent to the user's matrix during the solve */
+   if (hypre_ParCSRMatrixRelaxBlocks(A_array[0]))
+   {
+      hypre_ParAMGDataRelaxBlocks(amg_data) = hypre_ParCSRMatrixRelaxBlocks(A_array[0]);
+      hypre_ParCSRMatrixRelaxBlocks(A_array[0]) = NULL;
+   }
+
+   hypre_BoomerAMGProfileStageEnd(amg_data);
    HYPRE_ANNOTATE_FUNC_END;
 
    return (hypre_error_flag);
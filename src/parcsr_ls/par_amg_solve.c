@@ -14,6 +14,210 @@
 #include "_hypre_parcsr_ls.h"
 #include "par_amg.h"
 
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSolveWorkSwap
+ *
+ * Exchange the single-column work vectors of the cycle (coarse-level F/U
+ * vectors and the temporaries) with the multivector ones in mv_work.
+ *--------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGSolveWorkSwap( hypre_ParAMGData *amg_data )
+{
+   hypre_ParVector **F_array    = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector **U_array    = hypre_ParAMGDataUArray(amg_data);
+   hypre_ParVector **mv_work    = hypre_ParAMGDataMVWork(amg_data);
+   HYPRE_Int         num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParVector  *tmp;
+   HYPRE_Int         i = 0, j;
+
+#define hypre_SwapWork(v) { tmp = (v); (v) = mv_work[i]; mv_work[i++] = tmp; }
+   for (j = 1; j < num_levels; j++)
+   {
+      hypre_SwapWork(F_array[j]);
+      hypre_SwapWork(U_array[j]);
+   }
+   hypre_SwapWork(hypre_ParAMGDataVtemp(amg_data));
+   hypre_SwapWork(hypre_ParAMGDataRtemp(amg_data));
+   hypre_SwapWork(hypre_ParAMGDataPtemp(amg_data));
+   hypre_SwapWork(hypre_ParAMGDataZtemp(amg_data));
+   hypre_SwapWork(hypre_ParAMGDataResidual(amg_data));
+#undef hypre_SwapWork
+
+   hypre_ParAMGDataMVActive(amg_data) = !hypre_ParAMGDataMVActive(amg_data);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSolveWorkDestroy
+ *
+ * Restore the single-column work vectors and free the multivector ones.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSolveWorkDestroy( hypre_ParAMGData *amg_data )
+{
+   hypre_ParVector **mv_work = hypre_ParAMGDataMVWork(amg_data);
+   HYPRE_Int         i;
+
+   if (!mv_work)
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_ParAMGDataMVActive(amg_data))
+   {
+      hypre_BoomerAMGSolveWorkSwap(amg_data);
+   }
+
+   for (i = 0; i < hypre_ParAMGDataMVWorkSize(amg_data); i++)
+   {
+      hypre_ParVectorDestroy(mv_work[i]);
+   }
+   hypre_TFree(mv_work, HYPRE_MEMORY_HOST);
+
+   hypre_ParAMGDataMVWork(amg_data)       = NULL;
+   hypre_ParAMGDataMVWorkSize(amg_data)   = 0;
+   hypre_ParAMGDataMVNumVectors(amg_data) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSetSolveNumVectors
+ *
+ * Switch the coarse-level F/U vectors and the cycle temporaries to copies
+ * with num_vectors columns, so that a multivector right-hand side is cycled
+ * as a block: residuals, restriction and interpolation become SpMMs and the
+ * Jacobi-type and Chebyshev smoothers update all columns at once. The
+ * multivector copies are kept until the next setup, so alternating single
+ * and multivector solves do not reallocate them.
+ * Returns nonzero if the configured cycle cannot run on multivectors.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetSolveNumVectors( hypre_ParAMGData *amg_data,
+                                   HYPRE_Int         num_vectors )
+{
+   hypre_ParVector **F_array    = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector **U_array    = hypre_ParAMGDataUArray(amg_data);
+   HYPRE_Int         num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int        *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int         additive      = hypre_ParAMGDataAdditive(amg_data);
+   HYPRE_Int         mult_additive = hypre_ParAMGDataMultAdditive(amg_data);
+   HYPRE_Int         simple        = hypre_ParAMGDataSimple(amg_data);
+   HYPRE_Int         work_size     = 2 * num_levels + 3;
+   hypre_ParVector **mv_work;
+   hypre_ParVector  *v;
+   HYPRE_Int         i, j;
+
+   if (num_vectors < 2)
+   {
+      if (hypre_ParAMGDataMVActive(amg_data))
+      {
+         hypre_BoomerAMGSolveWorkSwap(amg_data);
+      }
+
+      return hypre_error_flag;
+   }
+
+   if (hypre_ParAMGDataBlockMode(amg_data) ||
+       hypre_ParAMGDataSmoothNumLevels(amg_data) > 0 ||
+       hypre_ParAMGDataParticipate(amg_data) ||
+       hypre_ParAMGDataAgglomComm(amg_data) != hypre_MPI_COMM_NULL ||
+       (additive      >= 0 && additive      < num_levels) ||
+       (mult_additive >= 0 && mult_additive < num_levels) ||
+       (simple        >= 0 && simple        < num_levels))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Multivector BoomerAMG solve does not support this cycle or smoother!\n");
+      return HYPRE_ERROR_GENERIC;
+   }
+
+   for (j = 0; j < 4; j++)
+   {
+      if (grid_relax_type && grid_relax_type[j] == 15)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Multivector BoomerAMG solve does not support CG relaxation!\n");
+         return HYPRE_ERROR_GENERIC;
+      }
+   }
+
+   if (hypre_ParAMGDataMVActive(amg_data))
+   {
+      if (hypre_ParAMGDataMVNumVectors(amg_data) == num_vectors)
+      {
+         return hypre_error_flag;
+      }
+      hypre_BoomerAMGSolveWorkSwap(amg_data);
+   }
+
+   if (hypre_ParAMGDataMVWork(amg_data) &&
+       (hypre_ParAMGDataMVNumVectors(amg_data) != num_vectors ||
+        hypre_ParAMGDataMVWorkSize(amg_data) != work_size))
+   {
+      hypre_BoomerAMGSolveWorkDestroy(amg_data);
+   }
+
+   if (!hypre_ParAMGDataMVWork(amg_data))
+   {
+      /* Same order as in hypre_BoomerAMGSolveWorkSwap */
+      hypre_ParVector *singles[4];
+
+      mv_work = hypre_CTAlloc(hypre_ParVector *, work_size, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataMVWork(amg_data)       = mv_work;
+      hypre_ParAMGDataMVWorkSize(amg_data)   = work_size;
+      hypre_ParAMGDataMVNumVectors(amg_data) = num_vectors;
+
+      singles[0] = hypre_ParAMGDataVtemp(amg_data);
+      singles[1] = hypre_ParAMGDataRtemp(amg_data);
+      singles[2] = hypre_ParAMGDataPtemp(amg_data);
+      singles[3] = hypre_ParAMGDataZtemp(amg_data);
+
+      for (i = 0; i < work_size; i++)
+      {
+         if (i < 2 * (num_levels - 1))
+         {
+            v = (i % 2) ? U_array[i / 2 + 1] : F_array[i / 2 + 1];
+         }
+         else if (i < work_size - 1)
+         {
+            v = singles[i - 2 * (num_levels - 1)];
+         }
+         else
+         {
+            v = (hypre_ParAMGDataLogging(amg_data) > 1) ? hypre_ParAMGDataResidual(amg_data) : NULL;
+         }
+
+         if (!v)
+         {
+            continue;
+         }
+
+         mv_work[i] = hypre_ParMultiVectorCreate(hypre_ParVectorComm(v),
+                                                 hypre_ParVectorGlobalSize(v),
+                                                 hypre_ParVectorPartitioning(v),
+                                                 num_vectors);
+         if (mv_work[i])
+         {
+            hypre_ParVectorInitialize_v2(mv_work[i], hypre_ParVectorMemoryLocation(v));
+         }
+         if (!mv_work[i] || (hypre_ParVectorActualLocalSize(mv_work[i]) > 0 &&
+                             !hypre_VectorData(hypre_ParVectorLocalVector(mv_work[i]))))
+         {
+            hypre_BoomerAMGSolveWorkDestroy(amg_data);
+            hypre_error_w_msg(HYPRE_ERROR_MEMORY,
+                              "Cannot allocate the multivector BoomerAMG work vectors!\n");
+            return HYPRE_ERROR_MEMORY;
+         }
+      }
+   }
+
+   return hypre_BoomerAMGSolveWorkSwap(amg_data);
+}
+
 /*--------------------------------------------------------------------
  * hypre_BoomerAMGSolve
  *--------------------------------------------------------------------*/
@@ -81,6 +285,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    hypre_ParVector  *Residual;
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
+   hypre_BoomerAMGProfileStageBegin(amg_data, HYPRE_AMG_PROFILE_SOLVE);
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
 
@@ -104,10 +309,29 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    simple           = hypre_ParAMGDataSimple(amg_data);
    mult_additive    = hypre_ParAMGDataMultAdditive(amg_data);
 
+   /* there is no hierarchy if the setup stopped on an error */
+   if (!A_array)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "BoomerAMG solve called without a hierarchy!\n");
+      hypre_BoomerAMGProfileStageEnd(amg_data);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
    A_array[0] = A;
    F_array[0] = f;
    U_array[0] = u;
 
+   /* Size the hierarchy's work vectors for the number of right-hand sides */
+   if (hypre_BoomerAMGSetSolveNumVectors(amg_data, hypre_ParVectorNumVectors(f)))
+   {
+      hypre_BoomerAMGProfileStageEnd(amg_data);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
    block_mode = hypre_ParAMGDataBlockMode(amg_data);
 
    A_block_array = hypre_ParAMGDataABlockArray(amg_data);
@@ -167,13 +391,15 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
          }
          resid_nrm = sqrt(hypre_ParVectorInnerProd( Residual, Residual ));
       }
+      else if (tol > 0)
+      {
+         /* Vtemp = f - A*u with its norm in one pass */
+         hypre_ParCSRMatrixResidualNorm(A_array[0], U_array[0], F_array[0], Vtemp, &resid_nrm, NULL);
+         resid_nrm = sqrt(resid_nrm);
+      }
       else
       {
          hypre_ParVectorCopy(F_array[0], Vtemp);
-         if (tol > 0)
-         {
-            hypre_ParCSRMatrixMatvec(alpha, A_array[0], U_array[0], beta, Vtemp);
-         }
          resid_nrm = sqrt(hypre_ParVectorInnerProd(Vtemp, Vtemp));
       }
 
@@ -199,6 +425,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
             hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
          }
          hypre_error(HYPRE_ERROR_GENERIC);
+         hypre_BoomerAMGProfileStageEnd(amg_data);
          HYPRE_ANNOTATE_FUNC_END;
 
          return hypre_error_flag;
@@ -243,6 +470,12 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
     *    Main V-cycle loop
     *-----------------------------------------------------------------------*/
 
+   /* lend the fine-level relax blocks to the user's matrix for the cycles */
+   if (hypre_ParAMGDataRelaxBlocks(amg_data))
+   {
+      hypre_ParCSRMatrixRelaxBlocks(A_array[0]) = hypre_ParAMGDataRelaxBlocks(amg_data);
+   }
+
    while ( (relative_resid >= tol || cycle_count < min_iter) && cycle_count < max_iter )
    {
       hypre_ParAMGDataCycleOpCount(amg_data) = 0;
@@ -273,8 +506,8 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
          }
          else
          {
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[0], U_array[0], beta, F_array[0], Vtemp);
-            resid_nrm = sqrt(hypre_ParVectorInnerProd(Vtemp, Vtemp));
+            hypre_ParCSRMatrixResidualNorm(A_array[0], U_array[0], F_array[0], Vtemp, &resid_nrm, NULL);
+            resid_nrm = sqrt(resid_nrm);
          }
 
          if (old_resid)
@@ -319,6 +552,11 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       }
    }
 
+   if (hypre_ParAMGDataRelaxBlocks(amg_data))
+   {
+      hypre_ParCSRMatrixRelaxBlocks(A_array[0]) = NULL;
+   }
+
    if (cycle_count == max_iter && tol > 0.)
    {
       Solve_err_flag = 1;
@@ -402,6 +640,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       hypre_TFree(num_coeffs, HYPRE_MEMORY_HOST);
       hypre_TFree(num_variables, HYPRE_MEMORY_HOST);
    }
+   hypre_BoomerAMGProfileStageEnd(amg_data);
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
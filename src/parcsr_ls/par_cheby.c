@@ -35,9 +35,331 @@ this is rlx 15 if scale = 0, and 17 if scale == 1
 ratio indicates the percentage of the whole spectrum to use (so .5
 means half, and .1 means 10percent)
 
+variant 2: fourth-kind chebyshev (Lottes 2022), any order up to
+hypre_CHEBY_FOURTH_MAX_ORDER, computed with the three-term recurrence of
+Phillips and Fischer. The smoother acts on the whole interval (0, rho],
+so the ratio is not used.
+
+variant 3: optimized fourth-kind chebyshev: as variant 2, with the update
+of iteration k scaled by beta_k. The betas minimize the two-level bound
+max_{0<x<=1} x p(x)^2/(1 - p(x)^2) of the error polynomial p and were
+precomputed offline (Lawson iterations followed by a Remez exchange).
+
+The fourth-kind variants run on the host only. Each polynomial degree is
+applied in a single pass over A, which updates the residual, the search
+direction and the solution at once.
+
 
 *******************************************************************************/
 
+#define hypre_CHEBY_FOURTH_MAX_ORDER 16
+
+/* optimized fourth-kind betas, order m starts at entry m*(m-1)/2 */
+static const HYPRE_Real hypre_ChebyOptFourthBetas[] =
+{
+   /* m = 1 */
+   1.12500000000000,
+   /* m = 2 */
+   1.02387287570313, 1.26408905371084,
+   /* m = 3 */
+   1.00842544782028, 1.08867839208730, 1.33753125909614,
+   /* m = 4 */
+   1.00391310474559, 1.04035811223690, 1.14863498708662, 1.38268869580745,
+   /* m = 5 */
+   1.00212930126308, 1.02173711628672, 1.07872433298207, 1.19810065431963,
+   1.41322543081432,
+   /* m = 6 */
+   1.00128517276608, 1.01304293034988, 1.04678215228854, 1.11616489572811,
+   1.23829020338898, 1.43524297356525,
+   /* m = 7 */
+   1.00083464397912, 1.00843949430122, 1.03008707768712, 1.07408384092000,
+   1.15036186707358, 1.27116474046124, 1.45186658649336,
+   /* m = 8 */
+   1.00057246631198, 1.00577427662415, 1.02050187922940, 1.05019803444562,
+   1.10115572984934, 1.18086042806843, 1.29838585382553, 1.46486073151063,
+   /* m = 9 */
+   1.00040960072833, 1.00412439506106, 1.01460212148265, 1.03561113626669,
+   1.07139972529188, 1.12688273710951, 1.20785219140710, 1.32121930716716,
+   1.47529642820653,
+   /* m = 10 */
+   1.00030312237062, 1.00304840655560, 1.01077022753782, 1.02619011632964,
+   1.05231725032412, 1.09255743335888, 1.15083376812414, 1.23172251083694,
+   1.34060802099056, 1.48386124552862,
+   /* m = 11 */
+   1.00023058590649, 1.00231675039880, 1.00817245398627, 1.01982986627150,
+   1.03950210284695, 1.06965042830929, 1.11305754432206, 1.17290876440265,
+   1.25288300798517, 1.35725579964468, 1.49101672766745,
+   /* m = 12 */
+   1.00017947200828, 1.00180189139619, 1.00634861907307, 1.01537864566304,
+   1.03056942830756, 1.05376019693935, 1.08699862592059, 1.13259183097892,
+   1.19316273358141, 1.27171293675066, 1.37169337969737, 1.49708418575477,
+   /* m = 13 */
+   1.00014241921560, 1.00142906932629, 1.00503028986297, 1.01216910518493,
+   1.02414874342788, 1.04238158880813, 1.06842008128689, 1.10399010936741,
+   1.15102748242618, 1.21171811910085, 1.28854264865073, 1.38432619380916,
+   1.50229418757268,
+   /* m = 14 */
+   1.00011490537112, 1.00115246381441, 1.00405357341909, 1.00979590591063,
+   1.01941300520187, 1.03401425082719, 1.05480599717286, 1.08311420396006,
+   1.12040891829062, 1.16833095802211, 1.22872122452464, 1.30365305875067,
+   1.39546814081802, 1.50681646281470,
+   /* m = 15 */
+   1.00009404750753, 1.00094291696343, 1.00331449056444, 1.00800294833814,
+   1.01584236259137, 1.02772083317698, 1.04459535422821, 1.06750761206109,
+   1.09760092545866, 1.13613855366124, 1.18452361426191, 1.24432087304414,
+   1.31728069083312, 1.40536543893454, 1.51077872501710,
+   /* m = 16 */
+   1.00007794828179, 1.00078126847253, 1.00274487974401, 1.00662291017013,
+   1.01309858836968, 1.02289448329331, 1.03678321409974, 1.05559875719882,
+   1.08024848405539, 1.11172607131467, 1.15112543431031, 1.19965584614918,
+   1.25865841744872, 1.32962412656569, 1.41421360695454, 1.51427891730192
+};
+
+/**
+ * @brief Setup of the fourth-kind Chebyshev smoothers (variants 2 and 3)
+ *
+ * coefs[0] holds 1/rho, where rho bounds the eigenvalue of largest
+ * magnitude, and coefs[1..order] hold the betas of the iterations.
+ */
+static HYPRE_Int
+hypre_ParCSRRelax_Cheby_FourthSetup(hypre_ParCSRMatrix *A,
+                                    HYPRE_Real          max_eig,
+                                    HYPRE_Real          min_eig,
+                                    HYPRE_Int           order,
+                                    HYPRE_Int           scale,
+                                    HYPRE_Int           variant,
+                                    HYPRE_Real        **coefs_ptr,
+                                    HYPRE_Real        **ds_ptr)
+{
+   HYPRE_Int        num_rows = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Real      *coefs;
+   HYPRE_Real      *ds_data = NULL;
+   HYPRE_Real       rho;
+   HYPRE_Int        k;
+
+   order = hypre_max(hypre_min(order, hypre_CHEBY_FOURTH_MAX_ORDER), 1);
+   coefs = hypre_CTAlloc(HYPRE_Real, order + 1, HYPRE_MEMORY_HOST);
+
+   /* make sure we are large enough, as for the other variants */
+   rho = (max_eig <= 0.0) ? min_eig * 1.1 : max_eig * 1.1;
+   coefs[0] = (rho != 0.0) ? 1.0 / rho : 0.0;
+
+   for (k = 0; k < order; k++)
+   {
+      coefs[k + 1] = (variant == 3) ? hypre_ChebyOptFourthBetas[order * (order - 1) / 2 + k] : 1.0;
+   }
+   *coefs_ptr = coefs;
+
+   if (scale)
+   {
+      /* 1/sqrt(abs(diagonal)), squared when applied */
+      ds_data = hypre_CTAlloc(HYPRE_Real, num_rows, hypre_ParCSRMatrixMemoryLocation(A));
+      hypre_CSRMatrixExtractDiagonal(hypre_ParCSRMatrixDiag(A), ds_data, 4);
+   }
+   *ds_ptr = ds_data;
+
+   return hypre_error_flag;
+}
+
+/**
+ * @brief Fourth-kind Chebyshev smoothing on the host
+ *
+ * With M = |D| if scale is set and M = I otherwise:
+ *
+ *   r = f - A u,  d = 4/(3 rho) M^{-1} r
+ *   for k = 1, ..., order - 1:
+ *      u = u + beta_k d,  r = r - A d,
+ *      d = (2k-1)/(2k+3) d + (8k+4)/((2k+3) rho) M^{-1} r
+ *   u = u + beta_order d
+ *
+ * The updates of iteration k are fused with the product A d into one pass
+ * over the rows. Rows without off-processor couplings are done while the
+ * halo of d is exchanged. All columns of a multivector are relaxed at once.
+ *
+ * @param[in,out] u Initial/updated approximation
+ * @param[in] r Temp vector (residual)
+ * @param[in] d Temp vector (search direction)
+ * @param[in] d_new Temp vector (next search direction)
+ */
+static HYPRE_Int
+hypre_ParCSRRelax_Cheby_FourthSolveHost(hypre_ParCSRMatrix *A,
+                                        hypre_ParVector    *f,
+                                        HYPRE_Real         *ds_data,
+                                        HYPRE_Real         *coefs,
+                                        HYPRE_Int           order,
+                                        HYPRE_Int           scale,
+                                        hypre_ParVector    *u,
+                                        hypre_ParVector    *r,
+                                        hypre_ParVector    *d,
+                                        hypre_ParVector    *d_new)
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   hypre_ParCSRCommPkg *comm_pkg;
+
+   /* values of the single-precision levels, see hypre_CSRMatrixConvertToFloat */
+   float               *A_diag_data_f = hypre_CSRMatrixDataFloat(A_diag);
+   float               *A_offd_data_f = hypre_CSRMatrixDataFloat(A_offd);
+
+   HYPRE_Real          *u_data        = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real          *r_data        = hypre_VectorData(hypre_ParVectorLocalVector(r));
+   HYPRE_Real          *d_data        = hypre_VectorData(hypre_ParVectorLocalVector(d));
+   HYPRE_Real          *d_new_data    = hypre_VectorData(hypre_ParVectorLocalVector(d_new));
+   HYPRE_Real          *d_tmp;
+   HYPRE_Real          *d_buf_data    = NULL;
+   HYPRE_Real          *d_ext_data    = NULL;
+
+   /* multivector columns are stored contiguously with stride num_rows */
+   HYPRE_Int            num_vectors   = hypre_ParVectorNumVectors(u);
+   HYPRE_Int            n             = num_rows * num_vectors;
+
+   hypre_ParCSRCommHandle **comm_handles = NULL;
+   HYPRE_Real           inv_rho       = coefs[0];
+   HYPRE_Real          *betas         = coefs + 1;
+   HYPRE_Real           c_d, c_r, dinv, ad;
+   HYPRE_Int            num_procs, num_sends = 0, send_size = 0;
+   HYPRE_Int            i, j, k, jv, index, pass;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   order = hypre_max(hypre_min(order, hypre_CHEBY_FOURTH_MAX_ORDER), 1);
+
+   /* r = f - A*u */
+   hypre_ParVectorCopy(f, r);
+   hypre_ParCSRMatrixMatvec(-1.0, A, u, 1.0, r);
+
+   /* d = 4/(3 rho) M^{-1} r */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i,k,dinv) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      dinv = scale ? ds_data[i] * ds_data[i] : 1.0;
+      for (k = i; k < n; k += num_rows)
+      {
+         d_data[k] = (4.0 / 3.0) * inv_rho * dinv * r_data[k];
+      }
+   }
+
+   if (num_procs > 1 && order > 1)
+   {
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      send_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+      d_buf_data = hypre_TAlloc(HYPRE_Real, send_size * num_vectors, HYPRE_MEMORY_HOST);
+      d_ext_data = hypre_TAlloc(HYPRE_Real, num_cols_offd * num_vectors, HYPRE_MEMORY_HOST);
+      comm_handles = hypre_CTAlloc(hypre_ParCSRCommHandle *, num_vectors, HYPRE_MEMORY_HOST);
+   }
+
+   for (k = 1; k < order; k++)
+   {
+      c_d = (2.0 * k - 1.0) / (2.0 * k + 3.0);
+      c_r = (8.0 * k + 4.0) / (2.0 * k + 3.0) * inv_rho;
+
+      /* start the halo exchange of d */
+      if (comm_handles)
+      {
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            index = jv * send_size;
+            for (j = 0; j < send_size; j++)
+            {
+               d_buf_data[index + j] =
+                  d_data[jv * num_rows + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+            }
+            comm_handles[jv] = hypre_ParCSRCommHandleCreate(1, comm_pkg, &d_buf_data[index],
+                                                            &d_ext_data[jv * num_cols_offd]);
+         }
+      }
+
+      /* pass 0: rows without off-processor couplings, pass 1: the others */
+      for (pass = 0; pass < 2; pass++)
+      {
+         if (pass == 1 && comm_handles)
+         {
+            for (jv = 0; jv < num_vectors; jv++)
+            {
+               hypre_ParCSRCommHandleDestroy(comm_handles[jv]);
+               comm_handles[jv] = NULL;
+            }
+         }
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i,j,jv,index,dinv,ad) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            if ((A_offd_i[i + 1] > A_offd_i[i]) != pass)
+            {
+               continue;
+            }
+
+            dinv = scale ? ds_data[i] * ds_data[i] : 1.0;
+            for (jv = 0; jv < num_vectors; jv++)
+            {
+               ad = 0.0;
+               if (A_diag_data_f)
+               {
+                  for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+                  {
+                     ad += (HYPRE_Real) A_diag_data_f[j] * d_data[jv * num_rows + A_diag_j[j]];
+                  }
+                  for (j = A_offd_i[i]; j < A_offd_i[i + 1]; j++)
+                  {
+                     ad += (HYPRE_Real) A_offd_data_f[j] *
+                           d_ext_data[jv * num_cols_offd + A_offd_j[j]];
+                  }
+               }
+               else
+               {
+                  for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+                  {
+                     ad += A_diag_data[j] * d_data[jv * num_rows + A_diag_j[j]];
+                  }
+                  for (j = A_offd_i[i]; j < A_offd_i[i + 1]; j++)
+                  {
+                     ad += A_offd_data[j] * d_ext_data[jv * num_cols_offd + A_offd_j[j]];
+                  }
+               }
+
+               index = jv * num_rows + i;
+               u_data[index] += betas[k - 1] * d_data[index];
+               r_data[index] -= ad;
+               d_new_data[index] = c_d * d_data[index] + c_r * dinv * r_data[index];
+            }
+         }
+      }
+
+      d_tmp = d_data;
+      d_data = d_new_data;
+      d_new_data = d_tmp;
+   }
+
+   /* u = u + beta_order * d */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < n; i++)
+   {
+      u_data[i] += betas[order - 1] * d_data[i];
+   }
+
+   hypre_TFree(d_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(d_ext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(comm_handles, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /**
  * @brief Setups of coefficients (and optional diagonal scaling elements) for
  * Chebyshev relaxation
@@ -74,6 +396,20 @@ hypre_ParCSRRelax_Cheby_Setup(hypre_ParCSRMatrix *A,         /* matrix to relax
    HYPRE_Int        cheby_order;
    HYPRE_Real      *ds_data = NULL;
 
+   if (variant > 1)
+   {
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+      if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) == HYPRE_EXEC_DEVICE)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Fourth-kind Chebyshev is not available on device!\n");
+         return hypre_error_flag;
+      }
+#endif
+      return hypre_ParCSRRelax_Cheby_FourthSetup(A, max_eig, min_eig, order, scale,
+                                                 variant, coefs_ptr, ds_ptr);
+   }
+
    /* u = u + p(A)r */
    if (order > 4)
    {
@@ -236,9 +572,13 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
 
    HYPRE_Real  *r_data = hypre_VectorData(hypre_ParVectorLocalVector(r));
 
-   HYPRE_Int i, j;
+   HYPRE_Int i, j, k;
    HYPRE_Int num_rows = hypre_CSRMatrixNumRows(A_diag);
 
+   /* multivector columns are stored contiguously with stride num_rows */
+   HYPRE_Int num_vectors = hypre_ParVectorNumVectors(u);
+   HYPRE_Int n = num_rows * num_vectors;
+
    HYPRE_Real mult;
    HYPRE_Real *orig_u;
 
@@ -271,7 +611,7 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
       hypre_ParCSRMatrixMatvec(-1.0, A, u, 1.0, r);
 
       /* o = u; u = r .* coef */
-      for ( i = 0; i < num_rows; i++ )
+      for ( i = 0; i < n; i++ )
       {
          orig_u[i] = u_data[i];
          u_data[i] = r_data[i] * coefs[cheby_order];
@@ -284,7 +624,7 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
 #ifdef HYPRE_USING_OPENMP
          #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
 #endif
-         for ( j = 0; j < num_rows; j++ )
+         for ( j = 0; j < n; j++ )
          {
             u_data[j] = mult * r_data[j] + v_data[j];
          }
@@ -294,7 +634,7 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
 #ifdef HYPRE_USING_OPENMP
       #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
-      for ( i = 0; i < num_rows; i++ )
+      for ( i = 0; i < n; i++ )
       {
          u_data[i] = orig_u[i] + u_data[i];
       }
@@ -311,11 +651,14 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
       hypre_ParCSRMatrixMatvec(-1.0, A, u, 0.0, tmp_vec);
       /* r = ds .* (f + tmp) */
 #ifdef HYPRE_USING_OPENMP
-      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+      #pragma omp parallel for private(j,k) HYPRE_SMP_SCHEDULE
 #endif
       for ( j = 0; j < num_rows; j++ )
       {
-         r_data[j] = ds_data[j] * (f_data[j] + tmp_data[j]);
+         for ( k = j; k < n; k += num_rows )
+         {
+            r_data[k] = ds_data[j] * (f_data[k] + tmp_data[k]);
+         }
       }
 
       /* save original u, then start
@@ -325,7 +668,7 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
 #ifdef HYPRE_USING_OPENMP
       #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
 #endif
-      for ( j = 0; j < num_rows; j++ )
+      for ( j = 0; j < n; j++ )
       {
          orig_u[j] = u_data[j]; /* orig, unscaled u */
 
@@ -338,11 +681,14 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
          /* v = D^(-1/2)AD^(-1/2)u */
          /* tmp = ds .* u */
 #ifdef HYPRE_USING_OPENMP
-         #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+         #pragma omp parallel for private(j,k) HYPRE_SMP_SCHEDULE
 #endif
          for ( j = 0; j < num_rows; j++ )
          {
-            tmp_data[j]  =  ds_data[j] * u_data[j];
+            for ( k = j; k < n; k += num_rows )
+            {
+               tmp_data[k]  =  ds_data[j] * u_data[k];
+            }
          }
          hypre_ParCSRMatrixMatvec(1.0, A, tmp_vec, 0.0, v);
 
@@ -351,11 +697,14 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
 
          /* u = coef * r + ds .* v */
 #ifdef HYPRE_USING_OPENMP
-         #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+         #pragma omp parallel for private(j,k) HYPRE_SMP_SCHEDULE
 #endif
          for ( j = 0; j < num_rows; j++ )
          {
-            u_data[j] = mult * r_data[j] + ds_data[j] * v_data[j];
+            for ( k = j; k < n; k += num_rows )
+            {
+               u_data[k] = mult * r_data[k] + ds_data[j] * v_data[k];
+            }
          }
 
       } /* end of cheby_order loop */
@@ -364,11 +713,14 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
 
       /* u = orig_u + ds .* u */
 #ifdef HYPRE_USING_OPENMP
-      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+      #pragma omp parallel for private(j,k) HYPRE_SMP_SCHEDULE
 #endif
       for ( j = 0; j < num_rows; j++ )
       {
-         u_data[j] = orig_u[j] + ds_data[j] * u_data[j];
+         for ( k = j; k < n; k += num_rows )
+         {
+            u_data[k] = orig_u[k] + ds_data[j] * u_data[k];
+         }
       }
 
    }/* end of scaling code */
@@ -408,6 +760,13 @@ hypre_ParCSRRelax_Cheby_Solve(hypre_ParCSRMatrix *A, /* matrix to relax with */
                               hypre_ParVector    *orig_u_vec, /*another temp vector */
                               hypre_ParVector    *tmp_vec) /*another temp vector */
 {
+   if (variant > 1)
+   {
+      /* host only, see hypre_ParCSRRelax_Cheby_Setup */
+      return hypre_ParCSRRelax_Cheby_FourthSolveHost(A, f, ds_data, coefs, order, scale,
+                                                     u, r, orig_u_vec, v);
+   }
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    hypre_GpuProfilingPushRange("ParCSRRelaxChebySolve");
 #endif
@@ -415,7 +774,29 @@ hypre_ParCSRRelax_Cheby_Solve(hypre_ParCSRMatrix *A, /* matrix to relax with */
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A));
-   if (exec == HYPRE_EXEC_DEVICE)
+   if (exec == HYPRE_EXEC_DEVICE && hypre_ParVectorNumVectors(u) > 1)
+   {
+      /* the device kernels are single-vector: relax column by column */
+      hypre_ParVector f_k, u_k, v_k, r_k, o_k, t_k;
+      hypre_Vector    f_kl, u_kl, v_kl, r_kl, o_kl, t_kl;
+      HYPRE_Int       k;
+
+      for (k = 0; k < hypre_ParVectorNumVectors(u) && !ierr; k++)
+      {
+         hypre_ParVectorGetColumnView(f, k, &f_k, &f_kl);
+         hypre_ParVectorGetColumnView(u, k, &u_k, &u_kl);
+         hypre_ParVectorGetColumnView(v, k, &v_k, &v_kl);
+         hypre_ParVectorGetColumnView(r, k, &r_k, &r_kl);
+         hypre_ParVectorGetColumnView(orig_u_vec, k, &o_k, &o_kl);
+         if (tmp_vec)
+         {
+            hypre_ParVectorGetColumnView(tmp_vec, k, &t_k, &t_kl);
+         }
+         ierr = hypre_ParCSRRelax_Cheby_SolveDevice(A, &f_k, ds_data, coefs, order, scale, variant,
+                                                    &u_k, &v_k, &r_k, &o_k, tmp_vec ? &t_k : NULL);
+      }
+   }
+   else if (exec == HYPRE_EXEC_DEVICE)
    {
       ierr = hypre_ParCSRRelax_Cheby_SolveDevice(A, f, ds_data, coefs, order, scale, variant, u, v, r,
                                                  orig_u_vec, tmp_vec);
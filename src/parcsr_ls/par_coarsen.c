@@ -2086,6 +2086,141 @@ hypre_BoomerAMGCoarsenFalgout( hypre_ParCSRMatrix  *S,
 #define COMMON_C_PT  2
 #define Z_PT -2
 
+/*--------------------------------------------------------------------------
+ * hypre_PMISBoundaryPkgCreate
+ *
+ * Private copy of the matvec pattern used to exchange CF_marker during PMIS.
+ * recv_cols maps the (possibly compressed) receive buffer back to offd columns.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRCommPkg *
+hypre_PMISBoundaryPkgCreate( hypre_ParCSRCommPkg  *comm_pkg,
+                             HYPRE_Int           **recv_cols_ptr )
+{
+   HYPRE_Int            num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int            send_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   HYPRE_Int            recv_size = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
+   hypre_ParCSRCommPkg *pkg       = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+   HYPRE_Int           *recv_cols = hypre_TAlloc(HYPRE_Int, recv_size, HYPRE_MEMORY_HOST);
+   HYPRE_Int            k;
+
+   hypre_ParCSRCommPkgComm(pkg)          = hypre_ParCSRCommPkgComm(comm_pkg);
+   hypre_ParCSRCommPkgNumSends(pkg)      = num_sends;
+   hypre_ParCSRCommPkgNumRecvs(pkg)      = num_recvs;
+   hypre_ParCSRCommPkgSendProcs(pkg)     = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgSendMapStarts(pkg) = hypre_TAlloc(HYPRE_Int, num_sends + 1,
+                                                        HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgSendMapElmts(pkg)  = hypre_TAlloc(HYPRE_Int, send_size, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgRecvProcs(pkg)     = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgRecvVecStarts(pkg) = hypre_TAlloc(HYPRE_Int, num_recvs + 1,
+                                                        HYPRE_MEMORY_HOST);
+
+   hypre_TMemcpy(hypre_ParCSRCommPkgSendProcs(pkg), hypre_ParCSRCommPkgSendProcs(comm_pkg),
+                 HYPRE_Int, num_sends, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_ParCSRCommPkgSendMapStarts(pkg), hypre_ParCSRCommPkgSendMapStarts(comm_pkg),
+                 HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_ParCSRCommPkgSendMapElmts(pkg), hypre_ParCSRCommPkgSendMapElmts(comm_pkg),
+                 HYPRE_Int, send_size, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_ParCSRCommPkgRecvProcs(pkg), hypre_ParCSRCommPkgRecvProcs(comm_pkg),
+                 HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_ParCSRCommPkgRecvVecStarts(pkg), hypre_ParCSRCommPkgRecvVecStarts(comm_pkg),
+                 HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   for (k = 0; k < recv_size; k++)
+   {
+      recv_cols[k] = k;
+   }
+
+   *recv_cols_ptr = recv_cols;
+
+   return pkg;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PMISBoundaryPkgCompress
+ *
+ * Removes from the exchange pattern every entry that carried a nonzero
+ * CF_marker in the last forward exchange (send_vals -> recv_vals). Those
+ * points are decided on both sides and never change again, so later sweeps
+ * only ship undecided boundary points, and neighbors with none are dropped.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PMISBoundaryPkgCompress( hypre_ParCSRCommPkg *pkg,
+                               HYPRE_Int           *recv_cols,
+                               HYPRE_Int           *send_vals,
+                               HYPRE_Int           *recv_vals )
+{
+   HYPRE_Int  num_sends   = hypre_ParCSRCommPkgNumSends(pkg);
+   HYPRE_Int  num_recvs   = hypre_ParCSRCommPkgNumRecvs(pkg);
+   HYPRE_Int *send_procs  = hypre_ParCSRCommPkgSendProcs(pkg);
+   HYPRE_Int *send_starts = hypre_ParCSRCommPkgSendMapStarts(pkg);
+   HYPRE_Int *send_elmts  = hypre_ParCSRCommPkgSendMapElmts(pkg);
+   HYPRE_Int *recv_procs  = hypre_ParCSRCommPkgRecvProcs(pkg);
+   HYPRE_Int *recv_starts = hypre_ParCSRCommPkgRecvVecStarts(pkg);
+   HYPRE_Int  p, k, begin, end, first, cnt, num_new;
+
+   cnt = num_new = 0;
+   begin = send_starts[0];
+   for (p = 0; p < num_sends; p++)
+   {
+      end = send_starts[p + 1];
+      first = cnt;
+      for (k = begin; k < end; k++)
+      {
+         if (!send_vals[k])
+         {
+            send_elmts[cnt++] = send_elmts[k];
+         }
+      }
+      if (cnt > first)
+      {
+         send_procs[num_new] = send_procs[p];
+         send_starts[++num_new] = cnt;
+      }
+      begin = end;
+   }
+   hypre_ParCSRCommPkgNumSends(pkg) = num_new;
+
+   cnt = num_new = 0;
+   begin = recv_starts[0];
+   for (p = 0; p < num_recvs; p++)
+   {
+      end = recv_starts[p + 1];
+      first = cnt;
+      for (k = begin; k < end; k++)
+      {
+         if (!recv_vals[k])
+         {
+            recv_cols[cnt++] = recv_cols[k];
+         }
+      }
+      if (cnt > first)
+      {
+         recv_procs[num_new] = recv_procs[p];
+         recv_starts[++num_new] = cnt;
+      }
+      begin = end;
+   }
+   hypre_ParCSRCommPkgNumRecvs(pkg) = num_new;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PMISBoundaryPkgDestroy
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PMISBoundaryPkgDestroy( hypre_ParCSRCommPkg *pkg )
+{
+   hypre_TFree(hypre_ParCSRCommPkgSendProcs(pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRCommPkgSendMapStarts(pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRCommPkgSendMapElmts(pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRCommPkgRecvProcs(pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRCommPkgRecvVecStarts(pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(pkg, HYPRE_MEMORY_HOST);
+}
+
 /* begin HANS added */
 /**************************************************************
  *
@@ -2128,6 +2263,14 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
    HYPRE_Int                *int_buf_data;
    HYPRE_Real               *buf_data;
 
+   /* CF_marker exchange pattern, shrinking to the undecided boundary points */
+   hypre_ParCSRCommPkg      *bnd_pkg = NULL;
+   hypre_ParCSRCommHandle   *bnd_handle = NULL;
+   HYPRE_Int                *bnd_recv_cols = NULL;
+   HYPRE_Int                *int_recv_data = NULL;
+   HYPRE_Int                 bnd_send_size = 0;
+   HYPRE_Int                 bnd_recv_size = 0;
+
    HYPRE_Int                *CF_marker;
    HYPRE_Int                *CF_marker_offd;
 
@@ -2139,7 +2282,7 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
    HYPRE_Int                 graph_offd_size;
    HYPRE_BigInt              global_graph_size;
 
-   HYPRE_Int                 i, j, jj, jS, ig;
+   HYPRE_Int                 i, j, jj, jS, ig, k, pass;
    HYPRE_Int                 index, start, my_id, num_procs, jrow, cnt, elmt;
    HYPRE_Int                 nnzrow;
 
@@ -2456,6 +2599,18 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
       graph_array_offd2 = hypre_CTAlloc(HYPRE_Int,  num_cols_offd, HYPRE_MEMORY_HOST);
    }
 
+   /* CF_marker is exchanged through a private copy of comm_pkg. Boundary points are
+      dropped from it as soon as both sides know they are decided (see below) */
+   if (num_procs > 1)
+   {
+      bnd_pkg = hypre_PMISBoundaryPkgCreate(comm_pkg, &bnd_recv_cols);
+      bnd_send_size = hypre_ParCSRCommPkgSendMapStart(bnd_pkg,
+                                                      hypre_ParCSRCommPkgNumSends(bnd_pkg));
+      bnd_recv_size = hypre_ParCSRCommPkgRecvVecStart(bnd_pkg,
+                                                      hypre_ParCSRCommPkgNumRecvs(bnd_pkg));
+      int_recv_data = hypre_CTAlloc(HYPRE_Int, bnd_recv_size, HYPRE_MEMORY_HOST);
+   }
+
    /*******************************************************************************
      THE INDEPENDENT SET COARSENING LOOP:
     ******************************************************************************/
@@ -2573,33 +2728,28 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
           *------------------------------------------------------------------------------*/
          if (num_procs > 1)
          {
-            comm_handle = hypre_ParCSRCommHandleCreate(12, comm_pkg, CF_marker_offd, int_buf_data);
+            for (k = 0; k < bnd_recv_size; k++)
+            {
+               int_recv_data[k] = CF_marker_offd[bnd_recv_cols[k]];
+            }
+            comm_handle = hypre_ParCSRCommHandleCreate(12, bnd_pkg, int_recv_data, int_buf_data);
             hypre_ParCSRCommHandleDestroy(comm_handle);
-         }
 
-         index = 0;
-         for (i = 0; i < num_sends; i++)
-         {
-            start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1); j++)
+            for (k = 0; k < bnd_send_size; k++)
             {
-               elmt = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j);
-               if (!int_buf_data[index] && CF_marker[elmt] > 0)
+               elmt = hypre_ParCSRCommPkgSendMapElmt(bnd_pkg, k);
+               if (!int_buf_data[k] && CF_marker[elmt] > 0)
                {
                   CF_marker[elmt] = 0;
-                  index++;
                }
                else
                {
-                  int_buf_data[index++] = CF_marker[elmt];
+                  int_buf_data[k] = CF_marker[elmt];
                }
             }
-         }
 
-         if (num_procs > 1)
-         {
-            comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf_data, CF_marker_offd);
-            hypre_ParCSRCommHandleDestroy(comm_handle);
+            /* completed below, once the interior points are done */
+            bnd_handle = hypre_ParCSRCommHandleCreate(11, bnd_pkg, int_buf_data, int_recv_data);
          }
       } /* if (!CF_init || iter) */
 
@@ -2607,63 +2757,86 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
 
       /*------------------------------------------------
        * Set C-pts and F-pts.
+       *
+       * Points without external strong connections (pass 0)
+       * are handled while the boundary CF_marker is in flight,
+       * the others (pass 1) after it has arrived. The result
+       * does not depend on the order since no point with
+       * CF_marker > 0 changes sign in this loop.
        *------------------------------------------------*/
+      for (pass = 0; pass < 2; pass++)
+      {
+         if (pass == 1 && bnd_handle)
+         {
+            hypre_ParCSRCommHandleDestroy(bnd_handle);
+            bnd_handle = NULL;
+            for (k = 0; k < bnd_recv_size; k++)
+            {
+               CF_marker_offd[bnd_recv_cols[k]] = int_recv_data[k];
+            }
+         }
+
 #ifdef HYPRE_USING_OPENMP
-      #pragma omp parallel for private(ig, i, jS, j) HYPRE_SMP_SCHEDULE
+         #pragma omp parallel for private(ig, i, jS, j) HYPRE_SMP_SCHEDULE
 #endif
-      for (ig = 0; ig < graph_size; ig++)
-      {
-         i = graph_array[ig];
+         for (ig = 0; ig < graph_size; ig++)
+         {
+            i = graph_array[ig];
+            if ((S_offd_i[i + 1] > S_offd_i[i]) != pass)
+            {
+               continue;
+            }
 
-         /*---------------------------------------------
-          * If the measure of i is smaller than 1, then
-          * make i and F point (because it does not influence
-          * any other point)
-          *---------------------------------------------*/
+            /*---------------------------------------------
+             * If the measure of i is smaller than 1, then
+             * make i and F point (because it does not influence
+             * any other point)
+             *---------------------------------------------*/
 
-         if (measure_array[i] < 1)
-         {
-            CF_marker[i] = F_PT;
-         }
+            if (measure_array[i] < 1)
+            {
+               CF_marker[i] = F_PT;
+            }
 
-         /*---------------------------------------------
-          * First treat the case where point i is in the
-          * independent set: make i a C point,
-          *---------------------------------------------*/
+            /*---------------------------------------------
+             * First treat the case where point i is in the
+             * independent set: make i a C point,
+             *---------------------------------------------*/
 
-         if (CF_marker[i] > 0)
-         {
-            CF_marker[i] = C_PT;
-         }
-         /*---------------------------------------------
-          * Now treat the case where point i is not in the
-          * independent set: loop over
-          * all the points j that influence equation i; if
-          * j is a C point, then make i an F point.
-          *---------------------------------------------*/
-         else
-         {
-            /* first the local part */
-            for (jS = S_diag_i[i]; jS < S_diag_i[i + 1]; jS++)
+            if (CF_marker[i] > 0)
             {
-               /* j is the column number, or the local number of the point influencing i */
-               j = S_diag_j[jS];
-               if (CF_marker[j] > 0) /* j is a C-point */
-               {
-                  CF_marker[i] = F_PT;
-               }
+               CF_marker[i] = C_PT;
             }
-            /* now the external part */
-            for (jS = S_offd_i[i]; jS < S_offd_i[i + 1]; jS++)
+            /*---------------------------------------------
+             * Now treat the case where point i is not in the
+             * independent set: loop over
+             * all the points j that influence equation i; if
+             * j is a C point, then make i an F point.
+             *---------------------------------------------*/
+            else
             {
-               j = S_offd_j[jS];
-               if (CF_marker_offd[j] > 0) /* j is a C-point */
+               /* first the local part */
+               for (jS = S_diag_i[i]; jS < S_diag_i[i + 1]; jS++)
                {
-                  CF_marker[i] = F_PT;
+                  /* j is the column number, or the local number of the point influencing i */
+                  j = S_diag_j[jS];
+                  if (CF_marker[j] > 0) /* j is a C-point */
+                  {
+                     CF_marker[i] = F_PT;
+                  }
                }
-            }
-         } /* end else */
-      } /* end first loop over graph */
+               /* now the external part */
+               for (jS = S_offd_i[i]; jS < S_offd_i[i + 1]; jS++)
+               {
+                  j = S_offd_j[jS];
+                  if (CF_marker_offd[j] > 0) /* j is a C-point */
+                  {
+                     CF_marker[i] = F_PT;
+                  }
+               }
+            } /* end else */
+         } /* end first loop over graph */
+      } /* for each pass */
 
       /* now communicate CF_marker to CF_marker_offd, to make
          sure that new external F points are known on this processor */
@@ -2671,20 +2844,15 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
       /*------------------------------------------------------------------------------
        * Exchange boundary data for CF_marker: send internal points to external points
        *------------------------------------------------------------------------------*/
-      index = 0;
-      for (i = 0; i < num_sends; i++)
+      if (num_procs > 1)
       {
-         start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-         for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1); j++)
+         for (k = 0; k < bnd_send_size; k++)
          {
-            int_buf_data[index++] = CF_marker[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+            int_buf_data[k] = CF_marker[hypre_ParCSRCommPkgSendMapElmt(bnd_pkg, k)];
          }
-      }
 
-      if (num_procs > 1)
-      {
-         comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf_data, CF_marker_offd);
-         hypre_ParCSRCommHandleDestroy(comm_handle);
+         /* completed inside the subgraph update, after the local part */
+         bnd_handle = hypre_ParCSRCommHandleCreate(11, bnd_pkg, int_buf_data, int_recv_data);
       }
 
       /*------------------------------------------------
@@ -2695,7 +2863,7 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
       prefix_sum_workspace = hypre_TAlloc(HYPRE_Int, 2 * (hypre_NumThreads() + 1), HYPRE_MEMORY_HOST);
 
 #ifdef HYPRE_USING_OPENMP
-      #pragma omp parallel private(ig,i)
+      #pragma omp parallel private(ig,i,k)
 #endif
       {
          HYPRE_Int private_graph_size_cnt = 0;
@@ -2722,6 +2890,24 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
             }
          }
 
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp master
+#endif
+         {
+            if (bnd_handle)
+            {
+               hypre_ParCSRCommHandleDestroy(bnd_handle);
+               bnd_handle = NULL;
+               for (k = 0; k < bnd_recv_size; k++)
+               {
+                  CF_marker_offd[bnd_recv_cols[k]] = int_recv_data[k];
+               }
+            }
+         }
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp barrier
+#endif
+
          for (ig = ig_offd_begin; ig < ig_offd_end; ig++)
          {
             i = graph_array_offd[ig];
@@ -2769,6 +2955,15 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
 
       hypre_TFree(prefix_sum_workspace, HYPRE_MEMORY_HOST);
 
+      /* entries that just carried a C or F point are final on both sides */
+      if (num_procs > 1)
+      {
+         hypre_PMISBoundaryPkgCompress(bnd_pkg, bnd_recv_cols, int_buf_data, int_recv_data);
+         bnd_send_size = hypre_ParCSRCommPkgSendMapStart(bnd_pkg,
+                                                         hypre_ParCSRCommPkgNumSends(bnd_pkg));
+         bnd_recv_size = hypre_ParCSRCommPkgRecvVecStart(bnd_pkg,
+                                                         hypre_ParCSRCommPkgNumRecvs(bnd_pkg));
+      }
    } /* end while */
 
    /*
@@ -2799,6 +2994,12 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
    }
    hypre_TFree(buf_data, HYPRE_MEMORY_HOST);
    hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(int_recv_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(bnd_recv_cols, HYPRE_MEMORY_HOST);
+   if (bnd_pkg)
+   {
+      hypre_PMISBoundaryPkgDestroy(bnd_pkg);
+   }
    hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
    /*if (num_procs > 1) hypre_CSRMatrixDestroy(S_ext);*/
 
@@ -296,6 +296,23 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
       {
          local_size = hypre_VectorSize(hypre_ParVectorLocalVector(F_array[level]));
          hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp)) = local_size;
+         /* keep the columns of multivector temporaries contiguous on this level */
+         hypre_VectorVectorStride(hypre_ParVectorLocalVector(Vtemp)) = local_size;
+         if (Ztemp)
+         {
+            hypre_VectorSize(hypre_ParVectorLocalVector(Ztemp)) = local_size;
+            hypre_VectorVectorStride(hypre_ParVectorLocalVector(Ztemp)) = local_size;
+         }
+         if (Rtemp)
+         {
+            hypre_VectorSize(hypre_ParVectorLocalVector(Rtemp)) = local_size;
+            hypre_VectorVectorStride(hypre_ParVectorLocalVector(Rtemp)) = local_size;
+         }
+         if (Ptemp)
+         {
+            hypre_VectorSize(hypre_ParVectorLocalVector(Ptemp)) = local_size;
+            hypre_VectorVectorStride(hypre_ParVectorLocalVector(Ptemp)) = local_size;
+         }
 
          if (smooth_num_levels <= level)
          {
@@ -306,9 +323,6 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          }
          else if (smooth_type > 9)
          {
-            hypre_VectorSize(hypre_ParVectorLocalVector(Ztemp)) = local_size;
-            hypre_VectorSize(hypre_ParVectorLocalVector(Rtemp)) = local_size;
-            hypre_VectorSize(hypre_ParVectorLocalVector(Ptemp)) = local_size;
             Ztemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Ztemp));
             Ptemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Ptemp));
             hypre_ParVectorSetConstantValues(Ztemp, 0);
@@ -365,6 +379,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          l1_norms_level = NULL;
       }
 
+      hypre_BoomerAMGProfileBegin(amg_data, level, HYPRE_AMG_PROFILE_SMOOTH);
+
       if (cycle_param == 3 && seq_cg)
       {
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
@@ -375,6 +391,19 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          HYPRE_ANNOTATE_REGION_END("%s", "Coarse solve");
 #if defined(HYPRE_USING_NVTX)
          hypre_GpuProfilingPopRange();
+#endif
+      }
+      else if (cycle_param == 3 &&
+               hypre_ParAMGDataAgglomComm(amg_data) != hypre_MPI_COMM_NULL)
+      {
+         HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
+#if defined(HYPRE_USING_NVTX)
+         hypre_GpuProfilingPushRange("Coarse solve");
+#endif
+         hypre_BoomerAMGAgglomerateCycle(amg_data, level, F_array, U_array);
+         HYPRE_ANNOTATE_REGION_END("%s", "Coarse solve");
+#if defined(HYPRE_USING_NVTX)
+         hypre_GpuProfilingPopRange();
 #endif
       }
 #ifdef HYPRE_USING_DSUPERLU
@@ -611,6 +640,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
                if (Solve_err_flag != 0)
                {
+                  hypre_BoomerAMGProfileEnd(amg_data);
                   HYPRE_ANNOTATE_REGION_END("%s", "Relaxation");
                   HYPRE_ANNOTATE_MGLEVEL_END(level);
                   HYPRE_ANNOTATE_FUNC_END;
@@ -651,6 +681,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 #endif
       }
 
+      hypre_BoomerAMGProfileEnd(amg_data);
+
       /*------------------------------------------------------------------
        * Decrement the control counter and determine which grid to visit next
        *-----------------------------------------------------------------*/
@@ -675,6 +707,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          alpha = -1.0;
          beta = 1.0;
 
+         hypre_BoomerAMGProfileBegin(amg_data, fine_grid, HYPRE_AMG_PROFILE_RESTRICT);
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Residual");
 #if defined(HYPRE_USING_NVTX)
          hypre_GpuProfilingPushRange("Residual");
@@ -723,6 +756,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
             }
          }
          HYPRE_ANNOTATE_REGION_END("%s", "Restriction");
+         hypre_BoomerAMGProfileEnd(amg_data);
          HYPRE_ANNOTATE_MGLEVEL_END(level);
 #if defined(HYPRE_USING_NVTX)
          hypre_GpuProfilingPopRange();
@@ -758,6 +792,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          alpha = 1.0;
          beta = 1.0;
 
+         hypre_BoomerAMGProfileBegin(amg_data, fine_grid, HYPRE_AMG_PROFILE_INTERP_APPLY);
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Interpolation");
 #if defined(HYPRE_USING_NVTX)
          hypre_GpuProfilingPushRange("Interpolation");
@@ -777,6 +812,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
             /* printf("Proc %d: level %d, n %d, Interpolation done\n", my_id, level, local_size); */
          }
          HYPRE_ANNOTATE_REGION_END("%s", "Interpolation");
+         hypre_BoomerAMGProfileEnd(amg_data);
          HYPRE_ANNOTATE_MGLEVEL_END(level);
 #if defined(HYPRE_USING_NVTX)
          hypre_GpuProfilingPopRange();
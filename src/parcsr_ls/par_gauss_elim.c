@@ -227,7 +227,29 @@ HYPRE_Int hypre_GaussElimSolve (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
       hypre_GaussElimSetup(amg_data, level, relax_type);
    }
 
-   if (n)
+   /* Multivectors: solve for one column at a time through single-vector views */
+   if (hypre_ParVectorNumVectors(hypre_ParAMGDataFArray(amg_data)[level]) > 1)
+   {
+      hypre_ParVector **F_array = hypre_ParAMGDataFArray(amg_data);
+      hypre_ParVector **U_array = hypre_ParAMGDataUArray(amg_data);
+      hypre_ParVector  *f = F_array[level];
+      hypre_ParVector  *u = U_array[level];
+      hypre_ParVector   f_k, u_k;
+      hypre_Vector      f_k_local, u_k_local;
+      HYPRE_Int         k;
+
+      for (k = 0; k < hypre_ParVectorNumVectors(f); k++)
+      {
+         hypre_ParVectorGetColumnView(f, k, &f_k, &f_k_local);
+         hypre_ParVectorGetColumnView(u, k, &u_k, &u_k_local);
+         F_array[level] = &f_k;
+         U_array[level] = &u_k;
+         hypre_GaussElimSolve(amg_data, level, relax_type);
+      }
+      F_array[level] = f;
+      U_array[level] = u;
+   }
+   else if (n)
    {
       MPI_Comm new_comm = hypre_ParAMGDataNewComm(amg_data);
       hypre_ParVector *f = hypre_ParAMGDataFArray(amg_data)[level];
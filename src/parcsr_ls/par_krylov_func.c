@@ -43,9 +43,12 @@ hypre_ParKrylovCreateVector( void *vvector )
    hypre_ParVector *vector = (hypre_ParVector *) vvector;
    hypre_ParVector *new_vector;
 
-   new_vector = hypre_ParVectorCreate( hypre_ParVectorComm(vector),
-                                       hypre_ParVectorGlobalSize(vector),
-                                       hypre_ParVectorPartitioning(vector) );
+   new_vector = hypre_ParMultiVectorCreate( hypre_ParVectorComm(vector),
+                                            hypre_ParVectorGlobalSize(vector),
+                                            hypre_ParVectorPartitioning(vector),
+                                            hypre_ParVectorNumVectors(vector) );
+   hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(new_vector)) =
+      hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(vector));
 
    hypre_ParVectorInitialize_v2(new_vector, hypre_ParVectorMemoryLocation(vector));
 
@@ -55,7 +58,7 @@ hypre_ParKrylovCreateVector( void *vvector )
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovCreateVectorArray
  * Note: one array will be allocated for all vectors, with vector 0 owning
- * the data, vector i will have data[i*size] assigned, not owning data
+ * the data, vector i will have data[i*size*num_vectors] assigned, not owning data
  *--------------------------------------------------------------------------*/
 
 void *
@@ -64,20 +67,25 @@ hypre_ParKrylovCreateVectorArray(HYPRE_Int n, void *vvector )
    hypre_ParVector *vector = (hypre_ParVector *) vvector;
 
    hypre_ParVector **new_vector;
-   HYPRE_Int i, size;
+   HYPRE_Int i, size, num_vectors;
    HYPRE_Complex *array_data;
 
    HYPRE_MemoryLocation memory_location = hypre_ParVectorMemoryLocation(vector);
 
    size = hypre_VectorSize(hypre_ParVectorLocalVector(vector));
-   array_data = hypre_CTAlloc(HYPRE_Complex, (n * size), memory_location);
+   num_vectors = hypre_ParVectorNumVectors(vector);
+   array_data = hypre_CTAlloc(HYPRE_Complex, (n * size * num_vectors), memory_location);
    new_vector = hypre_CTAlloc(hypre_ParVector*, n, HYPRE_MEMORY_HOST);
    for (i = 0; i < n; i++)
    {
-      new_vector[i] = hypre_ParVectorCreate( hypre_ParVectorComm(vector),
-                                             hypre_ParVectorGlobalSize(vector),
-                                             hypre_ParVectorPartitioning(vector) );
-      hypre_VectorData(hypre_ParVectorLocalVector(new_vector[i])) = &array_data[i * size];
+      new_vector[i] = hypre_ParMultiVectorCreate( hypre_ParVectorComm(vector),
+                                                  hypre_ParVectorGlobalSize(vector),
+                                                  hypre_ParVectorPartitioning(vector),
+                                                  num_vectors );
+      hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(new_vector[i])) =
+         hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(vector));
+      hypre_VectorData(hypre_ParVectorLocalVector(new_vector[i])) =
+         &array_data[i * size * num_vectors];
       hypre_ParVectorInitialize_v2(new_vector[i], memory_location);
       if (i)
       {
@@ -135,6 +143,26 @@ hypre_ParKrylovMatvec( void   *matvec_data,
                                        (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovResidualNorm( void              *matvec_data,
+                             void              *A,
+                             void              *x,
+                             void              *b,
+                             void              *r,
+                             HYPRE_Real        *r_norm2,
+                             hypre_MPI_Request *request )
+{
+   return ( hypre_ParCSRMatrixResidualNorm ( (hypre_ParCSRMatrix *) A,
+                                             (hypre_ParVector *) x,
+                                             (hypre_ParVector *) b,
+                                             (hypre_ParVector *) r,
+                                             r_norm2, request ) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMatvecT
  *--------------------------------------------------------------------------*/
@@ -176,6 +204,21 @@ hypre_ParKrylovInnerProd( void *x,
                                       (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProdStart
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovInnerProdStart( HYPRE_Int           k,
+                               void              **x,
+                               void              **y,
+                               HYPRE_Real         *result,
+                               hypre_MPI_Request  *request )
+{
+   return ( hypre_ParVectorInnerProdStart( k, (hypre_ParVector **) x, (hypre_ParVector **) y,
+                                           result, request ) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassInnerProd
  *--------------------------------------------------------------------------*/
@@ -187,6 +230,22 @@ hypre_ParKrylovMassInnerProd( void *x,
                                           (HYPRE_Real*)result ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovBlockInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovBlockInnerProd( void      **x,
+                               HYPRE_Int   kx,
+                               void      **y,
+                               HYPRE_Int   ky,
+                               HYPRE_Int   unroll,
+                               void       *result )
+{
+   return ( hypre_ParVectorBlockInnerProd( (hypre_ParVector **) x, kx, (hypre_ParVector **) y, ky,
+                                           unroll, (HYPRE_Real *) result ) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassDotpTwo
  *--------------------------------------------------------------------------*/
@@ -262,6 +321,57 @@ hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha,
                                      (hypre_ParVector *) y, k, unroll));
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovNumVectors
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovNumVectors( void *x )
+{
+   return hypre_ParVectorNumVectors((hypre_ParVector *) x);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMultiInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovMultiInnerProd( HYPRE_Int    k,
+                               void       **x,
+                               void        *y,
+                               HYPRE_Real  *result )
+{
+   return ( hypre_ParVectorMultiInnerProd( k, (hypre_ParVector **) x, (hypre_ParVector *) y,
+                                           result ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovColumnInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovColumnInnerProd( void       *x,
+                                void       *y,
+                                HYPRE_Real *result )
+{
+   return ( hypre_ParVectorColumnInnerProd( (hypre_ParVector *) x, (hypre_ParVector *) y,
+                                            result ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMultiAxpy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovMultiAxpy( HYPRE_Complex *alpha,
+                          void          *x,
+                          HYPRE_Complex  beta,
+                          void          *y )
+{
+   return ( hypre_ParVectorMultiAxpy( alpha, (hypre_ParVector *) x, beta,
+                                      (hypre_ParVector *) y ) );
+}
+
 
 
 /*--------------------------------------------------------------------------
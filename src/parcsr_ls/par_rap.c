@@ -183,6 +183,7 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
    HYPRE_Real       r_entry;
    HYPRE_Real       r_a_product;
    HYPRE_Real       r_a_p_product;
+   HYPRE_Real       num_products = 0.0;
 
    HYPRE_Real       zero = 0.0;
    HYPRE_Int      *prefix_sum_workspace;
@@ -762,7 +763,7 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
        *-----------------------------------------------------------------------*/
 
 #ifdef HYPRE_USING_OPENMP
-      #pragma omp parallel for private(i,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_counter,jj_row_begining,A_marker,P_marker,r_entry,r_a_product,r_a_p_product) HYPRE_SMP_SCHEDULE
+      #pragma omp parallel for private(i,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_counter,jj_row_begining,A_marker,P_marker,r_entry,r_a_product,r_a_p_product) reduction(+:num_products) HYPRE_SMP_SCHEDULE
 #endif
       for (ii = 0; ii < num_threads; ii++)
       {
@@ -827,6 +828,8 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
                {
                   i2 = A_offd_j[jj2];
                   r_a_product = r_entry * A_offd_data[jj2];
+                  num_products += 1 + (P_ext_diag_i[i2 + 1] - P_ext_diag_i[i2]) +
+                                  (P_ext_offd_i[i2 + 1] - P_ext_offd_i[i2]);
 
                   /*--------------------------------------------------------------
                    *  Check A_marker to see if point i2 has been previously
@@ -926,6 +929,8 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
                {
                   i2 = A_diag_j[jj2];
                   r_a_product = r_entry * A_diag_data[jj2];
+                  num_products += 1 + (P_diag_i[i2 + 1] - P_diag_i[i2]) +
+                                  (P_offd_i[i2 + 1] - P_offd_i[i2]);
 
                   /*--------------------------------------------------------------
                    *  Check A_marker to see if point i2 has been previously
@@ -1532,7 +1537,7 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
     *-----------------------------------------------------------------------*/
 
 #ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel for private(i,j,k,jcol,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_count_diag,jj_count_offd,jj_row_begin_diag,jj_row_begin_offd,A_marker,P_marker,r_entry,r_a_product,r_a_p_product) HYPRE_SMP_SCHEDULE
+   #pragma omp parallel for private(i,j,k,jcol,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_count_diag,jj_count_offd,jj_row_begin_diag,jj_row_begin_offd,A_marker,P_marker,r_entry,r_a_product,r_a_p_product) reduction(+:num_products) HYPRE_SMP_SCHEDULE
 #endif
    for (ii = 0; ii < num_threads; ii++)
    {
@@ -1710,6 +1715,8 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
          {
             i1  = R_diag_j[jj1];
             r_entry = R_diag_data[jj1];
+            num_products += (A_diag_i[i1 + 1] - A_diag_i[i1]) +
+                            (A_offd_i[i1 + 1] - A_offd_i[i1]);
 
             /*-----------------------------------------------------------------
              *  Loop over entries in row i1 of A_offd.
@@ -1797,6 +1804,8 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
          {
             i1 = RA_offd.j[jj1 - ra_row_begin_offd];
             r_a_product = RA_offd.data[jj1 - ra_row_begin_offd];
+            num_products += (P_ext_diag_i[i1 + 1] - P_ext_diag_i[i1]) +
+                            (P_ext_offd_i[i1 + 1] - P_ext_offd_i[i1]);
 
             /*-----------------------------------------------------------
              *  Loop over entries in row i1 of P_ext.
@@ -1857,6 +1866,8 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
          {
             HYPRE_Int i1 = RA_diag.j[jj1 - ra_row_begin_diag];
             HYPRE_Real r_a_product = RA_diag.data[jj1 - ra_row_begin_diag];
+            num_products += (P_diag_i[i1 + 1] - P_diag_i[i1]) +
+                            (P_offd_i[i1 + 1] - P_offd_i[i1]);
 
             /*-----------------------------------------------------------------
              *  Loop over entries in row i1 of P_diag.
@@ -2081,6 +2092,9 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
    hypre_TFree(send_map_elmts_RT_aggregated, HYPRE_MEMORY_HOST);
 #endif
 
+   /* one multiply and one add per product */
+   hypre_OpCountsAddFlops(2.0 * num_products);
+
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_RAP] += hypre_MPI_Wtime();
 #endif
@@ -34,6 +34,13 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 {
    HYPRE_Int relax_error = 0;
 
+   /* Multivectors are relaxed as a block where the smoother allows it */
+   if (hypre_ParVectorNumVectors(f) > 1)
+   {
+      return hypre_BoomerAMGRelaxMultiVector(A, f, cf_marker, relax_type, relax_points, relax_weight,
+                                             omega, l1_norms, u, Vtemp, Ztemp);
+   }
+
    /*---------------------------------------------------------------------------------------
     * Switch statement to direct control based on relax_type:
     *     relax_type =  0 -> Jacobi or CF-Jacobi
@@ -66,6 +73,8 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
     *     relax_type = 18 -> L1-Jacobi [GPU-supported through call to relax7Jacobi]
     *     relax_type = 19 -> Direct Solve, (old version)
     *     relax_type = 20 -> Kaczmarz
+    *     relax_type = 31 -> multicolor Gauss-Seidel, colors from the strength graph
+    *     relax_type = 32 -> multicolor symm. Gauss-Seidel, colors from the strength graph
     *     relax_type = 29 -> Direct solve: use gaussian elimination & BLAS
     *                        (with pivoting) (old version)
     *     relax_type = 98 -> Direct solve, Gaussian elimination
@@ -155,14 +164,168 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          hypre_BoomerAMGRelaxKaczmarz(A, f, omega, l1_norms, u);
          break;
 
+      case 31: /* multicolor Gauss-Seidel */
+         hypre_BoomerAMGRelax31MulticolorGaussSeidel(A, f, cf_marker, relax_points, relax_weight, omega,
+                                                     u, Vtemp, Ztemp);
+         break;
+
+      case 32: /* multicolor symm. Gauss-Seidel */
+         hypre_BoomerAMGRelax32MulticolorSSOR(A, f, cf_marker, relax_points, relax_weight, omega, u,
+                                              Vtemp, Ztemp);
+         break;
+
       case 98: /* Direct solve: use gaussian elimination & BLAS (with pivoting) */
          relax_error = hypre_BoomerAMGRelax98GaussElimPivot(A, f, u);
          break;
    }
 
+   /* Smoothers that do not go through the ParCSR matvec are charged one
+    * multiply-add per nonzero and sweep direction in the operation counters */
+   switch (relax_type)
+   {
+      case 6:
+      case 8:
+      case 32:
+         hypre_OpCountsAddFlops(4.0 * (hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A)) +
+                                       hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A))));
+         break;
+
+      case 0:
+      case 1:
+      case 2:
+      case 3:
+      case 4:
+      case 5:
+      case 10:
+      case 13:
+      case 14:
+      case 20:
+      case 31:
+         hypre_OpCountsAddFlops(2.0 * (hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A)) +
+                                       hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A))));
+         break;
+   }
+
    return relax_error;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiVector
+ *
+ * Relaxation of all columns of the multivectors f and u. On the host, the
+ * Jacobi-type smoothers (0, 7 and 18) compute the residual of every column
+ * with a single SpMM and halo exchange; the remaining smoothers, and all
+ * smoothers on the device, are applied column by column through
+ * single-vector views.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMultiVector( hypre_ParCSRMatrix *A,
+                                 hypre_ParVector    *f,
+                                 HYPRE_Int          *cf_marker,
+                                 HYPRE_Int           relax_type,
+                                 HYPRE_Int           relax_points,
+                                 HYPRE_Real          relax_weight,
+                                 HYPRE_Real          omega,
+                                 HYPRE_Real         *l1_norms,
+                                 hypre_ParVector    *u,
+                                 hypre_ParVector    *Vtemp,
+                                 hypre_ParVector    *Ztemp )
+{
+   HYPRE_Int             num_vectors = hypre_ParVectorNumVectors(f);
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1(hypre_ParVectorMemoryLocation(u));
+   HYPRE_Int             relax_error = 0;
+   HYPRE_Int             k;
+
+   hypre_ParVector       f_k, u_k, Vtemp_k, Ztemp_k;
+   hypre_Vector          f_k_local, u_k_local, Vtemp_k_local, Ztemp_k_local;
+   hypre_ParVector      *Z_k;
+
+   if (exec == HYPRE_EXEC_HOST && (relax_type == 0 || relax_type == 7 || relax_type == 18))
+   {
+      /* relax_type 0 divides by the diagonal, 7 and 18 by l1_norms */
+      return hypre_BoomerAMGRelaxJacobiMultiVector(A, f, cf_marker, relax_points, relax_weight,
+                                                   relax_type == 0 ? NULL : l1_norms, u, Vtemp);
+   }
+
+   for (k = 0; k < num_vectors && !relax_error; k++)
+   {
+      hypre_ParVectorGetColumnView(f, k, &f_k, &f_k_local);
+      hypre_ParVectorGetColumnView(u, k, &u_k, &u_k_local);
+      hypre_ParVectorGetColumnView(Vtemp, k, &Vtemp_k, &Vtemp_k_local);
+      Z_k = Ztemp;
+      if (Ztemp && hypre_ParVectorNumVectors(Ztemp) == num_vectors)
+      {
+         hypre_ParVectorGetColumnView(Ztemp, k, &Ztemp_k, &Ztemp_k_local);
+         Z_k = &Ztemp_k;
+      }
+
+      relax_error = hypre_BoomerAMGRelax(A, &f_k, cf_marker, relax_type, relax_points, relax_weight,
+                                         omega, l1_norms, &u_k, &Vtemp_k, Z_k);
+   }
+
+   return relax_error;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxJacobiMultiVector
+ *
+ * u += w D^{-1} (f - A u) on all columns, with D the diagonal of A when
+ * l1_norms is NULL. Only points with cf_marker == relax_points are updated
+ * when relax_points is nonzero.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxJacobiMultiVector( hypre_ParCSRMatrix *A,
+                                       hypre_ParVector    *f,
+                                       HYPRE_Int          *cf_marker,
+                                       HYPRE_Int           relax_points,
+                                       HYPRE_Real          relax_weight,
+                                       HYPRE_Real         *l1_norms,
+                                       hypre_ParVector    *u,
+                                       hypre_ParVector    *Vtemp )
+{
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   hypre_Vector        *u_local       = hypre_ParVectorLocalVector(u);
+   HYPRE_Complex       *u_data        = hypre_VectorData(u_local);
+   HYPRE_Int            u_stride      = hypre_VectorVectorStride(u_local);
+   hypre_Vector        *Vtemp_local   = hypre_ParVectorLocalVector(Vtemp);
+   HYPRE_Complex       *Vtemp_data    = hypre_VectorData(Vtemp_local);
+   HYPRE_Int            Vtemp_stride  = hypre_VectorVectorStride(Vtemp_local);
+   HYPRE_Int            num_vectors   = hypre_VectorNumVectors(u_local);
+
+   HYPRE_Complex        zero = 0.0;
+   HYPRE_Complex        di, wi;
+   HYPRE_Int            i, k;
+
+   /*-----------------------------------------------------------------
+    * Vtemp = f - A*u for all columns at once
+    *-----------------------------------------------------------------*/
+   hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, Vtemp);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i,k,di,wi) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+      {
+         wi = relax_weight / di;
+         for (k = 0; k < num_vectors; k++)
+         {
+            u_data[k * u_stride + i] += wi * Vtemp_data[k * Vtemp_stride + i];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
                                          hypre_ParVector    *f,
@@ -657,6 +820,7 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    HYPRE_Complex       *v_ext_data    = NULL;
    HYPRE_Complex       *v_buf_data    = NULL;
    HYPRE_Int           *proc_ordering = NULL;
+   HYPRE_Int           *relax_blocks  = hypre_ParCSRMatrixRelaxBlocks(A);
 
    const HYPRE_Real     one_minus_omega  = 1.0 - omega;
    HYPRE_Int            num_procs, my_id, num_threads, j, num_sends;
@@ -684,10 +848,9 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    }
    */
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
    // JSP: persistent comm can be similarly used for other smoothers
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
-#endif
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+   const HYPRE_Int use_persistent_comm = hypre_HandleUsePersistentComm(hypre_handle());
 
    if (num_procs > 1)
    {
@@ -703,15 +866,18 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
 
       num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
-      v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
-      v_ext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
-#else
-      v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                                 HYPRE_MEMORY_HOST);
-      v_ext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
-#endif
+      if (use_persistent_comm)
+      {
+         persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+         v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+         v_ext_data = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+      }
+      else
+      {
+         v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                    HYPRE_MEMORY_HOST);
+         v_ext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+      }
 
       HYPRE_Int begin = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
       HYPRE_Int end   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
@@ -728,17 +894,16 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
       hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
 #endif
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-      hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
-#else
-      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
-#endif
-
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-      hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, v_ext_data);
-#else
-      hypre_ParCSRCommHandleDestroy(comm_handle);
-#endif
+      if (use_persistent_comm)
+      {
+         hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
+         hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, v_ext_data);
+      }
+      else
+      {
+         comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+      }
       comm_handle = NULL;
 
 #ifdef HYPRE_PROFILE
@@ -782,7 +947,79 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
       }
    }
 
-   if (num_threads > 1)
+   if (relax_blocks && !Topo_order)
+   {
+      /* Gauss-Seidel within cache-sized blocks of rows: the blocks of one color
+       * in parallel, the colors one after the other (in reverse order for a
+       * backward sweep). Blocks of the same color are not coupled, so the result
+       * does not depend on the number of threads. */
+      const HYPRE_Int  num_colors   = relax_blocks[1];
+      const HYPRE_Int *color_starts = relax_blocks + 2;
+      const HYPRE_Int *block_list   = color_starts + num_colors + 1;
+      const HYPRE_Int *block_starts = block_list + relax_blocks[0];
+      const HYPRE_Int  use_short_j  = non_scale && hypre_CSRMatrixShortJIsUsable(A_diag);
+
+      if (use_short_j)
+      {
+         hypre_CSRMatrixShortJSetup(A_diag);
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel num_threads(num_threads)
+#endif
+      {
+         const HYPRE_Int my_thread = hypre_GetThreadNum();
+         const HYPRE_Int my_num_threads = hypre_NumActiveThreads();
+         HYPRE_Int sweep, c, k, kb, ke;
+
+         for (sweep = 0; sweep < num_sweeps; sweep++)
+         {
+            const HYPRE_Int iorder = num_sweeps == 1 ? gs_order : sweep == 0 ? 1 : -1;
+
+            for (c = 0; c < num_colors; c++)
+            {
+               const HYPRE_Int color = iorder > 0 ? c : num_colors - 1 - c;
+
+               /* same assignment of blocks to threads as for the first touch */
+               hypre_partition1D(color_starts[color + 1] - color_starts[color],
+                                 my_num_threads, my_thread, &kb, &ke);
+
+               for (k = color_starts[color] + kb; k < color_starts[color] + ke; k++)
+               {
+                  const HYPRE_Int ns = block_starts[block_list[k]];
+                  const HYPRE_Int ne = block_starts[block_list[k] + 1];
+                  const HYPRE_Int ibegin = iorder > 0 ? ns : ne - 1;
+                  const HYPRE_Int iend = iorder > 0 ? ne : ns - 1;
+
+                  if (use_short_j)
+                  {
+                     hypre_HybridGaussSeidelNSShortJ(A_diag_i, hypre_CSRMatrixIShort(A_diag),
+                                                     hypre_CSRMatrixJShort(A_diag), A_diag_data,
+                                                     A_offd_i, A_offd_j, A_offd_data, f_data, cf_marker,
+                                                     relax_points, l1_norms, u_data, v_ext_data,
+                                                     ibegin, iend, iorder, Skip_diag);
+                  }
+                  else if (non_scale)
+                  {
+                     hypre_HybridGaussSeidelNS(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
+                                               f_data, cf_marker, relax_points, l1_norms, u_data, Vtemp_data, v_ext_data,
+                                               ibegin, iend, iorder, Skip_diag);
+                  }
+                  else
+                  {
+                     hypre_HybridGaussSeidel(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
+                                             f_data, cf_marker, relax_points, relax_weight, omega, one_minus_omega,
+                                             prod, l1_norms, u_data, Vtemp_data, v_ext_data, ibegin, iend, iorder, Skip_diag);
+                  }
+               }
+#ifdef HYPRE_USING_OPENMP
+               #pragma omp barrier
+#endif
+            }
+         } /* for (sweep = 0; sweep < num_sweeps; sweep++) */
+      }
+   }
+   else if (num_threads > 1)
    {
 #ifdef HYPRE_USING_OPENMP
       #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
@@ -830,7 +1067,16 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
          }
          else
          {
-            if (non_scale)
+            if (non_scale && hypre_CSRMatrixShortJIsUsable(A_diag))
+            {
+               hypre_CSRMatrixShortJSetup(A_diag);
+               hypre_HybridGaussSeidelNSShortJ(A_diag_i, hypre_CSRMatrixIShort(A_diag),
+                                               hypre_CSRMatrixJShort(A_diag), A_diag_data,
+                                               A_offd_i, A_offd_j, A_offd_data, f_data, cf_marker,
+                                               relax_points, l1_norms, u_data, v_ext_data,
+                                               ibegin, iend, iorder, Skip_diag);
+            }
+            else if (non_scale)
             {
                hypre_HybridGaussSeidelNS(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
                                          f_data, cf_marker, relax_points, l1_norms, u_data, Vtemp_data, v_ext_data,
@@ -846,13 +1092,11 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
       } /* for (sweep = 0; sweep < num_sweeps; sweep++) */
    } /* if (num_threads > 1) */
 
-#ifndef HYPRE_USING_PERSISTENT_COMM
-   if (num_procs > 1)
+   if (num_procs > 1 && !use_persistent_comm)
    {
       hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
       hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
    }
-#endif
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
@@ -861,6 +1105,278 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    return hypre_error_flag;
 }
 
+#ifdef HYPRE_USING_OPENMP
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxBlocksFirstTouch
+ *
+ * Replaces the arrays of A, the diag or offd part of a matrix with relax
+ * blocks, by copies in which each thread writes the rows of the blocks it
+ * relaxes first, so that the pages are placed in its NUMA domain.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGRelaxBlocksFirstTouch( hypre_CSRMatrix *A,
+                                      HYPRE_Int       *relax_blocks )
+{
+   HYPRE_MemoryLocation memory_location = hypre_CSRMatrixMemoryLocation(A);
+   HYPRE_Int            num_rows        = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int           *A_i             = hypre_CSRMatrixI(A);
+   HYPRE_Int           *A_j             = hypre_CSRMatrixJ(A);
+   HYPRE_Complex       *A_data          = hypre_CSRMatrixData(A);
+   const HYPRE_Int      num_colors      = relax_blocks[1];
+   const HYPRE_Int     *color_starts    = relax_blocks + 2;
+   const HYPRE_Int     *block_list      = color_starts + num_colors + 1;
+   const HYPRE_Int     *block_starts    = block_list + relax_blocks[0];
+   HYPRE_Int           *new_i, *new_j;
+   HYPRE_Complex       *new_data;
+
+   if (hypre_NumThreads() < 2 || !hypre_CSRMatrixOwnsData(A) ||
+       !A_i || !A_j || !A_data || hypre_CSRMatrixBigJ(A))
+   {
+      return hypre_error_flag;
+   }
+
+   new_i    = hypre_TAlloc(HYPRE_Int, num_rows + 1, memory_location);
+   new_j    = hypre_TAlloc(HYPRE_Int, A_i[num_rows], memory_location);
+   new_data = hypre_TAlloc(HYPRE_Complex, A_i[num_rows], memory_location);
+   new_i[0] = A_i[0];
+
+   /* same assignment of blocks to threads as in the smoothers */
+   #pragma omp parallel
+   {
+      const HYPRE_Int my_thread = hypre_GetThreadNum();
+      const HYPRE_Int my_num_threads = hypre_NumActiveThreads();
+      HYPRE_Int c, k, kb, ke, i, jj;
+
+      for (c = 0; c < num_colors; c++)
+      {
+         hypre_partition1D(color_starts[c + 1] - color_starts[c], my_num_threads, my_thread,
+                           &kb, &ke);
+
+         for (k = color_starts[c] + kb; k < color_starts[c] + ke; k++)
+         {
+            for (i = block_starts[block_list[k]]; i < block_starts[block_list[k] + 1]; i++)
+            {
+               new_i[i + 1] = A_i[i + 1];
+               for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+               {
+                  new_j[jj]    = A_j[jj];
+                  new_data[jj] = A_data[jj];
+               }
+            }
+         }
+      }
+   }
+
+   hypre_TFree(A_i, memory_location);
+   hypre_TFree(A_j, memory_location);
+   hypre_TFree(A_data, memory_location);
+   hypre_CSRMatrixI(A)    = new_i;
+   hypre_CSRMatrixJ(A)    = new_j;
+   hypre_CSRMatrixData(A) = new_data;
+   hypre_CSRMatrixSellDestroy(A);
+   hypre_CSRMatrixShortJDestroy(A);
+
+   return hypre_error_flag;
+}
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxBlocksSetup
+ *
+ * Splits the local rows of A into blocks of consecutive rows, each holding
+ * about block_kbytes kilobytes of matrix and vector data, and colors the
+ * blocks greedily such that blocks of the same color are not coupled in
+ * A_diag. The hybrid Gauss-Seidel smoothers then relax the blocks of one
+ * color in parallel, which gives the same result for any number of threads.
+ * Both steps only depend on the pattern of A. With OpenMP and first_touch,
+ * the arrays of A are also copied such that each thread first touches the
+ * rows it relaxes; this replaces the arrays of A, so it must only be asked
+ * for on matrices that hypre created, never on the user's matrix.
+ *
+ * The result is stored in A as the array
+ *    [num_blocks, num_colors, color_starts[num_colors + 1],
+ *     block_list[num_blocks] (grouped by color), block_starts[num_blocks + 1]]
+ * block_kbytes <= 0 removes it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxBlocksSetup( hypre_ParCSRMatrix *A,
+                                 HYPRE_Int           block_kbytes,
+                                 HYPRE_Int           first_touch )
+{
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int        num_rows    = hypre_CSRMatrixNumRows(A_diag);
+
+   const HYPRE_Int  entry_bytes = (HYPRE_Int) (sizeof(HYPRE_Complex) + sizeof(HYPRE_Int));
+   /* row pointers and the entries of u, f, Vtemp and l1_norms */
+   const HYPRE_Int  row_bytes   = (HYPRE_Int) (2 * sizeof(HYPRE_Int) + 4 * sizeof(HYPRE_Complex));
+
+   HYPRE_Int       *relax_blocks;
+   HYPRE_Int       *block_starts, *block_list, *color_starts;
+   HYPRE_Int       *row_block, *block_color, *marker;
+   HYPRE_Int       *edges = NULL, *graph_i, *graph_j;
+   HYPRE_Int        num_blocks, num_colors, num_edges, max_edges;
+   HYPRE_Int        i, jj, b, c, k;
+   HYPRE_Real       bytes, max_bytes;
+
+   hypre_TFree(hypre_ParCSRMatrixRelaxBlocks(A), HYPRE_MEMORY_HOST);
+
+   if (block_kbytes <= 0 ||
+       hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      return hypre_error_flag;
+   }
+
+   /* blocks of consecutive rows */
+   max_bytes    = 1024.0 * (HYPRE_Real) block_kbytes;
+   block_starts = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   row_block    = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   num_blocks   = 0;
+   bytes        = 0.0;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (i == 0 || bytes >= max_bytes)
+      {
+         block_starts[num_blocks++] = i;
+         bytes = 0.0;
+      }
+      row_block[i] = num_blocks - 1;
+      bytes += (HYPRE_Real) (row_bytes + entry_bytes *
+                             (A_diag_i[i + 1] - A_diag_i[i] + A_offd_i[i + 1] - A_offd_i[i]));
+   }
+   block_starts[num_blocks] = num_rows;
+
+   /* couplings between blocks, each one listed once per direction */
+   marker    = hypre_TAlloc(HYPRE_Int, hypre_max(num_blocks, 1), HYPRE_MEMORY_HOST);
+   num_edges = 0;
+   max_edges = 0;
+   for (b = 0; b < num_blocks; b++)
+   {
+      marker[b] = -1;
+   }
+   for (b = 0; b < num_blocks; b++)
+   {
+      for (i = block_starts[b]; i < block_starts[b + 1]; i++)
+      {
+         for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+         {
+            c = row_block[A_diag_j[jj]];
+            if (c != b && marker[c] != b)
+            {
+               marker[c] = b;
+               if (num_edges == max_edges)
+               {
+                  max_edges = hypre_max(2 * max_edges, 64);
+                  edges = hypre_TReAlloc(edges, HYPRE_Int, 2 * max_edges, HYPRE_MEMORY_HOST);
+               }
+               edges[2 * num_edges]     = b;
+               edges[2 * num_edges + 1] = c;
+               num_edges++;
+            }
+         }
+      }
+   }
+
+   /* symmetric block graph */
+   graph_i = hypre_CTAlloc(HYPRE_Int, num_blocks + 1, HYPRE_MEMORY_HOST);
+   graph_j = hypre_TAlloc(HYPRE_Int, 2 * num_edges, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_edges; k++)
+   {
+      graph_i[edges[2 * k] + 1]++;
+      graph_i[edges[2 * k + 1] + 1]++;
+   }
+   for (b = 0; b < num_blocks; b++)
+   {
+      graph_i[b + 1] += graph_i[b];
+   }
+   for (k = 0; k < num_edges; k++)
+   {
+      graph_j[graph_i[edges[2 * k]]++]     = edges[2 * k + 1];
+      graph_j[graph_i[edges[2 * k + 1]]++] = edges[2 * k];
+   }
+   for (b = num_blocks; b > 0; b--)
+   {
+      graph_i[b] = graph_i[b - 1];
+   }
+   graph_i[0] = 0;
+
+   /* greedy coloring in block order */
+   block_color = hypre_TAlloc(HYPRE_Int, hypre_max(num_blocks, 1), HYPRE_MEMORY_HOST);
+   num_colors  = 0;
+   for (b = 0; b < num_blocks; b++)
+   {
+      marker[b] = -1;
+   }
+   for (b = 0; b < num_blocks; b++)
+   {
+      for (k = graph_i[b]; k < graph_i[b + 1]; k++)
+      {
+         if (graph_j[k] < b)
+         {
+            marker[block_color[graph_j[k]]] = b;
+         }
+      }
+      for (c = 0; marker[c] == b; c++);
+      block_color[b] = c;
+      num_colors = hypre_max(num_colors, c + 1);
+   }
+
+   /* group the blocks by color */
+   relax_blocks = hypre_TAlloc(HYPRE_Int, 2 * num_blocks + num_colors + 4, HYPRE_MEMORY_HOST);
+   relax_blocks[0] = num_blocks;
+   relax_blocks[1] = num_colors;
+   color_starts = relax_blocks + 2;
+   block_list   = color_starts + num_colors + 1;
+   for (c = 0; c <= num_colors; c++)
+   {
+      color_starts[c] = 0;
+   }
+   for (b = 0; b < num_blocks; b++)
+   {
+      color_starts[block_color[b] + 1]++;
+   }
+   for (c = 0; c < num_colors; c++)
+   {
+      color_starts[c + 1] += color_starts[c];
+   }
+   for (b = 0; b < num_blocks; b++)
+   {
+      block_list[color_starts[block_color[b]]++] = b;
+   }
+   for (c = num_colors; c > 0; c--)
+   {
+      color_starts[c] = color_starts[c - 1];
+   }
+   color_starts[0] = 0;
+   hypre_TMemcpy(block_list + num_blocks, block_starts, HYPRE_Int, num_blocks + 1,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRMatrixRelaxBlocks(A) = relax_blocks;
+
+   hypre_TFree(block_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_block, HYPRE_MEMORY_HOST);
+   hypre_TFree(block_color, HYPRE_MEMORY_HOST);
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(edges, HYPRE_MEMORY_HOST);
+   hypre_TFree(graph_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(graph_j, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   if (first_touch)
+   {
+      hypre_BoomerAMGRelaxBlocksFirstTouch(A_diag, relax_blocks);
+      hypre_BoomerAMGRelaxBlocksFirstTouch(A_offd, relax_blocks);
+   }
+#endif
+
+   return hypre_error_flag;
+}
+
 /* forward hybrid G-S */
 HYPRE_Int
 hypre_BoomerAMGRelax3HybridGaussSeidel( hypre_ParCSRMatrix *A,
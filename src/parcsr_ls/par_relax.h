@@ -102,6 +102,87 @@ hypre_HybridGaussSeidelNS( HYPRE_Int     *A_diag_i,
    }
 }
 
+/* Non-Scale version reading the diag column indices as 16-bit deltas */
+static inline void
+hypre_HybridGaussSeidelNSShortJ( HYPRE_Int     *A_diag_i,
+                                 HYPRE_Int     *A_diag_i_short,
+                                 short         *A_diag_j_short,
+                                 HYPRE_Complex *A_diag_data,
+                                 HYPRE_Int     *A_offd_i,
+                                 HYPRE_Int     *A_offd_j,
+                                 HYPRE_Complex *A_offd_data,
+                                 HYPRE_Complex *f_data,
+                                 HYPRE_Int     *cf_marker,
+                                 HYPRE_Int      relax_points,
+                                 HYPRE_Complex *l1_norms,
+                                 HYPRE_Complex *u_data,
+                                 HYPRE_Complex *v_ext_data,
+                                 HYPRE_Int      ibegin,
+                                 HYPRE_Int      iend,
+                                 HYPRE_Int      iorder,
+                                 HYPRE_Int      Skip_diag )
+{
+   HYPRE_Int i;
+   const HYPRE_Complex zero = 0.0;
+
+   for (i = ibegin; i != iend; i += iorder)
+   {
+      const HYPRE_Complex diag = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && diag != zero )
+      {
+         HYPRE_Int jj = A_diag_i[i];
+         HYPRE_Int pos = A_diag_i_short[i];
+         HYPRE_Int ii;
+         HYPRE_Complex res = f_data[i];
+
+         if (A_diag_i_short[i + 1] - pos == A_diag_i[i + 1] - jj)
+         {
+            /* no escapes in this row */
+            const short         *js = A_diag_j_short + pos;
+            const HYPRE_Complex *ad = A_diag_data + jj;
+            const HYPRE_Complex *ui = u_data + i;
+            const HYPRE_Int      nr = A_diag_i[i + 1] - jj;
+            HYPRE_Int            k;
+
+            for (k = Skip_diag; k < nr; k++)
+            {
+               res -= ad[k] * ui[js[k]];
+            }
+         }
+         else
+         {
+            if (Skip_diag)
+            {
+               hypre_CSRShortJNext(A_diag_j_short, &pos, i);
+               jj++;
+            }
+
+            for (; jj < A_diag_i[i + 1]; jj++)
+            {
+               ii = hypre_CSRShortJNext(A_diag_j_short, &pos, i);
+               res -= A_diag_data[jj] * u_data[ii];
+            }
+         }
+
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            ii = A_offd_j[jj];
+            res -= A_offd_data[jj] * v_ext_data[ii];
+         }
+
+         if (Skip_diag)
+         {
+            u_data[i] = res / diag;
+         }
+         else
+         {
+            u_data[i] += res / diag;
+         }
+      }
+   } /* for ( i = ...) */
+}
+
 /* Non-Scale Threaded version */
 static inline void
 hypre_HybridGaussSeidelNSThreads( HYPRE_Int     *A_diag_i,
@@ -0,0 +1,426 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Multicolor Gauss-Seidel smoothers (relax_type 31 and 32).
+ *
+ * At setup, the points of a level are colored so that no two points of the
+ * same color are strongly connected, across processes as well. The sweep
+ * then relaxes one color at a time, all points of a color in parallel, and
+ * exchanges the ghost values before each color. Couplings between colors
+ * are treated Gauss-Seidel-like; weak couplings within a color are treated
+ * Jacobi-like, since only the strength graph is colored. The result does
+ * not depend on the number of processes or threads.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * Priority of a point in the coloring, computed from its global index only
+ *--------------------------------------------------------------------------*/
+
+static inline hypre_ulonglongint
+hypre_BoomerAMGRelaxColorKey( HYPRE_BigInt gid )
+{
+   return ((hypre_ulonglongint) gid + 1) * 0x9E3779B97F4A7C15ULL;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxColorsSetup
+ *
+ * Colors the symmetrized strength graph of A and stores the coloring in
+ * A, as
+ *
+ *    [num_colors, color_starts[num_colors + 1], rows[num_rows]]
+ *
+ * where rows lists the local rows grouped by color, in increasing order
+ * within a color. num_colors is the same on all processes. Any previous
+ * coloring is freed; with S = NULL nothing else is done.
+ *
+ * The coloring is a Jones-Plassmann iteration: an uncolored point whose key
+ * is larger than the keys of all its uncolored neighbors takes the smallest
+ * color not used by its neighbors. The keys depend only on the global
+ * indices, so the coloring does not depend on the number of processes or
+ * threads.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxColorsSetup( hypre_ParCSRMatrix *A,
+                                 hypre_ParCSRMatrix *S )
+{
+   MPI_Comm             comm = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int            num_rows = hypre_ParCSRMatrixNumRows(A);
+
+   hypre_ParCSRMatrix  *G;
+   hypre_CSRMatrix     *G_diag, *G_offd;
+   hypre_ParCSRCommPkg *comm_pkg;
+   HYPRE_Int           *G_diag_i, *G_diag_j, *G_offd_i, *G_offd_j;
+   HYPRE_BigInt        *col_map_offd_G;
+   HYPRE_BigInt         first_row;
+   HYPRE_Int            num_cols_offd_G, num_sends;
+
+   HYPRE_Int           *color, *color_offd, *selected, *int_buf;
+   HYPRE_Int           *relax_colors, *color_starts, *color_rows;
+   HYPRE_Int            num_left, num_left_global, num_colors, num_colors_local;
+   HYPRE_Int            i, jj, c;
+
+   hypre_TFree(hypre_ParCSRMatrixRelaxColors(A), HYPRE_MEMORY_HOST);
+   if (!S)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_BoomerAMGSymmetrizeS(S, &G);
+
+   G_diag          = hypre_ParCSRMatrixDiag(G);
+   G_offd          = hypre_ParCSRMatrixOffd(G);
+   G_diag_i        = hypre_CSRMatrixI(G_diag);
+   G_diag_j        = hypre_CSRMatrixJ(G_diag);
+   G_offd_i        = hypre_CSRMatrixI(G_offd);
+   G_offd_j        = hypre_CSRMatrixJ(G_offd);
+   col_map_offd_G  = hypre_ParCSRMatrixColMapOffd(G);
+   num_cols_offd_G = hypre_CSRMatrixNumCols(G_offd);
+   first_row       = hypre_ParCSRMatrixFirstRowIndex(G);
+   comm_pkg        = hypre_ParCSRMatrixCommPkg(G);
+   num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+   color      = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   selected   = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   color_offd = hypre_TAlloc(HYPRE_Int, num_cols_offd_G, HYPRE_MEMORY_HOST);
+   int_buf    = hypre_CTAlloc(HYPRE_Int, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                              HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_rows; i++)
+   {
+      color[i] = -1;
+   }
+   for (i = 0; i < num_cols_offd_G; i++)
+   {
+      color_offd[i] = -1;
+   }
+
+   num_left_global = 1;
+   while (num_left_global)
+   {
+      /* select the uncolored points that are local maxima of the key */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, jj) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         hypre_ulonglongint key = hypre_BoomerAMGRelaxColorKey(first_row + i);
+
+         selected[i] = (color[i] < 0);
+         for (jj = G_diag_i[i]; jj < G_diag_i[i + 1] && selected[i]; jj++)
+         {
+            HYPRE_Int j = G_diag_j[jj];
+            if (j != i && color[j] < 0 && hypre_BoomerAMGRelaxColorKey(first_row + j) > key)
+            {
+               selected[i] = 0;
+            }
+         }
+         for (jj = G_offd_i[i]; jj < G_offd_i[i + 1] && selected[i]; jj++)
+         {
+            HYPRE_Int j = G_offd_j[jj];
+            if (color_offd[j] < 0 && hypre_BoomerAMGRelaxColorKey(col_map_offd_G[j]) > key)
+            {
+               selected[i] = 0;
+            }
+         }
+      }
+
+      /* color them; the selected points are pairwise not adjacent */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, jj) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         HYPRE_Int          base, cb;
+         hypre_ulonglongint used;
+
+         if (!selected[i])
+         {
+            continue;
+         }
+
+         /* smallest free color, 64 candidates at a time */
+         for (base = 0; ; base += 64)
+         {
+            used = 0;
+            for (jj = G_diag_i[i]; jj < G_diag_i[i + 1]; jj++)
+            {
+               HYPRE_Int cj = color[G_diag_j[jj]] - base;
+               if (cj >= 0 && cj < 64)
+               {
+                  used |= (hypre_ulonglongint) 1 << cj;
+               }
+            }
+            for (jj = G_offd_i[i]; jj < G_offd_i[i + 1]; jj++)
+            {
+               HYPRE_Int cj = color_offd[G_offd_j[jj]] - base;
+               if (cj >= 0 && cj < 64)
+               {
+                  used |= (hypre_ulonglongint) 1 << cj;
+               }
+            }
+            if (~used)
+            {
+               break;
+            }
+         }
+         for (cb = 0; used & ((hypre_ulonglongint) 1 << cb); cb++);
+         color[i] = base + cb;
+      }
+
+      num_left = 0;
+      for (i = 0; i < num_rows; i++)
+      {
+         num_left += (color[i] < 0);
+      }
+
+      if (num_sends || num_cols_offd_G)
+      {
+         hypre_ParCSRCommHandle *comm_handle;
+
+         for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+         {
+            int_buf[i] = color[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+         }
+         comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf, color_offd);
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+      }
+
+      hypre_MPI_Allreduce(&num_left, &num_left_global, 1, HYPRE_MPI_INT, hypre_MPI_SUM, comm);
+   }
+
+   /* group the rows by color */
+   num_colors_local = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      num_colors_local = hypre_max(num_colors_local, color[i] + 1);
+   }
+   hypre_MPI_Allreduce(&num_colors_local, &num_colors, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+
+   relax_colors = hypre_CTAlloc(HYPRE_Int, num_colors + 2 + num_rows, HYPRE_MEMORY_HOST);
+   relax_colors[0] = num_colors;
+   color_starts = relax_colors + 1;
+   color_rows = color_starts + num_colors + 1;
+
+   for (i = 0; i < num_rows; i++)
+   {
+      color_starts[color[i] + 1]++;
+   }
+   for (c = 0; c < num_colors; c++)
+   {
+      color_starts[c + 1] += color_starts[c];
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      color_rows[color_starts[color[i]]++] = i;
+   }
+   for (c = num_colors; c > 0; c--)
+   {
+      color_starts[c] = color_starts[c - 1];
+   }
+   color_starts[0] = 0;
+
+   hypre_ParCSRMatrixRelaxColors(A) = relax_colors;
+
+   hypre_TFree(color, HYPRE_MEMORY_HOST);
+   hypre_TFree(selected, HYPRE_MEMORY_HOST);
+   hypre_TFree(color_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(int_buf, HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatrixDestroy(G);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulticolorGaussSeidel_core
+ *
+ * Gauss-Seidel/SOR in the color order stored in A, with weight
+ * relax_weight * omega; with Symm, the forward sweep is followed by a
+ * backward one. Points of the same color that are weakly connected are
+ * relaxed Jacobi-like, with the values from before the color, so that the
+ * result does not depend on the number of threads. Without a coloring,
+ * hybrid Gauss-Seidel is used.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGRelaxMulticolorGaussSeidel_core( hypre_ParCSRMatrix *A,
+                                                hypre_ParVector    *f,
+                                                HYPRE_Int          *cf_marker,
+                                                HYPRE_Int           relax_points,
+                                                HYPRE_Real          relax_weight,
+                                                HYPRE_Real          omega,
+                                                hypre_ParVector    *u,
+                                                hypre_ParVector    *Vtemp,
+                                                hypre_ParVector    *Ztemp,
+                                                HYPRE_Int           Symm )
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Complex       *u_data        = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Complex       *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Int           *relax_colors  = hypre_ParCSRMatrixRelaxColors(A);
+   HYPRE_Complex       *v_ext_data    = NULL;
+   HYPRE_Complex       *v_buf_data    = NULL;
+   HYPRE_Complex       *u_new         = NULL;
+   const HYPRE_Real     weight        = relax_weight * omega;
+   const HYPRE_Complex  zero          = 0.0;
+
+   HYPRE_Int           *color_starts, *color_rows;
+   HYPRE_Int            num_colors, num_procs, num_sends = 0, max_color_size;
+   HYPRE_Int            sweep, k, c, r, cs, ce;
+
+   hypre_ParCSRCommHandle *comm_handle;
+
+   if (!relax_colors)
+   {
+      return hypre_BoomerAMGRelaxHybridGaussSeidel_core(A, f, cf_marker, relax_points, relax_weight,
+                                                        omega, NULL, u, Vtemp, Ztemp,
+                                                        1, Symm, 1 /* skip diag */, 0, 0);
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   num_colors   = relax_colors[0];
+   color_starts = relax_colors + 1;
+   color_rows   = color_starts + num_colors + 1;
+
+   max_color_size = 0;
+   for (c = 0; c < num_colors; c++)
+   {
+      max_color_size = hypre_max(max_color_size, color_starts[c + 1] - color_starts[c]);
+   }
+   u_new = hypre_TAlloc(HYPRE_Complex, max_color_size, HYPRE_MEMORY_HOST);
+
+   if (num_procs > 1)
+   {
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+      v_buf_data = hypre_CTAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                 HYPRE_MEMORY_HOST);
+      v_ext_data = hypre_CTAlloc(HYPRE_Complex, num_cols_offd, HYPRE_MEMORY_HOST);
+   }
+
+   for (sweep = 0; sweep < (Symm ? 2 : 1); sweep++)
+   {
+      /* the backward sweep starts with the second to last color, the last
+       * one is already relaxed */
+      for (k = sweep; k < num_colors; k++)
+      {
+         c  = sweep ? num_colors - 1 - k : k;
+         cs = color_starts[c];
+         ce = color_starts[c + 1];
+
+         if (num_procs > 1)
+         {
+#ifdef HYPRE_PROFILE
+            hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+            for (r = 0; r < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); r++)
+            {
+               v_buf_data[r] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, r)];
+            }
+            comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
+            hypre_ParCSRCommHandleDestroy(comm_handle);
+#ifdef HYPRE_PROFILE
+            hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+         }
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+         for (r = cs; r < ce; r++)
+         {
+            const HYPRE_Int i = color_rows[r];
+            HYPRE_Complex   res;
+            HYPRE_Int       jj;
+
+            u_new[r - cs] = u_data[i];
+            if ((relax_points == 0 || cf_marker[i] == relax_points) &&
+                A_diag_data[A_diag_i[i]] != zero)
+            {
+               res = f_data[i];
+               for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+               {
+                  res -= A_diag_data[jj] * u_data[A_diag_j[jj]];
+               }
+               for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+               {
+                  res -= A_offd_data[jj] * v_ext_data[A_offd_j[jj]];
+               }
+               u_new[r - cs] += weight * res / A_diag_data[A_diag_i[i]];
+            }
+         }
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+         for (r = cs; r < ce; r++)
+         {
+            u_data[color_rows[r]] = u_new[r - cs];
+         }
+      }
+   }
+
+   hypre_TFree(u_new, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/* multicolor G-S */
+HYPRE_Int
+hypre_BoomerAMGRelax31MulticolorGaussSeidel( hypre_ParCSRMatrix *A,
+                                             hypre_ParVector    *f,
+                                             HYPRE_Int          *cf_marker,
+                                             HYPRE_Int           relax_points,
+                                             HYPRE_Real          relax_weight,
+                                             HYPRE_Real          omega,
+                                             hypre_ParVector    *u,
+                                             hypre_ParVector    *Vtemp,
+                                             hypre_ParVector    *Ztemp )
+{
+   return hypre_BoomerAMGRelaxMulticolorGaussSeidel_core(A, f, cf_marker, relax_points, relax_weight,
+                                                         omega, u, Vtemp, Ztemp, 0 /* nonsymm */);
+}
+
+/* symmetric multicolor G-S */
+HYPRE_Int
+hypre_BoomerAMGRelax32MulticolorSSOR( hypre_ParCSRMatrix *A,
+                                      hypre_ParVector    *f,
+                                      HYPRE_Int          *cf_marker,
+                                      HYPRE_Int           relax_points,
+                                      HYPRE_Real          relax_weight,
+                                      HYPRE_Real          omega,
+                                      hypre_ParVector    *u,
+                                      hypre_ParVector    *Vtemp,
+                                      hypre_ParVector    *Ztemp )
+{
+   return hypre_BoomerAMGRelaxMulticolorGaussSeidel_core(A, f, cf_marker, relax_points, relax_weight,
+                                                         omega, u, Vtemp, Ztemp, 1 /* symm */);
+}
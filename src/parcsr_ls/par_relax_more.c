@@ -402,6 +402,124 @@ hypre_ParCSRMaxEigEstimateCGHost( hypre_ParCSRMatrix *A,     /* matrix to relax
    return hypre_error_flag;
 }
 
+/**
+ *  @brief Uses power iterations to refine the estimate of the eigenvalue of
+ *  largest magnitude on the host
+ *
+ *  The iterations start from x, which is normalized and overwritten by the
+ *  last iterate. With max_iter = 0, only the Rayleigh quotient of x is
+ *  evaluated. This is cheap enough to check a cached estimate for drift.
+ *
+ *  @param[in] A Matrix to relax with
+ *  @param[in] scale Gets the eigenvalue est of D^{-1/2} A D^{-1/2}
+ *  @param[in] max_iter Number of power iterations
+ *  @param[in,out] x Starting vector / last iterate
+ *  @param[out] eig Rayleigh quotient of the last iterate
+ */
+HYPRE_Int
+hypre_ParCSRMaxEigEstimatePower( hypre_ParCSRMatrix *A,
+                                 HYPRE_Int           scale,
+                                 HYPRE_Int           max_iter,
+                                 hypre_ParVector    *x,
+                                 HYPRE_Real         *eig )
+{
+   HYPRE_Int        local_size = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   hypre_ParVector *s;
+   hypre_ParVector *y;
+   HYPRE_Real      *x_data, *s_data, *y_data;
+   HYPRE_Real      *ds_data = NULL;
+   HYPRE_Real       norm, lambda = 0.0;
+   HYPRE_Int        i, iter;
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Power iterations are not available on device!\n");
+      return hypre_error_flag;
+   }
+
+   s = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
+                             hypre_ParCSRMatrixGlobalNumRows(A),
+                             hypre_ParCSRMatrixRowStarts(A));
+   hypre_ParVectorInitialize(s);
+
+   y = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
+                             hypre_ParCSRMatrixGlobalNumRows(A),
+                             hypre_ParCSRMatrixRowStarts(A));
+   hypre_ParVectorInitialize(y);
+
+   x_data = hypre_VectorData(hypre_ParVectorLocalVector(x));
+   s_data = hypre_VectorData(hypre_ParVectorLocalVector(s));
+   y_data = hypre_VectorData(hypre_ParVectorLocalVector(y));
+
+   if (scale)
+   {
+      ds_data = hypre_CTAlloc(HYPRE_Real, local_size, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixExtractDiagonal(hypre_ParCSRMatrixDiag(A), ds_data, 4);
+   }
+
+   norm = sqrt(hypre_ParVectorInnerProd(x, x));
+   if (norm == 0.0)
+   {
+      hypre_ParVectorSetRandomValues(x, 1);
+      norm = sqrt(hypre_ParVectorInnerProd(x, x));
+   }
+   hypre_ParVectorScale(1.0 / norm, x);
+
+   for (iter = 0; ; iter++)
+   {
+      /* y = D^{-1/2} A D^{-1/2} x */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < local_size; i++)
+      {
+         s_data[i] = ds_data ? ds_data[i] * x_data[i] : x_data[i];
+      }
+      hypre_ParCSRMatrixMatvec(1.0, A, s, 0.0, y);
+      if (ds_data)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < local_size; i++)
+         {
+            y_data[i] *= ds_data[i];
+         }
+      }
+
+      /* x is normalized */
+      lambda = hypre_ParVectorInnerProd(x, y);
+
+      if (iter == max_iter)
+      {
+         break;
+      }
+
+      norm = sqrt(hypre_ParVectorInnerProd(y, y));
+      if (norm == 0.0)
+      {
+         break;
+      }
+
+      /* x = y / |y| */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < local_size; i++)
+      {
+         x_data[i] = y_data[i] / norm;
+      }
+   }
+
+   hypre_TFree(ds_data, HYPRE_MEMORY_HOST);
+   hypre_ParVectorDestroy(s);
+   hypre_ParVectorDestroy(y);
+
+   *eig = lambda;
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
 Chebyshev relaxation
 
@@ -262,6 +262,10 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
       {
          hypre_printf(" Coarsening Type = CLJP, fixed random \n");
       }
+      else if (hypre_abs(coarsen_type) == 12)
+      {
+         hypre_printf(" Coarsening Type = distance-2 MIS aggregation \n");
+      }
       else if (hypre_abs(coarsen_type) == 21) /* BM Aug 29, 2006 */
       {
          hypre_printf(" Coarsening Type = CGC \n");
@@ -381,6 +385,14 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
          hypre_printf(" Interpolation = block direct interpolation \n");
          hypre_printf("                 for nodal systems AMG\n");
       }
+      else if (interp_type == 25)
+      {
+         hypre_printf(" Interpolation = tentative aggregation interpolation \n");
+      }
+      else if (interp_type == 26)
+      {
+         hypre_printf(" Interpolation = smoothed aggregation interpolation \n");
+      }
       else if (interp_type == 100)
       {
          hypre_printf(" Interpolation = one-point interpolation \n");
@@ -85,7 +85,7 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
 
    MPI_Comm                 comm       = hypre_ParCSRMatrixComm(A);
    hypre_ParCSRCommPkg     *comm_pkg   = hypre_ParCSRMatrixCommPkg(A);
-   hypre_ParCSRCommHandle  *comm_handle;
+   hypre_ParCSRCommHandle  *comm_handle = NULL;
    hypre_CSRMatrix    *A_diag          = hypre_ParCSRMatrixDiag(A);
    HYPRE_Int          *A_diag_i        = hypre_CSRMatrixI(A_diag);
    HYPRE_Real         *A_diag_data     = hypre_CSRMatrixData(A_diag);
@@ -121,10 +121,11 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
 
    HYPRE_Int          *dof_func_offd;
    HYPRE_Int           num_sends;
-   HYPRE_Int          *int_buf_data;
+   HYPRE_Int          *int_buf_data = NULL;
    HYPRE_Int           index, start, j;
 
    HYPRE_Int *prefix_sum_workspace;
+   HYPRE_Int  num_passes;
 
    HYPRE_MemoryLocation memory_location = hypre_ParCSRMatrixMemoryLocation(A);
 
@@ -216,12 +217,15 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
          }
       }
 
+      /* completed inside the row loop below, once the interior rows are done */
       comm_handle = hypre_ParCSRCommHandleCreate( 11, comm_pkg, int_buf_data, dof_func_offd);
-
-      hypre_ParCSRCommHandleDestroy(comm_handle);
-      hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
    }
 
+   /* With dof_func_offd in flight, rows without offd entries go first (pass 0) and
+      boundary rows follow once it has arrived (pass 1). Rows are then visited out
+      of order, so S_diag_i/S_offd_i hold row counts until the thread-local scan. */
+   num_passes = comm_handle ? 2 : 1;
+
    /*HYPRE_Int prefix_sum_workspace[2*(hypre_NumThreads() + 1)];*/
    prefix_sum_workspace = hypre_TAlloc(HYPRE_Int,  2 * (hypre_NumThreads() + 1), HYPRE_MEMORY_HOST);
 
@@ -230,144 +234,61 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
    #pragma omp parallel private(i,diag,row_scale,row_sum,jA,jS)
 #endif
    {
-      HYPRE_Int start, stop;
+      HYPRE_Int start, stop, pass, cnt;
       hypre_GetSimpleThreadPartition(&start, &stop, num_variables);
       HYPRE_Int jS_diag = 0, jS_offd = 0;
 
-      for (i = start; i < stop; i++)
+      for (pass = 0; pass < num_passes; pass++)
       {
-         S_diag_i[i] = jS_diag;
-         if (num_cols_offd)
-         {
-            S_offd_i[i] = jS_offd;
-         }
-
-         diag = A_diag_data[A_diag_i[i]];
-
-         /* compute scaling factor and row sum */
-         row_scale = 0.0;
-         row_sum = diag;
-         if (num_functions > 1)
-         {
-            if (diag < 0)
-            {
-               for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
-               {
-                  if (dof_func[i] == dof_func[A_diag_j[jA]])
-                  {
-                     row_scale = hypre_max(row_scale, A_diag_data[jA]);
-                     row_sum += A_diag_data[jA];
-                  }
-               }
-               for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
-               {
-                  if (dof_func[i] == dof_func_offd[A_offd_j[jA]])
-                  {
-                     row_scale = hypre_max(row_scale, A_offd_data[jA]);
-                     row_sum += A_offd_data[jA];
-                  }
-               }
-            }
-            else
-            {
-               for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
-               {
-                  if (dof_func[i] == dof_func[A_diag_j[jA]])
-                  {
-                     row_scale = hypre_min(row_scale, A_diag_data[jA]);
-                     row_sum += A_diag_data[jA];
-                  }
-               }
-               for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
-               {
-                  if (dof_func[i] == dof_func_offd[A_offd_j[jA]])
-                  {
-                     row_scale = hypre_min(row_scale, A_offd_data[jA]);
-                     row_sum += A_offd_data[jA];
-                  }
-               }
-            } /* diag >= 0 */
-         } /* num_functions > 1 */
-         else
+         if (pass == 1)
          {
-            if (diag < 0)
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp master
+#endif
             {
-               for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
-               {
-                  row_scale = hypre_max(row_scale, A_diag_data[jA]);
-                  row_sum += A_diag_data[jA];
-               }
-               for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
-               {
-                  row_scale = hypre_max(row_scale, A_offd_data[jA]);
-                  row_sum += A_offd_data[jA];
-               }
+               hypre_ParCSRCommHandleDestroy(comm_handle);
             }
-            else
-            {
-               for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
-               {
-                  row_scale = hypre_min(row_scale, A_diag_data[jA]);
-                  row_sum += A_diag_data[jA];
-               }
-               for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
-               {
-                  row_scale = hypre_min(row_scale, A_offd_data[jA]);
-                  row_sum += A_offd_data[jA];
-               }
-            } /* diag >= 0*/
-         } /* num_functions <= 1 */
-
-         jS_diag += A_diag_i[i + 1] - A_diag_i[i] - 1;
-         jS_offd += A_offd_i[i + 1] - A_offd_i[i];
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp barrier
+#endif
+         }
 
-         /* compute row entries of S */
-         S_temp_diag_j[A_diag_i[i]] = -1;
-         if ((fabs(row_sum) > fabs(diag)*max_row_sum) && (max_row_sum < 1.0))
+         for (i = start; i < stop; i++)
          {
-            /* make all dependencies weak */
-            for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
+            if (num_passes > 1 && (A_offd_i[i + 1] > A_offd_i[i]) != pass)
             {
-               S_temp_diag_j[jA] = -1;
+               continue;
             }
-            jS_diag -= A_diag_i[i + 1] - (A_diag_i[i] + 1);
 
-            for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+            S_diag_i[i] = jS_diag;
+            if (num_cols_offd)
             {
-               S_temp_offd_j[jA] = -1;
+               S_offd_i[i] = jS_offd;
             }
-            jS_offd -= A_offd_i[i + 1] - A_offd_i[i];
-         }
-         else
-         {
+
+            diag = A_diag_data[A_diag_i[i]];
+
+            /* compute scaling factor and row sum */
+            row_scale = 0.0;
+            row_sum = diag;
             if (num_functions > 1)
             {
                if (diag < 0)
                {
                   for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
                   {
-                     if (A_diag_data[jA] <= strength_threshold * row_scale
-                         || dof_func[i] != dof_func[A_diag_j[jA]])
+                     if (dof_func[i] == dof_func[A_diag_j[jA]])
                      {
-                        S_temp_diag_j[jA] = -1;
-                        --jS_diag;
-                     }
-                     else
-                     {
-                        S_temp_diag_j[jA] = A_diag_j[jA];
+                        row_scale = hypre_max(row_scale, A_diag_data[jA]);
+                        row_sum += A_diag_data[jA];
                      }
                   }
                   for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
                   {
-                     if (A_offd_data[jA] <= strength_threshold * row_scale
-                         || dof_func[i] != dof_func_offd[A_offd_j[jA]])
-                     {
-                        S_temp_offd_j[jA] = -1;
-                        --jS_offd;
-                     }
-                     else
+                     if (dof_func[i] == dof_func_offd[A_offd_j[jA]])
                      {
-                        S_temp_offd_j[jA] = A_offd_j[jA];
+                        row_scale = hypre_max(row_scale, A_offd_data[jA]);
+                        row_sum += A_offd_data[jA];
                      }
                   }
                }
@@ -375,28 +296,18 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
                {
                   for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
                   {
-                     if (A_diag_data[jA] >= strength_threshold * row_scale
-                         || dof_func[i] != dof_func[A_diag_j[jA]])
-                     {
-                        S_temp_diag_j[jA] = -1;
-                        --jS_diag;
-                     }
-                     else
+                     if (dof_func[i] == dof_func[A_diag_j[jA]])
                      {
-                        S_temp_diag_j[jA] = A_diag_j[jA];
+                        row_scale = hypre_min(row_scale, A_diag_data[jA]);
+                        row_sum += A_diag_data[jA];
                      }
                   }
                   for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
                   {
-                     if (A_offd_data[jA] >= strength_threshold * row_scale
-                         || dof_func[i] != dof_func_offd[A_offd_j[jA]])
-                     {
-                        S_temp_offd_j[jA] = -1;
-                        --jS_offd;
-                     }
-                     else
+                     if (dof_func[i] == dof_func_offd[A_offd_j[jA]])
                      {
-                        S_temp_offd_j[jA] = A_offd_j[jA];
+                        row_scale = hypre_min(row_scale, A_offd_data[jA]);
+                        row_sum += A_offd_data[jA];
                      }
                   }
                } /* diag >= 0 */
@@ -407,59 +318,200 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
                {
                   for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
                   {
-                     if (A_diag_data[jA] <= strength_threshold * row_scale)
+                     row_scale = hypre_max(row_scale, A_diag_data[jA]);
+                     row_sum += A_diag_data[jA];
+                  }
+                  for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+                  {
+                     row_scale = hypre_max(row_scale, A_offd_data[jA]);
+                     row_sum += A_offd_data[jA];
+                  }
+               }
+               else
+               {
+                  for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
+                  {
+                     row_scale = hypre_min(row_scale, A_diag_data[jA]);
+                     row_sum += A_diag_data[jA];
+                  }
+                  for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+                  {
+                     row_scale = hypre_min(row_scale, A_offd_data[jA]);
+                     row_sum += A_offd_data[jA];
+                  }
+               } /* diag >= 0*/
+            } /* num_functions <= 1 */
+
+            jS_diag += A_diag_i[i + 1] - A_diag_i[i] - 1;
+            jS_offd += A_offd_i[i + 1] - A_offd_i[i];
+
+            /* compute row entries of S */
+            S_temp_diag_j[A_diag_i[i]] = -1;
+            if ((fabs(row_sum) > fabs(diag)*max_row_sum) && (max_row_sum < 1.0))
+            {
+               /* make all dependencies weak */
+               for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
+               {
+                  S_temp_diag_j[jA] = -1;
+               }
+               jS_diag -= A_diag_i[i + 1] - (A_diag_i[i] + 1);
+
+               for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+               {
+                  S_temp_offd_j[jA] = -1;
+               }
+               jS_offd -= A_offd_i[i + 1] - A_offd_i[i];
+            }
+            else
+            {
+               if (num_functions > 1)
+               {
+                  if (diag < 0)
+                  {
+                     for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
                      {
-                        S_temp_diag_j[jA] = -1;
-                        --jS_diag;
+                        if (A_diag_data[jA] <= strength_threshold * row_scale
+                            || dof_func[i] != dof_func[A_diag_j[jA]])
+                        {
+                           S_temp_diag_j[jA] = -1;
+                           --jS_diag;
+                        }
+                        else
+                        {
+                           S_temp_diag_j[jA] = A_diag_j[jA];
+                        }
                      }
-                     else
+                     for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
                      {
-                        S_temp_diag_j[jA] = A_diag_j[jA];
+                        if (A_offd_data[jA] <= strength_threshold * row_scale
+                            || dof_func[i] != dof_func_offd[A_offd_j[jA]])
+                        {
+                           S_temp_offd_j[jA] = -1;
+                           --jS_offd;
+                        }
+                        else
+                        {
+                           S_temp_offd_j[jA] = A_offd_j[jA];
+                        }
                      }
                   }
-                  for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+                  else
                   {
-                     if (A_offd_data[jA] <= strength_threshold * row_scale)
+                     for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
                      {
-                        S_temp_offd_j[jA] = -1;
-                        --jS_offd;
+                        if (A_diag_data[jA] >= strength_threshold * row_scale
+                            || dof_func[i] != dof_func[A_diag_j[jA]])
+                        {
+                           S_temp_diag_j[jA] = -1;
+                           --jS_diag;
+                        }
+                        else
+                        {
+                           S_temp_diag_j[jA] = A_diag_j[jA];
+                        }
                      }
-                     else
+                     for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
                      {
-                        S_temp_offd_j[jA] = A_offd_j[jA];
+                        if (A_offd_data[jA] >= strength_threshold * row_scale
+                            || dof_func[i] != dof_func_offd[A_offd_j[jA]])
+                        {
+                           S_temp_offd_j[jA] = -1;
+                           --jS_offd;
+                        }
+                        else
+                        {
+                           S_temp_offd_j[jA] = A_offd_j[jA];
+                        }
                      }
-                  }
-               }
+                  } /* diag >= 0 */
+               } /* num_functions > 1 */
                else
                {
-                  for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
+                  if (diag < 0)
                   {
-                     if (A_diag_data[jA] >= strength_threshold * row_scale)
+                     for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
                      {
-                        S_temp_diag_j[jA] = -1;
-                        --jS_diag;
+                        if (A_diag_data[jA] <= strength_threshold * row_scale)
+                        {
+                           S_temp_diag_j[jA] = -1;
+                           --jS_diag;
+                        }
+                        else
+                        {
+                           S_temp_diag_j[jA] = A_diag_j[jA];
+                        }
                      }
-                     else
+                     for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
                      {
-                        S_temp_diag_j[jA] = A_diag_j[jA];
+                        if (A_offd_data[jA] <= strength_threshold * row_scale)
+                        {
+                           S_temp_offd_j[jA] = -1;
+                           --jS_offd;
+                        }
+                        else
+                        {
+                           S_temp_offd_j[jA] = A_offd_j[jA];
+                        }
                      }
                   }
-                  for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
+                  else
                   {
-                     if (A_offd_data[jA] >= strength_threshold * row_scale)
+                     for (jA = A_diag_i[i] + 1; jA < A_diag_i[i + 1]; jA++)
                      {
-                        S_temp_offd_j[jA] = -1;
-                        --jS_offd;
+                        if (A_diag_data[jA] >= strength_threshold * row_scale)
+                        {
+                           S_temp_diag_j[jA] = -1;
+                           --jS_diag;
+                        }
+                        else
+                        {
+                           S_temp_diag_j[jA] = A_diag_j[jA];
+                        }
                      }
-                     else
+                     for (jA = A_offd_i[i]; jA < A_offd_i[i + 1]; jA++)
                      {
-                        S_temp_offd_j[jA] = A_offd_j[jA];
+                        if (A_offd_data[jA] >= strength_threshold * row_scale)
+                        {
+                           S_temp_offd_j[jA] = -1;
+                           --jS_offd;
+                        }
+                        else
+                        {
+                           S_temp_offd_j[jA] = A_offd_j[jA];
+                        }
                      }
-                  }
-               } /* diag >= 0 */
-            } /* num_functions <= 1 */
-         } /* !((row_sum > max_row_sum) && (max_row_sum < 1.0)) */
-      } /* for each variable */
+                  } /* diag >= 0 */
+               } /* num_functions <= 1 */
+            } /* !((row_sum > max_row_sum) && (max_row_sum < 1.0)) */
+
+            if (num_passes > 1)
+            {
+               S_diag_i[i] = jS_diag - S_diag_i[i];
+               if (num_cols_offd)
+               {
+                  S_offd_i[i] = jS_offd - S_offd_i[i];
+               }
+            }
+         } /* for each variable */
+      } /* for each pass */
+
+      if (num_passes > 1)
+      {
+         /* turn the row counts into thread-local offsets */
+         jS_diag = jS_offd = 0;
+         for (i = start; i < stop; i++)
+         {
+            cnt = S_diag_i[i];
+            S_diag_i[i] = jS_diag;
+            jS_diag += cnt;
+            if (num_cols_offd)
+            {
+               cnt = S_offd_i[i];
+               S_offd_i[i] = jS_offd;
+               jS_offd += cnt;
+            }
+         }
+      }
 
       hypre_prefix_sum_pair(&jS_diag, S_diag_i + num_variables, &jS_offd, S_offd_i + num_variables,
                             prefix_sum_workspace);
@@ -515,6 +567,7 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
    *S_ptr = S;
 
    hypre_TFree(prefix_sum_workspace, HYPRE_MEMORY_HOST);
+   hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
    hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
    hypre_TFree(S_temp_diag_j, HYPRE_MEMORY_HOST);
    hypre_TFree(S_temp_offd_j, HYPRE_MEMORY_HOST);
@@ -1789,6 +1842,50 @@ hypre_BoomerAMGCreateSCommPkg(hypre_ParCSRMatrix *A,
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSymmetrizeS
+ *
+ * Returns the pattern of S + S^T (all values one), with a communication
+ * package.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSymmetrizeS( hypre_ParCSRMatrix  *S,
+                            hypre_ParCSRMatrix **G_ptr )
+{
+   hypre_ParCSRMatrix *S1, *ST, *G;
+   HYPRE_Int           i, nnz;
+
+   S1 = hypre_ParCSRMatrixClone(S, 0);
+
+   nnz = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(S1));
+   for (i = 0; i < nnz; i++)
+   {
+      hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(S1))[i] = 1.0;
+   }
+   nnz = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(S1));
+   for (i = 0; i < nnz; i++)
+   {
+      hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(S1))[i] = 1.0;
+   }
+
+   hypre_MatvecCommPkgCreate(S1);
+   hypre_ParCSRMatrixTranspose(S1, &ST, 1);
+   hypre_ParCSRMatrixAdd(1.0, S1, 1.0, ST, &G);
+
+   if (!hypre_ParCSRMatrixCommPkg(G))
+   {
+      hypre_MatvecCommPkgCreate(G);
+   }
+
+   hypre_ParCSRMatrixDestroy(S1);
+   hypre_ParCSRMatrixDestroy(ST);
+
+   *G_ptr = G;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_BoomerAMGCreate2ndS : creates strength matrix on coarse points
  * for second coarsening pass in aggressive coarsening (S*S+2S)
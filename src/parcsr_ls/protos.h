@@ -277,6 +277,10 @@ HYPRE_Int hypre_seqAMGSetup ( hypre_ParAMGData *amg_data, HYPRE_Int p_level,
                               HYPRE_Int coarse_threshold );
 HYPRE_Int hypre_seqAMGCycle ( hypre_ParAMGData *amg_data, HYPRE_Int p_level,
                               hypre_ParVector **Par_F_array, hypre_ParVector **Par_U_array );
+HYPRE_Int hypre_BoomerAMGAgglomerateSetup ( hypre_ParAMGData *amg_data, HYPRE_Int p_level );
+HYPRE_Int hypre_BoomerAMGAgglomerateCycle ( hypre_ParAMGData *amg_data, HYPRE_Int p_level,
+                                            hypre_ParVector **F_array,
+                                            hypre_ParVector **U_array );
 HYPRE_Int hypre_GenerateSubComm ( MPI_Comm comm, HYPRE_Int participate, MPI_Comm *new_comm_ptr );
 void hypre_merge_lists ( HYPRE_Int *list1, HYPRE_Int *list2, hypre_int *np1,
                          hypre_MPI_Datatype *dptr );
@@ -397,6 +401,11 @@ HYPRE_Int HYPRE_BoomerAMGSetSeqThreshold ( HYPRE_Solver solver, HYPRE_Int seq_th
 HYPRE_Int HYPRE_BoomerAMGGetSeqThreshold ( HYPRE_Solver solver, HYPRE_Int *seq_threshold );
 HYPRE_Int HYPRE_BoomerAMGSetRedundant ( HYPRE_Solver solver, HYPRE_Int redundant );
 HYPRE_Int HYPRE_BoomerAMGGetRedundant ( HYPRE_Solver solver, HYPRE_Int *redundant );
+HYPRE_Int HYPRE_BoomerAMGSetAgglomThreshold ( HYPRE_Solver solver, HYPRE_Int agglom_threshold );
+HYPRE_Int HYPRE_BoomerAMGGetAgglomThreshold ( HYPRE_Solver solver,
+                                              HYPRE_Int *agglom_threshold );
+HYPRE_Int HYPRE_BoomerAMGSetNeighborColl ( HYPRE_Solver solver, HYPRE_Int neighbor_coll );
+HYPRE_Int HYPRE_BoomerAMGGetNeighborColl ( HYPRE_Solver solver, HYPRE_Int *neighbor_coll );
 HYPRE_Int HYPRE_BoomerAMGSetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int coarsen_cut_factor );
 HYPRE_Int HYPRE_BoomerAMGGetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int *coarsen_cut_factor );
 HYPRE_Int HYPRE_BoomerAMGSetStrongThreshold ( HYPRE_Solver solver, HYPRE_Real strong_threshold );
@@ -455,6 +464,7 @@ HYPRE_Int HYPRE_BoomerAMGSetCycleRelaxType ( HYPRE_Solver solver, HYPRE_Int rela
 HYPRE_Int HYPRE_BoomerAMGGetCycleRelaxType ( HYPRE_Solver solver, HYPRE_Int *relax_type,
                                              HYPRE_Int k );
 HYPRE_Int HYPRE_BoomerAMGSetRelaxOrder ( HYPRE_Solver solver, HYPRE_Int relax_order );
+HYPRE_Int HYPRE_BoomerAMGSetRelaxCacheBlock ( HYPRE_Solver solver, HYPRE_Int relax_cache_block );
 HYPRE_Int HYPRE_BoomerAMGSetGridRelaxPoints ( HYPRE_Solver solver, HYPRE_Int **grid_relax_points );
 HYPRE_Int HYPRE_BoomerAMGSetRelaxWeight ( HYPRE_Solver solver, HYPRE_Real *relax_weight );
 HYPRE_Int HYPRE_BoomerAMGSetRelaxWt ( HYPRE_Solver solver, HYPRE_Real relax_wt );
@@ -556,6 +566,7 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyFraction ( HYPRE_Solver solver, HYPRE_Real rati
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst ( HYPRE_Solver solver, HYPRE_Int eig_est );
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant ( HYPRE_Solver solver, HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGSetChebyScale ( HYPRE_Solver solver, HYPRE_Int scale );
+HYPRE_Int HYPRE_BoomerAMGSetChebyEigRefine ( HYPRE_Solver solver, HYPRE_Int eig_refine );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVectors ( HYPRE_Solver solver, HYPRE_Int num_vectors,
                                             HYPRE_ParVector *vectors );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVecVariant ( HYPRE_Solver solver, HYPRE_Int num );
@@ -580,6 +591,8 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongal
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecisionLevel ( HYPRE_Solver solver, HYPRE_Int mp_level );
+HYPRE_Int HYPRE_BoomerAMGSetSetupReuse ( HYPRE_Solver solver, HYPRE_Int setup_reuse );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -744,6 +757,8 @@ HYPRE_Int HYPRE_ParCSRCOGMRESSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A,
                                      HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetKDim ( HYPRE_Solver solver, HYPRE_Int k_dim );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetCGS2 ( HYPRE_Solver solver, HYPRE_Int cgs2 );
+HYPRE_Int HYPRE_ParCSRCOGMRESSetSStep ( HYPRE_Solver solver, HYPRE_Int s_step );
+HYPRE_Int HYPRE_ParCSRCOGMRESSetSStepBasis ( HYPRE_Solver solver, HYPRE_Int s_step_basis );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetMinIter ( HYPRE_Solver solver, HYPRE_Int min_iter );
@@ -935,6 +950,12 @@ HYPRE_Int HYPRE_ParCSRPCGSetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPR
                                  HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRPCGSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
                                  HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGCreate ( MPI_Comm comm, HYPRE_Solver *solver );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGDestroy ( HYPRE_Solver solver );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A,
+                                          HYPRE_ParVector b, HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A,
+                                          HYPRE_ParVector b, HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRPCGSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRPCGSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
 HYPRE_Int HYPRE_ParCSRPCGSetMaxIter ( HYPRE_Solver solver, HYPRE_Int max_iter );
@@ -990,6 +1011,16 @@ HYPRE_Int hypre_BoomerAMGAdditiveCycle ( void *amg_vdata );
 HYPRE_Int hypre_CreateLambda ( void *amg_vdata );
 HYPRE_Int hypre_CreateDinv ( void *amg_vdata );
 
+/* par_aggregate.c */
+HYPRE_Int hypre_BoomerAMGCoarsenAggregates ( hypre_ParCSRMatrix *S, HYPRE_Int debug_flag,
+                                             hypre_IntArray **CF_marker_ptr,
+                                             HYPRE_BigInt **aggregates_ptr );
+HYPRE_Int hypre_BoomerAMGBuildAggInterp ( hypre_ParCSRMatrix *A, HYPRE_BigInt *aggregates,
+                                          HYPRE_BigInt *num_cpts_global, HYPRE_Int block_size,
+                                          HYPRE_Int smooth, HYPRE_Int debug_flag,
+                                          HYPRE_Real trunc_factor, HYPRE_Int max_elmts,
+                                          hypre_ParCSRMatrix **P_ptr );
+
 /* par_amg.c */
 void *hypre_BoomerAMGCreate ( void );
 HYPRE_Int hypre_BoomerAMGDestroy ( void *data );
@@ -1008,6 +1039,10 @@ HYPRE_Int hypre_BoomerAMGSetCoarsenCutFactor( void *data, HYPRE_Int coarsen_cut_
 HYPRE_Int hypre_BoomerAMGGetCoarsenCutFactor( void *data, HYPRE_Int *coarsen_cut_factor );
 HYPRE_Int hypre_BoomerAMGSetRedundant ( void *data, HYPRE_Int redundant );
 HYPRE_Int hypre_BoomerAMGGetRedundant ( void *data, HYPRE_Int *redundant );
+HYPRE_Int hypre_BoomerAMGSetAgglomThreshold ( void *data, HYPRE_Int agglom_threshold );
+HYPRE_Int hypre_BoomerAMGGetAgglomThreshold ( void *data, HYPRE_Int *agglom_threshold );
+HYPRE_Int hypre_BoomerAMGSetNeighborColl ( void *data, HYPRE_Int neighbor_coll );
+HYPRE_Int hypre_BoomerAMGGetNeighborColl ( void *data, HYPRE_Int *neighbor_coll );
 HYPRE_Int hypre_BoomerAMGSetStrongThreshold ( void *data, HYPRE_Real strong_threshold );
 HYPRE_Int hypre_BoomerAMGGetStrongThreshold ( void *data, HYPRE_Real *strong_threshold );
 HYPRE_Int hypre_BoomerAMGSetStrongThresholdR ( void *data, HYPRE_Real strong_threshold );
@@ -1055,6 +1090,7 @@ HYPRE_Int hypre_BoomerAMGSetRelaxType ( void *data, HYPRE_Int relax_type );
 HYPRE_Int hypre_BoomerAMGSetCycleRelaxType ( void *data, HYPRE_Int relax_type, HYPRE_Int k );
 HYPRE_Int hypre_BoomerAMGGetCycleRelaxType ( void *data, HYPRE_Int *relax_type, HYPRE_Int k );
 HYPRE_Int hypre_BoomerAMGSetRelaxOrder ( void *data, HYPRE_Int relax_order );
+HYPRE_Int hypre_BoomerAMGSetRelaxCacheBlock ( void *data, HYPRE_Int relax_cache_block );
 HYPRE_Int hypre_BoomerAMGGetRelaxOrder ( void *data, HYPRE_Int *relax_order );
 HYPRE_Int hypre_BoomerAMGSetGridRelaxType ( void *data, HYPRE_Int *grid_relax_type );
 HYPRE_Int hypre_BoomerAMGGetGridRelaxType ( void *data, HYPRE_Int **grid_relax_type );
@@ -1090,6 +1126,7 @@ HYPRE_Int hypre_BoomerAMGSetNumSamples ( void *data, HYPRE_Int par );
 HYPRE_Int hypre_BoomerAMGSetCGCIts ( void *data, HYPRE_Int its );
 HYPRE_Int hypre_BoomerAMGSetPlotGrids ( void *data, HYPRE_Int plotgrids );
 HYPRE_Int hypre_BoomerAMGSetPlotFileName ( void *data, const char *plot_file_name );
+HYPRE_Int hypre_BoomerAMGSetProfileFile ( void *data, const char *profile_file_name );
 HYPRE_Int hypre_BoomerAMGSetCoordDim ( void *data, HYPRE_Int coorddim );
 HYPRE_Int hypre_BoomerAMGSetCoordinates ( void *data, float *coordinates );
 HYPRE_Int hypre_BoomerAMGGetGridHierarchy(void *data, HYPRE_Int *cgrid );
@@ -1162,6 +1199,7 @@ HYPRE_Int hypre_BoomerAMGSetChebyFraction ( void *data, HYPRE_Real ratio );
 HYPRE_Int hypre_BoomerAMGSetChebyEigEst ( void *data, HYPRE_Int eig_est );
 HYPRE_Int hypre_BoomerAMGSetChebyVariant ( void *data, HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGSetChebyScale ( void *data, HYPRE_Int scale );
+HYPRE_Int hypre_BoomerAMGSetChebyEigRefine ( void *data, HYPRE_Int eig_refine );
 HYPRE_Int hypre_BoomerAMGSetInterpVectors ( void *solver, HYPRE_Int num_vectors,
                                             hypre_ParVector **interp_vectors );
 HYPRE_Int hypre_BoomerAMGSetInterpVecVariant ( void *solver, HYPRE_Int var );
@@ -1185,6 +1223,8 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_t
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetMixedPrecisionLevel ( void *data, HYPRE_Int mp_level );
+HYPRE_Int hypre_BoomerAMGSetSetupReuse ( void *data, HYPRE_Int setup_reuse );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -1193,11 +1233,30 @@ HYPRE_Int hypre_BoomerAMGSetCPoints( void *data, HYPRE_Int cpt_coarse_level,
 HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int num_points,
                                      HYPRE_BigInt *indices );
 
+/* par_amg_profile.c */
+HYPRE_Int hypre_BoomerAMGProfileStageBegin( void *data, HYPRE_Int stage );
+HYPRE_Int hypre_BoomerAMGProfileStageEnd( void *data );
+HYPRE_Int hypre_BoomerAMGProfileBegin( void *data, HYPRE_Int level, HYPRE_Int phase );
+HYPRE_Int hypre_BoomerAMGProfileEnd( void *data );
+HYPRE_Int hypre_BoomerAMGProfileWrite( void *data );
+HYPRE_Int hypre_BoomerAMGProfileDestroy( void *data );
+
+/* par_amg_reuse.c */
+HYPRE_Int hypre_BoomerAMGSetupReuseCheck ( void *amg_vdata, hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGSetupReuseLevels ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGSetupReuseDestroy ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGChebyEigCacheLookup ( void *amg_vdata, HYPRE_Int level, HYPRE_Int scale,
+                                               HYPRE_Real *max_eig, HYPRE_Real *min_eig );
+HYPRE_Int hypre_BoomerAMGChebyEigCacheStore ( void *amg_vdata, HYPRE_Int level, HYPRE_Int scale,
+                                              HYPRE_Real max_eig, HYPRE_Real min_eig );
+
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                  hypre_ParVector *u );
 
 /* par_amg_solve.c */
+HYPRE_Int hypre_BoomerAMGSetSolveNumVectors ( hypre_ParAMGData *amg_data, HYPRE_Int num_vectors );
+HYPRE_Int hypre_BoomerAMGSolveWorkDestroy ( hypre_ParAMGData *amg_data );
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                  hypre_ParVector *u );
 
@@ -1634,6 +1693,14 @@ HYPRE_Int hypre_GenerateSendMapAndCommPkg ( MPI_Comm comm, HYPRE_Int num_sends,
 HYPRE_Int hypre_BoomerAMGRelax ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker,
                                  HYPRE_Int relax_type, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
                                  HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxMultiVector ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                            HYPRE_Int *cf_marker, HYPRE_Int relax_type, HYPRE_Int relax_points,
+                                            HYPRE_Real relax_weight, HYPRE_Real omega, HYPRE_Real *l1_norms,
+                                            hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxJacobiMultiVector ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                  HYPRE_Int *cf_marker, HYPRE_Int relax_points,
+                                                  HYPRE_Real relax_weight, HYPRE_Real *l1_norms,
+                                                  hypre_ParVector *u, hypre_ParVector *Vtemp );
 HYPRE_Int hypre_GaussElimSetup ( hypre_ParAMGData *amg_data, HYPRE_Int level,
                                  HYPRE_Int relax_type );
 HYPRE_Int hypre_GaussElimSolve ( hypre_ParAMGData *amg_data, HYPRE_Int level,
@@ -1643,6 +1710,8 @@ HYPRE_Int hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A, hyp
                                                       HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp,
                                                       HYPRE_Int GS_order, HYPRE_Int Symm, HYPRE_Int Skip_diag, HYPRE_Int forced_seq,
                                                       HYPRE_Int Topo_order );
+HYPRE_Int hypre_BoomerAMGRelaxBlocksSetup( hypre_ParCSRMatrix *A, HYPRE_Int block_kbytes,
+                                           HYPRE_Int first_touch );
 HYPRE_Int hypre_BoomerAMGRelax0WeightedJacobi( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                                HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, hypre_ParVector *u,
                                                hypre_ParVector *Vtemp );
@@ -1723,6 +1792,15 @@ HYPRE_Int hypre_BoomerAMGRelaxHybridGaussSeidelDevice( hypre_ParCSRMatrix *A, hy
                                                        HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp,
                                                        HYPRE_Int GS_order, HYPRE_Int Symm );
 
+/* par_relax_color.c */
+HYPRE_Int hypre_BoomerAMGRelaxColorsSetup( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *S );
+HYPRE_Int hypre_BoomerAMGRelax31MulticolorGaussSeidel( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                       HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
+                                                       hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelax32MulticolorSSOR( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
+                                                hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
+
 /* par_relax_interface.c */
 HYPRE_Int hypre_BoomerAMGRelaxIF ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker,
                                    HYPRE_Int relax_type, HYPRE_Int relax_order, HYPRE_Int cycle_type, HYPRE_Real relax_weight,
@@ -1738,6 +1816,8 @@ HYPRE_Int hypre_ParCSRMaxEigEstimateCG ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
                                          HYPRE_Real *max_eig, HYPRE_Real *min_eig );
 HYPRE_Int hypre_ParCSRMaxEigEstimateCGHost ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
                                              HYPRE_Int max_iter, HYPRE_Real *max_eig, HYPRE_Real *min_eig );
+HYPRE_Int hypre_ParCSRMaxEigEstimatePower ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
+                                             HYPRE_Int max_iter, hypre_ParVector *x, HYPRE_Real *eig );
 HYPRE_Int hypre_ParCSRRelax_Cheby ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Real max_eig,
                                     HYPRE_Real min_eig, HYPRE_Real fraction, HYPRE_Int order, HYPRE_Int scale, HYPRE_Int variant,
                                     hypre_ParVector *u, hypre_ParVector *v, hypre_ParVector *r );
@@ -1797,6 +1877,7 @@ HYPRE_Int hypre_BoomerAMGCreateSabs ( hypre_ParCSRMatrix *A, HYPRE_Real strength
                                       HYPRE_Real max_row_sum, HYPRE_Int num_functions, HYPRE_Int *dof_func, hypre_ParCSRMatrix **S_ptr );
 HYPRE_Int hypre_BoomerAMGCreateSCommPkg ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *S,
                                           HYPRE_Int **col_offd_S_to_A_ptr );
+HYPRE_Int hypre_BoomerAMGSymmetrizeS ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix **G_ptr );
 HYPRE_Int hypre_BoomerAMGCreate2ndS ( hypre_ParCSRMatrix *S, HYPRE_Int *CF_marker,
                                       HYPRE_Int num_paths, HYPRE_BigInt *coarse_row_starts, hypre_ParCSRMatrix **C_ptr );
 HYPRE_Int hypre_BoomerAMGCorrectCFMarker ( hypre_IntArray *CF_marker,
@@ -1905,13 +1986,23 @@ HYPRE_Int hypre_ParKrylovMatvec ( void *matvec_data, HYPRE_Complex alpha, void *
 HYPRE_Int hypre_ParKrylovMatvecT ( void *matvec_data, HYPRE_Complex alpha, void *A, void *x,
                                    HYPRE_Complex beta, void *y );
 HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
+HYPRE_Int hypre_ParKrylovResidualNorm ( void *matvec_data, void *A, void *x, void *b, void *r,
+                                        HYPRE_Real *r_norm2, hypre_MPI_Request *request );
 HYPRE_Real hypre_ParKrylovInnerProd ( void *x, void *y );
+HYPRE_Int hypre_ParKrylovInnerProdStart ( HYPRE_Int k, void **x, void **y, HYPRE_Real *result,
+                                         hypre_MPI_Request *request );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
                                          void *result );
+HYPRE_Int hypre_ParKrylovBlockInnerProd ( void **x, HYPRE_Int kx, void **y, HYPRE_Int ky,
+                                         HYPRE_Int unroll, void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll,
                                        void *result_x, void *result_y );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
                                    HYPRE_Int unroll);
+HYPRE_Int hypre_ParKrylovNumVectors ( void *x );
+HYPRE_Int hypre_ParKrylovMultiInnerProd ( HYPRE_Int k, void **x, void *y, HYPRE_Real *result );
+HYPRE_Int hypre_ParKrylovColumnInnerProd ( void *x, void *y, HYPRE_Real *result );
+HYPRE_Int hypre_ParKrylovMultiAxpy ( HYPRE_Complex *alpha, void *x, HYPRE_Complex beta, void *y );
 HYPRE_Int hypre_ParKrylovCopyVector ( void *x, void *y );
 HYPRE_Int hypre_ParKrylovClearVector ( void *x );
 HYPRE_Int hypre_ParKrylovScaleVector ( HYPRE_Complex alpha, void *x );
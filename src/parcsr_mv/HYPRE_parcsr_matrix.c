@@ -93,6 +93,32 @@ HYPRE_ParCSRMatrixPrint( HYPRE_ParCSRMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixPrintBinary( HYPRE_ParCSRMatrix  matrix,
+                               const char         *file_name,
+                               HYPRE_Int           compress )
+{
+   return ( hypre_ParCSRMatrixPrintBinary( (hypre_ParCSRMatrix *) matrix,
+                                           file_name, compress ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixReadBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixReadBinary( MPI_Comm            comm,
+                              const char         *file_name,
+                              HYPRE_ParCSRMatrix *matrix )
+{
+   return ( hypre_ParCSRMatrixReadBinary( comm, file_name,
+                                          (hypre_ParCSRMatrix **) matrix ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRMatrixGetComm
  *--------------------------------------------------------------------------*/
@@ -408,3 +434,15 @@ HYPRE_ParCSRMatrixMatvecT( HYPRE_Complex      alpha,
                alpha, (hypre_ParCSRMatrix *) A,
                (hypre_ParVector *) x, beta, (hypre_ParVector *) y) );
 }
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixSetNeighborColl
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixSetNeighborColl( HYPRE_ParCSRMatrix matrix,
+                                   HYPRE_Int          neighbor_coll )
+{
+   return ( hypre_ParCSRMatrixSetNeighborColl( (hypre_ParCSRMatrix *) matrix,
+                                               neighbor_coll ) );
+}
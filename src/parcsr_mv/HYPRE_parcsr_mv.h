@@ -44,6 +44,12 @@ HYPRE_Int HYPRE_ParCSRMatrixInitialize( HYPRE_ParCSRMatrix matrix );
 HYPRE_Int HYPRE_ParCSRMatrixRead( MPI_Comm comm, const char *file_name,
                                   HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixPrint( HYPRE_ParCSRMatrix matrix, const char *file_name );
+/* Binary files "<file_name>.%05d" and "<file_name>.index", readable on any
+   number of processes; compress stores the column indices as delta varints */
+HYPRE_Int HYPRE_ParCSRMatrixPrintBinary( HYPRE_ParCSRMatrix matrix, const char *file_name,
+                                         HYPRE_Int compress );
+HYPRE_Int HYPRE_ParCSRMatrixReadBinary( MPI_Comm comm, const char *file_name,
+                                        HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixGetComm( HYPRE_ParCSRMatrix matrix, MPI_Comm *comm );
 HYPRE_Int HYPRE_ParCSRMatrixGetDims( HYPRE_ParCSRMatrix matrix, HYPRE_BigInt *M, HYPRE_BigInt *N );
 HYPRE_Int HYPRE_ParCSRMatrixGetRowPartitioning( HYPRE_ParCSRMatrix matrix,
@@ -62,6 +68,8 @@ HYPRE_Int HYPRE_ParCSRMatrixMatvec( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A, H
                                     HYPRE_Complex beta, HYPRE_ParVector y );
 HYPRE_Int HYPRE_ParCSRMatrixMatvecT( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A, HYPRE_ParVector x,
                                      HYPRE_Complex beta, HYPRE_ParVector y );
+/* Halo exchanges of the matrix through MPI neighborhood collectives (collective call) */
+HYPRE_Int HYPRE_ParCSRMatrixSetNeighborColl( HYPRE_ParCSRMatrix matrix, HYPRE_Int neighbor_coll );
 
 /* HYPRE_parcsr_vector.c */
 HYPRE_Int HYPRE_ParVectorCreate( MPI_Comm comm, HYPRE_BigInt global_size,
@@ -70,6 +78,9 @@ HYPRE_Int HYPRE_ParVectorDestroy( HYPRE_ParVector vector );
 HYPRE_Int HYPRE_ParVectorInitialize( HYPRE_ParVector vector );
 HYPRE_Int HYPRE_ParVectorRead( MPI_Comm comm, const char *file_name, HYPRE_ParVector *vector );
 HYPRE_Int HYPRE_ParVectorPrint( HYPRE_ParVector vector, const char *file_name );
+HYPRE_Int HYPRE_ParVectorPrintBinary( HYPRE_ParVector vector, const char *file_name );
+HYPRE_Int HYPRE_ParVectorReadBinary( MPI_Comm comm, const char *file_name,
+                                     HYPRE_ParVector *vector );
 HYPRE_Int HYPRE_ParVectorSetConstantValues( HYPRE_ParVector vector, HYPRE_Complex value );
 HYPRE_Int HYPRE_ParVectorSetRandomValues( HYPRE_ParVector vector, HYPRE_Int seed );
 HYPRE_Int HYPRE_ParVectorCopy( HYPRE_ParVector x, HYPRE_ParVector y );
@@ -104,6 +104,31 @@ HYPRE_ParVectorPrint( HYPRE_ParVector  vector,
                                   file_name ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParVectorPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParVectorPrintBinary( HYPRE_ParVector  vector,
+                            const char      *file_name )
+{
+   return ( hypre_ParVectorPrintBinary( (hypre_ParVector *) vector,
+                                        file_name ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParVectorReadBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParVectorReadBinary( MPI_Comm         comm,
+                           const char      *file_name,
+                           HYPRE_ParVector *vector )
+{
+   return ( hypre_ParVectorReadBinary( comm, file_name,
+                                       (hypre_ParVector **) vector ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParVectorSetConstantValues
  *--------------------------------------------------------------------------*/
@@ -28,7 +28,6 @@ extern "C" {
  *   Structure containing information for doing communications
  *--------------------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 typedef enum CommPkgJobType
 {
    HYPRE_COMM_PKG_JOB_COMPLEX = 0,
@@ -39,7 +38,9 @@ typedef enum CommPkgJobType
    HYPRE_COMM_PKG_JOB_BIGINT_TRANSPOSE,
    NUM_OF_COMM_PKG_JOB_TYPE,
 } CommPkgJobType;
-#endif
+
+/* persistent handles kept per job, one for each number of vectors in use */
+#define HYPRE_PERSISTENT_COMM_HANDLES_PER_JOB 4
 
 /*--------------------------------------------------------------------------
  * hypre_ParCSRCommHandle, hypre_ParCSRPersistentCommHandle
@@ -53,12 +54,17 @@ typedef struct
    HYPRE_MemoryLocation  recv_memory_location;
    HYPRE_Int             num_send_bytes;
    HYPRE_Int             num_recv_bytes;
+   HYPRE_Int             num_vectors;   /* persistent handles: vectors packed per message */
    void                 *send_data;
    void                 *recv_data;
    void                 *send_data_buffer;
    void                 *recv_data_buffer;
    HYPRE_Int             num_requests;
+   HYPRE_Int             num_send_requests; /* persistent handles: point-to-point sends */
    hypre_MPI_Request    *requests;
+   /* persistent handles on the neighborhood collective backend */
+   hypre_int            *neighbor_counts;   /* send counts/displs, recv counts/displs */
+   hypre_MPI_Datatype    neighbor_type;
 } hypre_ParCSRCommHandle;
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
@@ -77,9 +83,19 @@ typedef struct _hypre_ParCSRCommPkg
    /* remote communication information */
    hypre_MPI_Datatype               *send_mpi_types;
    hypre_MPI_Datatype               *recv_mpi_types;
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
-#endif
+   /* most recently used first */
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE]
+   [HYPRE_PERSISTENT_COMM_HANDLES_PER_JOB];
+   /* neighborhood collective backend: distributed graph communicator over the
+      union of send_procs and recv_procs, with per-neighbor counts and
+      displacements of the forward (job 1) exchange */
+   HYPRE_Int                         neighbor_coll;
+   MPI_Comm                          neighbor_comm;
+   HYPRE_Int                         num_neighbors;
+   hypre_int                        *neighbor_send_counts;
+   hypre_int                        *neighbor_send_displs;
+   hypre_int                        *neighbor_recv_counts;
+   hypre_int                        *neighbor_recv_displs;
 #if defined(HYPRE_USING_GPU)
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
    HYPRE_Complex                    *tmp_data;
@@ -112,6 +128,13 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgNeighborColl(comm_pkg)        (comm_pkg -> neighbor_coll)
+#define hypre_ParCSRCommPkgNeighborComm(comm_pkg)        (comm_pkg -> neighbor_comm)
+#define hypre_ParCSRCommPkgNumNeighbors(comm_pkg)        (comm_pkg -> num_neighbors)
+#define hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg)  (comm_pkg -> neighbor_send_counts)
+#define hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg)  (comm_pkg -> neighbor_send_displs)
+#define hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg)  (comm_pkg -> neighbor_recv_counts)
+#define hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg)  (comm_pkg -> neighbor_recv_displs)
 
 #if defined(HYPRE_USING_GPU)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -146,6 +169,10 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle)     (comm_handle -> recv_memory_location)
 #define hypre_ParCSRCommHandleNumSendBytes(comm_handle)           (comm_handle -> num_send_bytes)
 #define hypre_ParCSRCommHandleNumRecvBytes(comm_handle)           (comm_handle -> num_recv_bytes)
+#define hypre_ParCSRCommHandleNumVectors(comm_handle)             (comm_handle -> num_vectors)
+#define hypre_ParCSRCommHandleNumSendRequests(comm_handle)        (comm_handle -> num_send_requests)
+#define hypre_ParCSRCommHandleNeighborCounts(comm_handle)         (comm_handle -> neighbor_counts)
+#define hypre_ParCSRCommHandleNeighborType(comm_handle)           (comm_handle -> neighbor_type)
 #define hypre_ParCSRCommHandleSendData(comm_handle)               (comm_handle -> send_data)
 #define hypre_ParCSRCommHandleRecvData(comm_handle)               (comm_handle -> recv_data)
 #define hypre_ParCSRCommHandleSendDataBuffer(comm_handle)         (comm_handle -> send_data_buffer)
@@ -324,6 +351,8 @@ typedef struct hypre_ParCSRMatrix_struct
 
    hypre_ParCSRCommPkg  *comm_pkg;
    hypre_ParCSRCommPkg  *comm_pkgT;
+   /* use MPI neighborhood collectives in the comm_pkg created for matvecs */
+   HYPRE_Int             neighbor_coll;
 
    /* Does the ParCSRMatrix create/destroy `diag', `offd', `col_map_offd'? */
    HYPRE_Int             owns_data;
@@ -341,6 +370,12 @@ typedef struct hypre_ParCSRMatrix_struct
    /* Array to store ordering of local diagonal block to relax. In particular,
    used for triangulr matrices that are not ordered to be triangular. */
    HYPRE_Int            *proc_ordering;
+   /* Cache-sized blocks of local rows and their coloring, used by the
+      threaded hybrid Gauss-Seidel smoothers (see hypre_BoomerAMGRelaxBlocksSetup) */
+   HYPRE_Int            *relax_blocks;
+   /* Color classes of the rows for the multicolor Gauss-Seidel smoothers
+      (see hypre_BoomerAMGRelaxColorsSetup) */
+   HYPRE_Int            *relax_colors;
 
    /* Save block diagonal inverse */
    HYPRE_Int             bdiag_size;
@@ -377,6 +412,7 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixColStarts(matrix)              ((matrix) -> col_starts)
 #define hypre_ParCSRMatrixCommPkg(matrix)                ((matrix) -> comm_pkg)
 #define hypre_ParCSRMatrixCommPkgT(matrix)               ((matrix) -> comm_pkgT)
+#define hypre_ParCSRMatrixNeighborColl(matrix)           ((matrix) -> neighbor_coll)
 #define hypre_ParCSRMatrixOwnsData(matrix)               ((matrix) -> owns_data)
 #define hypre_ParCSRMatrixNumNonzeros(matrix)            ((matrix) -> num_nonzeros)
 #define hypre_ParCSRMatrixDNumNonzeros(matrix)           ((matrix) -> d_num_nonzeros)
@@ -386,6 +422,8 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixRelaxBlocks(matrix)            ((matrix) -> relax_blocks)
+#define hypre_ParCSRMatrixRelaxColors(matrix)            ((matrix) -> relax_colors)
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) || defined(HYPRE_USING_SYCL)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -466,6 +504,81 @@ typedef struct
 #define hypre_ParCSRBooleanMatrix_Get_Rowindices(matrix)    ((matrix)->rowindices)
 #define hypre_ParCSRBooleanMatrix_Get_Getrowactive(matrix)  ((matrix)->getrowactive)
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlan
+ *
+ * Symbolic part of the host product C = A*B, so that the values of C can be
+ * recomputed for new values of A and B with unchanged sparsity patterns.
+ * It holds the value exchange of the external rows of B (B_ext) and the
+ * columns of B and B_ext mapped to the local columns of C.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int            num_rows;          /* local rows of A and C */
+   HYPRE_Int            num_cols_diag;     /* local columns of B and C */
+   HYPRE_Int            num_cols_offd;     /* off-processor columns of C */
+   HYPRE_Int            num_rows_B;
+   HYPRE_Int            num_cols_offd_A;
+   HYPRE_Int            num_cols_offd_B;
+
+   /* nonzeros of the diag and offd parts of A, B and C, checked on every
+    * execute, and keys of their local patterns, checked by the Matches
+    * routines */
+   HYPRE_Int            num_nonzeros[6];
+   hypre_ulonglongint   pattern_key[3];
+
+   HYPRE_Int           *map_B_to_C;        /* offd column of B -> offd column of C */
+
+   /* value exchange of B_ext: the starts of comm_pkg count nonzeros, its
+    * send_map_elmts hold the local rows of B that are sent */
+   hypre_ParCSRCommPkg *comm_pkg;
+   HYPRE_Int            num_send_rows;
+   HYPRE_Int           *send_i;            /* offsets of the sent rows in the send buffer */
+   HYPRE_Int           *B_ext_i;
+   HYPRE_Int           *B_ext_j;           /* local columns of C: num_cols_diag + offd column */
+
+} hypre_ParCSRMatMatPlan;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlan
+ *
+ * Plan for the Galerkin product R^T*A*P computed as (R^T)*(A*P). R^T is
+ * kept by the plan, so the values of R only change through
+ * hypre_ParCSRRAPPlanUpdateR.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRMatrix     *RT;
+   hypre_ParCSRMatrix     *AP;
+   hypre_ParCSRMatMatPlan *AP_plan;
+   hypre_ParCSRMatMatPlan *RAP_plan;
+
+} hypre_ParCSRRAPPlan;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBinaryView
+ *
+ * Local rows of a binary matrix file mapped into memory. The row pointers
+ * and values of matrix point into the mapping, and so do its global column
+ * indices (BigJ) unless the file is compressed.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   void               *addr;              /* start of the mapping */
+   size_t              length;            /* length of the mapping in bytes */
+
+   HYPRE_BigInt        global_num_rows;
+   HYPRE_BigInt        global_num_cols;
+   HYPRE_BigInt        first_row;         /* global index of the first row */
+
+   hypre_CSRMatrix    *matrix;
+   HYPRE_Int           owns_big_j;        /* BigJ was decoded from the file */
+
+} hypre_ParCSRBinaryView;
+
 #endif
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
@@ -672,6 +785,10 @@ HYPRE_Int HYPRE_ParCSRMatrixBigInitialize ( HYPRE_ParCSRMatrix matrix );
 HYPRE_Int HYPRE_ParCSRMatrixRead ( MPI_Comm comm, const char *file_name,
                                    HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixPrint ( HYPRE_ParCSRMatrix matrix, const char *file_name );
+HYPRE_Int HYPRE_ParCSRMatrixPrintBinary ( HYPRE_ParCSRMatrix matrix, const char *file_name,
+                                          HYPRE_Int compress );
+HYPRE_Int HYPRE_ParCSRMatrixReadBinary ( MPI_Comm comm, const char *file_name,
+                                         HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixGetComm ( HYPRE_ParCSRMatrix matrix, MPI_Comm *comm );
 HYPRE_Int HYPRE_ParCSRMatrixGetDims ( HYPRE_ParCSRMatrix matrix, HYPRE_BigInt *M, HYPRE_BigInt *N );
 HYPRE_Int HYPRE_ParCSRMatrixGetRowPartitioning ( HYPRE_ParCSRMatrix matrix,
@@ -694,6 +811,7 @@ HYPRE_Int HYPRE_ParCSRMatrixMatvec ( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A,
                                      HYPRE_Complex beta, HYPRE_ParVector y );
 HYPRE_Int HYPRE_ParCSRMatrixMatvecT ( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A, HYPRE_ParVector x,
                                       HYPRE_Complex beta, HYPRE_ParVector y );
+HYPRE_Int HYPRE_ParCSRMatrixSetNeighborColl ( HYPRE_ParCSRMatrix matrix, HYPRE_Int neighbor_coll );
 HYPRE_Int hypre_ParCSRMatrixTruncate(hypre_ParCSRMatrix *A, HYPRE_Real tol, HYPRE_Int max_row_elmts,
                                      HYPRE_Int rescale, HYPRE_Int nrm_type);
 /* HYPRE_parcsr_vector.c */
@@ -705,6 +823,9 @@ HYPRE_Int HYPRE_ParVectorDestroy ( HYPRE_ParVector vector );
 HYPRE_Int HYPRE_ParVectorInitialize ( HYPRE_ParVector vector );
 HYPRE_Int HYPRE_ParVectorRead ( MPI_Comm comm, const char *file_name, HYPRE_ParVector *vector );
 HYPRE_Int HYPRE_ParVectorPrint ( HYPRE_ParVector vector, const char *file_name );
+HYPRE_Int HYPRE_ParVectorPrintBinary ( HYPRE_ParVector vector, const char *file_name );
+HYPRE_Int HYPRE_ParVectorReadBinary ( MPI_Comm comm, const char *file_name,
+                                      HYPRE_ParVector *vector );
 HYPRE_Int HYPRE_ParVectorSetConstantValues ( HYPRE_ParVector vector, HYPRE_Complex value );
 HYPRE_Int HYPRE_ParVectorSetRandomValues ( HYPRE_ParVector vector, HYPRE_Int seed );
 HYPRE_Int HYPRE_ParVectorCopy ( HYPRE_ParVector x, HYPRE_ParVector y );
@@ -798,6 +919,18 @@ HYPRE_Int hypre_GetAssumedPartitionRowRange ( MPI_Comm comm, HYPRE_Int proc_id,
                                               HYPRE_BigInt *row_end );
 HYPRE_Int hypre_ParVectorCreateAssumedPartition ( hypre_ParVector *vector );
 
+/* par_csr_binary.c */
+HYPRE_Int hypre_ParCSRMatrixPrintBinary ( hypre_ParCSRMatrix *matrix, const char *filename,
+                                          HYPRE_Int compress );
+HYPRE_Int hypre_ParCSRMatrixReadBinary ( MPI_Comm comm, const char *filename,
+                                         hypre_ParCSRMatrix **matrix_ptr );
+HYPRE_Int hypre_ParCSRMatrixMapBinary ( const char *filename, HYPRE_Int file_id,
+                                        hypre_ParCSRBinaryView **view_ptr );
+HYPRE_Int hypre_ParCSRBinaryViewDestroy ( hypre_ParCSRBinaryView *view );
+HYPRE_Int hypre_ParVectorPrintBinary ( hypre_ParVector *vector, const char *filename );
+HYPRE_Int hypre_ParVectorReadBinary ( MPI_Comm comm, const char *filename,
+                                      hypre_ParVector **vector_ptr );
+
 /* par_csr_bool_matop.c */
 hypre_ParCSRBooleanMatrix *hypre_ParBooleanMatmul ( hypre_ParCSRBooleanMatrix *A,
                                                     hypre_ParCSRBooleanMatrix *B );
@@ -870,6 +1003,8 @@ hypre_ParCSRCommPkgCreate(MPI_Comm comm, HYPRE_BigInt *col_map_offd, HYPRE_BigIn
                           hypre_ParCSRCommPkg *comm_pkg);
 HYPRE_Int hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_MatvecCommPkgDestroy ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRCommPkgCreateNeighborComm ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRCommPkgDestroyNeighborComm ( hypre_ParCSRCommPkg *comm_pkg );
 HYPRE_Int hypre_BuildCSRMatrixMPIDataType ( HYPRE_Int num_nonzeros, HYPRE_Int num_rows,
                                             HYPRE_Complex *a_data, HYPRE_Int *a_i, HYPRE_Int *a_j, hypre_MPI_Datatype *csr_matrix_datatype );
 HYPRE_Int hypre_BuildCSRJDataType ( HYPRE_Int num_nonzeros, HYPRE_Complex *a_data, HYPRE_Int *a_j,
@@ -879,6 +1014,24 @@ HYPRE_Int hypre_ParCSRFindExtendCommPkg(MPI_Comm comm, HYPRE_BigInt global_num_c
                                         hypre_IJAssumedPart *apart, HYPRE_Int indices_len, HYPRE_BigInt *indices,
                                         hypre_ParCSRCommPkg **extend_comm_pkg);
 
+/* par_csr_matmat_plan.c */
+HYPRE_Int hypre_ParCSRMatMatPlanCreate ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                         hypre_ParCSRMatMatPlan **plan_ptr, hypre_ParCSRMatrix **C_ptr );
+HYPRE_Int hypre_ParCSRMatMatPlanMatches ( hypre_ParCSRMatMatPlan *plan, hypre_ParCSRMatrix *A,
+                                          hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRMatMatPlanExecute ( hypre_ParCSRMatMatPlan *plan, hypre_ParCSRMatrix *A,
+                                          hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRMatMatPlanDestroy ( hypre_ParCSRMatMatPlan *plan );
+HYPRE_Int hypre_ParCSRRAPPlanCreate ( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A,
+                                      hypre_ParCSRMatrix *P, hypre_ParCSRRAPPlan **plan_ptr,
+                                      hypre_ParCSRMatrix **RAP_ptr );
+HYPRE_Int hypre_ParCSRRAPPlanMatches ( hypre_ParCSRRAPPlan *plan, hypre_ParCSRMatrix *A,
+                                       hypre_ParCSRMatrix *P, hypre_ParCSRMatrix *RAP );
+HYPRE_Int hypre_ParCSRRAPPlanExecute ( hypre_ParCSRRAPPlan *plan, hypre_ParCSRMatrix *A,
+                                       hypre_ParCSRMatrix *P, hypre_ParCSRMatrix *RAP );
+HYPRE_Int hypre_ParCSRRAPPlanUpdateR ( hypre_ParCSRRAPPlan *plan, hypre_ParCSRMatrix *R );
+HYPRE_Int hypre_ParCSRRAPPlanDestroy ( hypre_ParCSRRAPPlan *plan );
+
 /* par_csr_matop.c */
 HYPRE_Int hypre_ParCSRMatrixScale(hypre_ParCSRMatrix *A, HYPRE_Complex scalar);
 void hypre_ParMatmul_RowSizes ( HYPRE_MemoryLocation memory_location, HYPRE_Int **C_diag_i,
@@ -964,17 +1117,21 @@ HYPRE_Int hypre_ParCSRMatrixDropSmallEntriesDevice( hypre_ParCSRMatrix *A, HYPRE
 
 HYPRE_Int hypre_ParCSRCommPkgCreateMatrixE( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int local_ncols );
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreate(HYPRE_Int job,
                                                                          hypre_ParCSRCommPkg *comm_pkg);
+hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreate_v2(HYPRE_Int job,
+                                                                            hypre_ParCSRCommPkg *comm_pkg,
+                                                                            HYPRE_Int num_vectors);
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandle(HYPRE_Int job,
                                                                              hypre_ParCSRCommPkg *comm_pkg);
+hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandle_v2(HYPRE_Int job,
+                                                                                hypre_ParCSRCommPkg *comm_pkg,
+                                                                                HYPRE_Int num_vectors);
 void hypre_ParCSRPersistentCommHandleDestroy(hypre_ParCSRPersistentCommHandle *comm_handle);
 void hypre_ParCSRPersistentCommHandleStart(hypre_ParCSRPersistentCommHandle *comm_handle,
                                            HYPRE_MemoryLocation send_memory_location, void *send_data);
 void hypre_ParCSRPersistentCommHandleWait(hypre_ParCSRPersistentCommHandle *comm_handle,
                                           HYPRE_MemoryLocation recv_memory_location, void *recv_data);
-#endif
 
 HYPRE_Int hypre_ParcsrGetExternalRowsInit( hypre_ParCSRMatrix *A, HYPRE_Int indices_len,
                                            HYPRE_BigInt *indices, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int want_data, void **request_ptr);
@@ -1033,6 +1190,7 @@ HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumRownnz ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix, HYPRE_Int owns_data );
 HYPRE_Int hypre_ParCSRMatrixSetPatternOnly( hypre_ParCSRMatrix *matrix, HYPRE_Int pattern_only);
+HYPRE_Int hypre_ParCSRMatrixSetNeighborColl( hypre_ParCSRMatrix *matrix, HYPRE_Int neighbor_coll );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRead ( MPI_Comm comm, const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrint ( hypre_ParCSRMatrix *matrix, const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrintIJ ( const hypre_ParCSRMatrix *matrix, const HYPRE_Int base_i,
@@ -1064,7 +1222,10 @@ hypre_ParCSRMatrix* hypre_ParCSRMatrixClone_v2 ( hypre_ParCSRMatrix *A, HYPRE_In
                                                  HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_ParCSRMatrixMigrate(hypre_ParCSRMatrix *A, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_ParCSRMatrixSetConstantValues( hypre_ParCSRMatrix *A, HYPRE_Complex value );
+HYPRE_Int hypre_ParCSRMatrixConvertToFloat( hypre_ParCSRMatrix *A );
 void hypre_ParCSRMatrixCopyColMapOffdToDevice(hypre_ParCSRMatrix *A);
+HYPRE_Int hypre_ParCSRMatrixRedistribute ( hypre_ParCSRMatrix *A, HYPRE_Int group_size,
+                                          MPI_Comm *group_comm_ptr, hypre_ParCSRMatrix **A_new_ptr );
 
 /* par_csr_matvec.c */
 // y = alpha*A*x + beta*b
@@ -1073,6 +1234,10 @@ HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha, hypre_ParCSR
 // y = alpha*A*x + beta*y
 HYPRE_Int hypre_ParCSRMatrixMatvec ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A, hypre_ParVector *x,
                                      HYPRE_Complex beta, hypre_ParVector *y );
+// r = b - A*x, r_norm2 = <r,r>
+HYPRE_Int hypre_ParCSRMatrixResidualNorm ( hypre_ParCSRMatrix *A, hypre_ParVector *x,
+                                           hypre_ParVector *b, hypre_ParVector *r, HYPRE_Real *r_norm2,
+                                           hypre_MPI_Request *request );
 HYPRE_Int hypre_ParCSRMatrixMatvecT ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                       hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvecT_unpack( HYPRE_Int ncols, HYPRE_Complex *locl_data,
@@ -1139,10 +1304,22 @@ HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha, hypre_ParVector *x, hypre_P
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y,
                                     HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x, hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorInnerProdStart ( HYPRE_Int k, hypre_ParVector **x, hypre_ParVector **y,
+                                          HYPRE_Real *result, hypre_MPI_Request *request );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x, hypre_ParVector **y, HYPRE_Int k,
                                          HYPRE_Int unroll, HYPRE_Real *prod );
+HYPRE_Int hypre_ParVectorBlockInnerProd ( hypre_ParVector **x, HYPRE_Int kx, hypre_ParVector **y,
+                                          HYPRE_Int ky, HYPRE_Int unroll, HYPRE_Real *result );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x, hypre_ParVector *y, hypre_ParVector **z,
                                        HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x, HYPRE_Real *prod_y );
+HYPRE_Int hypre_ParVectorMultiInnerProd ( HYPRE_Int k, hypre_ParVector **x, hypre_ParVector *y,
+                                          HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorColumnInnerProd ( hypre_ParVector *x, hypre_ParVector *y,
+                                           HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorMultiAxpy ( HYPRE_Complex *alpha, hypre_ParVector *x, HYPRE_Complex beta,
+                                     hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorGetColumnView ( hypre_ParVector *x, HYPRE_Int k, hypre_ParVector *view,
+                                         hypre_Vector *view_local );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm, hypre_Vector *v,
                                            HYPRE_BigInt *vec_starts );
 hypre_Vector *hypre_ParVectorToVectorAll ( hypre_ParVector *par_v );
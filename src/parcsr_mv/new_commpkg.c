@@ -575,6 +575,8 @@ hypre_ParCSRCommPkgCreateApart
     * get commpkg info information
     *----------------------------------------------------------*/
 
+   hypre_OpCountsCommPkgBegin();
+
    hypre_ParCSRCommPkgCreateApart_core( comm, col_map_off_d, first_col_diag,
                                         num_cols_off_d, global_num_cols,
                                         &num_recvs, &recv_procs, &recv_vec_starts,
@@ -591,6 +593,8 @@ hypre_ParCSRCommPkgCreateApart
    hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = send_map_starts;
    hypre_ParCSRCommPkgSendMapElmts (comm_pkg) = send_map_elmts;
 
+   hypre_OpCountsCommPkgEnd();
+
    return hypre_error_flag;
 
 
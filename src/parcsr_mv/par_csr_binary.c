@@ -0,0 +1,1335 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Binary checkpoint files for hypre_ParCSRMatrix and hypre_ParVector.
+ *
+ * Every process writes one file "<name>.%05d" with a fixed header followed by
+ * aligned sections, and process 0 writes "<name>.index" with the row (and
+ * column) partitioning of all files.  For a matrix, the sections are
+ *
+ *    I     HYPRE_Int [num_rows + 1]       local row pointers
+ *    C     hypre_ulonglongint [chunks+1]  byte offsets of the chunks of J
+ *                                         (only for compressed files)
+ *    J     global column indices, diagonal block first in each row; either
+ *          raw HYPRE_BigInt or, if compressed, zigzag delta varints coded
+ *          independently for each chunk of chunk_size rows
+ *    Data  HYPRE_Complex [num_nonzeros]
+ *
+ * and for a vector just the Data section.  The files can be read back on any
+ * number of processes: each process reads only the row ranges of the files it
+ * overlaps and, for compressed files, decodes only the chunks it needs.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define HYPRE_BINARY_VERSION    1
+#define HYPRE_BINARY_ENDIAN     0x0102030405060708ULL
+#define HYPRE_BINARY_MATRIX     1
+#define HYPRE_BINARY_VECTOR     2
+#define HYPRE_BINARY_COMPRESSED 1
+#define HYPRE_BINARY_CHUNK_SIZE 4096
+#define HYPRE_BINARY_ALIGN      16
+
+typedef struct
+{
+   char                magic[8];
+   hypre_ulonglongint  endian;
+   hypre_ulonglongint  version;
+   hypre_ulonglongint  object_type;
+   hypre_ulonglongint  flags;
+   hypre_ulonglongint  size_int;
+   hypre_ulonglongint  size_bigint;
+   hypre_ulonglongint  size_complex;
+
+   hypre_ulonglongint  global_num_rows;
+   hypre_ulonglongint  global_num_cols;
+   hypre_ulonglongint  first_row;
+   hypre_ulonglongint  num_rows;
+   hypre_ulonglongint  first_col;
+   hypre_ulonglongint  num_cols;
+   hypre_ulonglongint  num_nonzeros;
+   hypre_ulonglongint  chunk_size;
+   hypre_ulonglongint  num_chunks;
+   hypre_ulonglongint  num_files;
+   hypre_ulonglongint  file_id;
+
+   /* byte offsets of the sections; in the index file, i_offset and j_offset
+      are the offsets of the row and column partitionings */
+   hypre_ulonglongint  i_offset;
+   hypre_ulonglongint  chunk_offset;
+   hypre_ulonglongint  j_offset;
+   hypre_ulonglongint  data_offset;
+   hypre_ulonglongint  file_size;
+
+} hypre_BinaryHeader;
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryAlign
+ *--------------------------------------------------------------------------*/
+
+static hypre_ulonglongint
+hypre_BinaryAlign( hypre_ulonglongint offset )
+{
+   return (offset + HYPRE_BINARY_ALIGN - 1) / HYPRE_BINARY_ALIGN * HYPRE_BINARY_ALIGN;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryHeaderInit
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BinaryHeaderInit( hypre_BinaryHeader *header,
+                        HYPRE_Int           object_type )
+{
+   memset(header, 0, sizeof(hypre_BinaryHeader));
+   memcpy(header -> magic, "hypreBIN", 8);
+   header -> endian       = HYPRE_BINARY_ENDIAN;
+   header -> version      = HYPRE_BINARY_VERSION;
+   header -> object_type  = (hypre_ulonglongint) object_type;
+   header -> size_int     = (hypre_ulonglongint) sizeof(HYPRE_Int);
+   header -> size_bigint  = (hypre_ulonglongint) sizeof(HYPRE_BigInt);
+   header -> size_complex = (hypre_ulonglongint) sizeof(HYPRE_Complex);
+   header -> i_offset     = hypre_BinaryAlign(sizeof(hypre_BinaryHeader));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryHeaderCheck
+ *
+ * Returns 0 if the header was written by a build with the same type sizes
+ * and byte order and describes an object of the given type.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryHeaderCheck( hypre_BinaryHeader *header,
+                         HYPRE_Int           object_type )
+{
+   if (memcmp(header -> magic, "hypreBIN", 8) ||
+       header -> endian       != HYPRE_BINARY_ENDIAN ||
+       header -> version      != HYPRE_BINARY_VERSION ||
+       header -> object_type  != (hypre_ulonglongint) object_type ||
+       header -> size_int     != (hypre_ulonglongint) sizeof(HYPRE_Int) ||
+       header -> size_bigint  != (hypre_ulonglongint) sizeof(HYPRE_BigInt) ||
+       header -> size_complex != (hypre_ulonglongint) sizeof(HYPRE_Complex))
+   {
+      return 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryWriteAt
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryWriteAt( FILE               *file,
+                     hypre_ulonglongint  offset,
+                     const void         *buffer,
+                     size_t              size )
+{
+   if (!size)
+   {
+      return 0;
+   }
+   if (fseek(file, (long) offset, SEEK_SET) || fwrite(buffer, 1, size, file) != size)
+   {
+      return 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryReadAt
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryReadAt( FILE               *file,
+                    hypre_ulonglongint  offset,
+                    void               *buffer,
+                    size_t              size )
+{
+   if (!size)
+   {
+      return 0;
+   }
+   if (fseek(file, (long) offset, SEEK_SET) || fread(buffer, 1, size, file) != size)
+   {
+      return 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryEncodeChunk
+ *
+ * Codes the column indices of num_rows rows as zigzag varints of the
+ * difference to the previous column of the row (to the row index for the
+ * first entry).  Returns the number of bytes; buffer may be NULL to count.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ulonglongint
+hypre_BinaryEncodeChunk( HYPRE_BigInt   first_row,
+                         HYPRE_Int      num_rows,
+                         HYPRE_Int     *a_i,
+                         HYPRE_BigInt  *big_j,
+                         unsigned char *buffer )
+{
+   hypre_ulonglongint  num_bytes = 0;
+   hypre_ulonglongint  z;
+   long long           prev, delta;
+   HYPRE_Int           i, j;
+
+   for (i = 0; i < num_rows; i++)
+   {
+      prev = (long long) (first_row + (HYPRE_BigInt) i);
+      for (j = a_i[i]; j < a_i[i + 1]; j++)
+      {
+         delta = (long long) big_j[j] - prev;
+         prev  = (long long) big_j[j];
+         z = ((hypre_ulonglongint) delta << 1) ^ (hypre_ulonglongint) (delta >> 63);
+         while (z >= 0x80)
+         {
+            if (buffer)
+            {
+               buffer[num_bytes] = (unsigned char) (z | 0x80);
+            }
+            num_bytes++;
+            z >>= 7;
+         }
+         if (buffer)
+         {
+            buffer[num_bytes] = (unsigned char) z;
+         }
+         num_bytes++;
+      }
+   }
+
+   return num_bytes;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryDecodeChunk
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BinaryDecodeChunk( HYPRE_BigInt         first_row,
+                         HYPRE_Int            num_rows,
+                         HYPRE_Int           *a_i,
+                         const unsigned char *buffer,
+                         HYPRE_BigInt        *big_j )
+{
+   hypre_ulonglongint  z;
+   long long           prev, delta;
+   HYPRE_Int           i, j, shift;
+
+   for (i = 0; i < num_rows; i++)
+   {
+      prev = (long long) (first_row + (HYPRE_BigInt) i);
+      for (j = a_i[i]; j < a_i[i + 1]; j++)
+      {
+         z = 0;
+         shift = 0;
+         while (*buffer & 0x80)
+         {
+            z |= (hypre_ulonglongint) (*buffer++ & 0x7f) << shift;
+            shift += 7;
+         }
+         z |= (hypre_ulonglongint) (*buffer++) << shift;
+         delta = (long long) (z >> 1) ^ -((long long) (z & 1));
+         prev += delta;
+         big_j[j - a_i[0]] = (HYPRE_BigInt) prev;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryDecodeChunks
+ *
+ * Decodes the chunks of a compressed J section.  a_i holds the row pointers
+ * of all rows of the chunks, with a_i[0] the first entry of the first chunk.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BinaryDecodeChunks( HYPRE_BigInt         first_row,
+                          HYPRE_Int            num_rows,
+                          HYPRE_Int            chunk_size,
+                          HYPRE_Int           *a_i,
+                          hypre_ulonglongint  *chunk_ptr,
+                          const unsigned char *buffer,
+                          HYPRE_BigInt        *big_j )
+{
+   HYPRE_Int num_chunks = (num_rows + chunk_size - 1) / chunk_size;
+   HYPRE_Int c, row, nrows;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(c, row, nrows) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      row   = c * chunk_size;
+      nrows = hypre_min(chunk_size, num_rows - row);
+      hypre_BinaryDecodeChunk(first_row + (HYPRE_BigInt) row, nrows, a_i + row,
+                              buffer + (chunk_ptr[c] - chunk_ptr[0]),
+                              big_j + (a_i[row] - a_i[0]));
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryWriteIndex
+ *
+ * Gathers the first row (and column) of every file and writes the index
+ * file on process 0.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryWriteIndex( MPI_Comm            comm,
+                        const char         *filename,
+                        hypre_BinaryHeader *header,
+                        HYPRE_BigInt        first_row,
+                        HYPRE_BigInt        first_col )
+{
+   hypre_BinaryHeader  index;
+   HYPRE_BigInt        firsts[2];
+   HYPRE_BigInt       *all_firsts = NULL;
+   HYPRE_BigInt       *starts = NULL;
+   HYPRE_Int           num_procs, my_id, p, num_parts;
+   char                new_filename[1024];
+   FILE               *file;
+   HYPRE_Int           ierr = 0;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   num_parts = (header -> object_type == HYPRE_BINARY_MATRIX) ? 2 : 1;
+   firsts[0] = first_row;
+   firsts[1] = first_col;
+   if (my_id == 0)
+   {
+      all_firsts = hypre_TAlloc(HYPRE_BigInt, 2 * num_procs, HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gather(firsts, 2, HYPRE_MPI_BIG_INT, all_firsts, 2, HYPRE_MPI_BIG_INT, 0, comm);
+
+   if (my_id == 0)
+   {
+      /* row starts followed by column starts, each of length num_files + 1 */
+      starts = hypre_TAlloc(HYPRE_BigInt, 2 * (num_procs + 1), HYPRE_MEMORY_HOST);
+      for (p = 0; p < num_procs; p++)
+      {
+         starts[p] = all_firsts[2 * p];
+         starts[num_procs + 1 + p] = all_firsts[2 * p + 1];
+      }
+      starts[num_procs] = (HYPRE_BigInt) header -> global_num_rows;
+      starts[2 * num_procs + 1] = (HYPRE_BigInt) header -> global_num_cols;
+
+      index = *header;
+      index.first_row    = 0;
+      index.num_rows     = header -> global_num_rows;
+      index.first_col    = 0;
+      index.num_cols     = header -> global_num_cols;
+      index.num_nonzeros = 0;
+      index.num_chunks   = 0;
+      index.file_id      = 0;
+      index.chunk_offset = 0;
+      index.data_offset  = 0;
+      index.j_offset     = index.i_offset + (num_procs + 1) * sizeof(HYPRE_BigInt);
+      index.file_size    = index.i_offset + num_parts * (num_procs + 1) * sizeof(HYPRE_BigInt);
+
+      hypre_sprintf(new_filename, "%s.index", filename);
+      if ((file = fopen(new_filename, "wb")) == NULL)
+      {
+         ierr = 1;
+      }
+      else
+      {
+         ierr  = hypre_BinaryWriteAt(file, 0, &index, sizeof(hypre_BinaryHeader));
+         ierr |= hypre_BinaryWriteAt(file, index.i_offset, starts,
+                                     num_parts * (num_procs + 1) * sizeof(HYPRE_BigInt));
+         fclose(file);
+      }
+
+      hypre_TFree(all_firsts, HYPRE_MEMORY_HOST);
+      hypre_TFree(starts, HYPRE_MEMORY_HOST);
+   }
+
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't write binary index file\n");
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryReadIndex
+ *
+ * Reads the index file on process 0 and broadcasts it.  Returns the header
+ * and the row (and column) starts of the files; starts is NULL on error.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryReadIndex( MPI_Comm             comm,
+                       const char          *filename,
+                       HYPRE_Int            object_type,
+                       hypre_BinaryHeader  *header,
+                       HYPRE_BigInt       **starts_ptr )
+{
+   HYPRE_BigInt  *starts = NULL;
+   HYPRE_Int      my_id, num_files, num_parts;
+   char           new_filename[1024];
+   FILE          *file = NULL;
+   HYPRE_Int      ierr = 0;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   num_parts = (object_type == HYPRE_BINARY_MATRIX) ? 2 : 1;
+
+   if (my_id == 0)
+   {
+      hypre_sprintf(new_filename, "%s.index", filename);
+      if ((file = fopen(new_filename, "rb")) == NULL ||
+          hypre_BinaryReadAt(file, 0, header, sizeof(hypre_BinaryHeader)) ||
+          hypre_BinaryHeaderCheck(header, object_type))
+      {
+         ierr = 1;
+      }
+   }
+   hypre_MPI_Bcast(&ierr, 1, HYPRE_MPI_INT, 0, comm);
+   if (ierr)
+   {
+      if (file)
+      {
+         fclose(file);
+      }
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't read binary index file\n");
+      *starts_ptr = NULL;
+      return hypre_error_flag;
+   }
+   hypre_MPI_Bcast(header, (HYPRE_Int) sizeof(hypre_BinaryHeader), hypre_MPI_BYTE, 0, comm);
+
+   num_files = (HYPRE_Int) header -> num_files;
+   starts = hypre_TAlloc(HYPRE_BigInt, num_parts * (num_files + 1), HYPRE_MEMORY_HOST);
+   if (my_id == 0)
+   {
+      ierr = hypre_BinaryReadAt(file, header -> i_offset, starts,
+                                num_parts * (num_files + 1) * sizeof(HYPRE_BigInt));
+      fclose(file);
+   }
+   hypre_MPI_Bcast(&ierr, 1, HYPRE_MPI_INT, 0, comm);
+   if (ierr)
+   {
+      hypre_TFree(starts, HYPRE_MEMORY_HOST);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't read binary index file\n");
+      *starts_ptr = NULL;
+      return hypre_error_flag;
+   }
+   hypre_MPI_Bcast(starts, num_parts * (num_files + 1), HYPRE_MPI_BIG_INT, 0, comm);
+
+   *starts_ptr = starts;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryLocalRange
+ *
+ * Keeps the partitioning of the files if they were written by as many
+ * processes as there are now, and splits the range evenly otherwise.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BinaryLocalRange( MPI_Comm      comm,
+                        HYPRE_BigInt  global_size,
+                        HYPRE_Int     num_files,
+                        HYPRE_BigInt *file_starts,
+                        HYPRE_BigInt *starts )
+{
+   HYPRE_Int num_procs, my_id;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (num_procs == num_files)
+   {
+      starts[0] = file_starts[my_id];
+      starts[1] = file_starts[my_id + 1];
+   }
+   else
+   {
+      hypre_GenerateLocalPartitioning(global_size, num_procs, my_id, starts);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryOpenFile
+ *--------------------------------------------------------------------------*/
+
+static FILE *
+hypre_BinaryOpenFile( const char         *filename,
+                      HYPRE_Int           file_id,
+                      HYPRE_Int           object_type,
+                      hypre_BinaryHeader *header )
+{
+   char  new_filename[1024];
+   FILE *file;
+
+   hypre_sprintf(new_filename, "%s.%05d", filename, file_id);
+   if ((file = fopen(new_filename, "rb")) == NULL)
+   {
+      return NULL;
+   }
+   if (hypre_BinaryReadAt(file, 0, header, sizeof(hypre_BinaryHeader)) ||
+       hypre_BinaryHeaderCheck(header, object_type))
+   {
+      fclose(file);
+      return NULL;
+   }
+
+   return file;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixBinaryRowsRead
+ *
+ * Reads rows lo <= i < hi of an open matrix file.  The row pointers are
+ * written to a_i[0..hi-lo] relative to a_i[0], which is left unchanged, and
+ * the entries to big_j and data starting at position a_i[0].
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixBinaryRowsRead( FILE               *file,
+                                  hypre_BinaryHeader *header,
+                                  HYPRE_Int           lo,
+                                  HYPRE_Int           hi,
+                                  HYPRE_Int          *a_i,
+                                  HYPRE_BigInt      **big_j_ptr,
+                                  HYPRE_Complex     **data_ptr )
+{
+   HYPRE_Int           num_rows   = (HYPRE_Int) header -> num_rows;
+   HYPRE_Int           chunk_size = (HYPRE_Int) header -> chunk_size;
+   HYPRE_Int           offset     = a_i[0];
+   HYPRE_Int          *file_i;
+   HYPRE_Int           c_lo, c_hi, c_first, c_last, first_nnz, nnz, i;
+   hypre_ulonglongint *chunk_ptr;
+   unsigned char      *buffer;
+   HYPRE_BigInt       *chunk_j;
+   HYPRE_Int           ierr = 0;
+
+   /* for compressed files, read the row pointers of the covering chunks */
+   if (header -> flags & HYPRE_BINARY_COMPRESSED)
+   {
+      c_first = lo / chunk_size;
+      c_last  = (hi - 1) / chunk_size;
+      c_lo    = c_first * chunk_size;
+      c_hi    = hypre_min((c_last + 1) * chunk_size, num_rows);
+   }
+   else
+   {
+      c_first = c_last = 0;
+      c_lo    = lo;
+      c_hi    = hi;
+   }
+
+   file_i = hypre_TAlloc(HYPRE_Int, c_hi - c_lo + 1, HYPRE_MEMORY_HOST);
+   ierr = hypre_BinaryReadAt(file, header -> i_offset + c_lo * sizeof(HYPRE_Int),
+                             file_i, (c_hi - c_lo + 1) * sizeof(HYPRE_Int));
+   if (ierr)
+   {
+      hypre_TFree(file_i, HYPRE_MEMORY_HOST);
+      return ierr;
+   }
+
+   first_nnz = file_i[lo - c_lo];
+   nnz       = file_i[hi - c_lo] - first_nnz;
+   for (i = 0; i <= hi - lo; i++)
+   {
+      a_i[i] = offset + file_i[lo - c_lo + i] - first_nnz;
+   }
+
+   *big_j_ptr = hypre_TReAlloc(*big_j_ptr, HYPRE_BigInt, offset + nnz, HYPRE_MEMORY_HOST);
+   *data_ptr  = hypre_TReAlloc(*data_ptr, HYPRE_Complex, offset + nnz, HYPRE_MEMORY_HOST);
+
+   ierr = hypre_BinaryReadAt(file, header -> data_offset + first_nnz * sizeof(HYPRE_Complex),
+                             *data_ptr + offset, nnz * sizeof(HYPRE_Complex));
+
+   if (!(header -> flags & HYPRE_BINARY_COMPRESSED))
+   {
+      ierr |= hypre_BinaryReadAt(file, header -> j_offset + first_nnz * sizeof(HYPRE_BigInt),
+                                 *big_j_ptr + offset, nnz * sizeof(HYPRE_BigInt));
+   }
+   else if (!ierr)
+   {
+      chunk_ptr = hypre_TAlloc(hypre_ulonglongint, c_last - c_first + 2, HYPRE_MEMORY_HOST);
+      ierr = hypre_BinaryReadAt(file, header -> chunk_offset + c_first * sizeof(hypre_ulonglongint),
+                                chunk_ptr, (c_last - c_first + 2) * sizeof(hypre_ulonglongint));
+      if (!ierr)
+      {
+         buffer  = hypre_TAlloc(unsigned char, chunk_ptr[c_last - c_first + 1] - chunk_ptr[0],
+                                HYPRE_MEMORY_HOST);
+         chunk_j = hypre_TAlloc(HYPRE_BigInt, file_i[c_hi - c_lo] - file_i[0], HYPRE_MEMORY_HOST);
+         ierr = hypre_BinaryReadAt(file, header -> j_offset + chunk_ptr[0], buffer,
+                                   chunk_ptr[c_last - c_first + 1] - chunk_ptr[0]);
+         if (!ierr)
+         {
+            hypre_BinaryDecodeChunks((HYPRE_BigInt) header -> first_row + (HYPRE_BigInt) c_lo,
+                                     c_hi - c_lo, chunk_size, file_i, chunk_ptr, buffer, chunk_j);
+            hypre_TMemcpy(*big_j_ptr + offset, chunk_j + (first_nnz - file_i[0]), HYPRE_BigInt, nnz,
+                          HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+         hypre_TFree(chunk_j, HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(chunk_ptr, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(file_i, HYPRE_MEMORY_HOST);
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixBinaryBuild
+ *
+ * Creates a ParCSR matrix from local rows with global column indices.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRMatrix *
+hypre_ParCSRMatrixBinaryBuild( MPI_Comm       comm,
+                               HYPRE_BigInt   global_num_rows,
+                               HYPRE_BigInt   global_num_cols,
+                               HYPRE_BigInt  *row_starts,
+                               HYPRE_BigInt  *col_starts,
+                               HYPRE_Int     *a_i,
+                               HYPRE_BigInt  *big_j,
+                               HYPRE_Complex *data )
+{
+   HYPRE_Int           num_rows = (HYPRE_Int) (row_starts[1] - row_starts[0]);
+   HYPRE_BigInt        first_col = col_starts[0];
+   HYPRE_BigInt        last_col  = col_starts[1] - 1;
+   hypre_ParCSRMatrix *matrix;
+   hypre_CSRMatrix    *diag, *offd;
+   HYPRE_Int          *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex      *diag_data, *offd_data;
+   HYPRE_BigInt       *col_map_offd, *offd_cols;
+   HYPRE_BigInt        row, col;
+   HYPRE_Complex       value;
+   HYPRE_Int           num_cols_offd, nnz_diag, nnz_offd;
+   HYPRE_Int           i, j, k, jd, jo, first;
+
+   /* count diagonal and off-diagonal entries */
+   diag_i = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   offd_i = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, j, col) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      for (j = a_i[i]; j < a_i[i + 1]; j++)
+      {
+         col = big_j[j];
+         if (col < first_col || col > last_col)
+         {
+            offd_i[i + 1]++;
+         }
+         else
+         {
+            diag_i[i + 1]++;
+         }
+      }
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      diag_i[i + 1] += diag_i[i];
+      offd_i[i + 1] += offd_i[i];
+   }
+   nnz_diag = diag_i[num_rows];
+   nnz_offd = offd_i[num_rows];
+
+   /* sorted off-diagonal columns */
+   offd_cols = hypre_TAlloc(HYPRE_BigInt, nnz_offd, HYPRE_MEMORY_HOST);
+   for (i = 0, k = 0; i < num_rows; i++)
+   {
+      for (j = a_i[i]; j < a_i[i + 1]; j++)
+      {
+         col = big_j[j];
+         if (col < first_col || col > last_col)
+         {
+            offd_cols[k++] = col;
+         }
+      }
+   }
+   num_cols_offd = 0;
+   if (nnz_offd)
+   {
+      hypre_BigQsort0(offd_cols, 0, nnz_offd - 1);
+      for (k = 1; k < nnz_offd; k++)
+      {
+         if (offd_cols[k] > offd_cols[num_cols_offd])
+         {
+            offd_cols[++num_cols_offd] = offd_cols[k];
+         }
+      }
+      num_cols_offd++;
+   }
+
+   matrix = hypre_ParCSRMatrixCreate(comm, global_num_rows, global_num_cols,
+                                     row_starts, col_starts, num_cols_offd,
+                                     nnz_diag, nnz_offd);
+   hypre_ParCSRMatrixInitialize_v2(matrix, HYPRE_MEMORY_HOST);
+
+   diag = hypre_ParCSRMatrixDiag(matrix);
+   offd = hypre_ParCSRMatrixOffd(matrix);
+   col_map_offd = hypre_ParCSRMatrixColMapOffd(matrix);
+   hypre_TMemcpy(col_map_offd, offd_cols, HYPRE_BigInt, num_cols_offd,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_cols, HYPRE_MEMORY_HOST);
+
+   hypre_TMemcpy(hypre_CSRMatrixI(diag), diag_i, HYPRE_Int, num_rows + 1,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_CSRMatrixI(offd), offd_i, HYPRE_Int, num_rows + 1,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   diag_j    = hypre_CSRMatrixJ(diag);
+   diag_data = hypre_CSRMatrixData(diag);
+   offd_j    = hypre_CSRMatrixJ(offd);
+   offd_data = hypre_CSRMatrixData(offd);
+
+   /* fill the rows; the diagonal entry goes first in diag */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, j, jd, jo, row, col, first, value) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      row = row_starts[0] + (HYPRE_BigInt) i;
+      jd  = diag_i[i];
+      jo  = offd_i[i];
+      for (j = a_i[i]; j < a_i[i + 1]; j++)
+      {
+         col = big_j[j];
+         if (col < first_col || col > last_col)
+         {
+            offd_j[jo]      = hypre_BigBinarySearch(col_map_offd, col, num_cols_offd);
+            offd_data[jo++] = data[j];
+         }
+         else
+         {
+            diag_j[jd]      = (HYPRE_Int) (col - first_col);
+            diag_data[jd++] = data[j];
+         }
+      }
+
+      first = diag_i[i];
+      for (jd = first; jd < diag_i[i + 1]; jd++)
+      {
+         if ((HYPRE_BigInt) diag_j[jd] + first_col == row)
+         {
+            diag_j[jd]       = diag_j[first];
+            diag_j[first]    = (HYPRE_Int) (row - first_col);
+            value            = diag_data[jd];
+            diag_data[jd]    = diag_data[first];
+            diag_data[first] = value;
+            break;
+         }
+      }
+   }
+
+   hypre_TFree(diag_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_i, HYPRE_MEMORY_HOST);
+
+   return matrix;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPrintBinary
+ *
+ * Writes the matrix to "<filename>.%05d" on every process and the index
+ * "<filename>.index" on process 0.  If compress is nonzero, the column
+ * indices are stored as delta varints in chunks of rows.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixPrintBinary( hypre_ParCSRMatrix *matrix,
+                               const char         *filename,
+                               HYPRE_Int           compress )
+{
+   MPI_Comm              comm;
+   hypre_ParCSRMatrix   *h_matrix;
+   hypre_CSRMatrix      *diag, *offd;
+   HYPRE_Int            *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex        *diag_data, *offd_data;
+   HYPRE_BigInt         *col_map_offd;
+   HYPRE_BigInt          first_row, first_col;
+   HYPRE_Int             num_procs, my_id;
+   HYPRE_Int             num_rows, num_nonzeros, num_chunks, chunk_size;
+   HYPRE_Int             i, j, k, c, row;
+   HYPRE_Int            *a_i;
+   HYPRE_BigInt         *big_j;
+   HYPRE_Complex        *data;
+   hypre_ulonglongint   *chunk_ptr = NULL;
+   unsigned char        *buffer = NULL;
+   hypre_ulonglongint    j_size;
+   hypre_BinaryHeader    header;
+   char                  new_filename[1024];
+   FILE                 *file;
+   HYPRE_Int             ierr;
+
+   HYPRE_MemoryLocation  memory_location;
+
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   /* Create temporary matrix on host memory if needed */
+   memory_location = hypre_ParCSRMatrixMemoryLocation(matrix);
+   if (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST)
+   {
+      h_matrix = matrix;
+   }
+   else
+   {
+      h_matrix = hypre_ParCSRMatrixClone_v2(matrix, 1, HYPRE_MEMORY_HOST);
+   }
+
+   comm         = hypre_ParCSRMatrixComm(h_matrix);
+   diag         = hypre_ParCSRMatrixDiag(h_matrix);
+   offd         = hypre_ParCSRMatrixOffd(h_matrix);
+   col_map_offd = hypre_ParCSRMatrixColMapOffd(h_matrix);
+   first_row    = hypre_ParCSRMatrixFirstRowIndex(h_matrix);
+   first_col    = hypre_ParCSRMatrixFirstColDiag(h_matrix);
+   num_rows     = hypre_CSRMatrixNumRows(diag);
+   diag_i       = hypre_CSRMatrixI(diag);
+   diag_j       = hypre_CSRMatrixJ(diag);
+   diag_data    = hypre_CSRMatrixData(diag);
+   offd_i       = hypre_CSRMatrixI(offd);
+   offd_j       = hypre_CSRMatrixJ(offd);
+   offd_data    = hypre_CSRMatrixData(offd);
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   /* merge diag and offd into rows with global column indices */
+   a_i = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i <= num_rows; i++)
+   {
+      a_i[i] = diag_i[i] + offd_i[i];
+   }
+   num_nonzeros = a_i[num_rows];
+   big_j = hypre_TAlloc(HYPRE_BigInt, num_nonzeros, HYPRE_MEMORY_HOST);
+   data  = hypre_TAlloc(HYPRE_Complex, num_nonzeros, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, j, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      k = a_i[i];
+      for (j = diag_i[i]; j < diag_i[i + 1]; j++, k++)
+      {
+         big_j[k] = first_col + (HYPRE_BigInt) diag_j[j];
+         data[k]  = diag_data[j];
+      }
+      for (j = offd_i[i]; j < offd_i[i + 1]; j++, k++)
+      {
+         big_j[k] = col_map_offd[offd_j[j]];
+         data[k]  = offd_data[j];
+      }
+   }
+
+   /* code the column indices chunk by chunk */
+   chunk_size = HYPRE_BINARY_CHUNK_SIZE;
+   num_chunks = (num_rows + chunk_size - 1) / chunk_size;
+   if (compress)
+   {
+      chunk_ptr = hypre_CTAlloc(hypre_ulonglongint, num_chunks + 1, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(c, row) HYPRE_SMP_SCHEDULE
+#endif
+      for (c = 0; c < num_chunks; c++)
+      {
+         row = c * chunk_size;
+         chunk_ptr[c + 1] = hypre_BinaryEncodeChunk(first_row + (HYPRE_BigInt) row,
+                                                    hypre_min(chunk_size, num_rows - row),
+                                                    a_i + row, big_j, NULL);
+      }
+      for (c = 0; c < num_chunks; c++)
+      {
+         chunk_ptr[c + 1] += chunk_ptr[c];
+      }
+      buffer = hypre_TAlloc(unsigned char, chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(c, row) HYPRE_SMP_SCHEDULE
+#endif
+      for (c = 0; c < num_chunks; c++)
+      {
+         row = c * chunk_size;
+         hypre_BinaryEncodeChunk(first_row + (HYPRE_BigInt) row,
+                                 hypre_min(chunk_size, num_rows - row),
+                                 a_i + row, big_j, buffer + chunk_ptr[c]);
+      }
+      j_size = chunk_ptr[num_chunks];
+   }
+   else
+   {
+      j_size = (hypre_ulonglongint) num_nonzeros * sizeof(HYPRE_BigInt);
+   }
+
+   hypre_BinaryHeaderInit(&header, HYPRE_BINARY_MATRIX);
+   header.flags           = compress ? HYPRE_BINARY_COMPRESSED : 0;
+   header.global_num_rows = (hypre_ulonglongint) hypre_ParCSRMatrixGlobalNumRows(h_matrix);
+   header.global_num_cols = (hypre_ulonglongint) hypre_ParCSRMatrixGlobalNumCols(h_matrix);
+   header.first_row       = (hypre_ulonglongint) first_row;
+   header.num_rows        = (hypre_ulonglongint) num_rows;
+   header.first_col       = (hypre_ulonglongint) first_col;
+   header.num_cols        = (hypre_ulonglongint) hypre_CSRMatrixNumCols(diag);
+   header.num_nonzeros    = (hypre_ulonglongint) num_nonzeros;
+   header.chunk_size      = (hypre_ulonglongint) chunk_size;
+   header.num_chunks      = (hypre_ulonglongint) num_chunks;
+   header.num_files       = (hypre_ulonglongint) num_procs;
+   header.file_id         = (hypre_ulonglongint) my_id;
+   header.chunk_offset    = hypre_BinaryAlign(header.i_offset + (num_rows + 1) * sizeof(HYPRE_Int));
+   header.j_offset        = hypre_BinaryAlign(header.chunk_offset +
+                                              (compress ? (num_chunks + 1) * sizeof(hypre_ulonglongint) : 0));
+   header.data_offset     = hypre_BinaryAlign(header.j_offset + j_size);
+   header.file_size       = header.data_offset + num_nonzeros * sizeof(HYPRE_Complex);
+
+   hypre_sprintf(new_filename, "%s.%05d", filename, my_id);
+   if ((file = fopen(new_filename, "wb")) == NULL)
+   {
+      ierr = 1;
+   }
+   else
+   {
+      ierr  = hypre_BinaryWriteAt(file, 0, &header, sizeof(hypre_BinaryHeader));
+      ierr |= hypre_BinaryWriteAt(file, header.i_offset, a_i, (num_rows + 1) * sizeof(HYPRE_Int));
+      if (compress)
+      {
+         ierr |= hypre_BinaryWriteAt(file, header.chunk_offset, chunk_ptr,
+                                     (num_chunks + 1) * sizeof(hypre_ulonglongint));
+         ierr |= hypre_BinaryWriteAt(file, header.j_offset, buffer, j_size);
+      }
+      else
+      {
+         ierr |= hypre_BinaryWriteAt(file, header.j_offset, big_j, j_size);
+      }
+      ierr |= hypre_BinaryWriteAt(file, header.data_offset, data,
+                                  num_nonzeros * sizeof(HYPRE_Complex));
+      fclose(file);
+   }
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't write binary matrix file\n");
+   }
+
+   hypre_BinaryWriteIndex(comm, filename, &header, first_row, first_col);
+
+   hypre_TFree(a_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(big_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(data, HYPRE_MEMORY_HOST);
+   hypre_TFree(chunk_ptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+
+   /* Free temporary matrix */
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      hypre_ParCSRMatrixDestroy(h_matrix);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixReadBinary
+ *
+ * Reads a matrix written by hypre_ParCSRMatrixPrintBinary.  If the number
+ * of processes differs from the number of files, rows and columns are
+ * partitioned evenly.  The matrix is created in host memory.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixReadBinary( MPI_Comm             comm,
+                              const char          *filename,
+                              hypre_ParCSRMatrix **matrix_ptr )
+{
+   hypre_BinaryHeader   index, header;
+   HYPRE_BigInt        *file_starts;
+   HYPRE_BigInt        *file_rows, *file_cols;
+   HYPRE_BigInt         global_num_rows, global_num_cols;
+   HYPRE_BigInt         row_starts[2], col_starts[2];
+   HYPRE_Int            num_files, num_rows, f, lo, hi, row;
+   HYPRE_Int           *a_i;
+   HYPRE_BigInt        *big_j = NULL;
+   HYPRE_Complex       *data = NULL;
+   FILE                *file;
+   HYPRE_Int            ierr = 0, ierr_global;
+
+   if (!matrix_ptr)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+   *matrix_ptr = NULL;
+
+   hypre_BinaryReadIndex(comm, filename, HYPRE_BINARY_MATRIX, &index, &file_starts);
+   if (!file_starts)
+   {
+      return hypre_error_flag;
+   }
+
+   num_files       = (HYPRE_Int) index.num_files;
+   global_num_rows = (HYPRE_BigInt) index.global_num_rows;
+   global_num_cols = (HYPRE_BigInt) index.global_num_cols;
+   file_rows       = file_starts;
+   file_cols       = file_starts + num_files + 1;
+
+   hypre_BinaryLocalRange(comm, global_num_rows, num_files, file_rows, row_starts);
+   hypre_BinaryLocalRange(comm, global_num_cols, num_files, file_cols, col_starts);
+   num_rows = (HYPRE_Int) (row_starts[1] - row_starts[0]);
+
+   /* read the rows of all files overlapping the local range */
+   a_i = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   for (f = 0; f < num_files && !ierr; f++)
+   {
+      if (file_rows[f + 1] <= row_starts[0] || file_rows[f] >= row_starts[1] ||
+          file_rows[f + 1] == file_rows[f])
+      {
+         continue;
+      }
+      if ((file = hypre_BinaryOpenFile(filename, f, HYPRE_BINARY_MATRIX, &header)) == NULL)
+      {
+         ierr = 1;
+         break;
+      }
+      lo  = (HYPRE_Int) (hypre_max(row_starts[0], file_rows[f]) - file_rows[f]);
+      hi  = (HYPRE_Int) (hypre_min(row_starts[1], file_rows[f + 1]) - file_rows[f]);
+      row = (HYPRE_Int) (file_rows[f] + lo - row_starts[0]);
+      ierr = hypre_ParCSRMatrixBinaryRowsRead(file, &header, lo, hi, a_i + row, &big_j, &data);
+      fclose(file);
+   }
+
+   /* building the matrix is collective, so all ranks have to fail together */
+   hypre_MPI_Allreduce(&ierr, &ierr_global, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (ierr_global)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't read binary matrix file\n");
+   }
+   else
+   {
+      *matrix_ptr = hypre_ParCSRMatrixBinaryBuild(comm, global_num_rows, global_num_cols,
+                                                  row_starts, col_starts, a_i, big_j, data);
+   }
+
+   hypre_TFree(file_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(a_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(big_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMapBinary
+ *
+ * Maps the matrix file of one process into memory.  The local rows are
+ * returned as a CSR matrix with global column indices in BigJ whose row
+ * pointers and values point directly into the mapping, as do the column
+ * indices of an uncompressed file.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixMapBinary( const char              *filename,
+                             HYPRE_Int                file_id,
+                             hypre_ParCSRBinaryView **view_ptr )
+{
+#if !defined(_WIN32)
+   hypre_ParCSRBinaryView  *view;
+   hypre_BinaryHeader      *header;
+   hypre_CSRMatrix         *local;
+   char                     new_filename[1024];
+   struct stat              st;
+   void                    *addr;
+   unsigned char           *base;
+   HYPRE_Int               *a_i;
+   HYPRE_Int                num_rows, num_cols;
+   int                      fd;
+
+   if (!view_ptr)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+   *view_ptr = NULL;
+
+   hypre_sprintf(new_filename, "%s.%05d", filename, file_id);
+   if ((fd = open(new_filename, O_RDONLY)) < 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open binary matrix file\n");
+      return hypre_error_flag;
+   }
+   if (fstat(fd, &st) || (size_t) st.st_size < sizeof(hypre_BinaryHeader))
+   {
+      close(fd);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't read binary matrix file\n");
+      return hypre_error_flag;
+   }
+
+   /* private mapping: changes to the values do not reach the file */
+   addr = mmap(NULL, (size_t) st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if (addr == MAP_FAILED)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't map binary matrix file\n");
+      return hypre_error_flag;
+   }
+
+   base   = (unsigned char *) addr;
+   header = (hypre_BinaryHeader *) addr;
+   if (hypre_BinaryHeaderCheck(header, HYPRE_BINARY_MATRIX) ||
+       header -> file_size > (hypre_ulonglongint) st.st_size)
+   {
+      munmap(addr, (size_t) st.st_size);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: invalid binary matrix file\n");
+      return hypre_error_flag;
+   }
+
+   num_rows = (HYPRE_Int) header -> num_rows;
+   num_cols = (HYPRE_Int) header -> global_num_cols;
+   a_i      = (HYPRE_Int *) (base + header -> i_offset);
+
+   local = hypre_CSRMatrixCreate(num_rows, num_cols, (HYPRE_Int) header -> num_nonzeros);
+   hypre_CSRMatrixMemoryLocation(local) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixOwnsData(local)       = 0;
+   hypre_CSRMatrixI(local)              = a_i;
+   hypre_CSRMatrixData(local)           = (HYPRE_Complex *) (base + header -> data_offset);
+
+   view = hypre_CTAlloc(hypre_ParCSRBinaryView, 1, HYPRE_MEMORY_HOST);
+   view -> addr            = addr;
+   view -> length          = (size_t) st.st_size;
+   view -> global_num_rows = (HYPRE_BigInt) header -> global_num_rows;
+   view -> global_num_cols = (HYPRE_BigInt) header -> global_num_cols;
+   view -> first_row       = (HYPRE_BigInt) header -> first_row;
+   view -> matrix          = local;
+
+   if (header -> flags & HYPRE_BINARY_COMPRESSED)
+   {
+      /* only the column indices are decoded */
+      hypre_CSRMatrixBigJ(local) = hypre_TAlloc(HYPRE_BigInt, header -> num_nonzeros,
+                                                HYPRE_MEMORY_HOST);
+      hypre_BinaryDecodeChunks(view -> first_row, num_rows, (HYPRE_Int) header -> chunk_size, a_i,
+                               (hypre_ulonglongint *) (base + header -> chunk_offset),
+                               base + header -> j_offset, hypre_CSRMatrixBigJ(local));
+      view -> owns_big_j = 1;
+   }
+   else
+   {
+      hypre_CSRMatrixBigJ(local) = (HYPRE_BigInt *) (base + header -> j_offset);
+   }
+
+   *view_ptr = view;
+#else
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: memory mapped files are not supported\n");
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBinaryViewDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRBinaryViewDestroy( hypre_ParCSRBinaryView *view )
+{
+#if !defined(_WIN32)
+   hypre_CSRMatrix *local;
+
+   if (view)
+   {
+      local = view -> matrix;
+      if (view -> owns_big_j)
+      {
+         hypre_TFree(hypre_CSRMatrixBigJ(local), HYPRE_MEMORY_HOST);
+      }
+      hypre_CSRMatrixI(local)    = NULL;
+      hypre_CSRMatrixBigJ(local) = NULL;
+      hypre_CSRMatrixData(local) = NULL;
+      hypre_CSRMatrixDestroy(local);
+
+      munmap(view -> addr, view -> length);
+      hypre_TFree(view, HYPRE_MEMORY_HOST);
+   }
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorPrintBinary( hypre_ParVector *vector,
+                            const char      *filename )
+{
+   MPI_Comm              comm;
+   hypre_ParVector      *h_vector;
+   HYPRE_Int             num_procs, my_id, num_rows;
+   hypre_BinaryHeader    header;
+   char                  new_filename[1024];
+   FILE                 *file;
+   HYPRE_Int             ierr;
+
+   HYPRE_MemoryLocation  memory_location;
+
+   if (!vector)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (hypre_ParVectorNumVectors(vector) > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Binary files of multivectors are not supported\n");
+      return hypre_error_flag;
+   }
+
+   memory_location = hypre_ParVectorMemoryLocation(vector);
+   if (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST)
+   {
+      h_vector = vector;
+   }
+   else
+   {
+      h_vector = hypre_ParVectorCloneDeep_v2(vector, HYPRE_MEMORY_HOST);
+   }
+
+   comm     = hypre_ParVectorComm(h_vector);
+   num_rows = hypre_VectorSize(hypre_ParVectorLocalVector(h_vector));
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   hypre_BinaryHeaderInit(&header, HYPRE_BINARY_VECTOR);
+   header.global_num_rows = (hypre_ulonglongint) hypre_ParVectorGlobalSize(h_vector);
+   header.first_row       = (hypre_ulonglongint) hypre_ParVectorFirstIndex(h_vector);
+   header.num_rows        = (hypre_ulonglongint) num_rows;
+   header.num_files       = (hypre_ulonglongint) num_procs;
+   header.file_id         = (hypre_ulonglongint) my_id;
+   header.data_offset     = header.i_offset;
+   header.file_size       = header.data_offset + num_rows * sizeof(HYPRE_Complex);
+
+   hypre_sprintf(new_filename, "%s.%05d", filename, my_id);
+   if ((file = fopen(new_filename, "wb")) == NULL)
+   {
+      ierr = 1;
+   }
+   else
+   {
+      ierr  = hypre_BinaryWriteAt(file, 0, &header, sizeof(hypre_BinaryHeader));
+      ierr |= hypre_BinaryWriteAt(file, header.data_offset,
+                                  hypre_VectorData(hypre_ParVectorLocalVector(h_vector)),
+                                  num_rows * sizeof(HYPRE_Complex));
+      fclose(file);
+   }
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't write binary vector file\n");
+   }
+
+   hypre_BinaryWriteIndex(comm, filename, &header, hypre_ParVectorFirstIndex(h_vector), 0);
+
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      hypre_ParVectorDestroy(h_vector);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorReadBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorReadBinary( MPI_Comm          comm,
+                           const char       *filename,
+                           hypre_ParVector **vector_ptr )
+{
+   hypre_BinaryHeader   index, header;
+   hypre_ParVector     *vector;
+   HYPRE_Complex       *data;
+   HYPRE_BigInt        *file_rows;
+   HYPRE_BigInt         global_size;
+   HYPRE_BigInt         partitioning[2];
+   HYPRE_Int            num_files, f, lo, hi;
+   FILE                *file;
+   HYPRE_Int            ierr = 0, ierr_global;
+
+   if (!vector_ptr)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+   *vector_ptr = NULL;
+
+   hypre_BinaryReadIndex(comm, filename, HYPRE_BINARY_VECTOR, &index, &file_rows);
+   if (!file_rows)
+   {
+      return hypre_error_flag;
+   }
+   num_files   = (HYPRE_Int) index.num_files;
+   global_size = (HYPRE_BigInt) index.global_num_rows;
+
+   hypre_BinaryLocalRange(comm, global_size, num_files, file_rows, partitioning);
+
+   vector = hypre_ParVectorCreate(comm, global_size, partitioning);
+   hypre_ParVectorInitialize_v2(vector, HYPRE_MEMORY_HOST);
+   data = hypre_VectorData(hypre_ParVectorLocalVector(vector));
+
+   for (f = 0; f < num_files && !ierr; f++)
+   {
+      if (file_rows[f + 1] <= partitioning[0] || file_rows[f] >= partitioning[1] ||
+          file_rows[f + 1] == file_rows[f])
+      {
+         continue;
+      }
+      if ((file = hypre_BinaryOpenFile(filename, f, HYPRE_BINARY_VECTOR, &header)) == NULL)
+      {
+         ierr = 1;
+         break;
+      }
+      lo = (HYPRE_Int) (hypre_max(partitioning[0], file_rows[f]) - file_rows[f]);
+      hi = (HYPRE_Int) (hypre_min(partitioning[1], file_rows[f + 1]) - file_rows[f]);
+      ierr = hypre_BinaryReadAt(file, header.data_offset + lo * sizeof(HYPRE_Complex),
+                                data + (file_rows[f] + lo - partitioning[0]),
+                                (hi - lo) * sizeof(HYPRE_Complex));
+      fclose(file);
+   }
+
+   /* return the same result on all ranks, as the matrix reader does */
+   hypre_MPI_Allreduce(&ierr, &ierr_global, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   hypre_TFree(file_rows, HYPRE_MEMORY_HOST);
+
+   if (ierr_global)
+   {
+      hypre_ParVectorDestroy(vector);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't read binary vector file\n");
+      return hypre_error_flag;
+   }
+
+   *vector_ptr = vector;
+
+   return hypre_error_flag;
+}
@@ -9,7 +9,6 @@
 
 /*==========================================================================*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 static CommPkgJobType getJobTypeOf(HYPRE_Int job)
 {
    CommPkgJobType job_type = HYPRE_COMM_PKG_JOB_COMPLEX;
@@ -38,225 +37,280 @@ static CommPkgJobType getJobTypeOf(HYPRE_Int job)
    return job_type;
 }
 
-/**
- * When send_data and recv_data are NULL, buffers are internally allocated
- * and CommHandle owns the buffer
- */
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRPersistentCommHandleCreate_v2
+ *
+ * Creates a persistent communication handle for the given job with send
+ * and recv buffers owned by the handle. MPI_Send_init/MPI_Recv_init are
+ * posted once here and reused by every Start/Wait pair.
+ *
+ * With num_vectors > 1, the entries of all vectors are interleaved
+ * (row-wise) in the buffers, i.e., entry i of vector k is stored at
+ * i * num_vectors + k, so that each neighbor receives a single message.
+ *
+ * If comm_pkg carries a neighborhood communicator (see
+ * hypre_ParCSRCommPkgCreateNeighborComm), the handle stores counts and
+ * displacements scaled by num_vectors instead, and each Start issues one
+ * MPI_Ineighbor_alltoallv on the internal buffers.
+ *--------------------------------------------------------------------------*/
+
 hypre_ParCSRPersistentCommHandle*
-hypre_ParCSRPersistentCommHandleCreate( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg )
+hypre_ParCSRPersistentCommHandleCreate_v2( HYPRE_Int            job,
+                                           hypre_ParCSRCommPkg *comm_pkg,
+                                           HYPRE_Int            num_vectors )
 {
-   HYPRE_Int i;
-   size_t num_bytes_send, num_bytes_recv;
-
-   hypre_ParCSRPersistentCommHandle *comm_handle = hypre_CTAlloc(hypre_ParCSRPersistentCommHandle, 1,
-                                                                 HYPRE_MEMORY_HOST);
-
-   CommPkgJobType job_type = getJobTypeOf(job);
-
-   HYPRE_Int num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
-   HYPRE_Int num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
-   MPI_Comm  comm      = hypre_ParCSRCommPkgComm(comm_pkg);
-
-   HYPRE_Int num_requests = num_sends + num_recvs;
-   hypre_MPI_Request *requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
-
-   hypre_ParCSRCommHandleNumRequests(comm_handle) = num_requests;
-   hypre_ParCSRCommHandleRequests(comm_handle)    = requests;
-
-   void *send_buff = NULL, *recv_buff = NULL;
+   HYPRE_Int           num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int           num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   MPI_Comm            comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   CommPkgJobType      job_type  = getJobTypeOf(job);
+
+   hypre_ParCSRPersistentCommHandle *comm_handle;
+   hypre_MPI_Request  *requests;
+   hypre_MPI_Datatype  mpi_type;
+   HYPRE_Int           num_requests = num_sends + num_recvs;
+   HYPRE_Int           num_send_procs, num_recv_procs;
+   HYPRE_Int          *send_procs, *recv_procs;
+   HYPRE_Int          *send_starts, *recv_starts;
+   size_t              elmt_size, num_bytes_send, num_bytes_recv;
+   char               *send_buff, *recv_buff;
+   hypre_int          *neighbor_counts = NULL;
+   HYPRE_Int           i;
 
    switch (job_type)
    {
       case HYPRE_COMM_PKG_JOB_COMPLEX:
-         num_bytes_send = sizeof(HYPRE_Complex) * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
-         num_bytes_recv = sizeof(HYPRE_Complex) * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
-         send_buff = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                                  HYPRE_MEMORY_HOST);
-         recv_buff = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs),
-                                  HYPRE_MEMORY_HOST);
-         for (i = 0; i < num_recvs; ++i)
-         {
-            HYPRE_Int ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            HYPRE_Int vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            HYPRE_Int vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Recv_init( (HYPRE_Complex *)recv_buff + vec_start, vec_len, HYPRE_MPI_COMPLEX,
-                                 ip, 0, comm, requests + i );
-         }
-         for (i = 0; i < num_sends; ++i)
-         {
-            HYPRE_Int ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            HYPRE_Int vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            HYPRE_Int vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Send_init( (HYPRE_Complex *)send_buff + vec_start, vec_len, HYPRE_MPI_COMPLEX,
-                                 ip, 0, comm, requests + num_recvs + i );
-         }
-         break;
-
       case HYPRE_COMM_PKG_JOB_COMPLEX_TRANSPOSE:
-         num_bytes_recv = sizeof(HYPRE_Complex) * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
-         num_bytes_send = sizeof(HYPRE_Complex) * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
-         recv_buff = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                                  HYPRE_MEMORY_HOST);
-         send_buff = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs),
-                                  HYPRE_MEMORY_HOST);
-         for (i = 0; i < num_sends; ++i)
-         {
-            HYPRE_Int ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            HYPRE_Int vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            HYPRE_Int vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Recv_init( (HYPRE_Complex *)recv_buff + vec_start, vec_len, HYPRE_MPI_COMPLEX,
-                                 ip, 0, comm, requests + i );
-         }
-         for (i = 0; i < num_recvs; ++i)
-         {
-            HYPRE_Int ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            HYPRE_Int vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            HYPRE_Int vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Send_init( (HYPRE_Complex *)send_buff + vec_start, vec_len, HYPRE_MPI_COMPLEX,
-                                 ip, 0, comm, requests + num_sends + i );
-         }
+         elmt_size = sizeof(HYPRE_Complex);
+         mpi_type  = HYPRE_MPI_COMPLEX;
          break;
 
       case HYPRE_COMM_PKG_JOB_INT:
-         num_bytes_send = sizeof(HYPRE_Int) * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
-         num_bytes_recv = sizeof(HYPRE_Int) * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
-         send_buff = hypre_TAlloc(HYPRE_Int, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                                  HYPRE_MEMORY_HOST);
-         recv_buff = hypre_TAlloc(HYPRE_Int, hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs),
-                                  HYPRE_MEMORY_HOST);
-         for (i = 0; i < num_recvs; ++i)
-         {
-            HYPRE_Int ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            HYPRE_Int vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            HYPRE_Int vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Recv_init( (HYPRE_Int *)recv_buff + vec_start, vec_len, HYPRE_MPI_INT,
-                                 ip, 0, comm, requests + i );
-         }
-         for (i = 0; i < num_sends; ++i)
-         {
-            HYPRE_Int ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            HYPRE_Int vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            HYPRE_Int vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Send_init( (HYPRE_Int *)send_buff + vec_start, vec_len, HYPRE_MPI_INT,
-                                 ip, 0, comm, requests + num_recvs + i );
-         }
-         break;
-
       case HYPRE_COMM_PKG_JOB_INT_TRANSPOSE:
-         num_bytes_recv = sizeof(HYPRE_Int) * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
-         num_bytes_send = sizeof(HYPRE_Int) * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
-         recv_buff = hypre_TAlloc(HYPRE_Int, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                                  HYPRE_MEMORY_HOST);
-         send_buff = hypre_TAlloc(HYPRE_Int, hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs),
-                                  HYPRE_MEMORY_HOST);
-         for (i = 0; i < num_sends; ++i)
-         {
-            HYPRE_Int ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            HYPRE_Int vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            HYPRE_Int vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Recv_init( (HYPRE_Int *)recv_buff + vec_start, vec_len, HYPRE_MPI_INT,
-                                 ip, 0, comm, requests + i );
-         }
-         for (i = 0; i < num_recvs; ++i)
-         {
-            HYPRE_Int ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            HYPRE_Int vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            HYPRE_Int vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Send_init( (HYPRE_Int *)send_buff + vec_start, vec_len, HYPRE_MPI_INT,
-                                 ip, 0, comm, requests + num_sends + i );
-         }
+         elmt_size = sizeof(HYPRE_Int);
+         mpi_type  = HYPRE_MPI_INT;
          break;
 
       case HYPRE_COMM_PKG_JOB_BIGINT:
-         num_bytes_send = sizeof(HYPRE_BigInt) * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
-         num_bytes_recv = sizeof(HYPRE_BigInt) * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
-         send_buff = hypre_TAlloc(HYPRE_BigInt, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                                  HYPRE_MEMORY_HOST);
-         recv_buff = hypre_TAlloc(HYPRE_BigInt, hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs),
-                                  HYPRE_MEMORY_HOST);
-         for (i = 0; i < num_recvs; ++i)
-         {
-            HYPRE_Int ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            HYPRE_Int vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            HYPRE_Int vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Recv_init( (HYPRE_BigInt *)recv_buff + (HYPRE_BigInt)vec_start, vec_len,
-                                 HYPRE_MPI_BIG_INT,
-                                 ip, 0, comm, requests + i );
-         }
-         for (i = 0; i < num_sends; ++i)
-         {
-            HYPRE_Int ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            HYPRE_Int vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            HYPRE_Int vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Send_init( (HYPRE_BigInt *)send_buff + (HYPRE_BigInt)vec_start, vec_len,
-                                 HYPRE_MPI_BIG_INT,
-                                 ip, 0, comm, requests + num_recvs + i);
-         }
-         break;
-
       case HYPRE_COMM_PKG_JOB_BIGINT_TRANSPOSE:
-         num_bytes_recv = sizeof(HYPRE_BigInt) * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
-         num_bytes_send = sizeof(HYPRE_BigInt) * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
-         recv_buff = hypre_TAlloc(HYPRE_BigInt, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                                  HYPRE_MEMORY_HOST);
-         send_buff = hypre_TAlloc(HYPRE_BigInt, hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs),
-                                  HYPRE_MEMORY_HOST);
-         for (i = 0; i < num_sends; ++i)
-         {
-            HYPRE_Int ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            HYPRE_Int vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            HYPRE_Int vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Recv_init( (HYPRE_BigInt *)recv_buff + (HYPRE_BigInt)vec_start, vec_len,
-                                 HYPRE_MPI_BIG_INT,
-                                 ip, 0, comm, requests + i );
-         }
-         for (i = 0; i < num_recvs; ++i)
-         {
-            HYPRE_Int ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            HYPRE_Int vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            HYPRE_Int vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
-
-            hypre_MPI_Send_init( (HYPRE_BigInt *)send_buff + (HYPRE_BigInt)vec_start, vec_len,
-                                 HYPRE_MPI_BIG_INT,
-                                 ip, 0, comm, requests + num_sends + i);
-         }
+         elmt_size = sizeof(HYPRE_BigInt);
+         mpi_type  = HYPRE_MPI_BIG_INT;
          break;
+
       default:
-         hypre_assert(1 == 0);
-         break;
+         hypre_error_in_arg(1);
+         return NULL;
    } // switch (job_type)
 
+   /* a transpose job sends along the receive pattern of comm_pkg and vice versa */
+   if (job_type == HYPRE_COMM_PKG_JOB_COMPLEX ||
+       job_type == HYPRE_COMM_PKG_JOB_INT     ||
+       job_type == HYPRE_COMM_PKG_JOB_BIGINT)
+   {
+      num_send_procs = num_sends;
+      send_procs     = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+      send_starts    = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+      num_recv_procs = num_recvs;
+      recv_procs     = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+      recv_starts    = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+   }
+   else
+   {
+      num_send_procs = num_recvs;
+      send_procs     = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+      send_starts    = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+      num_recv_procs = num_sends;
+      recv_procs     = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+      recv_starts    = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   }
+
+   num_bytes_send = elmt_size * (size_t) num_vectors * (size_t) send_starts[num_send_procs];
+   num_bytes_recv = elmt_size * (size_t) num_vectors * (size_t) recv_starts[num_recv_procs];
+
+   if (hypre_ParCSRCommPkgNeighborColl(comm_pkg))
+   {
+      HYPRE_Int   num_neighbors = hypre_ParCSRCommPkgNumNeighbors(comm_pkg);
+      hypre_int  *send_counts, *send_displs, *recv_counts, *recv_displs;
+
+      if (job_type == HYPRE_COMM_PKG_JOB_COMPLEX ||
+          job_type == HYPRE_COMM_PKG_JOB_INT     ||
+          job_type == HYPRE_COMM_PKG_JOB_BIGINT)
+      {
+         send_counts = hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg);
+         send_displs = hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg);
+         recv_counts = hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg);
+         recv_displs = hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg);
+      }
+      else
+      {
+         send_counts = hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg);
+         send_displs = hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg);
+         recv_counts = hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg);
+         recv_displs = hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg);
+      }
+
+      /* send counts, send displs, recv counts, recv displs; kept non-NULL on
+         ranks without neighbors, which still take part in the collective */
+      neighbor_counts = hypre_TAlloc(hypre_int, hypre_max(4 * num_neighbors, 1),
+                                     HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_neighbors; i++)
+      {
+         neighbor_counts[i]                     = send_counts[i] * (hypre_int) num_vectors;
+         neighbor_counts[num_neighbors + i]     = send_displs[i] * (hypre_int) num_vectors;
+         neighbor_counts[2 * num_neighbors + i] = recv_counts[i] * (hypre_int) num_vectors;
+         neighbor_counts[3 * num_neighbors + i] = recv_displs[i] * (hypre_int) num_vectors;
+      }
+      num_requests = 1;
+   }
+
+   comm_handle = hypre_CTAlloc(hypre_ParCSRPersistentCommHandle, 1, HYPRE_MEMORY_HOST);
+   requests    = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+   send_buff   = hypre_TAlloc(char, num_bytes_send, HYPRE_MEMORY_HOST);
+   recv_buff   = hypre_TAlloc(char, num_bytes_recv, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_recv_procs && !neighbor_counts; ++i)
+   {
+      HYPRE_Int vec_start = recv_starts[i];
+      HYPRE_Int vec_len   = recv_starts[i + 1] - vec_start;
+
+      hypre_MPI_Recv_init( recv_buff + elmt_size * (size_t) num_vectors * (size_t) vec_start,
+                           vec_len * num_vectors, mpi_type,
+                           recv_procs[i], 0, comm, requests + i );
+   }
+   for (i = 0; i < num_send_procs && !neighbor_counts; ++i)
+   {
+      HYPRE_Int vec_start = send_starts[i];
+      HYPRE_Int vec_len   = send_starts[i + 1] - vec_start;
+
+      hypre_MPI_Send_init( send_buff + elmt_size * (size_t) num_vectors * (size_t) vec_start,
+                           vec_len * num_vectors, mpi_type,
+                           send_procs[i], 0, comm, requests + num_recv_procs + i );
+   }
+
+   hypre_ParCSRCommHandleCommPkg(comm_handle)        = comm_pkg;
+   hypre_ParCSRCommHandleNumRequests(comm_handle)    = num_requests;
+   hypre_ParCSRCommHandleNumSendRequests(comm_handle) = neighbor_counts ? 0 : num_send_procs;
+   hypre_ParCSRCommHandleRequests(comm_handle)       = requests;
    hypre_ParCSRCommHandleRecvDataBuffer(comm_handle) = recv_buff;
    hypre_ParCSRCommHandleSendDataBuffer(comm_handle) = send_buff;
-   hypre_ParCSRCommHandleNumSendBytes(comm_handle)   = num_bytes_send;
-   hypre_ParCSRCommHandleNumRecvBytes(comm_handle)   = num_bytes_recv;
+   hypre_ParCSRCommHandleNumSendBytes(comm_handle)   = (HYPRE_Int) num_bytes_send;
+   hypre_ParCSRCommHandleNumRecvBytes(comm_handle)   = (HYPRE_Int) num_bytes_recv;
+   hypre_ParCSRCommHandleNumVectors(comm_handle)     = num_vectors;
+   hypre_ParCSRCommHandleNeighborCounts(comm_handle) = neighbor_counts;
+   hypre_ParCSRCommHandleNeighborType(comm_handle)   = mpi_type;
 
    return ( comm_handle );
 }
 
+/**
+ * When send_data and recv_data are NULL, buffers are internally allocated
+ * and CommHandle owns the buffer
+ */
+hypre_ParCSRPersistentCommHandle*
+hypre_ParCSRPersistentCommHandleCreate( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg )
+{
+   return hypre_ParCSRPersistentCommHandleCreate_v2(job, comm_pkg, 1);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgGetPersistentCommHandle_v2
+ *
+ * Returns the persistent handle of comm_pkg for the given job and number of
+ * vectors, creating it on first use. Handles for different numbers of
+ * vectors are kept side by side, so that alternating single and multiple
+ * vector exchanges reuse their requests. When all slots of the job are
+ * taken, the least recently used handle is replaced.
+ *--------------------------------------------------------------------------*/
 
 hypre_ParCSRPersistentCommHandle*
-hypre_ParCSRCommPkgGetPersistentCommHandle( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg )
+hypre_ParCSRCommPkgGetPersistentCommHandle_v2( HYPRE_Int            job,
+                                               hypre_ParCSRCommPkg *comm_pkg,
+                                               HYPRE_Int            num_vectors )
 {
-   CommPkgJobType type = getJobTypeOf(job);
-   if (!comm_pkg->persistent_comm_handles[type])
+   CommPkgJobType                     type    = getJobTypeOf(job);
+   hypre_ParCSRPersistentCommHandle **handles = comm_pkg->persistent_comm_handles[type];
+   hypre_ParCSRPersistentCommHandle  *comm_handle;
+   HYPRE_Int                          i, k;
+
+   for (k = 0; k < HYPRE_PERSISTENT_COMM_HANDLES_PER_JOB - 1; k++)
+   {
+      if (!handles[k] || hypre_ParCSRCommHandleNumVectors(handles[k]) == num_vectors)
+      {
+         break;
+      }
+   }
+
+   comm_handle = handles[k];
+   if (comm_handle && hypre_ParCSRCommHandleNumVectors(comm_handle) != num_vectors)
+   {
+      /* all slots taken: drop the least recently used handle */
+      hypre_ParCSRPersistentCommHandleDestroy(comm_handle);
+      comm_handle = NULL;
+   }
+
+   if (!comm_handle)
    {
       /* data is owned by persistent comm handle */
-      comm_pkg->persistent_comm_handles[type] = hypre_ParCSRPersistentCommHandleCreate(job, comm_pkg);
+      comm_handle = hypre_ParCSRPersistentCommHandleCreate_v2(job, comm_pkg, num_vectors);
    }
 
-   return comm_pkg->persistent_comm_handles[type];
+   /* move to the front */
+   for (i = k; i > 0; i--)
+   {
+      handles[i] = handles[i - 1];
+   }
+   handles[0] = comm_handle;
+
+   return comm_handle;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgDestroyPersistentCommHandles
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRCommPkgDestroyPersistentCommHandles( hypre_ParCSRCommPkg *comm_pkg )
+{
+   HYPRE_Int i, k;
+
+   for (i = HYPRE_COMM_PKG_JOB_COMPLEX; i < NUM_OF_COMM_PKG_JOB_TYPE; ++i)
+   {
+      for (k = 0; k < HYPRE_PERSISTENT_COMM_HANDLES_PER_JOB; k++)
+      {
+         if (comm_pkg->persistent_comm_handles[i][k])
+         {
+            hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_comm_handles[i][k]);
+            comm_pkg->persistent_comm_handles[i][k] = NULL;
+         }
+      }
+   }
+}
+
+hypre_ParCSRPersistentCommHandle*
+hypre_ParCSRCommPkgGetPersistentCommHandle( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg )
+{
+   return hypre_ParCSRCommPkgGetPersistentCommHandle_v2(job, comm_pkg, 1);
 }
 
 void
 hypre_ParCSRPersistentCommHandleDestroy( hypre_ParCSRPersistentCommHandle *comm_handle )
 {
+   HYPRE_Int i;
+
+   /* requests of the neighborhood collective are not persistent */
+   for (i = 0; i < hypre_ParCSRCommHandleNumRequests(comm_handle) &&
+        !hypre_ParCSRCommHandleNeighborCounts(comm_handle); i++)
+   {
+      hypre_MPI_Request_free(&hypre_ParCSRCommHandleRequest(comm_handle, i));
+   }
+
+   hypre_TFree(hypre_ParCSRCommHandleNeighborCounts(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParCSRCommHandleSendDataBuffer(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParCSRCommHandleRecvDataBuffer(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(comm_handle->requests, HYPRE_MEMORY_HOST);
    hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
 }
 
+/* send_data may be the handle's own send buffer, in which case no copy is made */
 void hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *comm_handle,
                                             HYPRE_MemoryLocation              send_memory_location,
                                             void                             *send_data )
@@ -266,15 +320,39 @@ void hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *co
 
    if (hypre_ParCSRCommHandleNumRequests(comm_handle) > 0)
    {
-      hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
-                     send_data,
-                     char,
-                     hypre_ParCSRCommHandleNumSendBytes(comm_handle),
-                     HYPRE_MEMORY_HOST,
-                     send_memory_location );
+      if (send_data != hypre_ParCSRCommHandleSendDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
+                        send_data,
+                        char,
+                        hypre_ParCSRCommHandleNumSendBytes(comm_handle),
+                        HYPRE_MEMORY_HOST,
+                        send_memory_location );
+      }
+
+      HYPRE_Int ret;
 
-      HYPRE_Int ret = hypre_MPI_Startall(hypre_ParCSRCommHandleNumRequests(comm_handle),
-                                         hypre_ParCSRCommHandleRequests(comm_handle));
+      if (hypre_ParCSRCommHandleNeighborCounts(comm_handle))
+      {
+         hypre_ParCSRCommPkg *comm_pkg  = hypre_ParCSRCommHandleCommPkg(comm_handle);
+         HYPRE_Int            nn        = hypre_ParCSRCommPkgNumNeighbors(comm_pkg);
+         hypre_int           *counts    = hypre_ParCSRCommHandleNeighborCounts(comm_handle);
+         hypre_MPI_Datatype   mpi_type  = hypre_ParCSRCommHandleNeighborType(comm_handle);
+
+         ret = hypre_MPI_Ineighbor_alltoallv(hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
+                                             counts, counts + nn, mpi_type,
+                                             hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
+                                             counts + 2 * nn, counts + 3 * nn, mpi_type,
+                                             hypre_ParCSRCommPkgNeighborComm(comm_pkg),
+                                             hypre_ParCSRCommHandleRequests(comm_handle));
+      }
+      else
+      {
+         hypre_OpCountsAddMessages(hypre_ParCSRCommHandleNumSendRequests(comm_handle),
+                                   hypre_ParCSRCommHandleNumSendBytes(comm_handle));
+         ret = hypre_MPI_Startall(hypre_ParCSRCommHandleNumRequests(comm_handle),
+                                  hypre_ParCSRCommHandleRequests(comm_handle));
+      }
       if (hypre_MPI_SUCCESS != ret)
       {
          hypre_error_w_msg(HYPRE_ERROR_GENERIC, "MPI error\n");
@@ -283,6 +361,7 @@ void hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *co
    }
 }
 
+/* recv_data may be the handle's own recv buffer, in which case no copy is made */
 void hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *comm_handle,
                                            HYPRE_MemoryLocation              recv_memory_location,
                                            void                             *recv_data )
@@ -301,15 +380,17 @@ void hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *com
          /*hypre_printf("MPI error %d in %s (%s, line %u)\n", ret, __FUNCTION__, __FILE__, __LINE__);*/
       }
 
-      hypre_TMemcpy(recv_data,
-                    hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
-                    char,
-                    hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
-                    recv_memory_location,
-                    HYPRE_MEMORY_HOST);
+      if (recv_data != hypre_ParCSRCommHandleRecvDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy(recv_data,
+                       hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
+                       char,
+                       hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
+                       recv_memory_location,
+                       HYPRE_MEMORY_HOST);
+      }
    }
 }
-#endif // HYPRE_USING_PERSISTENT_COMM
 
 hypre_ParCSRCommHandle*
 hypre_ParCSRCommHandleCreate ( HYPRE_Int            job,
@@ -444,148 +525,185 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    recv_data = recv_data_in;
 #endif
 
-   num_requests = num_sends + num_recvs;
-   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+   if (hypre_ParCSRCommPkgNeighborColl(comm_pkg) &&
+       (job == 1 || job == 2 || job == 11 || job == 12))
+   {
+      /* neighborhood collective backend: a single nonblocking
+         MPI_Ineighbor_alltoallv on the distributed graph of comm_pkg */
+      hypre_MPI_Datatype mpi_type = (job == 1 || job == 2) ? HYPRE_MPI_COMPLEX : HYPRE_MPI_INT;
 
-   hypre_MPI_Comm_size(comm, &num_procs);
-   hypre_MPI_Comm_rank(comm, &my_id);
+      num_requests = 1;
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
 
-   j = 0;
-   switch (job)
-   {
-      case  1:
+      if (job == 1 || job == 11)
       {
-         HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
-         HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
-         for (i = 0; i < num_recvs; i++)
-         {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Irecv(&d_recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
-                            ip, 0, comm, &requests[j++]);
-         }
-         for (i = 0; i < num_sends; i++)
-         {
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Isend(&d_send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
-                            ip, 0, comm, &requests[j++]);
-         }
-         break;
+         hypre_MPI_Ineighbor_alltoallv(send_data,
+                                       hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg),
+                                       hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg),
+                                       mpi_type, recv_data,
+                                       hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg),
+                                       hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg),
+                                       mpi_type, hypre_ParCSRCommPkgNeighborComm(comm_pkg),
+                                       requests);
       }
-      case  2:
+      else
       {
-         HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
-         HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
-         for (i = 0; i < num_sends; i++)
-         {
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Irecv(&d_recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
-                            ip, 0, comm, &requests[j++]);
-         }
-         for (i = 0; i < num_recvs; i++)
-         {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Isend(&d_send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
-                            ip, 0, comm, &requests[j++]);
-         }
-         break;
+         hypre_MPI_Ineighbor_alltoallv(send_data,
+                                       hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg),
+                                       hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg),
+                                       mpi_type, recv_data,
+                                       hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg),
+                                       hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg),
+                                       mpi_type, hypre_ParCSRCommPkgNeighborComm(comm_pkg),
+                                       requests);
       }
-      case  11:
-      {
-         HYPRE_Int *i_send_data = (HYPRE_Int *) send_data;
-         HYPRE_Int *i_recv_data = (HYPRE_Int *) recv_data;
-         for (i = 0; i < num_recvs; i++)
-         {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_INT,
-                            ip, 0, comm, &requests[j++]);
-         }
-         for (i = 0; i < num_sends; i++)
-         {
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_INT,
-                            ip, 0, comm, &requests[j++]);
-         }
-         break;
-      }
-      case  12:
+   }
+   else
+   {
+      num_requests = num_sends + num_recvs;
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+
+      hypre_MPI_Comm_size(comm, &num_procs);
+      hypre_MPI_Comm_rank(comm, &my_id);
+
+      j = 0;
+      switch (job)
       {
-         HYPRE_Int *i_send_data = (HYPRE_Int *) send_data;
-         HYPRE_Int *i_recv_data = (HYPRE_Int *) recv_data;
-         for (i = 0; i < num_sends; i++)
+         case  1:
          {
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
+            HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
+               hypre_MPI_Irecv(&d_recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_sends; i++)
+            {
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
+               hypre_MPI_Isend(&d_send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         for (i = 0; i < num_recvs; i++)
+         case  2:
          {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
+            HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
+            for (i = 0; i < num_sends; i++)
+            {
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
+               hypre_MPI_Irecv(&d_recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
+               hypre_MPI_Isend(&d_send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         break;
-      }
-      case  21:
-      {
-         HYPRE_BigInt *i_send_data = (HYPRE_BigInt *) send_data;
-         HYPRE_BigInt *i_recv_data = (HYPRE_BigInt *) recv_data;
-         for (i = 0; i < num_recvs; i++)
+         case  11:
          {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_Int *i_send_data = (HYPRE_Int *) send_data;
+            HYPRE_Int *i_recv_data = (HYPRE_Int *) recv_data;
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
+               hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_sends; i++)
+            {
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
+               hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         for (i = 0; i < num_sends; i++)
+         case  12:
          {
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_Int *i_send_data = (HYPRE_Int *) send_data;
+            HYPRE_Int *i_recv_data = (HYPRE_Int *) recv_data;
+            for (i = 0; i < num_sends; i++)
+            {
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
+               hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
+               hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         break;
-      }
-      case  22:
-      {
-         HYPRE_BigInt *i_send_data = (HYPRE_BigInt *) send_data;
-         HYPRE_BigInt *i_recv_data = (HYPRE_BigInt *) recv_data;
-         for (i = 0; i < num_sends; i++)
+         case  21:
          {
-            vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
-            ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
-            hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_BigInt *i_send_data = (HYPRE_BigInt *) send_data;
+            HYPRE_BigInt *i_recv_data = (HYPRE_BigInt *) recv_data;
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
+               hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_sends; i++)
+            {
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         for (i = 0; i < num_recvs; i++)
+         case  22:
          {
-            ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
-            vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
-            vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
-            hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
-                            ip, 0, comm, &requests[j++]);
+            HYPRE_BigInt *i_send_data = (HYPRE_BigInt *) send_data;
+            HYPRE_BigInt *i_recv_data = (HYPRE_BigInt *) recv_data;
+            for (i = 0; i < num_sends; i++)
+            {
+               vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) - vec_start;
+               ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+               hypre_MPI_Irecv(&i_recv_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            for (i = 0; i < num_recvs; i++)
+            {
+               ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+               vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+               vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) - vec_start;
+               hypre_MPI_Isend(&i_send_data[vec_start], vec_len, HYPRE_MPI_BIG_INT,
+                               ip, 0, comm, &requests[j++]);
+            }
+            break;
          }
-         break;
       }
    }
+
    /*--------------------------------------------------------------------
     * set up comm_handle and return
     *--------------------------------------------------------------------*/
@@ -947,6 +1065,8 @@ hypre_ParCSRCommPkgCreate
    HYPRE_Int *recv_procs;
    HYPRE_Int *recv_vec_starts;
 
+   hypre_OpCountsCommPkgBegin();
+
    hypre_ParCSRCommPkgCreate_core
    ( comm, col_map_offd, first_col_diag, col_starts,
      num_cols_diag, num_cols_offd,
@@ -963,6 +1083,8 @@ hypre_ParCSRCommPkgCreate
    hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = send_map_starts;
    hypre_ParCSRCommPkgSendMapElmts (comm_pkg) = send_map_elmts;
 
+   hypre_OpCountsCommPkgEnd();
+
    return hypre_error_flag;
 }
 
@@ -986,6 +1108,7 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
    HYPRE_BigInt         global_num_cols = hypre_ParCSRMatrixGlobalNumCols(A);
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
+   hypre_OpCountsCommPkgBegin();
 
    /* Create the assumed partition and should own it */
    if (apart == NULL)
@@ -1005,24 +1128,146 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
                                    apart,
                                    comm_pkg );
 
+   if (hypre_ParCSRMatrixNeighborColl(A))
+   {
+      hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+   }
+
+   hypre_OpCountsCommPkgEnd();
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgCreateNeighborComm
+ *
+ * Sets up the neighborhood collective backend of comm_pkg: a distributed
+ * graph communicator whose sources and destinations are both the union of
+ * send_procs and recv_procs, so that the same communicator serves forward
+ * and transpose exchanges (with zero counts where there is no message).
+ * Collective over the communicator of comm_pkg.
+ *--------------------------------------------------------------------------*/
+
 HYPRE_Int
-hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
+hypre_ParCSRCommPkgCreateNeighborComm( hypre_ParCSRCommPkg *comm_pkg )
 {
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   HYPRE_Int i;
-   for (i = HYPRE_COMM_PKG_JOB_COMPLEX; i < NUM_OF_COMM_PKG_JOB_TYPE; ++i)
+   MPI_Comm    comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int   num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int   num_neighbors;
+   HYPRE_Int  *neighbors;
+   hypre_int  *send_counts, *send_displs, *recv_counts, *recv_displs;
+   MPI_Comm    neighbor_comm;
+   HYPRE_Int   i, k, ierr;
+
+   if (hypre_ParCSRCommPkgNeighborColl(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   /* sorted union of send and recv processors */
+   neighbors = hypre_TAlloc(HYPRE_Int, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_sends; i++)
+   {
+      neighbors[i] = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+   }
+   for (i = 0; i < num_recvs; i++)
    {
-      if (comm_pkg->persistent_comm_handles[i])
+      neighbors[num_sends + i] = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+   }
+   hypre_qsort0(neighbors, 0, num_sends + num_recvs - 1);
+
+   num_neighbors = 0;
+   for (i = 0; i < num_sends + num_recvs; i++)
+   {
+      if (num_neighbors == 0 || neighbors[i] != neighbors[num_neighbors - 1])
       {
-         hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_comm_handles[i]);
+         neighbors[num_neighbors++] = neighbors[i];
       }
    }
-#endif
+
+   ierr = hypre_MPI_Dist_graph_create_adjacent(comm, num_neighbors, neighbors,
+                                               num_neighbors, neighbors, 0, &neighbor_comm);
+   if (ierr != hypre_MPI_SUCCESS)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "MPI neighborhood collectives are not available!\n");
+      hypre_TFree(neighbors, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   /* counts and displacements of the forward exchange (job 1) */
+   send_counts = hypre_CTAlloc(hypre_int, num_neighbors, HYPRE_MEMORY_HOST);
+   send_displs = hypre_CTAlloc(hypre_int, num_neighbors, HYPRE_MEMORY_HOST);
+   recv_counts = hypre_CTAlloc(hypre_int, num_neighbors, HYPRE_MEMORY_HOST);
+   recv_displs = hypre_CTAlloc(hypre_int, num_neighbors, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_sends; i++)
+   {
+      k = hypre_BinarySearch(neighbors, hypre_ParCSRCommPkgSendProc(comm_pkg, i), num_neighbors);
+      send_displs[k] = (hypre_int) hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+      send_counts[k] = (hypre_int) (hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1) -
+                                    hypre_ParCSRCommPkgSendMapStart(comm_pkg, i));
+   }
+   for (i = 0; i < num_recvs; i++)
+   {
+      k = hypre_BinarySearch(neighbors, hypre_ParCSRCommPkgRecvProc(comm_pkg, i), num_neighbors);
+      recv_displs[k] = (hypre_int) hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+      recv_counts[k] = (hypre_int) (hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i + 1) -
+                                    hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i));
+   }
+
+   hypre_TFree(neighbors, HYPRE_MEMORY_HOST);
+
+   /* cached persistent handles were set up for point-to-point messages */
+   hypre_ParCSRCommPkgDestroyPersistentCommHandles(comm_pkg);
+
+   hypre_ParCSRCommPkgNeighborColl(comm_pkg)       = 1;
+   hypre_ParCSRCommPkgNeighborComm(comm_pkg)       = neighbor_comm;
+   hypre_ParCSRCommPkgNumNeighbors(comm_pkg)       = num_neighbors;
+   hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg) = send_counts;
+   hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg) = send_displs;
+   hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg) = recv_counts;
+   hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg) = recv_displs;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgDestroyNeighborComm
+ *
+ * Returns comm_pkg to point-to-point messages. Collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgDestroyNeighborComm( hypre_ParCSRCommPkg *comm_pkg )
+{
+   if (!hypre_ParCSRCommPkgNeighborColl(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   /* cached persistent handles use the neighborhood collective */
+   hypre_ParCSRCommPkgDestroyPersistentCommHandles(comm_pkg);
+
+   hypre_MPI_Comm_free(&hypre_ParCSRCommPkgNeighborComm(comm_pkg));
+   hypre_TFree(hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg), HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgNumNeighbors(comm_pkg) = 0;
+   hypre_ParCSRCommPkgNeighborColl(comm_pkg) = 0;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
+{
+   hypre_ParCSRCommPkgDestroyPersistentCommHandles(comm_pkg);
+
+   hypre_ParCSRCommPkgDestroyNeighborComm(comm_pkg);
 
    if (hypre_ParCSRCommPkgNumSends(comm_pkg))
    {
@@ -13,7 +13,6 @@
  *   Structure containing information for doing communications
  *--------------------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 typedef enum CommPkgJobType
 {
    HYPRE_COMM_PKG_JOB_COMPLEX = 0,
@@ -24,7 +23,9 @@ typedef enum CommPkgJobType
    HYPRE_COMM_PKG_JOB_BIGINT_TRANSPOSE,
    NUM_OF_COMM_PKG_JOB_TYPE,
 } CommPkgJobType;
-#endif
+
+/* persistent handles kept per job, one for each number of vectors in use */
+#define HYPRE_PERSISTENT_COMM_HANDLES_PER_JOB 4
 
 /*--------------------------------------------------------------------------
  * hypre_ParCSRCommHandle, hypre_ParCSRPersistentCommHandle
@@ -38,12 +39,17 @@ typedef struct
    HYPRE_MemoryLocation  recv_memory_location;
    HYPRE_Int             num_send_bytes;
    HYPRE_Int             num_recv_bytes;
+   HYPRE_Int             num_vectors;   /* persistent handles: vectors packed per message */
    void                 *send_data;
    void                 *recv_data;
    void                 *send_data_buffer;
    void                 *recv_data_buffer;
    HYPRE_Int             num_requests;
+   HYPRE_Int             num_send_requests; /* persistent handles: point-to-point sends */
    hypre_MPI_Request    *requests;
+   /* persistent handles on the neighborhood collective backend */
+   hypre_int            *neighbor_counts;   /* send counts/displs, recv counts/displs */
+   hypre_MPI_Datatype    neighbor_type;
 } hypre_ParCSRCommHandle;
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
@@ -62,9 +68,19 @@ typedef struct _hypre_ParCSRCommPkg
    /* remote communication information */
    hypre_MPI_Datatype               *send_mpi_types;
    hypre_MPI_Datatype               *recv_mpi_types;
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
-#endif
+   /* most recently used first */
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE]
+   [HYPRE_PERSISTENT_COMM_HANDLES_PER_JOB];
+   /* neighborhood collective backend: distributed graph communicator over the
+      union of send_procs and recv_procs, with per-neighbor counts and
+      displacements of the forward (job 1) exchange */
+   HYPRE_Int                         neighbor_coll;
+   MPI_Comm                          neighbor_comm;
+   HYPRE_Int                         num_neighbors;
+   hypre_int                        *neighbor_send_counts;
+   hypre_int                        *neighbor_send_displs;
+   hypre_int                        *neighbor_recv_counts;
+   hypre_int                        *neighbor_recv_displs;
 #if defined(HYPRE_USING_GPU)
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
    HYPRE_Complex                    *tmp_data;
@@ -97,6 +113,13 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgNeighborColl(comm_pkg)        (comm_pkg -> neighbor_coll)
+#define hypre_ParCSRCommPkgNeighborComm(comm_pkg)        (comm_pkg -> neighbor_comm)
+#define hypre_ParCSRCommPkgNumNeighbors(comm_pkg)        (comm_pkg -> num_neighbors)
+#define hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg)  (comm_pkg -> neighbor_send_counts)
+#define hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg)  (comm_pkg -> neighbor_send_displs)
+#define hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg)  (comm_pkg -> neighbor_recv_counts)
+#define hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg)  (comm_pkg -> neighbor_recv_displs)
 
 #if defined(HYPRE_USING_GPU)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -131,6 +154,10 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle)     (comm_handle -> recv_memory_location)
 #define hypre_ParCSRCommHandleNumSendBytes(comm_handle)           (comm_handle -> num_send_bytes)
 #define hypre_ParCSRCommHandleNumRecvBytes(comm_handle)           (comm_handle -> num_recv_bytes)
+#define hypre_ParCSRCommHandleNumVectors(comm_handle)             (comm_handle -> num_vectors)
+#define hypre_ParCSRCommHandleNumSendRequests(comm_handle)        (comm_handle -> num_send_requests)
+#define hypre_ParCSRCommHandleNeighborCounts(comm_handle)         (comm_handle -> neighbor_counts)
+#define hypre_ParCSRCommHandleNeighborType(comm_handle)           (comm_handle -> neighbor_type)
 #define hypre_ParCSRCommHandleSendData(comm_handle)               (comm_handle -> send_data)
 #define hypre_ParCSRCommHandleRecvData(comm_handle)               (comm_handle -> recv_data)
 #define hypre_ParCSRCommHandleSendDataBuffer(comm_handle)         (comm_handle -> send_data_buffer)
@@ -0,0 +1,689 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Symbolic/numeric split of the host products C = A*B and C = R^T*A*P.
+ * The plan create routines compute the product once with hypre_ParMatmul and
+ * keep its pattern, the exchange of the external rows of B, and the column
+ * maps; the execute routines then only recompute the values of C.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanPatternKey
+ *
+ * Hash of the local sparsity pattern of M (row pointers, column indices
+ * and col_map_offd), used to check that a plan is applied to matrices with
+ * the pattern it was built for.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ulonglongint
+hypre_ParCSRMatMatPlanPatternKey( hypre_ParCSRMatrix *M )
+{
+   hypre_CSRMatrix    *M_diag       = hypre_ParCSRMatrixDiag(M);
+   hypre_CSRMatrix    *M_offd       = hypre_ParCSRMatrixOffd(M);
+   HYPRE_Int          *M_diag_i     = hypre_CSRMatrixI(M_diag);
+   HYPRE_Int          *M_diag_j     = hypre_CSRMatrixJ(M_diag);
+   HYPRE_Int          *M_offd_i     = hypre_CSRMatrixI(M_offd);
+   HYPRE_Int          *M_offd_j     = hypre_CSRMatrixJ(M_offd);
+   HYPRE_BigInt       *col_map_offd = hypre_ParCSRMatrixColMapOffd(M);
+   HYPRE_Int           num_rows     = hypre_CSRMatrixNumRows(M_diag);
+   HYPRE_Int           num_cols     = hypre_CSRMatrixNumCols(M_offd);
+   hypre_ulonglongint  key          = (hypre_ulonglongint) num_rows;
+   HYPRE_Int           i;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) reduction(+:key) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      hypre_ulonglongint h = 14695981039346656037ULL;
+      HYPRE_Int          k;
+
+      for (k = M_diag_i[i]; k < M_diag_i[i + 1]; k++)
+      {
+         h = (h ^ (hypre_ulonglongint) M_diag_j[k]) * 1099511628211ULL;
+      }
+      h = (h ^ 0xFFFFFFFFULL) * 1099511628211ULL;
+      for (k = M_offd_i[i]; k < M_offd_i[i + 1]; k++)
+      {
+         h = (h ^ (hypre_ulonglongint) M_offd_j[k]) * 1099511628211ULL;
+      }
+      key += h * (2 * (hypre_ulonglongint) i + 1);
+   }
+
+   for (i = 0; i < num_cols; i++)
+   {
+      key = (key ^ (hypre_ulonglongint) col_map_offd[i]) * 1099511628211ULL;
+   }
+
+   return key;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanSizes
+ *
+ * Sizes and numbers of nonzeros of A, B and C: a cheap exact check, done on
+ * every execute, that the matrices can be used with the plan.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatMatPlanSizes( hypre_ParCSRMatrix *A,
+                             hypre_ParCSRMatrix *B,
+                             hypre_ParCSRMatrix *C,
+                             HYPRE_Int          *sizes )
+{
+   sizes[0] = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   sizes[1] = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(B));
+   sizes[2] = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(C));
+   sizes[3] = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(B));
+   sizes[4] = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   sizes[5] = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(B));
+   sizes[6] = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A));
+   sizes[7] = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A));
+   sizes[8] = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(B));
+   sizes[9] = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(B));
+   sizes[10] = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(C));
+   sizes[11] = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(C));
+}
+
+static HYPRE_Int
+hypre_ParCSRMatMatPlanSizesMatch( hypre_ParCSRMatMatPlan *plan,
+                                  hypre_ParCSRMatrix     *A,
+                                  hypre_ParCSRMatrix     *B,
+                                  hypre_ParCSRMatrix     *C )
+{
+   HYPRE_Int sizes[12], k;
+
+   hypre_ParCSRMatMatPlanSizes(A, B, C, sizes);
+
+   if (sizes[0] != plan->num_rows || sizes[1] != plan->num_cols_diag ||
+       sizes[2] != plan->num_cols_offd || sizes[3] != plan->num_rows_B ||
+       sizes[4] != plan->num_cols_offd_A || sizes[5] != plan->num_cols_offd_B)
+   {
+      return 0;
+   }
+
+   for (k = 0; k < 6; k++)
+   {
+      if (sizes[6 + k] != plan->num_nonzeros[k])
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanCreate
+ *
+ * Computes C = A*B and returns in *plan_ptr the plan for recomputing the
+ * values of C with hypre_ParCSRMatMatPlanExecute. Host matrices only.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatPlanCreate( hypre_ParCSRMatrix      *A,
+                              hypre_ParCSRMatrix      *B,
+                              hypre_ParCSRMatMatPlan **plan_ptr,
+                              hypre_ParCSRMatrix     **C_ptr )
+{
+   MPI_Comm                comm           = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix        *B_diag         = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix        *B_offd         = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int              *B_diag_i       = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int              *B_offd_i       = hypre_CSRMatrixI(B_offd);
+   HYPRE_BigInt           *col_map_offd_B = hypre_ParCSRMatrixColMapOffd(B);
+   HYPRE_Int               num_cols_offd_B = hypre_CSRMatrixNumCols(B_offd);
+   HYPRE_BigInt            first_col_diag = hypre_ParCSRMatrixFirstColDiag(B);
+   HYPRE_Int               num_cols_diag  = hypre_CSRMatrixNumCols(B_diag);
+
+   hypre_ParCSRMatMatPlan *plan;
+   hypre_ParCSRMatrix     *C;
+   HYPRE_Int               sizes[12];
+   hypre_ParCSRCommPkg    *comm_pkg_A, *comm_pkg;
+   hypre_CSRMatrix        *B_ext;
+   HYPRE_Int              *B_ext_i, *B_ext_j, *send_i, *map_B_to_C;
+   HYPRE_BigInt           *B_ext_big_j, *col_map_offd_C, col;
+   HYPRE_Int               num_cols_offd_C, num_sends, num_recvs, num_rows_send;
+   HYPRE_Int               num_rows_recv, num_procs, i, j, row;
+
+   *plan_ptr = NULL;
+   *C_ptr    = NULL;
+
+#if defined(HYPRE_USING_GPU)
+   if (hypre_GetExecPolicy2(hypre_ParCSRMatrixMemoryLocation(A),
+                            hypre_ParCSRMatrixMemoryLocation(B)) == HYPRE_EXEC_DEVICE)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "MatMat plans are only available on the host\n");
+      return hypre_error_flag;
+   }
+#endif
+
+   C = hypre_ParMatmul(A, B);
+   if (!C)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   col_map_offd_C  = hypre_ParCSRMatrixColMapOffd(C);
+   num_cols_offd_C = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(C));
+
+   plan = hypre_CTAlloc(hypre_ParCSRMatMatPlan, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatMatPlanSizes(A, B, C, sizes);
+   plan->num_rows        = sizes[0];
+   plan->num_cols_diag   = sizes[1];
+   plan->num_cols_offd   = sizes[2];
+   plan->num_rows_B      = sizes[3];
+   plan->num_cols_offd_A = sizes[4];
+   plan->num_cols_offd_B = sizes[5];
+   for (i = 0; i < 6; i++)
+   {
+      plan->num_nonzeros[i] = sizes[6 + i];
+   }
+   plan->pattern_key[0] = hypre_ParCSRMatMatPlanPatternKey(A);
+   plan->pattern_key[1] = hypre_ParCSRMatMatPlanPatternKey(B);
+   plan->pattern_key[2] = hypre_ParCSRMatMatPlanPatternKey(C);
+
+   /* col_map_offd_C is sorted and contains col_map_offd_B */
+   map_B_to_C = hypre_TAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+   for (i = 0, j = 0; i < num_cols_offd_B; i++)
+   {
+      while (col_map_offd_C[j] != col_map_offd_B[i])
+      {
+         j++;
+      }
+      map_B_to_C[i] = j;
+   }
+   plan->map_B_to_C = map_B_to_C;
+
+   /*-----------------------------------------------------------------------
+    * Pattern of the external rows of B and the exchange of their values.
+    * The rows are packed as in hypre_ParcsrGetExternalRowsInit: the diag
+    * entries of a row followed by its offd entries.
+    *-----------------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      B_ext       = hypre_ParCSRMatrixExtractBExt(B, A, 0);
+      B_ext_big_j = hypre_CSRMatrixBigJ(B_ext);
+      comm_pkg_A  = hypre_ParCSRMatrixCommPkg(A);
+
+      num_sends     = hypre_ParCSRCommPkgNumSends(comm_pkg_A);
+      num_recvs     = hypre_ParCSRCommPkgNumRecvs(comm_pkg_A);
+      num_rows_send = hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, num_sends);
+      num_rows_recv = hypre_ParCSRCommPkgRecvVecStart(comm_pkg_A, num_recvs);
+
+      B_ext_i = hypre_TAlloc(HYPRE_Int, num_rows_recv + 1, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(B_ext_i, hypre_CSRMatrixI(B_ext), HYPRE_Int, num_rows_recv + 1,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      B_ext_j = hypre_TAlloc(HYPRE_Int, B_ext_i[num_rows_recv], HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, col) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < B_ext_i[num_rows_recv]; i++)
+      {
+         col = B_ext_big_j[i];
+         if (col >= first_col_diag && col < first_col_diag + (HYPRE_BigInt) num_cols_diag)
+         {
+            B_ext_j[i] = (HYPRE_Int) (col - first_col_diag);
+         }
+         else
+         {
+            B_ext_j[i] = num_cols_diag + hypre_BigBinarySearch(col_map_offd_C, col,
+                                                                num_cols_offd_C);
+         }
+      }
+      hypre_CSRMatrixDestroy(B_ext);
+
+      send_i = hypre_TAlloc(HYPRE_Int, num_rows_send + 1, HYPRE_MEMORY_HOST);
+      send_i[0] = 0;
+      for (i = 0; i < num_rows_send; i++)
+      {
+         row = hypre_ParCSRCommPkgSendMapElmt(comm_pkg_A, i);
+         send_i[i + 1] = send_i[i] + B_diag_i[row + 1] - B_diag_i[row] +
+                         B_offd_i[row + 1] - B_offd_i[row];
+      }
+
+      comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgComm(comm_pkg)            = comm;
+      hypre_ParCSRCommPkgNumSends(comm_pkg)        = num_sends;
+      hypre_ParCSRCommPkgNumRecvs(comm_pkg)        = num_recvs;
+      hypre_ParCSRCommPkgSendProcs(comm_pkg)       = hypre_TAlloc(HYPRE_Int, num_sends,
+                                                                  HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgRecvProcs(comm_pkg)       = hypre_TAlloc(HYPRE_Int, num_recvs,
+                                                                  HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgSendMapStarts(comm_pkg)   = hypre_TAlloc(HYPRE_Int, num_sends + 1,
+                                                                  HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgRecvVecStarts(comm_pkg)   = hypre_TAlloc(HYPRE_Int, num_recvs + 1,
+                                                                  HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgSendMapElmts(comm_pkg)    = hypre_TAlloc(HYPRE_Int, num_rows_send,
+                                                                  HYPRE_MEMORY_HOST);
+
+      hypre_TMemcpy(hypre_ParCSRCommPkgSendProcs(comm_pkg),
+                    hypre_ParCSRCommPkgSendProcs(comm_pkg_A), HYPRE_Int, num_sends,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRCommPkgRecvProcs(comm_pkg),
+                    hypre_ParCSRCommPkgRecvProcs(comm_pkg_A), HYPRE_Int, num_recvs,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRCommPkgSendMapElmts(comm_pkg),
+                    hypre_ParCSRCommPkgSendMapElmts(comm_pkg_A), HYPRE_Int, num_rows_send,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      for (i = 0; i <= num_sends; i++)
+      {
+         hypre_ParCSRCommPkgSendMapStart(comm_pkg, i) =
+            send_i[hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, i)];
+      }
+      for (i = 0; i <= num_recvs; i++)
+      {
+         hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i) =
+            B_ext_i[hypre_ParCSRCommPkgRecvVecStart(comm_pkg_A, i)];
+      }
+
+      plan->comm_pkg      = comm_pkg;
+      plan->num_send_rows = num_rows_send;
+      plan->send_i        = send_i;
+      plan->B_ext_i       = B_ext_i;
+      plan->B_ext_j       = B_ext_j;
+   }
+
+   *plan_ptr = plan;
+   *C_ptr    = C;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanMatches
+ *
+ * Returns 1 if the local patterns of A, B and C are the ones the plan was
+ * built for, 0 otherwise. The patterns are hashed, so this is meant to be
+ * called once before the plan is reused, not before every execute.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatPlanMatches( hypre_ParCSRMatMatPlan *plan,
+                               hypre_ParCSRMatrix     *A,
+                               hypre_ParCSRMatrix     *B,
+                               hypre_ParCSRMatrix     *C )
+{
+   return ( hypre_ParCSRMatMatPlanSizesMatch(plan, A, B, C) &&
+            hypre_ParCSRMatMatPlanPatternKey(A) == plan->pattern_key[0] &&
+            hypre_ParCSRMatMatPlanPatternKey(B) == plan->pattern_key[1] &&
+            hypre_ParCSRMatMatPlanPatternKey(C) == plan->pattern_key[2] );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanExecute
+ *
+ * Recomputes the values of C = A*B, where A, B and C have the patterns of
+ * the matrices the plan was created with (C may be a copy of the product
+ * returned by hypre_ParCSRMatMatPlanCreate). Only the sizes and numbers of
+ * nonzeros are checked here (see hypre_ParCSRMatMatPlanMatches); an entry
+ * of the product outside the pattern of C is reported as an error.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatPlanExecute( hypre_ParCSRMatMatPlan *plan,
+                               hypre_ParCSRMatrix     *A,
+                               hypre_ParCSRMatrix     *B,
+                               hypre_ParCSRMatrix     *C )
+{
+   hypre_CSRMatrix        *A_diag        = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *A_offd        = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix        *B_diag        = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix        *B_offd        = hypre_ParCSRMatrixOffd(B);
+   hypre_CSRMatrix        *C_diag        = hypre_ParCSRMatrixDiag(C);
+   hypre_CSRMatrix        *C_offd        = hypre_ParCSRMatrixOffd(C);
+
+   HYPRE_Int              *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int              *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int              *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int              *B_diag_i      = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int              *B_diag_j      = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Complex          *B_diag_data   = hypre_CSRMatrixData(B_diag);
+   HYPRE_Int              *B_offd_i      = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int              *B_offd_j      = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Complex          *B_offd_data   = hypre_CSRMatrixData(B_offd);
+   HYPRE_Int              *C_diag_i      = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int              *C_diag_j      = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Complex          *C_diag_data   = hypre_CSRMatrixData(C_diag);
+   HYPRE_Int              *C_offd_i      = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int              *C_offd_j      = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Complex          *C_offd_data   = hypre_CSRMatrixData(C_offd);
+
+   HYPRE_Int               num_rows      = plan->num_rows;
+   HYPRE_Int               num_cols_diag = plan->num_cols_diag;
+   HYPRE_Int               num_cols_offd = plan->num_cols_offd;
+   HYPRE_Int              *map_B_to_C    = plan->map_B_to_C;
+   HYPRE_Int              *B_ext_i       = plan->B_ext_i;
+   HYPRE_Int              *B_ext_j       = plan->B_ext_j;
+   hypre_ParCSRCommPkg    *comm_pkg      = plan->comm_pkg;
+
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Complex          *send_data = NULL, *B_ext_data = NULL;
+   HYPRE_Int               num_sends, num_recvs, num_rows_send, i;
+   HYPRE_Int               outside = 0;
+
+   if (!hypre_ParCSRMatMatPlanSizesMatch(plan, A, B, C))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrices do not match the MatMat plan\n");
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Start the exchange of the values of B_ext
+    *-----------------------------------------------------------------------*/
+
+   comm_handle = NULL;
+   if (comm_pkg)
+   {
+      num_sends     = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      num_recvs     = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+      num_rows_send = plan->num_send_rows;
+
+      send_data  = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                HYPRE_MEMORY_HOST);
+      B_ext_data = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs),
+                                HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows_send; i++)
+      {
+         HYPRE_Int row = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i);
+         HYPRE_Int pos = plan->send_i[i];
+         HYPRE_Int k;
+
+         for (k = B_diag_i[row]; k < B_diag_i[row + 1]; k++)
+         {
+            send_data[pos++] = B_diag_data[k];
+         }
+         for (k = B_offd_i[row]; k < B_offd_i[row + 1]; k++)
+         {
+            send_data[pos++] = B_offd_data[k];
+         }
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, send_data, B_ext_data);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Numeric product on the fixed pattern of C. The marker of a column holds
+    * its position in the current row of C.
+    *-----------------------------------------------------------------------*/
+
+   hypre_Memset(C_diag_data, 0, hypre_CSRMatrixNumNonzeros(C_diag) * sizeof(HYPRE_Complex),
+                HYPRE_MEMORY_HOST);
+   hypre_Memset(C_offd_data, 0, hypre_CSRMatrixNumNonzeros(C_offd) * sizeof(HYPRE_Complex),
+                HYPRE_MEMORY_HOST);
+
+   if (comm_handle)
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i) reduction(+:outside)
+#endif
+   {
+      HYPRE_Int  *marker;
+      HYPRE_Int   ns, ne, ia, ib, k, col, pos;
+      HYPRE_Complex a;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows);
+      marker = hypre_TAlloc(HYPRE_Int, num_cols_diag + num_cols_offd, HYPRE_MEMORY_HOST);
+      for (k = 0; k < num_cols_diag + num_cols_offd; k++)
+      {
+         marker[k] = -1;
+      }
+
+      for (i = ns; i < ne; i++)
+      {
+         for (k = C_diag_i[i]; k < C_diag_i[i + 1]; k++)
+         {
+            marker[C_diag_j[k]] = k;
+         }
+         for (k = C_offd_i[i]; k < C_offd_i[i + 1]; k++)
+         {
+            marker[num_cols_diag + C_offd_j[k]] = k;
+         }
+
+         for (ia = A_diag_i[i]; ia < A_diag_i[i + 1]; ia++)
+         {
+            k = A_diag_j[ia];
+            a = A_diag_data[ia];
+            for (ib = B_diag_i[k]; ib < B_diag_i[k + 1]; ib++)
+            {
+               pos = marker[B_diag_j[ib]];
+               if (pos < C_diag_i[i] || pos >= C_diag_i[i + 1])
+               {
+                  outside++;
+                  continue;
+               }
+               C_diag_data[pos] += a * B_diag_data[ib];
+            }
+            for (ib = B_offd_i[k]; ib < B_offd_i[k + 1]; ib++)
+            {
+               pos = marker[num_cols_diag + map_B_to_C[B_offd_j[ib]]];
+               if (pos < C_offd_i[i] || pos >= C_offd_i[i + 1])
+               {
+                  outside++;
+                  continue;
+               }
+               C_offd_data[pos] += a * B_offd_data[ib];
+            }
+         }
+
+         if (!comm_pkg)
+         {
+            continue;
+         }
+
+         for (ia = A_offd_i[i]; ia < A_offd_i[i + 1]; ia++)
+         {
+            k = A_offd_j[ia];
+            a = A_offd_data[ia];
+            for (ib = B_ext_i[k]; ib < B_ext_i[k + 1]; ib++)
+            {
+               col = B_ext_j[ib];
+               pos = marker[col];
+               if (col < num_cols_diag)
+               {
+                  if (pos < C_diag_i[i] || pos >= C_diag_i[i + 1])
+                  {
+                     outside++;
+                     continue;
+                  }
+                  C_diag_data[pos] += a * B_ext_data[ib];
+               }
+               else
+               {
+                  if (pos < C_offd_i[i] || pos >= C_offd_i[i + 1])
+                  {
+                     outside++;
+                     continue;
+                  }
+                  C_offd_data[pos] += a * B_ext_data[ib];
+               }
+            }
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(send_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(B_ext_data, HYPRE_MEMORY_HOST);
+
+   if (outside)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Product has entries outside the MatMat plan\n");
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatPlanDestroy( hypre_ParCSRMatMatPlan *plan )
+{
+   if (plan)
+   {
+      if (plan->comm_pkg)
+      {
+         hypre_MatvecCommPkgDestroy(plan->comm_pkg);
+      }
+      hypre_TFree(plan->map_B_to_C, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->send_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->B_ext_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->B_ext_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanCreate
+ *
+ * Computes RAP = R^T*A*P as (R^T)*(A*P) and returns in *plan_ptr the plan
+ * for recomputing its values with hypre_ParCSRRAPPlanExecute. The plan
+ * keeps R^T, so only A and the values of P may change afterwards, unless
+ * R^T is refreshed with hypre_ParCSRRAPPlanUpdateR.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanCreate( hypre_ParCSRMatrix   *R,
+                           hypre_ParCSRMatrix   *A,
+                           hypre_ParCSRMatrix   *P,
+                           hypre_ParCSRRAPPlan **plan_ptr,
+                           hypre_ParCSRMatrix  **RAP_ptr )
+{
+   hypre_ParCSRRAPPlan *plan;
+
+   *plan_ptr = NULL;
+   *RAP_ptr  = NULL;
+
+   plan = hypre_CTAlloc(hypre_ParCSRRAPPlan, 1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRMatrixTranspose(R, &plan->RT, 1);
+   hypre_ParCSRMatMatPlanCreate(A, P, &plan->AP_plan, &plan->AP);
+   if (plan->AP)
+   {
+      hypre_ParCSRMatMatPlanCreate(plan->RT, plan->AP, &plan->RAP_plan, RAP_ptr);
+   }
+
+   if (!*RAP_ptr)
+   {
+      hypre_ParCSRRAPPlanDestroy(plan);
+      return hypre_error_flag;
+   }
+
+   *plan_ptr = plan;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanMatches
+ *
+ * Returns 1 if the local patterns of A, P and RAP are the ones the plan was
+ * built for, 0 otherwise. R^T and A*P belong to the plan, so only A, P and
+ * RAP are hashed, after the cheap size checks.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanMatches( hypre_ParCSRRAPPlan *plan,
+                            hypre_ParCSRMatrix  *A,
+                            hypre_ParCSRMatrix  *P,
+                            hypre_ParCSRMatrix  *RAP )
+{
+   return ( hypre_ParCSRMatMatPlanSizesMatch(plan->AP_plan, A, P, plan->AP) &&
+            hypre_ParCSRMatMatPlanSizesMatch(plan->RAP_plan, plan->RT, plan->AP, RAP) &&
+            hypre_ParCSRMatMatPlanPatternKey(A)   == plan->AP_plan->pattern_key[0] &&
+            hypre_ParCSRMatMatPlanPatternKey(P)   == plan->AP_plan->pattern_key[1] &&
+            hypre_ParCSRMatMatPlanPatternKey(RAP) == plan->RAP_plan->pattern_key[2] );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanExecute
+ *
+ * Recomputes the values of RAP = R^T*A*P for the current values of A and P.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanExecute( hypre_ParCSRRAPPlan *plan,
+                            hypre_ParCSRMatrix  *A,
+                            hypre_ParCSRMatrix  *P,
+                            hypre_ParCSRMatrix  *RAP )
+{
+   hypre_ParCSRMatMatPlanExecute(plan->AP_plan, A, P, plan->AP);
+   hypre_ParCSRMatMatPlanExecute(plan->RAP_plan, plan->RT, plan->AP, RAP);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanUpdateR
+ *
+ * Refreshes the values of R^T kept by the plan after the values of R
+ * changed. The pattern of R must be the one the plan was built for.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanUpdateR( hypre_ParCSRRAPPlan *plan,
+                            hypre_ParCSRMatrix  *R )
+{
+   hypre_ParCSRMatrix *RT;
+
+   hypre_ParCSRMatrixTranspose(R, &RT, 1);
+
+   hypre_TMemcpy(hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(plan->RT)),
+                 hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(RT)), HYPRE_Complex,
+                 hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(RT)),
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(plan->RT)),
+                 hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(RT)), HYPRE_Complex,
+                 hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(RT)),
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatrixDestroy(RT);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanDestroy( hypre_ParCSRRAPPlan *plan )
+{
+   if (plan)
+   {
+      hypre_ParCSRMatrixDestroy(plan->RT);
+      hypre_ParCSRMatrixDestroy(plan->AP);
+      hypre_ParCSRMatMatPlanDestroy(plan->AP_plan);
+      hypre_ParCSRMatMatPlanDestroy(plan->RAP_plan);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
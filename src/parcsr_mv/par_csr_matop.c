@@ -6213,6 +6213,13 @@ hypre_ParCSRMatrixDropSmallEntries( hypre_ParCSRMatrix *A,
       ierr = hypre_ParCSRMatrixDropSmallEntriesHost(A, tol, type);
    }
 
+   hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixDiag(A));
+   hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixOffd(A));
+   hypre_CSRMatrixFloatDestroy(hypre_ParCSRMatrixDiag(A));
+   hypre_CSRMatrixFloatDestroy(hypre_ParCSRMatrixOffd(A));
+   hypre_CSRMatrixShortJDestroy(hypre_ParCSRMatrixDiag(A));
+   hypre_CSRMatrixShortJDestroy(hypre_ParCSRMatrixOffd(A));
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    hypre_GpuProfilingPopRange();
 #endif
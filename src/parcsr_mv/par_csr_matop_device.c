@@ -1707,22 +1707,36 @@ hypre_ParCSRDiagScaleVector( HYPRE_ParCSRMatrix HA,
    HYPRE_Real *A_data = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(A));
    HYPRE_Int *A_i = hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(A));
    HYPRE_Int local_size = hypre_VectorSize(hypre_ParVectorLocalVector(x));
+   /* multivectors: every column is scaled with the same diagonal */
+   HYPRE_Int num_vectors = hypre_VectorNumVectors(hypre_ParVectorLocalVector(x));
+   HYPRE_Int x_vstride = hypre_VectorVectorStride(hypre_ParVectorLocalVector(x));
+   HYPRE_Int y_vstride = hypre_VectorVectorStride(hypre_ParVectorLocalVector(y));
+   HYPRE_Int x_istride = hypre_VectorIndexStride(hypre_ParVectorLocalVector(x));
+   HYPRE_Int y_istride = hypre_VectorIndexStride(hypre_ParVectorLocalVector(y));
    HYPRE_Int ierr = 0;
+   HYPRE_Int j;
+
+   for (j = 0; j < num_vectors; j++)
+   {
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-   hypreDevice_DiagScaleVector(local_size, A_i, A_data, y_data, 0.0, x_data);
-   //hypre_SyncComputeStream(hypre_handle());
+      hypreDevice_DiagScaleVector(local_size, A_i, A_data, y_data + j * y_vstride, 0.0,
+                                  x_data + j * x_vstride);
+      //hypre_SyncComputeStream(hypre_handle());
 #else /* #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) */
-   HYPRE_Int i;
+      HYPRE_Real *xj_data = x_data + j * x_vstride;
+      HYPRE_Real *yj_data = y_data + j * y_vstride;
+      HYPRE_Int i;
 #if defined(HYPRE_USING_DEVICE_OPENMP)
-   #pragma omp target teams distribute parallel for private(i) is_device_ptr(x_data,y_data,A_data,A_i)
+      #pragma omp target teams distribute parallel for private(i) is_device_ptr(xj_data,yj_data,A_data,A_i)
 #elif defined(HYPRE_USING_OPENMP)
-   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
-   for (i = 0; i < local_size; i++)
-   {
-      x_data[i] = y_data[i] / A_data[A_i[i]];
-   }
+      for (i = 0; i < local_size; i++)
+      {
+         xj_data[i * x_istride] = yj_data[i * y_istride] / A_data[A_i[i]];
+      }
 #endif /* #if defined(HYPRE_USING_CUDA) */
+   }
 
    return ierr;
 }
@@ -108,12 +108,15 @@ hypre_ParCSRMatrixCreate( MPI_Comm      comm,
    hypre_ParCSRMatrixColMapOffd(matrix)       = NULL;
    hypre_ParCSRMatrixDeviceColMapOffd(matrix) = NULL;
    hypre_ParCSRMatrixProcOrdering(matrix)     = NULL;
+   hypre_ParCSRMatrixRelaxBlocks(matrix)      = NULL;
+   hypre_ParCSRMatrixRelaxColors(matrix)      = NULL;
 
    hypre_ParCSRMatrixAssumedPartition(matrix) = NULL;
    hypre_ParCSRMatrixOwnsAssumedPartition(matrix) = 1;
 
    hypre_ParCSRMatrixCommPkg(matrix)  = NULL;
    hypre_ParCSRMatrixCommPkgT(matrix) = NULL;
+   hypre_ParCSRMatrixNeighborColl(matrix) = 0;
 
    /* set defaults */
    hypre_ParCSRMatrixOwnsData(matrix)     = 1;
@@ -194,6 +197,8 @@ hypre_ParCSRMatrixDestroy( hypre_ParCSRMatrix *matrix )
       {
          hypre_TFree(hypre_ParCSRMatrixProcOrdering(matrix), HYPRE_MEMORY_HOST);
       }
+      hypre_TFree(hypre_ParCSRMatrixRelaxBlocks(matrix), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatrixRelaxColors(matrix), HYPRE_MEMORY_HOST);
 
       hypre_TFree(matrix->bdiaginv, HYPRE_MEMORY_HOST);
       if (matrix->bdiaginv_comm_pkg)
@@ -477,6 +482,45 @@ hypre_ParCSRMatrixSetPatternOnly( hypre_ParCSRMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSetNeighborColl
+ *
+ * Selects the MPI neighborhood collective backend (neighbor_coll = 1) or
+ * point-to-point messages (neighbor_coll = 0) for the halo exchanges on the
+ * communication package of the matrix. Collective over the matrix
+ * communicator, since it may create or free a distributed graph communicator.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSetNeighborColl( hypre_ParCSRMatrix *matrix,
+                                   HYPRE_Int           neighbor_coll )
+{
+   hypre_ParCSRCommPkg *comm_pkg;
+
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatrixNeighborColl(matrix) = neighbor_coll;
+
+   comm_pkg = hypre_ParCSRMatrixCommPkg(matrix);
+   if (comm_pkg)
+   {
+      if (neighbor_coll)
+      {
+         hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+      }
+      else
+      {
+         hypre_ParCSRCommPkgDestroyNeighborComm(comm_pkg);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixRead
  *--------------------------------------------------------------------------*/
@@ -2870,6 +2914,34 @@ hypre_ParCSRMatrixSetConstantValues( hypre_ParCSRMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixConvertToFloat
+ *
+ * Stores the values of the diag and offd blocks (and of their transposes,
+ * if present) in single precision. Afterwards, A may only be used in
+ * matvecs and in the kernels that handle float values; see
+ * hypre_CSRMatrixConvertToFloat.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixConvertToFloat( hypre_ParCSRMatrix *A )
+{
+   hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixDiag(A));
+   hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixOffd(A));
+
+   if (hypre_ParCSRMatrixDiagT(A))
+   {
+      hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixDiagT(A));
+   }
+
+   if (hypre_ParCSRMatrixOffdT(A))
+   {
+      hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixOffdT(A));
+   }
+
+   return hypre_error_flag;
+}
+
 void
 hypre_ParCSRMatrixCopyColMapOffdToDevice(hypre_ParCSRMatrix *A)
 {
@@ -2885,3 +2957,221 @@ hypre_ParCSRMatrixCopyColMapOffdToDevice(hypre_ParCSRMatrix *A)
    }
 #endif
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRedistribute
+ *
+ * Agglomerates the square matrix A onto fewer ranks: the rows of each group
+ * of group_size consecutive ranks of the communicator of A are moved to the
+ * first rank of the group (its leader). Since the groups are contiguous in
+ * the row partitioning, the global numbering of A is kept.
+ *
+ * On return, group_comm_ptr holds the communicator of the group of the
+ * calling rank, in which the leader has rank 0. A_new_ptr holds the
+ * agglomerated matrix, which lives on the communicator of the leaders, on
+ * the leaders and NULL elsewhere. Both communicators are to be freed by the
+ * caller. Host memory only.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixRedistribute( hypre_ParCSRMatrix  *A,
+                                HYPRE_Int            group_size,
+                                MPI_Comm            *group_comm_ptr,
+                                hypre_ParCSRMatrix **A_new_ptr )
+{
+   MPI_Comm             comm = hypre_ParCSRMatrixComm(A);
+   HYPRE_BigInt         global_num_rows = hypre_ParCSRMatrixGlobalNumRows(A);
+   MPI_Comm             group_comm, new_comm;
+
+   hypre_CSRMatrix     *A_local;
+   HYPRE_Int           *A_local_i;
+   HYPRE_Int           *row_sizes;
+   HYPRE_Int            num_rows, num_nonzeros;
+   HYPRE_Int            local_sizes[2];
+
+   HYPRE_Int           *group_sizes = NULL;
+   HYPRE_Int           *row_counts = NULL, *row_displs = NULL;
+   HYPRE_Int           *nnz_counts = NULL, *nnz_displs = NULL;
+   HYPRE_Int           *new_i = NULL;
+   HYPRE_BigInt        *new_j = NULL;
+   HYPRE_Complex       *new_data = NULL;
+
+   hypre_ParCSRMatrix  *A_new = NULL;
+   HYPRE_Int            my_id, group_nprocs, is_leader, i;
+
+   *group_comm_ptr = hypre_MPI_COMM_NULL;
+   *A_new_ptr = NULL;
+
+   if (group_size < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (global_num_rows != hypre_ParCSRMatrixGlobalNumCols(A) ||
+       hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Redistribution requires a square matrix in host memory!\n");
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   is_leader = !(my_id % group_size);
+
+   hypre_MPI_Comm_split(comm, my_id / group_size, my_id, &group_comm);
+   hypre_MPI_Comm_split(comm, is_leader ? 0 : hypre_MPI_UNDEFINED, my_id, &new_comm);
+   hypre_MPI_Comm_size(group_comm, &group_nprocs);
+
+   /* local rows with global column indices */
+   A_local      = hypre_MergeDiagAndOffd(A);
+   A_local_i    = hypre_CSRMatrixI(A_local);
+   num_rows     = hypre_CSRMatrixNumRows(A_local);
+   num_nonzeros = A_local_i[num_rows];
+
+   row_sizes = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      row_sizes[i] = A_local_i[i + 1] - A_local_i[i];
+   }
+
+   local_sizes[0] = num_rows;
+   local_sizes[1] = num_nonzeros;
+   if (is_leader)
+   {
+      group_sizes = hypre_TAlloc(HYPRE_Int, 2 * group_nprocs, HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gather(local_sizes, 2, HYPRE_MPI_INT, group_sizes, 2, HYPRE_MPI_INT, 0, group_comm);
+
+   if (is_leader)
+   {
+      row_counts = hypre_TAlloc(HYPRE_Int, group_nprocs, HYPRE_MEMORY_HOST);
+      row_displs = hypre_TAlloc(HYPRE_Int, group_nprocs + 1, HYPRE_MEMORY_HOST);
+      nnz_counts = hypre_TAlloc(HYPRE_Int, group_nprocs, HYPRE_MEMORY_HOST);
+      nnz_displs = hypre_TAlloc(HYPRE_Int, group_nprocs + 1, HYPRE_MEMORY_HOST);
+
+      row_displs[0] = nnz_displs[0] = 0;
+      for (i = 0; i < group_nprocs; i++)
+      {
+         row_counts[i] = group_sizes[2 * i];
+         nnz_counts[i] = group_sizes[2 * i + 1];
+         row_displs[i + 1] = row_displs[i] + row_counts[i];
+         nnz_displs[i + 1] = nnz_displs[i] + nnz_counts[i];
+      }
+
+      new_i    = hypre_TAlloc(HYPRE_Int, row_displs[group_nprocs] + 1, HYPRE_MEMORY_HOST);
+      new_j    = hypre_TAlloc(HYPRE_BigInt, nnz_displs[group_nprocs], HYPRE_MEMORY_HOST);
+      new_data = hypre_TAlloc(HYPRE_Complex, nnz_displs[group_nprocs], HYPRE_MEMORY_HOST);
+      new_i[0] = 0;
+   }
+
+   hypre_MPI_Gatherv(row_sizes, num_rows, HYPRE_MPI_INT,
+                     is_leader ? &new_i[1] : NULL, row_counts, row_displs,
+                     HYPRE_MPI_INT, 0, group_comm);
+   hypre_MPI_Gatherv(hypre_CSRMatrixBigJ(A_local), num_nonzeros, HYPRE_MPI_BIG_INT,
+                     new_j, nnz_counts, nnz_displs, HYPRE_MPI_BIG_INT, 0, group_comm);
+   hypre_MPI_Gatherv(hypre_CSRMatrixData(A_local), num_nonzeros, HYPRE_MPI_COMPLEX,
+                     new_data, nnz_counts, nnz_displs, HYPRE_MPI_COMPLEX, 0, group_comm);
+
+   hypre_CSRMatrixDestroy(A_local);
+   hypre_TFree(row_sizes, HYPRE_MEMORY_HOST);
+
+   if (is_leader)
+   {
+      HYPRE_Int      new_num_rows = row_displs[group_nprocs];
+      HYPRE_Int      new_num_nonzeros = nnz_displs[group_nprocs];
+      HYPRE_BigInt   row_starts[2];
+      HYPRE_BigInt  *col_map_offd;
+      HYPRE_Int     *diag_i, *diag_j, *offd_i, *offd_j;
+      HYPRE_Complex *diag_data, *offd_data;
+      HYPRE_Int      num_cols_offd, nnz_diag, nnz_offd, j;
+
+      /* the group owns the rows of its leader and of the ranks that follow it */
+      row_starts[0] = hypre_ParCSRMatrixFirstRowIndex(A);
+      row_starts[1] = row_starts[0] + (HYPRE_BigInt) new_num_rows;
+
+      for (i = 0; i < new_num_rows; i++)
+      {
+         new_i[i + 1] += new_i[i];
+      }
+
+      /* off-diagonal columns: sorted and unique */
+      col_map_offd = hypre_TAlloc(HYPRE_BigInt, new_num_nonzeros, HYPRE_MEMORY_HOST);
+      nnz_offd = 0;
+      for (j = 0; j < new_num_nonzeros; j++)
+      {
+         if (new_j[j] < row_starts[0] || new_j[j] >= row_starts[1])
+         {
+            col_map_offd[nnz_offd++] = new_j[j];
+         }
+      }
+      nnz_diag = new_num_nonzeros - nnz_offd;
+
+      hypre_BigQsort0(col_map_offd, 0, nnz_offd - 1);
+      num_cols_offd = 0;
+      for (j = 0; j < nnz_offd; j++)
+      {
+         if (!num_cols_offd || col_map_offd[j] != col_map_offd[num_cols_offd - 1])
+         {
+            col_map_offd[num_cols_offd++] = col_map_offd[j];
+         }
+      }
+
+      A_new = hypre_ParCSRMatrixCreate(new_comm, global_num_rows, global_num_rows,
+                                       row_starts, row_starts,
+                                       num_cols_offd, nnz_diag, nnz_offd);
+      hypre_ParCSRMatrixInitialize_v2(A_new, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRMatrixColMapOffd(A_new), col_map_offd, HYPRE_BigInt,
+                    num_cols_offd, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TFree(col_map_offd, HYPRE_MEMORY_HOST);
+      col_map_offd = hypre_ParCSRMatrixColMapOffd(A_new);
+
+      diag_i    = hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(A_new));
+      diag_j    = hypre_CSRMatrixJ(hypre_ParCSRMatrixDiag(A_new));
+      diag_data = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(A_new));
+      offd_i    = hypre_CSRMatrixI(hypre_ParCSRMatrixOffd(A_new));
+      offd_j    = hypre_CSRMatrixJ(hypre_ParCSRMatrixOffd(A_new));
+      offd_data = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(A_new));
+
+      /* the entries keep their order, so the diagonal stays first in its row */
+      nnz_diag = nnz_offd = 0;
+      for (i = 0; i < new_num_rows; i++)
+      {
+         diag_i[i] = nnz_diag;
+         offd_i[i] = nnz_offd;
+         for (j = new_i[i]; j < new_i[i + 1]; j++)
+         {
+            if (new_j[j] < row_starts[0] || new_j[j] >= row_starts[1])
+            {
+               offd_j[nnz_offd] = hypre_BigBinarySearch(col_map_offd, new_j[j], num_cols_offd);
+               offd_data[nnz_offd++] = new_data[j];
+            }
+            else
+            {
+               diag_j[nnz_diag] = (HYPRE_Int) (new_j[j] - row_starts[0]);
+               diag_data[nnz_diag++] = new_data[j];
+            }
+         }
+      }
+      diag_i[new_num_rows] = nnz_diag;
+      offd_i[new_num_rows] = nnz_offd;
+
+      hypre_ParCSRMatrixSetNumNonzeros(A_new);
+      hypre_ParCSRMatrixSetDNumNonzeros(A_new);
+      hypre_MatvecCommPkgCreate(A_new);
+
+      hypre_TFree(group_sizes, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_counts, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_displs, HYPRE_MEMORY_HOST);
+      hypre_TFree(nnz_counts, HYPRE_MEMORY_HOST);
+      hypre_TFree(nnz_displs, HYPRE_MEMORY_HOST);
+      hypre_TFree(new_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(new_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(new_data, HYPRE_MEMORY_HOST);
+   }
+
+   *group_comm_ptr = group_comm;
+   *A_new_ptr = A_new;
+
+   return hypre_error_flag;
+}
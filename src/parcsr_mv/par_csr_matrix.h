@@ -54,6 +54,8 @@ typedef struct hypre_ParCSRMatrix_struct
 
    hypre_ParCSRCommPkg  *comm_pkg;
    hypre_ParCSRCommPkg  *comm_pkgT;
+   /* use MPI neighborhood collectives in the comm_pkg created for matvecs */
+   HYPRE_Int             neighbor_coll;
 
    /* Does the ParCSRMatrix create/destroy `diag', `offd', `col_map_offd'? */
    HYPRE_Int             owns_data;
@@ -71,6 +73,12 @@ typedef struct hypre_ParCSRMatrix_struct
    /* Array to store ordering of local diagonal block to relax. In particular,
    used for triangulr matrices that are not ordered to be triangular. */
    HYPRE_Int            *proc_ordering;
+   /* Cache-sized blocks of local rows and their coloring, used by the
+      threaded hybrid Gauss-Seidel smoothers (see hypre_BoomerAMGRelaxBlocksSetup) */
+   HYPRE_Int            *relax_blocks;
+   /* Color classes of the rows for the multicolor Gauss-Seidel smoothers
+      (see hypre_BoomerAMGRelaxColorsSetup) */
+   HYPRE_Int            *relax_colors;
 
    /* Save block diagonal inverse */
    HYPRE_Int             bdiag_size;
@@ -107,6 +115,7 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixColStarts(matrix)              ((matrix) -> col_starts)
 #define hypre_ParCSRMatrixCommPkg(matrix)                ((matrix) -> comm_pkg)
 #define hypre_ParCSRMatrixCommPkgT(matrix)               ((matrix) -> comm_pkgT)
+#define hypre_ParCSRMatrixNeighborColl(matrix)           ((matrix) -> neighbor_coll)
 #define hypre_ParCSRMatrixOwnsData(matrix)               ((matrix) -> owns_data)
 #define hypre_ParCSRMatrixNumNonzeros(matrix)            ((matrix) -> num_nonzeros)
 #define hypre_ParCSRMatrixDNumNonzeros(matrix)           ((matrix) -> d_num_nonzeros)
@@ -116,6 +125,8 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixRelaxBlocks(matrix)            ((matrix) -> relax_blocks)
+#define hypre_ParCSRMatrixRelaxColors(matrix)            ((matrix) -> relax_colors)
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) || defined(HYPRE_USING_SYCL)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -196,4 +207,79 @@ typedef struct
 #define hypre_ParCSRBooleanMatrix_Get_Rowindices(matrix)    ((matrix)->rowindices)
 #define hypre_ParCSRBooleanMatrix_Get_Getrowactive(matrix)  ((matrix)->getrowactive)
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlan
+ *
+ * Symbolic part of the host product C = A*B, so that the values of C can be
+ * recomputed for new values of A and B with unchanged sparsity patterns.
+ * It holds the value exchange of the external rows of B (B_ext) and the
+ * columns of B and B_ext mapped to the local columns of C.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int            num_rows;          /* local rows of A and C */
+   HYPRE_Int            num_cols_diag;     /* local columns of B and C */
+   HYPRE_Int            num_cols_offd;     /* off-processor columns of C */
+   HYPRE_Int            num_rows_B;
+   HYPRE_Int            num_cols_offd_A;
+   HYPRE_Int            num_cols_offd_B;
+
+   /* nonzeros of the diag and offd parts of A, B and C, checked on every
+    * execute, and keys of their local patterns, checked by the Matches
+    * routines */
+   HYPRE_Int            num_nonzeros[6];
+   hypre_ulonglongint   pattern_key[3];
+
+   HYPRE_Int           *map_B_to_C;        /* offd column of B -> offd column of C */
+
+   /* value exchange of B_ext: the starts of comm_pkg count nonzeros, its
+    * send_map_elmts hold the local rows of B that are sent */
+   hypre_ParCSRCommPkg *comm_pkg;
+   HYPRE_Int            num_send_rows;
+   HYPRE_Int           *send_i;            /* offsets of the sent rows in the send buffer */
+   HYPRE_Int           *B_ext_i;
+   HYPRE_Int           *B_ext_j;           /* local columns of C: num_cols_diag + offd column */
+
+} hypre_ParCSRMatMatPlan;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlan
+ *
+ * Plan for the Galerkin product R^T*A*P computed as (R^T)*(A*P). R^T is
+ * kept by the plan, so the values of R only change through
+ * hypre_ParCSRRAPPlanUpdateR.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRMatrix     *RT;
+   hypre_ParCSRMatrix     *AP;
+   hypre_ParCSRMatMatPlan *AP_plan;
+   hypre_ParCSRMatMatPlan *RAP_plan;
+
+} hypre_ParCSRRAPPlan;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRBinaryView
+ *
+ * Local rows of a binary matrix file mapped into memory. The row pointers
+ * and values of matrix point into the mapping, and so do its global column
+ * indices (BigJ) unless the file is compressed.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   void               *addr;              /* start of the mapping */
+   size_t              length;            /* length of the mapping in bytes */
+
+   HYPRE_BigInt        global_num_rows;
+   HYPRE_BigInt        global_num_cols;
+   HYPRE_BigInt        first_row;         /* global index of the first row */
+
+   hypre_CSRMatrix    *matrix;
+   HYPRE_Int           owns_big_j;        /* BigJ was decoded from the file */
+
+} hypre_ParCSRBinaryView;
+
 #endif
@@ -56,9 +56,12 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    HYPRE_Int vecstride = hypre_VectorVectorStride( x_local );
    HYPRE_Int idxstride = hypre_VectorIndexStride( x_local );
 
-   HYPRE_Complex *x_tmp_data, **x_buf_data;
+   HYPRE_Complex *x_tmp_data, **x_buf_data, *x_buf_persistent;
    HYPRE_Complex *x_local_data = hypre_VectorData(x_local);
 
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+   HYPRE_Int use_persistent_comm = hypre_HandleUsePersistentComm(hypre_handle());
+
 #if defined(HYPRE_USING_GPU)
    HYPRE_Int sync_stream;
    hypre_GetSyncCudaCompute(&sync_stream);
@@ -126,21 +129,22 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
 #endif
 
-   HYPRE_Int use_persistent_comm = 0;
-
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   use_persistent_comm = num_vectors == 1;
-   // JSP TODO: we can use persistent communication for multi-vectors,
-   // but then we need different communication handles for different
-   // num_vectors.
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
+#if defined(HYPRE_USING_GPU)
+   /* device pack/unpack kernels work one vector at a time */
+   use_persistent_comm = use_persistent_comm && num_vectors == 1;
 #endif
 
+   /* The persistent handle of comm_pkg packs all vectors of x into a single
+      (row-wise) buffer, so that one message per neighbor is exchanged. Its
+      recv buffer is used as x_tmp on host */
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
-      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
-#endif
+      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle_v2(1, comm_pkg,
+                                                                             num_vectors);
+      if (num_vectors > 1)
+      {
+         hypre_VectorMultiVecStorageMethod(x_tmp) = 1;
+      }
    }
    else
    {
@@ -168,11 +172,9 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #else
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_VectorData(x_tmp) = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(
                                    persistent_comm_handle);
       hypre_SeqVectorSetDataOwner(x_tmp, 0);
-#endif
    }
 #endif
 
@@ -180,7 +182,14 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    x_tmp_data = hypre_VectorData(x_tmp);
 
    /* x_buff_data */
-   x_buf_data = hypre_CTAlloc(HYPRE_Complex*, num_vectors, HYPRE_MEMORY_HOST);
+   if (use_persistent_comm)
+   {
+      x_buf_data = &x_buf_persistent;
+   }
+   else
+   {
+      x_buf_data = hypre_CTAlloc(HYPRE_Complex*, num_vectors, HYPRE_MEMORY_HOST);
+   }
 
    for (jv = 0; jv < num_vectors; ++jv)
    {
@@ -205,10 +214,8 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #endif
       if (use_persistent_comm)
       {
-#ifdef HYPRE_USING_PERSISTENT_COMM
          x_buf_data[0] = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
-         continue;
-#endif
+         break;
       }
 
       x_buf_data[jv] = hypre_TAlloc(HYPRE_Complex,
@@ -216,67 +223,85 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
                                     HYPRE_MEMORY_DEVICE);
    }
 
-   /* The assert is because the following loop only works for 'column'
-      storage of a multivector. This needs to be fixed to work more generally,
-      at least for 'row' storage. This in turn, means either change CommPkg so
-      num_sends is no.zones*no.vectors (not no.zones) or, less dangerously, put
-      a stride in the logic of CommHandleCreate (stride either from a new arg or
-      a new variable inside CommPkg).  Or put the num_vector iteration inside
-      CommHandleCreate (perhaps a new multivector variant of it).
-   */
-
-   hypre_assert( idxstride == 1 );
-
    //hypre_SeqVectorPrefetch(x_local, HYPRE_MEMORY_DEVICE);
 
    /* send_map_elmts on device */
    hypre_ParCSRCommPkgCopySendMapElmtsToDevice(comm_pkg);
 
-   for (jv = 0; jv < num_vectors; ++jv)
+   if (use_persistent_comm && num_vectors > 1)
    {
-      HYPRE_Complex *send_data = (HYPRE_Complex *) x_buf_data[jv];
-      HYPRE_Complex *locl_data = x_local_data + jv * vecstride;
+      /* multivector on host: interleave the entries of all vectors */
+      HYPRE_Complex *send_data = x_buf_data[0];
+      HYPRE_Int      i, k;
 
-      /* if on device, no need to Sync: send_data is on device memory */
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-      /* pack send data on device */
-      HYPRE_THRUST_CALL( gather,
-                         hypre_ParCSRCommPkgDeviceSendMapElmts(comm_pkg),
-                         hypre_ParCSRCommPkgDeviceSendMapElmts(comm_pkg) +
-                         hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                         locl_data,
-                         send_data );
-#elif defined(HYPRE_USING_SYCL)
-      auto permuted_source = oneapi::dpl::make_permutation_iterator(locl_data,
-                                                                    hypre_ParCSRCommPkgDeviceSendMapElmts(comm_pkg));
-      HYPRE_ONEDPL_CALL( std::copy,
-                         permuted_source,
-                         permuted_source + hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                         send_data );
-#elif defined(HYPRE_USING_DEVICE_OPENMP)
-      /* pack send data on device */
-      HYPRE_Int i;
-      HYPRE_Int *device_send_map_elmts = hypre_ParCSRCommPkgDeviceSendMapElmts(comm_pkg);
-      HYPRE_Int start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
-      HYPRE_Int end   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
-      #pragma omp target teams distribute parallel for private(i) is_device_ptr(send_data, locl_data, device_send_map_elmts)
-      for (i = start; i < end; i++)
-      {
-         send_data[i] = locl_data[device_send_map_elmts[i]];
-      }
-#else
-      HYPRE_Int i;
-      /* pack send data on host */
 #if defined(HYPRE_USING_OPENMP)
-      #pragma omp parallel for HYPRE_SMP_SCHEDULE
+      #pragma omp parallel for private(i, k, jv) HYPRE_SMP_SCHEDULE
 #endif
       for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
            i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
            i ++)
       {
-         send_data[i] = locl_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+         k = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * idxstride;
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            send_data[i * num_vectors + jv] = x_local_data[k + jv * vecstride];
+         }
       }
+   }
+   else
+   {
+      /* The assert is because the following loop only works for 'column'
+         storage of a multivector. Row storage is handled by the persistent
+         path above, which packs all vectors into one interleaved buffer.
+      */
+      hypre_assert( idxstride == 1 );
+
+      for (jv = 0; jv < num_vectors; ++jv)
+      {
+         HYPRE_Complex *send_data = (HYPRE_Complex *) x_buf_data[jv];
+         HYPRE_Complex *locl_data = x_local_data + jv * vecstride;
+
+         /* if on device, no need to Sync: send_data is on device memory */
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+         /* pack send data on device */
+         HYPRE_THRUST_CALL( gather,
+                            hypre_ParCSRCommPkgDeviceSendMapElmts(comm_pkg),
+                            hypre_ParCSRCommPkgDeviceSendMapElmts(comm_pkg) +
+                            hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                            locl_data,
+                            send_data );
+#elif defined(HYPRE_USING_SYCL)
+         auto permuted_source = oneapi::dpl::make_permutation_iterator(locl_data,
+                                                                       hypre_ParCSRCommPkgDeviceSendMapElmts(comm_pkg));
+         HYPRE_ONEDPL_CALL( std::copy,
+                            permuted_source,
+                            permuted_source + hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                            send_data );
+#elif defined(HYPRE_USING_DEVICE_OPENMP)
+         /* pack send data on device */
+         HYPRE_Int i;
+         HYPRE_Int *device_send_map_elmts = hypre_ParCSRCommPkgDeviceSendMapElmts(comm_pkg);
+         HYPRE_Int start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+         HYPRE_Int end   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+         #pragma omp target teams distribute parallel for private(i) is_device_ptr(send_data, locl_data, device_send_map_elmts)
+         for (i = start; i < end; i++)
+         {
+            send_data[i] = locl_data[device_send_map_elmts[i]];
+         }
+#else
+         HYPRE_Int i;
+         /* pack send data on host */
+#if defined(HYPRE_USING_OPENMP)
+         #pragma omp parallel for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+              i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+              i ++)
+         {
+            send_data[i] = locl_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+         }
 #endif
+      }
    }
 
 #ifdef HYPRE_PROFILE
@@ -290,7 +315,7 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 
    /* when using GPUs, start local matvec first in order to overlap with communication */
 #if defined(HYPRE_USING_GPU)
-   hypre_CSRMatrixMatvecOutOfPlace( alpha, diag, x_local, beta, b_local, y_local, 0 );
+   hypre_CSRMatrixMatvecDiagOutOfPlace( alpha, diag, x_local, beta, b_local, y_local );
 #endif
 
 #ifdef HYPRE_PROFILE
@@ -300,9 +325,7 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    /* nonblocking communication starts */
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_DEVICE, x_buf_data[0]);
-#endif
    }
    else
    {
@@ -319,7 +342,7 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 
 #if !defined(HYPRE_USING_GPU)
    /* overlapped local computation */
-   hypre_CSRMatrixMatvecOutOfPlace( alpha, diag, x_local, beta, b_local, y_local, 0 );
+   hypre_CSRMatrixMatvecDiagOutOfPlace( alpha, diag, x_local, beta, b_local, y_local );
 #endif
 
 #ifdef HYPRE_PROFILE
@@ -329,9 +352,7 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    /* nonblocking communication ends */
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_DEVICE, x_tmp_data);
-#endif
    }
    else
    {
@@ -383,6 +404,9 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
 #endif
 
+   hypre_OpCountsAddFlops(2.0 * num_vectors * (hypre_CSRMatrixNumNonzeros(diag) +
+                                               hypre_CSRMatrixNumNonzeros(offd)));
+
    HYPRE_ANNOTATE_FUNC_END;
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -402,6 +426,189 @@ hypre_ParCSRMatrixMatvec( HYPRE_Complex       alpha,
    return hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, x, beta, y, y);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixResidualNorm
+ *
+ * Computes r = b - A*x together with r_norm2 = <r,r>. On host, the local
+ * part of the norm is accumulated while r is written (see
+ * hypre_CSRMatrixResidualNorm), so that r is not streamed a second time.
+ * A diag block read through its 16-bit column deltas takes the unfused
+ * matvec and inner product.
+ *
+ * If request is NULL, r_norm2 holds the global value on return. Otherwise,
+ * the reduction is only started, and r_norm2 holds the global value after
+ * hypre_MPI_Wait(request, ...). This allows the caller to overlap the
+ * reduction with independent work.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixResidualNorm( hypre_ParCSRMatrix *A,
+                                hypre_ParVector    *x,
+                                hypre_ParVector    *b,
+                                hypre_ParVector    *r,
+                                HYPRE_Real         *r_norm2,
+                                hypre_MPI_Request  *request )
+{
+   MPI_Comm                 comm     = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRCommPkg     *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_CSRMatrix         *diag     = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix         *offd     = hypre_ParCSRMatrixOffd(A);
+
+   hypre_Vector            *x_local  = hypre_ParVectorLocalVector(x);
+   hypre_Vector            *b_local  = hypre_ParVectorLocalVector(b);
+   hypre_Vector            *r_local  = hypre_ParVectorLocalVector(r);
+   hypre_Vector            *x_tmp;
+
+   HYPRE_Int                num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int                use_persistent_comm = hypre_HandleUsePersistentComm(hypre_handle());
+   HYPRE_Int                use_fused = (hypre_VectorNumVectors(x_local) == 1 &&
+                                         !hypre_CSRMatrixShortJIsUsable(diag));
+   HYPRE_Int                num_sends, i, ierr = 0;
+
+   hypre_ParCSRCommHandle           *comm_handle = NULL;
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+   HYPRE_Complex                    *x_local_data = hypre_VectorData(x_local);
+   HYPRE_Complex                    *x_buf_data;
+
+#if defined(HYPRE_USING_GPU)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_ParCSRMatrixMemoryLocation(A) );
+
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      use_fused = 0;
+   }
+#endif
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   if (!use_fused)
+   {
+      ierr = hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, x, 1.0, b, r);
+      *r_norm2 = hypre_SeqVectorInnerProd(r_local, r_local);
+   }
+   else
+   {
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+      x_tmp = hypre_SeqVectorCreate(num_cols_offd);
+      if (use_persistent_comm)
+      {
+         persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+         x_buf_data = (HYPRE_Complex *)
+                      hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+         hypre_VectorData(x_tmp) = (HYPRE_Complex *)
+                                   hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+         hypre_SeqVectorSetDataOwner(x_tmp, 0);
+      }
+      else
+      {
+         x_buf_data = hypre_TAlloc(HYPRE_Complex,
+                                   hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                   HYPRE_MEMORY_HOST);
+      }
+      hypre_SeqVectorInitialize_v2(x_tmp, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+           i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+           i++)
+      {
+         x_buf_data[i] = x_local_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+      }
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+      if (use_persistent_comm)
+      {
+         hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST,
+                                               x_buf_data);
+      }
+      else
+      {
+         comm_handle = hypre_ParCSRCommHandleCreate_v2(1, comm_pkg, HYPRE_MEMORY_HOST, x_buf_data,
+                                                       HYPRE_MEMORY_HOST, hypre_VectorData(x_tmp));
+      }
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+      /* the norm is fused into the last pass over r: the offd part if there
+         is one, the overlapped diag part otherwise */
+      if (num_cols_offd)
+      {
+         hypre_CSRMatrixMatvecDiagOutOfPlace(-1.0, diag, x_local, 1.0, b_local, r_local);
+      }
+      else
+      {
+         ierr = hypre_CSRMatrixResidualNorm(diag, x_local, b_local, r_local, r_norm2);
+      }
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+      if (use_persistent_comm)
+      {
+         hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST,
+                                              hypre_VectorData(x_tmp));
+      }
+      else
+      {
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+         hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
+      }
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+      if (num_cols_offd)
+      {
+         ierr = hypre_CSRMatrixResidualNorm(offd, x_tmp, r_local, r_local, r_norm2);
+      }
+
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+
+   if (request)
+   {
+      hypre_MPI_Iallreduce(hypre_MPI_IN_PLACE, r_norm2, 1, HYPRE_MPI_REAL,
+                           hypre_MPI_SUM, comm, request);
+   }
+   else
+   {
+      hypre_MPI_Allreduce(hypre_MPI_IN_PLACE, r_norm2, 1, HYPRE_MPI_REAL,
+                          hypre_MPI_SUM, comm);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return ierr;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvecT
  *
@@ -444,9 +651,12 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    HYPRE_Int vecstride     = hypre_VectorVectorStride(y_local);
    HYPRE_Int idxstride     = hypre_VectorIndexStride(y_local);
 
-   HYPRE_Complex *y_tmp_data, **y_buf_data;
+   HYPRE_Complex *y_tmp_data, **y_buf_data, *y_buf_persistent;
    HYPRE_Complex *y_local_data = hypre_VectorData(y_local);
 
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+   HYPRE_Int use_persistent_comm = hypre_HandleUsePersistentComm(hypre_handle());
+
 #if defined(HYPRE_USING_GPU)
    HYPRE_Int sync_stream;
    hypre_GetSyncCudaCompute(&sync_stream);
@@ -512,21 +722,21 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
 #endif
 
-   HYPRE_Int use_persistent_comm = 0;
-
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   use_persistent_comm = num_vectors == 1;
-   // JSP TODO: we can use persistent communication for multi-vectors,
-   // but then we need different communication handles for different
-   // num_vectors.
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
+#if defined(HYPRE_USING_GPU)
+   /* device pack/unpack kernels work one vector at a time */
+   use_persistent_comm = use_persistent_comm && num_vectors == 1;
 #endif
 
+   /* The persistent handle of comm_pkg sends all vectors of y_tmp in a single
+      (row-wise) buffer. Its send buffer is used as y_tmp on host */
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
-      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(2, comm_pkg);
-#endif
+      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle_v2(2, comm_pkg,
+                                                                             num_vectors);
+      if (num_vectors > 1)
+      {
+         hypre_VectorMultiVecStorageMethod(y_tmp) = 1;
+      }
    }
    else
    {
@@ -554,11 +764,9 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 #else
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_VectorData(y_tmp) = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(
                                    persistent_comm_handle);
       hypre_SeqVectorSetDataOwner(y_tmp, 0);
-#endif
    }
 #endif
 
@@ -566,7 +774,14 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    y_tmp_data = hypre_VectorData(y_tmp);
 
    /* y_buf_data */
-   y_buf_data = hypre_CTAlloc(HYPRE_Complex*, num_vectors, HYPRE_MEMORY_HOST);
+   if (use_persistent_comm)
+   {
+      y_buf_data = &y_buf_persistent;
+   }
+   else
+   {
+      y_buf_data = hypre_CTAlloc(HYPRE_Complex*, num_vectors, HYPRE_MEMORY_HOST);
+   }
 
    for (jv = 0; jv < num_vectors; ++jv)
    {
@@ -591,10 +806,8 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 #endif
       if (use_persistent_comm)
       {
-#ifdef HYPRE_USING_PERSISTENT_COMM
          y_buf_data[0] = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
-         continue;
-#endif
+         break;
       }
 
       y_buf_data[jv] = hypre_TAlloc(HYPRE_Complex,
@@ -643,9 +856,7 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_DEVICE, y_tmp_data);
-#endif
    }
    else
    {
@@ -682,9 +893,7 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    /* nonblocking communication ends */
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_DEVICE, y_buf_data[0]);
-#endif
    }
    else
    {
@@ -701,52 +910,67 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
 #endif
 
-   /* The assert is because the following loop only works for 'column'
-      storage of a multivector. This needs to be fixed to work more generally,
-      at least for 'row' storage. This in turn, means either change CommPkg so
-      num_sends is no.zones*no.vectors (not no.zones) or, less dangerously, put
-      a stride in the logic of CommHandleCreate (stride either from a new arg or
-      a new variable inside CommPkg).  Or put the num_vector iteration inside
-      CommHandleCreate (perhaps a new multivector variant of it).
-   */
-
-   hypre_assert( idxstride == 1 );
-
    /* send_map_elmts on device */
    hypre_ParCSRCommPkgCopySendMapElmtsToDevice(comm_pkg);
 
-   for (jv = 0; jv < num_vectors; ++jv)
+   if (use_persistent_comm && num_vectors > 1)
    {
-      HYPRE_Complex *recv_data = (HYPRE_Complex *) y_buf_data[jv];
-      HYPRE_Complex *locl_data = y_local_data + jv * vecstride;
+      /* multivector on host: received entries of all vectors are interleaved */
+      HYPRE_Complex *recv_data = y_buf_data[0];
+      HYPRE_Int      i, k;
 
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) || defined(HYPRE_USING_SYCL)
-      /* unpack recv data on device */
-      hypre_ParCSRMatrixMatvecT_unpack( hypre_ParCSRMatrixNumCols(A), locl_data, recv_data, comm_pkg );
-#elif defined(HYPRE_USING_DEVICE_OPENMP)
-      HYPRE_Int i, j;
-      /* unpack recv data on device */
-      for (i = 0; i < num_sends; i++)
-      {
-         HYPRE_Int *device_send_map_elmts = hypre_ParCSRCommPkgDeviceSendMapElmts(comm_pkg);
-         HYPRE_Int start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-         HYPRE_Int end   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1);
-         #pragma omp target teams distribute parallel for private(j) is_device_ptr(recv_data, locl_data, device_send_map_elmts)
-         for (j = start; j < end; j++)
-         {
-            locl_data[device_send_map_elmts[j]] += recv_data[j];
-         }
-      }
-#else
-      HYPRE_Int i;
-      /* unpack recv data on host, TODO OMP? */
       for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
            i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
            i ++)
       {
-         locl_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)] += recv_data[i];
+         k = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * idxstride;
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            y_local_data[k + jv * vecstride] += recv_data[i * num_vectors + jv];
+         }
       }
+   }
+   else
+   {
+      /* The assert is because the following loop only works for 'column'
+         storage of a multivector. Row storage is handled by the persistent
+         path above, which receives all vectors in one interleaved buffer.
+      */
+      hypre_assert( idxstride == 1 );
+
+      for (jv = 0; jv < num_vectors; ++jv)
+      {
+         HYPRE_Complex *recv_data = (HYPRE_Complex *) y_buf_data[jv];
+         HYPRE_Complex *locl_data = y_local_data + jv * vecstride;
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) || defined(HYPRE_USING_SYCL)
+         /* unpack recv data on device */
+         hypre_ParCSRMatrixMatvecT_unpack( hypre_ParCSRMatrixNumCols(A), locl_data, recv_data, comm_pkg );
+#elif defined(HYPRE_USING_DEVICE_OPENMP)
+         HYPRE_Int i, j;
+         /* unpack recv data on device */
+         for (i = 0; i < num_sends; i++)
+         {
+            HYPRE_Int *device_send_map_elmts = hypre_ParCSRCommPkgDeviceSendMapElmts(comm_pkg);
+            HYPRE_Int start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+            HYPRE_Int end   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i + 1);
+            #pragma omp target teams distribute parallel for private(j) is_device_ptr(recv_data, locl_data, device_send_map_elmts)
+            for (j = start; j < end; j++)
+            {
+               locl_data[device_send_map_elmts[j]] += recv_data[j];
+            }
+         }
+#else
+         HYPRE_Int i;
+         /* unpack recv data on host, TODO OMP? */
+         for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+              i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+              i ++)
+         {
+            locl_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)] += recv_data[i];
+         }
 #endif
+      }
    }
 
    hypre_SeqVectorDestroy(y_tmp);  y_tmp = NULL;
@@ -775,6 +999,9 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
 #endif
 
+   hypre_OpCountsAddFlops(2.0 * num_vectors * (hypre_CSRMatrixNumNonzeros(diag) +
+                                               hypre_CSRMatrixNumNonzeros(offd)));
+
    HYPRE_ANNOTATE_FUNC_END;
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -446,6 +446,36 @@ hypre_ParVectorInnerProd( hypre_ParVector *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorInnerProdStart
+ *
+ * Computes the local parts of result[j] = <x[j],y[j]>, j < k, and starts
+ * their global reduction in place. The values in result are only valid
+ * after hypre_MPI_Wait on request.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorInnerProdStart( HYPRE_Int           k,
+                               hypre_ParVector   **x,
+                               hypre_ParVector   **y,
+                               HYPRE_Real         *result,
+                               hypre_MPI_Request  *request )
+{
+   MPI_Comm   comm = hypre_ParVectorComm(x[0]);
+   HYPRE_Int  j;
+
+   for (j = 0; j < k; j++)
+   {
+      result[j] = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(x[j]),
+                                           hypre_ParVectorLocalVector(y[j]));
+   }
+
+   hypre_MPI_Iallreduce(hypre_MPI_IN_PLACE, result, k, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, comm, request);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorElmdivpy
  * y = y + x ./ b [MATLAB Notation]
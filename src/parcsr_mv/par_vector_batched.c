@@ -83,6 +83,55 @@ hypre_ParVectorMassInnerProd( hypre_ParVector  *x,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorBlockInnerProd
+ *
+ * result[j*kx+i] = <x[i],y[j]> for i < kx, j < ky, with a single global
+ * reduction for the whole block.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorBlockInnerProd( hypre_ParVector **x,
+                               HYPRE_Int         kx,
+                               hypre_ParVector **y,
+                               HYPRE_Int         ky,
+                               HYPRE_Int         unroll,
+                               HYPRE_Real       *result )
+{
+   MPI_Comm      comm    = hypre_ParVectorComm(x[0]);
+   HYPRE_Real *local_result;
+   HYPRE_Int i, j;
+   hypre_Vector **x_local;
+   x_local = hypre_TAlloc(hypre_Vector *, kx, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < kx; i++)
+   {
+      x_local[i] = (hypre_Vector *) hypre_ParVectorLocalVector(x[i]);
+   }
+
+   local_result = hypre_CTAlloc(HYPRE_Real, kx * ky, HYPRE_MEMORY_HOST);
+
+   for (j = 0; j < ky; j++)
+   {
+      hypre_SeqVectorMassInnerProd(hypre_ParVectorLocalVector(y[j]), x_local, kx, unroll,
+                                   &local_result[j * kx]);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, kx * ky, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(x_local, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorMassDotpTwo
  *--------------------------------------------------------------------------*/
@@ -136,3 +185,138 @@ hypre_ParVectorMassDotpTwo ( hypre_ParVector  *x,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorMultiInnerProd
+ *
+ * Gram matrix of the columns of the multivectors x[0], ..., x[k-1] against
+ * the columns of the multivector y, see hypre_SeqVectorMultiInnerProd. The
+ * k*nx*ny entries are reduced with a single global reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorMultiInnerProd( HYPRE_Int         k,
+                               hypre_ParVector **x,
+                               hypre_ParVector  *y,
+                               HYPRE_Real       *result )
+{
+   MPI_Comm       comm       = hypre_ParVectorComm(y);
+   HYPRE_Int      num_result = k * hypre_ParVectorNumVectors(x[0]) *
+                               hypre_ParVectorNumVectors(y);
+   HYPRE_Real    *local_result;
+   hypre_Vector **x_local;
+   HYPRE_Int      i;
+
+   x_local = hypre_TAlloc(hypre_Vector *, k, HYPRE_MEMORY_HOST);
+   for (i = 0; i < k; i++)
+   {
+      x_local[i] = hypre_ParVectorLocalVector(x[i]);
+   }
+
+   local_result = hypre_CTAlloc(HYPRE_Real, num_result, HYPRE_MEMORY_HOST);
+
+   hypre_SeqVectorMultiInnerProd(k, x_local, hypre_ParVectorLocalVector(y), local_result);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, num_result, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(x_local, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorColumnInnerProd
+ *
+ * result[j] = <x(:,j), y(:,j)> for every column j, with one global reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorColumnInnerProd( hypre_ParVector *x,
+                                hypre_ParVector *y,
+                                HYPRE_Real      *result )
+{
+   MPI_Comm     comm = hypre_ParVectorComm(x);
+   HYPRE_Int    nv   = hypre_ParVectorNumVectors(x);
+   HYPRE_Real  *local_result;
+
+   local_result = hypre_CTAlloc(HYPRE_Real, nv, HYPRE_MEMORY_HOST);
+
+   hypre_SeqVectorColumnInnerProd(hypre_ParVectorLocalVector(x),
+                                  hypre_ParVectorLocalVector(y), local_result);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, nv, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorMultiAxpy
+ *
+ * y = beta*y + x*alpha, see hypre_SeqVectorMultiAxpy.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorMultiAxpy( HYPRE_Complex   *alpha,
+                          hypre_ParVector *x,
+                          HYPRE_Complex    beta,
+                          hypre_ParVector *y )
+{
+   return hypre_SeqVectorMultiAxpy(alpha, hypre_ParVectorLocalVector(x), beta,
+                                   hypre_ParVectorLocalVector(y));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorGetColumnView
+ *
+ * Set up `view' as a single-column alias of column k of the column-major
+ * multivector x.  No data is copied and the view does not own its data, so
+ * it lives on the caller's stack and must not be destroyed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorGetColumnView( hypre_ParVector *x,
+                              HYPRE_Int        k,
+                              hypre_ParVector *view,
+                              hypre_Vector    *view_local )
+{
+   hypre_Vector *x_local = hypre_ParVectorLocalVector(x);
+
+   if (hypre_VectorMultiVecStorageMethod(x_local) != 0 ||
+       k < 0 || k >= hypre_VectorNumVectors(x_local))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Invalid column view of a multivector!\n");
+      return hypre_error_flag;
+   }
+
+   *view_local = *x_local;
+   hypre_VectorData(view_local)         = hypre_VectorData(x_local) +
+                                          k * hypre_VectorVectorStride(x_local);
+   hypre_VectorNumVectors(view_local)   = 1;
+   hypre_VectorOwnsData(view_local)     = 0;
+   hypre_VectorVectorStride(view_local) = hypre_VectorSize(x_local);
+   hypre_VectorIndexStride(view_local)  = 1;
+
+   *view = *x;
+   hypre_ParVectorLocalVector(view) = view_local;
+   hypre_ParVectorOwnsData(view)    = 0;
+   hypre_ParVectorAssumedPartition(view) = NULL;
+
+   return hypre_error_flag;
+}
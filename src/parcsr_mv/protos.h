@@ -47,6 +47,10 @@ HYPRE_Int HYPRE_ParCSRMatrixBigInitialize ( HYPRE_ParCSRMatrix matrix );
 HYPRE_Int HYPRE_ParCSRMatrixRead ( MPI_Comm comm, const char *file_name,
                                    HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixPrint ( HYPRE_ParCSRMatrix matrix, const char *file_name );
+HYPRE_Int HYPRE_ParCSRMatrixPrintBinary ( HYPRE_ParCSRMatrix matrix, const char *file_name,
+                                          HYPRE_Int compress );
+HYPRE_Int HYPRE_ParCSRMatrixReadBinary ( MPI_Comm comm, const char *file_name,
+                                         HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixGetComm ( HYPRE_ParCSRMatrix matrix, MPI_Comm *comm );
 HYPRE_Int HYPRE_ParCSRMatrixGetDims ( HYPRE_ParCSRMatrix matrix, HYPRE_BigInt *M, HYPRE_BigInt *N );
 HYPRE_Int HYPRE_ParCSRMatrixGetRowPartitioning ( HYPRE_ParCSRMatrix matrix,
@@ -69,6 +73,7 @@ HYPRE_Int HYPRE_ParCSRMatrixMatvec ( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A,
                                      HYPRE_Complex beta, HYPRE_ParVector y );
 HYPRE_Int HYPRE_ParCSRMatrixMatvecT ( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A, HYPRE_ParVector x,
                                       HYPRE_Complex beta, HYPRE_ParVector y );
+HYPRE_Int HYPRE_ParCSRMatrixSetNeighborColl ( HYPRE_ParCSRMatrix matrix, HYPRE_Int neighbor_coll );
 HYPRE_Int hypre_ParCSRMatrixTruncate(hypre_ParCSRMatrix *A, HYPRE_Real tol, HYPRE_Int max_row_elmts,
                                      HYPRE_Int rescale, HYPRE_Int nrm_type);
 /* HYPRE_parcsr_vector.c */
@@ -80,6 +85,9 @@ HYPRE_Int HYPRE_ParVectorDestroy ( HYPRE_ParVector vector );
 HYPRE_Int HYPRE_ParVectorInitialize ( HYPRE_ParVector vector );
 HYPRE_Int HYPRE_ParVectorRead ( MPI_Comm comm, const char *file_name, HYPRE_ParVector *vector );
 HYPRE_Int HYPRE_ParVectorPrint ( HYPRE_ParVector vector, const char *file_name );
+HYPRE_Int HYPRE_ParVectorPrintBinary ( HYPRE_ParVector vector, const char *file_name );
+HYPRE_Int HYPRE_ParVectorReadBinary ( MPI_Comm comm, const char *file_name,
+                                      HYPRE_ParVector *vector );
 HYPRE_Int HYPRE_ParVectorSetConstantValues ( HYPRE_ParVector vector, HYPRE_Complex value );
 HYPRE_Int HYPRE_ParVectorSetRandomValues ( HYPRE_ParVector vector, HYPRE_Int seed );
 HYPRE_Int HYPRE_ParVectorCopy ( HYPRE_ParVector x, HYPRE_ParVector y );
@@ -173,6 +181,18 @@ HYPRE_Int hypre_GetAssumedPartitionRowRange ( MPI_Comm comm, HYPRE_Int proc_id,
                                               HYPRE_BigInt *row_end );
 HYPRE_Int hypre_ParVectorCreateAssumedPartition ( hypre_ParVector *vector );
 
+/* par_csr_binary.c */
+HYPRE_Int hypre_ParCSRMatrixPrintBinary ( hypre_ParCSRMatrix *matrix, const char *filename,
+                                          HYPRE_Int compress );
+HYPRE_Int hypre_ParCSRMatrixReadBinary ( MPI_Comm comm, const char *filename,
+                                         hypre_ParCSRMatrix **matrix_ptr );
+HYPRE_Int hypre_ParCSRMatrixMapBinary ( const char *filename, HYPRE_Int file_id,
+                                        hypre_ParCSRBinaryView **view_ptr );
+HYPRE_Int hypre_ParCSRBinaryViewDestroy ( hypre_ParCSRBinaryView *view );
+HYPRE_Int hypre_ParVectorPrintBinary ( hypre_ParVector *vector, const char *filename );
+HYPRE_Int hypre_ParVectorReadBinary ( MPI_Comm comm, const char *filename,
+                                      hypre_ParVector **vector_ptr );
+
 /* par_csr_bool_matop.c */
 hypre_ParCSRBooleanMatrix *hypre_ParBooleanMatmul ( hypre_ParCSRBooleanMatrix *A,
                                                     hypre_ParCSRBooleanMatrix *B );
@@ -245,6 +265,8 @@ hypre_ParCSRCommPkgCreate(MPI_Comm comm, HYPRE_BigInt *col_map_offd, HYPRE_BigIn
                           hypre_ParCSRCommPkg *comm_pkg);
 HYPRE_Int hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_MatvecCommPkgDestroy ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRCommPkgCreateNeighborComm ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRCommPkgDestroyNeighborComm ( hypre_ParCSRCommPkg *comm_pkg );
 HYPRE_Int hypre_BuildCSRMatrixMPIDataType ( HYPRE_Int num_nonzeros, HYPRE_Int num_rows,
                                             HYPRE_Complex *a_data, HYPRE_Int *a_i, HYPRE_Int *a_j, hypre_MPI_Datatype *csr_matrix_datatype );
 HYPRE_Int hypre_BuildCSRJDataType ( HYPRE_Int num_nonzeros, HYPRE_Complex *a_data, HYPRE_Int *a_j,
@@ -254,6 +276,24 @@ HYPRE_Int hypre_ParCSRFindExtendCommPkg(MPI_Comm comm, HYPRE_BigInt global_num_c
                                         hypre_IJAssumedPart *apart, HYPRE_Int indices_len, HYPRE_BigInt *indices,
                                         hypre_ParCSRCommPkg **extend_comm_pkg);
 
+/* par_csr_matmat_plan.c */
+HYPRE_Int hypre_ParCSRMatMatPlanCreate ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                         hypre_ParCSRMatMatPlan **plan_ptr, hypre_ParCSRMatrix **C_ptr );
+HYPRE_Int hypre_ParCSRMatMatPlanMatches ( hypre_ParCSRMatMatPlan *plan, hypre_ParCSRMatrix *A,
+                                          hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRMatMatPlanExecute ( hypre_ParCSRMatMatPlan *plan, hypre_ParCSRMatrix *A,
+                                          hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRMatMatPlanDestroy ( hypre_ParCSRMatMatPlan *plan );
+HYPRE_Int hypre_ParCSRRAPPlanCreate ( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A,
+                                      hypre_ParCSRMatrix *P, hypre_ParCSRRAPPlan **plan_ptr,
+                                      hypre_ParCSRMatrix **RAP_ptr );
+HYPRE_Int hypre_ParCSRRAPPlanMatches ( hypre_ParCSRRAPPlan *plan, hypre_ParCSRMatrix *A,
+                                       hypre_ParCSRMatrix *P, hypre_ParCSRMatrix *RAP );
+HYPRE_Int hypre_ParCSRRAPPlanExecute ( hypre_ParCSRRAPPlan *plan, hypre_ParCSRMatrix *A,
+                                       hypre_ParCSRMatrix *P, hypre_ParCSRMatrix *RAP );
+HYPRE_Int hypre_ParCSRRAPPlanUpdateR ( hypre_ParCSRRAPPlan *plan, hypre_ParCSRMatrix *R );
+HYPRE_Int hypre_ParCSRRAPPlanDestroy ( hypre_ParCSRRAPPlan *plan );
+
 /* par_csr_matop.c */
 HYPRE_Int hypre_ParCSRMatrixScale(hypre_ParCSRMatrix *A, HYPRE_Complex scalar);
 void hypre_ParMatmul_RowSizes ( HYPRE_MemoryLocation memory_location, HYPRE_Int **C_diag_i,
@@ -339,17 +379,21 @@ HYPRE_Int hypre_ParCSRMatrixDropSmallEntriesDevice( hypre_ParCSRMatrix *A, HYPRE
 
 HYPRE_Int hypre_ParCSRCommPkgCreateMatrixE( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int local_ncols );
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreate(HYPRE_Int job,
                                                                          hypre_ParCSRCommPkg *comm_pkg);
+hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreate_v2(HYPRE_Int job,
+                                                                            hypre_ParCSRCommPkg *comm_pkg,
+                                                                            HYPRE_Int num_vectors);
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandle(HYPRE_Int job,
                                                                              hypre_ParCSRCommPkg *comm_pkg);
+hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandle_v2(HYPRE_Int job,
+                                                                                hypre_ParCSRCommPkg *comm_pkg,
+                                                                                HYPRE_Int num_vectors);
 void hypre_ParCSRPersistentCommHandleDestroy(hypre_ParCSRPersistentCommHandle *comm_handle);
 void hypre_ParCSRPersistentCommHandleStart(hypre_ParCSRPersistentCommHandle *comm_handle,
                                            HYPRE_MemoryLocation send_memory_location, void *send_data);
 void hypre_ParCSRPersistentCommHandleWait(hypre_ParCSRPersistentCommHandle *comm_handle,
                                           HYPRE_MemoryLocation recv_memory_location, void *recv_data);
-#endif
 
 HYPRE_Int hypre_ParcsrGetExternalRowsInit( hypre_ParCSRMatrix *A, HYPRE_Int indices_len,
                                            HYPRE_BigInt *indices, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int want_data, void **request_ptr);
@@ -408,6 +452,7 @@ HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumRownnz ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix, HYPRE_Int owns_data );
 HYPRE_Int hypre_ParCSRMatrixSetPatternOnly( hypre_ParCSRMatrix *matrix, HYPRE_Int pattern_only);
+HYPRE_Int hypre_ParCSRMatrixSetNeighborColl( hypre_ParCSRMatrix *matrix, HYPRE_Int neighbor_coll );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRead ( MPI_Comm comm, const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrint ( hypre_ParCSRMatrix *matrix, const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrintIJ ( const hypre_ParCSRMatrix *matrix, const HYPRE_Int base_i,
@@ -439,7 +484,10 @@ hypre_ParCSRMatrix* hypre_ParCSRMatrixClone_v2 ( hypre_ParCSRMatrix *A, HYPRE_In
                                                  HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_ParCSRMatrixMigrate(hypre_ParCSRMatrix *A, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_ParCSRMatrixSetConstantValues( hypre_ParCSRMatrix *A, HYPRE_Complex value );
+HYPRE_Int hypre_ParCSRMatrixConvertToFloat( hypre_ParCSRMatrix *A );
 void hypre_ParCSRMatrixCopyColMapOffdToDevice(hypre_ParCSRMatrix *A);
+HYPRE_Int hypre_ParCSRMatrixRedistribute ( hypre_ParCSRMatrix *A, HYPRE_Int group_size,
+                                          MPI_Comm *group_comm_ptr, hypre_ParCSRMatrix **A_new_ptr );
 
 /* par_csr_matvec.c */
 // y = alpha*A*x + beta*b
@@ -448,6 +496,10 @@ HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha, hypre_ParCSR
 // y = alpha*A*x + beta*y
 HYPRE_Int hypre_ParCSRMatrixMatvec ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A, hypre_ParVector *x,
                                      HYPRE_Complex beta, hypre_ParVector *y );
+// r = b - A*x, r_norm2 = <r,r>
+HYPRE_Int hypre_ParCSRMatrixResidualNorm ( hypre_ParCSRMatrix *A, hypre_ParVector *x,
+                                           hypre_ParVector *b, hypre_ParVector *r, HYPRE_Real *r_norm2,
+                                           hypre_MPI_Request *request );
 HYPRE_Int hypre_ParCSRMatrixMatvecT ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                       hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvecT_unpack( HYPRE_Int ncols, HYPRE_Complex *locl_data,
@@ -514,10 +566,22 @@ HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha, hypre_ParVector *x, hypre_P
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y,
                                     HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x, hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorInnerProdStart ( HYPRE_Int k, hypre_ParVector **x, hypre_ParVector **y,
+                                          HYPRE_Real *result, hypre_MPI_Request *request );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x, hypre_ParVector **y, HYPRE_Int k,
                                          HYPRE_Int unroll, HYPRE_Real *prod );
+HYPRE_Int hypre_ParVectorBlockInnerProd ( hypre_ParVector **x, HYPRE_Int kx, hypre_ParVector **y,
+                                          HYPRE_Int ky, HYPRE_Int unroll, HYPRE_Real *result );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x, hypre_ParVector *y, hypre_ParVector **z,
                                        HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x, HYPRE_Real *prod_y );
+HYPRE_Int hypre_ParVectorMultiInnerProd ( HYPRE_Int k, hypre_ParVector **x, hypre_ParVector *y,
+                                          HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorColumnInnerProd ( hypre_ParVector *x, hypre_ParVector *y,
+                                           HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorMultiAxpy ( HYPRE_Complex *alpha, hypre_ParVector *x, HYPRE_Complex beta,
+                                     hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorGetColumnView ( hypre_ParVector *x, HYPRE_Int k, hypre_ParVector *view,
+                                         hypre_Vector *view_local );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm, hypre_Vector *v,
                                            HYPRE_BigInt *vec_starts );
 hypre_Vector *hypre_ParVectorToVectorAll ( hypre_ParVector *par_v );
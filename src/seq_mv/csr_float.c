@@ -0,0 +1,313 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Single-precision value storage for hypre_CSRMatrix and the host matvec
+ * kernels using it. Only the matrix values are stored in float; vectors and
+ * all accumulations stay in HYPRE_Complex.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixConvertToFloat
+ *
+ * Replaces the values of a host matrix by a single-precision copy. The
+ * double-precision data (and the SELL-C-sigma copy, if any) is freed, so
+ * afterwards only the matvec routines and the kernels that check for
+ * hypre_CSRMatrixDataFloat may be applied to A. Calling this again on a
+ * converted matrix does nothing.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixConvertToFloat( hypre_CSRMatrix *A )
+{
+   HYPRE_Complex *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int      num_nnz  = hypre_CSRMatrixNumNonzeros(A);
+   float         *A_data_f;
+   HYPRE_Int      i;
+
+#if defined(HYPRE_COMPLEX) || defined(HYPRE_SINGLE) || defined(HYPRE_LONG_DOUBLE)
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                     "Float value storage is only available for real double precision!\n");
+   return hypre_error_flag;
+#endif
+
+   if (hypre_CSRMatrixDataFloat(A))
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Float value storage is only available for host matrices!\n");
+      return hypre_error_flag;
+   }
+
+   /* at least one entry, so that data_float marks the converted matrix */
+   A_data_f = hypre_TAlloc(float, hypre_max(num_nnz, 1), HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nnz; i++)
+   {
+      A_data_f[i] = (float) A_data[i];
+   }
+
+   hypre_CSRMatrixSellDestroy(A);
+   if (hypre_CSRMatrixOwnsData(A))
+   {
+      hypre_TFree(A_data, hypre_CSRMatrixMemoryLocation(A));
+   }
+   hypre_CSRMatrixData(A)      = NULL;
+   hypre_CSRMatrixDataFloat(A) = A_data_f;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixFloatDestroy
+ *
+ * Frees the single-precision values, if any. This is for matrices whose
+ * double-precision values were written again after a conversion.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixFloatDestroy( hypre_CSRMatrix *A )
+{
+   if (A)
+   {
+      hypre_TFree(hypre_CSRMatrixDataFloat(A), HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecFloatHost
+ *
+ * y = alpha*A*x + beta*b using the single-precision values of A. Supports
+ * multivectors and the row offset of hypre_CSRMatrixMatvecOutOfPlace.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecFloatHost( HYPRE_Complex    alpha,
+                                hypre_CSRMatrix *A,
+                                hypre_Vector    *x,
+                                HYPRE_Complex    beta,
+                                hypre_Vector    *b,
+                                hypre_Vector    *y,
+                                HYPRE_Int        offset )
+{
+   float            *A_data      = hypre_CSRMatrixDataFloat(A);
+   HYPRE_Int        *A_i         = hypre_CSRMatrixI(A) + offset;
+   HYPRE_Int        *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A) - offset;
+   HYPRE_Int         num_cols    = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data      = hypre_VectorData(x);
+   HYPRE_Complex    *b_data      = hypre_VectorData(b) + offset;
+   HYPRE_Complex    *y_data      = hypre_VectorData(y) + offset;
+   HYPRE_Int         x_size      = hypre_VectorSize(x);
+   HYPRE_Int         b_size      = hypre_VectorSize(b) - offset;
+   HYPRE_Int         y_size      = hypre_VectorSize(y) - offset;
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Int         i, ierr = 0;
+   hypre_Vector     *x_tmp = NULL;
+
+   hypre_assert(num_vectors == hypre_VectorNumVectors(y));
+   hypre_assert(num_vectors == hypre_VectorNumVectors(b));
+
+   if (num_cols != x_size)
+   {
+      ierr = 1;
+   }
+
+   if (num_rows != y_size || num_rows != b_size)
+   {
+      ierr = 2;
+   }
+
+   if (num_cols != x_size && (num_rows != y_size || num_rows != b_size))
+   {
+      ierr = 3;
+   }
+
+   if (alpha == 0.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows * num_vectors; i++)
+      {
+         y_data[i] = beta * b_data[i];
+      }
+
+      return ierr;
+   }
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   if (num_vectors == 1)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         HYPRE_Complex sum = 0.0;
+         HYPRE_Int     jj;
+
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            sum += (HYPRE_Complex) A_data[jj] * x_data[A_j[jj]];
+         }
+
+         y_data[i] = (beta == 0.0) ? alpha * sum : alpha * sum + beta * b_data[i];
+      }
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         HYPRE_Complex sum;
+         HYPRE_Int     j, jj, iy;
+
+         for (j = 0; j < num_vectors; j++)
+         {
+            sum = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               sum += (HYPRE_Complex) A_data[jj] * x_data[j * vecstride_x + A_j[jj] * idxstride_x];
+            }
+
+            iy = j * vecstride_y + i * idxstride_y;
+            y_data[iy] = (beta == 0.0) ? alpha * sum : alpha * sum + beta * b_data[iy];
+         }
+      }
+   }
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTFloatHost
+ *
+ * y = alpha*A^T*x + beta*y using the single-precision values of A. Supports
+ * multivectors. The scatter into y is done by a single thread.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTFloatHost( HYPRE_Complex    alpha,
+                                 hypre_CSRMatrix *A,
+                                 hypre_Vector    *x,
+                                 HYPRE_Complex    beta,
+                                 hypre_Vector    *y )
+{
+   float            *A_data      = hypre_CSRMatrixDataFloat(A);
+   HYPRE_Int        *A_i         = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         num_cols    = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data      = hypre_VectorData(x);
+   HYPRE_Complex    *y_data      = hypre_VectorData(y);
+   HYPRE_Int         x_size      = hypre_VectorSize(x);
+   HYPRE_Int         y_size      = hypre_VectorSize(y);
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Complex     xi;
+   HYPRE_Int         i, j, jj, ierr = 0;
+   hypre_Vector     *x_tmp = NULL;
+
+   hypre_assert(num_vectors == hypre_VectorNumVectors(y));
+
+   if (num_rows != x_size)
+   {
+      ierr = 1;
+   }
+
+   if (num_cols != y_size)
+   {
+      ierr = 2;
+   }
+
+   if (num_rows != x_size && num_cols != y_size)
+   {
+      ierr = 3;
+   }
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   /*-----------------------------------------------------------------------
+    * y = beta*y
+    *-----------------------------------------------------------------------*/
+
+   if (beta != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols * num_vectors; i++)
+      {
+         y_data[i] = (beta == 0.0) ? 0.0 : beta * y_data[i];
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * y += alpha*A^T*x
+    *-----------------------------------------------------------------------*/
+
+   if (alpha != 0.0)
+   {
+      for (j = 0; j < num_vectors; j++)
+      {
+         for (i = 0; i < num_rows; i++)
+         {
+            xi = alpha * x_data[j * vecstride_x + i * idxstride_x];
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               y_data[j * vecstride_y + A_j[jj] * idxstride_y] += (HYPRE_Complex) A_data[jj] * xi;
+            }
+         }
+      }
+   }
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
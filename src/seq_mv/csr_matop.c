@@ -652,11 +652,148 @@ hypre_CSRMatrixBigAdd( hypre_CSRMatrix *A,
 
 #endif
 
+/*--------------------------------------------------------------------------
+ * Row accumulators of hypre_CSRMatrixMultiplyHost
+ *
+ * Each row of C = A*B is formed with one of three accumulators, picked from
+ * the number of products (flops) of the row:
+ *   - list:  the columns found so far in the row are searched linearly;
+ *   - hash:  an open addressing table of at least twice the flops of the
+ *            row maps columns to their position in the row;
+ *   - dense: a marker array over all columns of B.
+ * The dense marker is only used when it is small or the row is dense enough
+ * to touch a good part of it. All accumulators append the columns in the
+ * order they are first reached, so C does not depend on the choice.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_SPGEMM_LIST_MAX_FLOPS  16
+#define HYPRE_SPGEMM_DENSE_MAX_COLS  262144
+
+#define HYPRE_SPGEMM_ROW_LIST  0
+#define HYPRE_SPGEMM_ROW_HASH  1
+#define HYPRE_SPGEMM_ROW_DENSE 2
+
+static inline HYPRE_Int
+hypre_CSRMatrixMultiplyRowKind( HYPRE_Int flops,
+                                HYPRE_Int ncols_B )
+{
+   if (ncols_B <= HYPRE_SPGEMM_DENSE_MAX_COLS || 8 * (HYPRE_BigInt) flops >= ncols_B)
+   {
+      return HYPRE_SPGEMM_ROW_DENSE;
+   }
+   else if (flops <= HYPRE_SPGEMM_LIST_MAX_FLOPS)
+   {
+      return HYPRE_SPGEMM_ROW_LIST;
+   }
+
+   return HYPRE_SPGEMM_ROW_HASH;
+}
+
+/* log2 of the hash table size used for a row with the given flops */
+static inline HYPRE_Int
+hypre_CSRMatrixMultiplyHashBits( HYPRE_Int flops )
+{
+   HYPRE_Int bits = 1;
+
+   while ((1 << bits) < 2 * flops)
+   {
+      bits++;
+   }
+
+   return bits;
+}
+
+/* first row ic in [0, n] with flops_start[ic] >= target */
+static inline HYPRE_Int
+hypre_CSRMatrixMultiplyFirstRow( size_t    *flops_start,
+                                 HYPRE_Int  n,
+                                 size_t     target )
+{
+   HYPRE_Int lo = 0, hi = n, mid;
+
+   while (lo < hi)
+   {
+      mid = lo + (hi - lo) / 2;
+      if (flops_start[mid] < target)
+      {
+         lo = mid + 1;
+      }
+      else
+      {
+         hi = mid;
+      }
+   }
+
+   return lo;
+}
+
+/* Returns the position of column col in the current row, which starts at
+ * row_start and has *row_len entries so far, appending col to the row if
+ * it is not in it yet. The dense marker holds row_start-based positions,
+ * the hash table and row_cols (when not NULL) positions within the row. */
+static inline HYPRE_Int
+hypre_CSRMatrixMultiplyRowFind( HYPRE_Int  kind,
+                                HYPRE_Int  col,
+                                HYPRE_Int  row_start,
+                                HYPRE_Int *row_len,
+                                HYPRE_Int *row_cols,
+                                HYPRE_Int *marker,
+                                HYPRE_Int *hash_keys,
+                                HYPRE_Int *hash_pos,
+                                HYPRE_Int  bits )
+{
+   HYPRE_Int pos, slot, mask;
+
+   if (kind == HYPRE_SPGEMM_ROW_DENSE)
+   {
+      if (marker[col] >= row_start)
+      {
+         return marker[col] - row_start;
+      }
+      marker[col] = row_start + *row_len;
+   }
+   else if (kind == HYPRE_SPGEMM_ROW_HASH)
+   {
+      mask = (1 << bits) - 1;
+      slot = (HYPRE_Int) (((hypre_uint) col * 2654435761U) >> (32 - bits));
+      while (hash_keys[slot] >= 0)
+      {
+         if (hash_keys[slot] == col)
+         {
+            return hash_pos[slot];
+         }
+         slot = (slot + 1) & mask;
+      }
+      hash_keys[slot] = col;
+      hash_pos[slot]  = *row_len;
+   }
+   else
+   {
+      for (pos = 0; pos < *row_len; pos++)
+      {
+         if (row_cols[pos] == col)
+         {
+            return pos;
+         }
+      }
+   }
+
+   if (row_cols)
+   {
+      row_cols[*row_len] = col;
+   }
+
+   return (*row_len)++;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMultiplyHost
  *
  * Multiplies two CSR Matrices A and B and returns a CSR Matrix C;
  *
+ * The rows of A are split over the threads by their number of products,
+ * and each row of C uses the accumulator described above.
+ *
  * Note: The routine does not check for 0-elements which might be generated
  *       through cancellation of elements in A and B or already contained
  *       in A and B. To remove those, use hypre_CSRMatrixDeleteZeros
@@ -685,16 +822,16 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
    HYPRE_MemoryLocation  memory_location_A = hypre_CSRMatrixMemoryLocation(A);
    HYPRE_MemoryLocation  memory_location_B = hypre_CSRMatrixMemoryLocation(B);
 
-   hypre_CSRMatrix      *C;
-   HYPRE_Complex        *C_data;
+   hypre_CSRMatrix      *C = NULL;
+   HYPRE_Complex        *C_data = NULL;
    HYPRE_Int            *C_i;
-   HYPRE_Int            *C_j;
+   HYPRE_Int            *C_j = NULL;
 
-   HYPRE_Int             ia, ib, ic, ja, jb, num_nonzeros;
-   HYPRE_Int             counter;
-   HYPRE_Complex         a_entry, b_entry;
+   HYPRE_Int             ic, iic, ia;
    HYPRE_Int             allsquare = 0;
    HYPRE_Int            *twspace;
+   HYPRE_Int            *row_flops;
+   size_t               *flops_start;
 
    /* RL: TODO cannot guarantee, maybe should never assert
    hypre_assert(memory_location_A == memory_location_B);
@@ -726,94 +863,182 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
       return C;
    }
 
+   if (!rownnz_A)
+   {
+      nnzrows_A = nrows_A;
+   }
+
    /* Allocate memory */
-   twspace = hypre_TAlloc(HYPRE_Int, hypre_NumThreads(), HYPRE_MEMORY_HOST);
-   C_i = hypre_CTAlloc(HYPRE_Int, nrows_A + 1, memory_location_C);
+   twspace     = hypre_TAlloc(HYPRE_Int, hypre_NumThreads() + 1, HYPRE_MEMORY_HOST);
+   row_flops   = hypre_TAlloc(HYPRE_Int, nnzrows_A, HYPRE_MEMORY_HOST);
+   flops_start = hypre_TAlloc(size_t, nnzrows_A + 1, HYPRE_MEMORY_HOST);
+   C_i         = hypre_CTAlloc(HYPRE_Int, nrows_A + 1, memory_location_C);
 
+   /* Number of products of each row, the diagonal of square C included */
 #ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel private(ia, ib, ic, ja, jb, num_nonzeros, counter, a_entry, b_entry)
+   #pragma omp parallel for private(ic, iic, ia) HYPRE_SMP_SCHEDULE
 #endif
+   for (ic = 0; ic < nnzrows_A; ic++)
    {
-      HYPRE_Int  *B_marker = NULL;
-      HYPRE_Int   ns, ne, ii, jj;
-      HYPRE_Int   num_threads;
-      HYPRE_Int   i1, iic;
+      HYPRE_Int flops = 0;
+
+      iic = rownnz_A ? rownnz_A[ic] : ic;
+      for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
+      {
+         flops += B_i[A_j[ia] + 1] - B_i[A_j[ia]];
+      }
+      row_flops[ic] = (allsquare && !rownnz_A) ? flops + 1 : flops;
+   }
+
+   flops_start[0] = 0;
+   for (ic = 0; ic < nnzrows_A; ic++)
+   {
+      flops_start[ic + 1] = flops_start[ic] + (size_t) row_flops[ic];
+   }
+
+   /* one multiply and one add per product */
+   hypre_OpCountsAddFlops(2.0 * (HYPRE_Real) flops_start[nnzrows_A]);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(ic, iic, ia)
+#endif
+   {
+      HYPRE_Int     *B_marker = NULL;
+      HYPRE_Int     *hash_keys = NULL;
+      HYPRE_Int     *hash_pos = NULL;
+      HYPRE_Int      list[HYPRE_SPGEMM_LIST_MAX_FLOPS + 1];
+      HYPRE_Int      ns, ne, ii, num_threads;
+      HYPRE_Int     *cols;
+      HYPRE_Complex *vals;
+      HYPRE_Int      ib, ja, k, pos, kind, bits, count, counter, row_start;
+      HYPRE_Int      max_bits = 0, offset, total;
+      HYPRE_Complex  a_entry;
 
       ii = hypre_GetThreadNum();
       num_threads = hypre_NumActiveThreads();
-      hypre_partition1D(nnzrows_A, num_threads, ii, &ns, &ne);
 
-      B_marker = hypre_CTAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
-      for (ib = 0; ib < ncols_B; ib++)
+      /* rows [ns, ne) of this thread hold about 1/num_threads of the flops */
+      ns = hypre_CSRMatrixMultiplyFirstRow(flops_start, nnzrows_A,
+                                           flops_start[nnzrows_A] * ii / num_threads);
+      ne = hypre_CSRMatrixMultiplyFirstRow(flops_start, nnzrows_A,
+                                           flops_start[nnzrows_A] * (ii + 1) / num_threads);
+      if (ii == num_threads - 1)
       {
-         B_marker[ib] = -1;
+         ne = nnzrows_A;
+      }
+
+      /* workspace of the accumulators used by the rows of this thread */
+      for (ic = ns; ic < ne; ic++)
+      {
+         kind = hypre_CSRMatrixMultiplyRowKind(row_flops[ic], ncols_B);
+         if (kind == HYPRE_SPGEMM_ROW_DENSE && !B_marker)
+         {
+            B_marker = hypre_TAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
+         }
+         else if (kind == HYPRE_SPGEMM_ROW_HASH)
+         {
+            max_bits = hypre_max(max_bits, hypre_CSRMatrixMultiplyHashBits(row_flops[ic]));
+         }
+      }
+      if (max_bits)
+      {
+         hash_keys = hypre_TAlloc(HYPRE_Int, 1 << max_bits, HYPRE_MEMORY_HOST);
+         hash_pos  = hypre_TAlloc(HYPRE_Int, 1 << max_bits, HYPRE_MEMORY_HOST);
+      }
+      if (B_marker)
+      {
+         for (ib = 0; ib < ncols_B; ib++)
+         {
+            B_marker[ib] = -1;
+         }
       }
 
       HYPRE_ANNOTATE_REGION_BEGIN("%s", "First pass");
 
       /* First pass: compute sizes of C rows. */
-      num_nonzeros = 0;
+      counter = 0;
       for (ic = ns; ic < ne; ic++)
       {
-         if (rownnz_A)
+         iic   = rownnz_A ? rownnz_A[ic] : ic;
+         kind  = hypre_CSRMatrixMultiplyRowKind(row_flops[ic], ncols_B);
+         bits  = (kind == HYPRE_SPGEMM_ROW_HASH) ?
+                 hypre_CSRMatrixMultiplyHashBits(row_flops[ic]) : 0;
+         cols  = (kind == HYPRE_SPGEMM_ROW_LIST) ? list : NULL;
+         count = 0;
+
+         if (kind == HYPRE_SPGEMM_ROW_HASH)
+         {
+            for (k = 0; k < (1 << bits); k++)
+            {
+               hash_keys[k] = -1;
+            }
+         }
+
+         if (allsquare && !rownnz_A)
          {
-            iic = rownnz_A[ic];
-            C_i[iic] = num_nonzeros;
+            hypre_CSRMatrixMultiplyRowFind(kind, iic, counter, &count, cols,
+                                           B_marker, hash_keys, hash_pos, bits);
          }
-         else
+
+         if (kind == HYPRE_SPGEMM_ROW_DENSE)
          {
-            iic = ic;
-            C_i[iic] = num_nonzeros;
-            if (allsquare)
+            for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
             {
-               B_marker[iic] = iic;
-               num_nonzeros++;
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+               {
+                  if (B_marker[B_j[ib]] < counter)
+                  {
+                     B_marker[B_j[ib]] = counter + count;
+                     count++;
+                  }
+               }
             }
          }
-
-         for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
+         else
          {
-            ja = A_j[ia];
-            for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+            for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
             {
-               jb = B_j[ib];
-               if (B_marker[jb] != iic)
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
                {
-                  B_marker[jb] = iic;
-                  num_nonzeros++;
+                  hypre_CSRMatrixMultiplyRowFind(kind, B_j[ib], counter, &count, cols,
+                                                 B_marker, hash_keys, hash_pos, bits);
                }
             }
          }
+
+         C_i[iic + 1] = count;
+         counter += count;
       }
-      twspace[ii] = num_nonzeros;
+      HYPRE_ANNOTATE_REGION_END("%s", "First pass");
 
+      /* Row sizes to row pointers, over a static partition of the rows */
 #ifdef HYPRE_USING_OPENMP
       #pragma omp barrier
 #endif
-
-      /* Correct C_i - phase 1 */
-      if (ii)
       {
-         jj = twspace[0];
-         for (i1 = 1; i1 < ii; i1++)
-         {
-            jj += twspace[i1];
-         }
+         HYPRE_Int rs, re;
 
-         for (i1 = ns; i1 < ne; i1++)
+         hypre_partition1D(nrows_A, num_threads, ii, &rs, &re);
+         offset = 0;
+         for (k = rs; k < re; k++)
          {
-            iic = rownnz_A ? rownnz_A[i1] : i1;
-            C_i[iic] += jj;
+            offset += C_i[k + 1];
+            C_i[k + 1] = offset;
          }
-      }
-      else
-      {
-         C_i[nrows_A] = 0;
-         for (i1 = 0; i1 < num_threads; i1++)
+         hypre_prefix_sum(&offset, &total, twspace);
+         for (k = rs; k < re; k++)
          {
-            C_i[nrows_A] += twspace[i1];
+            C_i[k + 1] += offset;
          }
+      }
 
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+      #pragma omp master
+#endif
+      {
          C = hypre_CSRMatrixCreate(nrows_A, ncols_B, C_i[nrows_A]);
          hypre_CSRMatrixI(C) = C_i;
          hypre_CSRMatrixInitialize_v2(C, 0, memory_location_C);
@@ -821,94 +1046,99 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
          C_data = hypre_CSRMatrixData(C);
       }
 
-      /* Correct C_i - phase 2 */
-      if (rownnz_A != NULL)
-      {
-#ifdef HYPRE_USING_OPENMP
-         #pragma omp barrier
-#endif
-         for (ic = ns; ic < (ne - 1); ic++)
-         {
-            for (iic = rownnz_A[ic] + 1; iic < rownnz_A[ic + 1]; iic++)
-            {
-               C_i[iic] = C_i[rownnz_A[ic + 1]];
-            }
-         }
-
-         if (ii < (num_threads - 1))
-         {
-            for (iic = rownnz_A[ne - 1] + 1; iic < rownnz_A[ne]; iic++)
-            {
-               C_i[iic] = C_i[rownnz_A[ne]];
-            }
-         }
-         else
-         {
-            for (iic = rownnz_A[ne - 1] + 1; iic < nrows_A; iic++)
-            {
-               C_i[iic] = C_i[nrows_A];
-            }
-         }
-      }
-      /* End of First Pass */
-      HYPRE_ANNOTATE_REGION_END("%s", "First pass");
-
 #ifdef HYPRE_USING_OPENMP
       #pragma omp barrier
 #endif
 
       /* Second pass: Fill in C_data and C_j. */
       HYPRE_ANNOTATE_REGION_BEGIN("%s", "Second pass");
-      for (ib = 0; ib < ncols_B; ib++)
+      if (B_marker)
       {
-         B_marker[ib] = -1;
+         for (ib = 0; ib < ncols_B; ib++)
+         {
+            B_marker[ib] = -1;
+         }
       }
 
-      counter = rownnz_A ? C_i[rownnz_A[ns]] : C_i[ns];
       for (ic = ns; ic < ne; ic++)
       {
-         if (rownnz_A)
+         iic       = rownnz_A ? rownnz_A[ic] : ic;
+         kind      = hypre_CSRMatrixMultiplyRowKind(row_flops[ic], ncols_B);
+         bits      = (kind == HYPRE_SPGEMM_ROW_HASH) ?
+                     hypre_CSRMatrixMultiplyHashBits(row_flops[ic]) : 0;
+         row_start = C_i[iic];
+         cols      = C_j + row_start;
+         vals      = C_data + row_start;
+         count     = 0;
+
+         if (kind == HYPRE_SPGEMM_ROW_HASH)
          {
-            iic = rownnz_A[ic];
-         }
-         else
-         {
-            iic = ic;
-            if (allsquare)
+            for (k = 0; k < (1 << bits); k++)
             {
-               B_marker[ic] = counter;
-               C_data[counter] = 0;
-               C_j[counter] = ic;
-               counter++;
+               hash_keys[k] = -1;
             }
          }
 
-         for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
+         if (allsquare && !rownnz_A)
          {
-            ja = A_j[ia];
-            a_entry = A_data[ia];
-            for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+            hypre_CSRMatrixMultiplyRowFind(kind, iic, row_start, &count, cols,
+                                           B_marker, hash_keys, hash_pos, bits);
+            vals[0] = 0;
+         }
+
+         if (kind == HYPRE_SPGEMM_ROW_DENSE)
+         {
+            for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
             {
-               jb = B_j[ib];
-               b_entry = B_data[ib];
-               if (B_marker[jb] < C_i[iic])
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
                {
-                  B_marker[jb] = counter;
-                  C_j[B_marker[jb]] = jb;
-                  C_data[B_marker[jb]] = a_entry * b_entry;
-                  counter++;
+                  pos = B_j[ib];
+                  if (B_marker[pos] < row_start)
+                  {
+                     B_marker[pos] = row_start + count;
+                     cols[count]   = pos;
+                     vals[count++] = a_entry * B_data[ib];
+                  }
+                  else
+                  {
+                     C_data[B_marker[pos]] += a_entry * B_data[ib];
+                  }
                }
-               else
+            }
+         }
+         else
+         {
+            for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
+            {
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
                {
-                  C_data[B_marker[jb]] += a_entry * b_entry;
+                  k   = count;
+                  pos = hypre_CSRMatrixMultiplyRowFind(kind, B_j[ib], row_start, &count, cols,
+                                                       B_marker, hash_keys, hash_pos, bits);
+                  if (count > k)
+                  {
+                     vals[pos] = a_entry * B_data[ib];
+                  }
+                  else
+                  {
+                     vals[pos] += a_entry * B_data[ib];
+                  }
                }
             }
          }
+
+         hypre_assert(row_start + count == C_i[iic + 1]);
       }
       HYPRE_ANNOTATE_REGION_END("%s", "Second pass");
 
       /* End of Second Pass */
       hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_keys, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_pos, HYPRE_MEMORY_HOST);
    } /*end parallel region */
 
 #ifdef HYPRE_DEBUG
@@ -923,6 +1153,8 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
 
    /* Free memory */
    hypre_TFree(twspace, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_flops, HYPRE_MEMORY_HOST);
+   hypre_TFree(flops_start, HYPRE_MEMORY_HOST);
 
    return C;
 }
@@ -1586,6 +1818,11 @@ hypre_CSRMatrixReorder(hypre_CSRMatrix *A)
 {
    HYPRE_Int ierr = 0;
 
+   /* the column indices and values are permuted in place */
+   hypre_CSRMatrixSellDestroy(A);
+   hypre_CSRMatrixFloatDestroy(A);
+   hypre_CSRMatrixShortJDestroy(A);
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) || defined(HYPRE_USING_SYCL)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_CSRMatrixMemoryLocation(A) );
 
@@ -1998,6 +2235,9 @@ hypre_CSRMatrixScale( hypre_CSRMatrix *A,
    HYPRE_Int      i;
    HYPRE_Int      k = hypre_CSRMatrixNumNonzeros(A);
 
+   hypre_CSRMatrixSellDestroy(A);
+   hypre_CSRMatrixFloatDestroy(A);
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_CSRMatrixMemoryLocation(A) );
 
@@ -2031,6 +2271,9 @@ hypre_CSRMatrixDiagScale( hypre_CSRMatrix *A,
       return hypre_error_flag;
    }
 
+   hypre_CSRMatrixSellDestroy(A);
+   hypre_CSRMatrixFloatDestroy(A);
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy2( hypre_CSRMatrixMemoryLocation(A),
                                                       hypre_VectorMemoryLocation(ld) );
@@ -2069,6 +2312,9 @@ hypre_CSRMatrixSetConstantValues( hypre_CSRMatrix *A,
    HYPRE_Int i;
    HYPRE_Int nnz = hypre_CSRMatrixNumNonzeros(A);
 
+   hypre_CSRMatrixSellDestroy(A);
+   hypre_CSRMatrixFloatDestroy(A);
+
    if (!hypre_CSRMatrixData(A))
    {
       hypre_CSRMatrixData(A) = hypre_TAlloc(HYPRE_Complex, nnz, hypre_CSRMatrixMemoryLocation(A));
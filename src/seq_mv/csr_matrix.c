@@ -40,6 +40,12 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    hypre_CSRMatrixNumCols(matrix)        = num_cols;
    hypre_CSRMatrixNumNonzeros(matrix)    = num_nonzeros;
    hypre_CSRMatrixMemoryLocation(matrix) = hypre_HandleMemoryLocation(hypre_handle());
+   hypre_CSRMatrixSellData(matrix)       = NULL;
+   hypre_CSRMatrixDataFloat(matrix)      = NULL;
+   hypre_CSRMatrixIShort(matrix)         = NULL;
+   hypre_CSRMatrixJShort(matrix)         = NULL;
+   hypre_CSRMatrixShortJCSRI(matrix)     = NULL;
+   hypre_CSRMatrixShortJCSRJ(matrix)     = NULL;
 
    /* set defaults */
    hypre_CSRMatrixOwnsData(matrix)       = 1;
@@ -76,6 +82,10 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
          hypre_TFree(hypre_CSRMatrixBigJ(matrix), memory_location);
       }
 
+      hypre_CSRMatrixSellDestroy(matrix);
+      hypre_TFree(hypre_CSRMatrixDataFloat(matrix), HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixShortJDestroy(matrix);
+
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE) || defined(HYPRE_USING_ONEMKLSPARSE)
       hypre_TFree(hypre_CSRMatrixSortedData(matrix), memory_location);
       hypre_TFree(hypre_CSRMatrixSortedJ(matrix), memory_location);
@@ -750,6 +760,11 @@ hypre_CSRMatrixCopy( hypre_CSRMatrix *A, hypre_CSRMatrix *B, HYPRE_Int copy_data
    HYPRE_MemoryLocation memory_location_A = hypre_CSRMatrixMemoryLocation(A);
    HYPRE_MemoryLocation memory_location_B = hypre_CSRMatrixMemoryLocation(B);
 
+   /* the arrays of B are overwritten in place */
+   hypre_CSRMatrixSellDestroy(B);
+   hypre_CSRMatrixFloatDestroy(B);
+   hypre_CSRMatrixShortJDestroy(B);
+
    hypre_TMemcpy(B_i, A_i, HYPRE_Int, num_rows + 1, memory_location_B, memory_location_A);
 
    if (A_rownnz)
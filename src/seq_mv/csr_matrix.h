@@ -26,6 +26,44 @@ struct hypre_GpuMatData;
 typedef struct hypre_GpuMatData hypre_GpuMatData;
 #endif
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma companion storage of a CSR Matrix (host only)
+ *
+ * Rows are sorted by decreasing length inside windows of sigma rows and
+ * grouped into slices of C rows. Each slice is padded to its longest row
+ * and stored column-major, so that the k-th nonzeros of the C rows of a
+ * slice are contiguous in memory and can be processed with SIMD loads.
+ * Padding entries have column -1 and are skipped by the kernels. The copy
+ * is a snapshot of the values, see hypre_CSRMatrixSellSetup.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int            chunk_size;      /* C: number of rows per slice */
+   HYPRE_Int            sigma;           /* sorting window (multiple of C) */
+   HYPRE_Int            num_rows;
+   HYPRE_Int            num_slices;
+   HYPRE_Int            num_nonzeros;    /* including padding */
+   HYPRE_Int           *slice_ptr;       /* offset of each slice in j and data */
+   HYPRE_Int           *slice_width;     /* longest row in each slice */
+   HYPRE_Int           *perm;            /* original row of each SELL row (-1: padding) */
+   HYPRE_Int           *j;
+   HYPRE_Complex       *data;
+   HYPRE_Complex       *csr_data;        /* data array of the CSR matrix it was built from */
+} hypre_CSRSellData;
+
+#define hypre_CSRSellDataChunkSize(sell)            ((sell) -> chunk_size)
+#define hypre_CSRSellDataSigma(sell)                ((sell) -> sigma)
+#define hypre_CSRSellDataNumRows(sell)              ((sell) -> num_rows)
+#define hypre_CSRSellDataNumSlices(sell)            ((sell) -> num_slices)
+#define hypre_CSRSellDataNumNonzeros(sell)          ((sell) -> num_nonzeros)
+#define hypre_CSRSellDataSlicePtr(sell)             ((sell) -> slice_ptr)
+#define hypre_CSRSellDataSliceWidth(sell)           ((sell) -> slice_width)
+#define hypre_CSRSellDataPerm(sell)                 ((sell) -> perm)
+#define hypre_CSRSellDataJ(sell)                    ((sell) -> j)
+#define hypre_CSRSellDataData(sell)                 ((sell) -> data)
+#define hypre_CSRSellDataCSRData(sell)              ((sell) -> csr_data)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -38,14 +76,19 @@ typedef struct
    HYPRE_Int             num_rows;
    HYPRE_Int             num_cols;
    HYPRE_Int             num_nonzeros;
-   hypre_int            *i_short;
-   hypre_int            *j_short;
+   HYPRE_Int            *i_short;         /* row pointer into j_short */
+   short                *j_short;         /* column indices as 16-bit deltas, built lazily */
+   HYPRE_Int            *short_j_csr_i;   /* i and j arrays and number of nonzeros */
+   HYPRE_Int            *short_j_csr_j;   /* j_short was built from */
+   HYPRE_Int             short_j_csr_nnz;
    HYPRE_Int             owns_data;       /* Does the CSRMatrix create/destroy `data', `i', `j'? */
    HYPRE_Int             pattern_only;    /* if 1, data array is ignored, and assumed to be all 1's */
    HYPRE_Complex        *data;
    HYPRE_Int            *rownnz;          /* for compressing rows in matrix multiplication  */
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
+   hypre_CSRSellData    *sell_data;       /* SELL-C-sigma copy used by host SpMV, built lazily */
+   float                *data_float;      /* single-precision values replacing data on host */
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE) || defined(HYPRE_USING_ONEMKLSPARSE)
    HYPRE_Int            *sorted_j;        /* some cusparse routines require sorted CSR */
    HYPRE_Complex        *sorted_data;
@@ -70,6 +113,13 @@ typedef struct
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixPatternOnly(matrix)          ((matrix) -> pattern_only)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixSellData(matrix)             ((matrix) -> sell_data)
+#define hypre_CSRMatrixDataFloat(matrix)            ((matrix) -> data_float)
+#define hypre_CSRMatrixIShort(matrix)               ((matrix) -> i_short)
+#define hypre_CSRMatrixJShort(matrix)               ((matrix) -> j_short)
+#define hypre_CSRMatrixShortJCSRI(matrix)           ((matrix) -> short_j_csr_i)
+#define hypre_CSRMatrixShortJCSRJ(matrix)           ((matrix) -> short_j_csr_j)
+#define hypre_CSRMatrixShortJCSRNnz(matrix)         ((matrix) -> short_j_csr_nnz)
 
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE) || defined(HYPRE_USING_ONEMKLSPARSE)
 #define hypre_CSRMatrixSortedJ(matrix)              ((matrix) -> sorted_j)
@@ -81,6 +131,35 @@ typedef struct
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionBegin( hypre_CSRMatrix *A );
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionEnd( hypre_CSRMatrix *A );
 
+/*--------------------------------------------------------------------------
+ * 16-bit column deltas (see csr_short_j.c)
+ *
+ * Row i of j_short starts at i_short[i]. Each column is stored as its
+ * difference to the row index i. Differences that do not fit are written
+ * as HYPRE_SHORT_J_ESCAPE followed by the low and high 16 bits of the
+ * column. Rows without escapes have as many entries in j_short as in j,
+ * which the kernels use to skip the escape checks.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_SHORT_J_ESCAPE (-32768)
+
+static inline HYPRE_Int
+hypre_CSRShortJNext( const short *j_short,
+                     HYPRE_Int   *pos,
+                     HYPRE_Int    row )
+{
+   HYPRE_Int d = (HYPRE_Int) j_short[(*pos)++];
+
+   if (d == HYPRE_SHORT_J_ESCAPE)
+   {
+      d  = (HYPRE_Int) (unsigned short) j_short[(*pos)++];
+      d |= (HYPRE_Int) (unsigned short) j_short[(*pos)++] << 16;
+      return d;
+   }
+
+   return row + d;
+}
+
 /*--------------------------------------------------------------------------
  * CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -695,14 +695,23 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
    return ierr;
 }
 
-HYPRE_Int
-hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
-                                 hypre_CSRMatrix *A,
-                                 hypre_Vector    *x,
-                                 HYPRE_Complex    beta,
-                                 hypre_Vector    *b,
-                                 hypre_Vector    *y,
-                                 HYPRE_Int        offset )
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecOutOfPlaceSelect
+ *
+ * Picks the kernel for y = alpha*A*x + beta*b. The 16-bit column deltas
+ * are only tried if use_short_j is set, i.e., for the diag block of a
+ * ParCSR matrix, whose column indices stay close to the row index.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CSRMatrixMatvecOutOfPlaceSelect( HYPRE_Complex    alpha,
+                                       hypre_CSRMatrix *A,
+                                       hypre_Vector    *x,
+                                       HYPRE_Complex    beta,
+                                       hypre_Vector    *b,
+                                       hypre_Vector    *y,
+                                       HYPRE_Int        offset,
+                                       HYPRE_Int        use_short_j )
 {
 #ifdef HYPRE_PROFILE
    HYPRE_Real time_begin = hypre_MPI_Wtime();
@@ -718,6 +727,20 @@ hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if (hypre_CSRMatrixDataFloat(A))
+   {
+      ierr = hypre_CSRMatrixMatvecFloatHost(alpha, A, x, beta, b, y, offset);
+   }
+   else if (hypre_CSRMatrixSellIsUsable(A, x, offset))
+   {
+      ierr = hypre_CSRMatrixMatvecSellHost(alpha, A, x, beta, b, y);
+   }
+   else if (use_short_j && offset == 0 && hypre_VectorNumVectors(x) == 1 &&
+            hypre_CSRMatrixShortJIsUsable(A))
+   {
+      ierr = hypre_CSRMatrixMatvecShortJHost(alpha, A, x, beta, b, y);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecOutOfPlaceHost(alpha, A, x, beta, b, y, offset);
    }
@@ -729,6 +752,36 @@ hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
    return ierr;
 }
 
+HYPRE_Int
+hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
+                                 hypre_CSRMatrix *A,
+                                 hypre_Vector    *x,
+                                 HYPRE_Complex    beta,
+                                 hypre_Vector    *b,
+                                 hypre_Vector    *y,
+                                 HYPRE_Int        offset )
+{
+   return hypre_CSRMatrixMatvecOutOfPlaceSelect(alpha, A, x, beta, b, y, offset, 0);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecDiagOutOfPlace
+ *
+ * hypre_CSRMatrixMatvecOutOfPlace for the diag block of a ParCSR matrix,
+ * which may also go through the 16-bit column deltas (see csr_short_j.c).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecDiagOutOfPlace( HYPRE_Complex    alpha,
+                                     hypre_CSRMatrix *A,
+                                     hypre_Vector    *x,
+                                     HYPRE_Complex    beta,
+                                     hypre_Vector    *b,
+                                     hypre_Vector    *y )
+{
+   return hypre_CSRMatrixMatvecOutOfPlaceSelect(alpha, A, x, beta, b, y, 0, 1);
+}
+
 HYPRE_Int
 hypre_CSRMatrixMatvec( HYPRE_Complex    alpha,
                        hypre_CSRMatrix *A,
@@ -739,6 +792,101 @@ hypre_CSRMatrixMatvec( HYPRE_Complex    alpha,
    return hypre_CSRMatrixMatvecOutOfPlace(alpha, A, x, beta, y, y, 0);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixResidualNorm
+ *
+ * Computes r = b - A*x and the squared 2-norm of r in a single pass over the
+ * rows of A. b and r may be the same vector. Each row is summed before b is
+ * added, in the same order as hypre_CSRMatrixMatvecOutOfPlace, so r and its
+ * norm match the unfused computation. Multiple vectors, device data, complex
+ * values and the float and SELL formats fall back to a matvec followed by
+ * an inner product.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixResidualNorm( hypre_CSRMatrix *A,
+                             hypre_Vector    *x,
+                             hypre_Vector    *b,
+                             hypre_Vector    *r,
+                             HYPRE_Real      *r_norm2 )
+{
+   HYPRE_Complex    *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A);
+
+   HYPRE_Complex    *x_data   = hypre_VectorData(x);
+   HYPRE_Complex    *b_data   = hypre_VectorData(b);
+   HYPRE_Complex    *r_data   = hypre_VectorData(r);
+   HYPRE_Real        result   = 0.0;
+   HYPRE_Complex     tempx;
+   HYPRE_Int         i, jj, ierr = 0;
+   HYPRE_Int         use_matvec;
+
+#if defined(HYPRE_USING_GPU)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_CSRMatrixMemoryLocation(A) );
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      ierr = hypre_CSRMatrixMatvecOutOfPlace(-1.0, A, x, 1.0, b, r, 0);
+      *r_norm2 = hypre_SeqVectorInnerProd(r, r);
+
+      return ierr;
+   }
+#endif
+
+#if defined(HYPRE_COMPLEX)
+   use_matvec = 1;
+#else
+   use_matvec = ( hypre_VectorNumVectors(x) > 1 || x == r ||
+                  hypre_CSRMatrixDataFloat(A) ||
+                  hypre_CSRMatrixSellIsUsable(A, x, 0) );
+#endif
+
+   if (use_matvec)
+   {
+      ierr = hypre_CSRMatrixMatvecOutOfPlace(-1.0, A, x, 1.0, b, r, 0);
+      *r_norm2 = hypre_SeqVectorInnerProd(r, r);
+
+      return ierr;
+   }
+
+   if (hypre_CSRMatrixNumCols(A) != hypre_VectorSize(x))
+   {
+      ierr = 1;
+   }
+   if (num_rows != hypre_VectorSize(r) || num_rows != hypre_VectorSize(b))
+   {
+      ierr = (ierr == 1) ? 3 : 2;
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_MATVEC] -= hypre_MPI_Wtime();
+#endif
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, jj, tempx) reduction(+:result) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      tempx = 0.0;
+      for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+      {
+         tempx -= A_data[jj] * x_data[A_j[jj]];
+      }
+      tempx += b_data[i];
+      r_data[i] = tempx;
+      result += tempx * tempx;
+   }
+
+   *r_norm2 = result;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_MATVEC] += hypre_MPI_Wtime();
+#endif
+
+   return ierr;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMatvecT
  *
@@ -998,6 +1146,15 @@ hypre_CSRMatrixMatvecT( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if (hypre_CSRMatrixDataFloat(A))
+   {
+      ierr = hypre_CSRMatrixMatvecTFloatHost(alpha, A, x, beta, y);
+   }
+   else if (hypre_CSRMatrixSellIsUsable(A, x, 0))
+   {
+      ierr = hypre_CSRMatrixMatvecTSellHost(alpha, A, x, beta, y);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecTHost(alpha, A, x, beta, y);
    }
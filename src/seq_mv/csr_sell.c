@@ -0,0 +1,661 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * SELL-C-sigma companion storage for hypre_CSRMatrix and the host
+ * (SIMD) matvec kernels using it.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/* The explicit SIMD kernels are only available for real double precision and
+ * 32-bit local indices. Otherwise, the plain loops below are used and left to
+ * the compiler for vectorization. */
+#if !defined(HYPRE_COMPLEX) && !defined(HYPRE_SINGLE) && !defined(HYPRE_LONG_DOUBLE) && !defined(HYPRE_BIGINT)
+#if defined(__AVX512F__)
+#define HYPRE_SELL_USING_AVX512
+#endif
+#if defined(__AVX2__)
+#define HYPRE_SELL_USING_AVX2
+#endif
+#endif
+
+#if defined(HYPRE_SELL_USING_AVX512) || defined(HYPRE_SELL_USING_AVX2)
+#include <immintrin.h>
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellCreate
+ *
+ * Builds the SELL-C-sigma copy of A with C = chunk_size and the given sigma.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellCreate( hypre_CSRMatrix *A,
+                           HYPRE_Int        chunk_size,
+                           HYPRE_Int        sigma )
+{
+   HYPRE_Int         *A_i        = hypre_CSRMatrixI(A);
+   HYPRE_Int          num_rows   = hypre_CSRMatrixNumRows(A);
+
+   hypre_CSRSellData *sell;
+   HYPRE_Int          num_slices;
+   HYPRE_Int         *slice_ptr;
+   HYPRE_Int         *slice_width;
+   HYPRE_Int         *perm;
+   HYPRE_Int         *keys;
+   HYPRE_Int          i, s, w, w_end, width;
+
+   if (chunk_size <= 0 || chunk_size > HYPRE_SELL_MAX_CHUNK_SIZE)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (sigma < chunk_size || sigma % chunk_size)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixSellDestroy(A);
+
+   num_slices  = (num_rows + chunk_size - 1) / chunk_size;
+   slice_ptr   = hypre_CTAlloc(HYPRE_Int, num_slices + 1, HYPRE_MEMORY_HOST);
+   slice_width = hypre_CTAlloc(HYPRE_Int, num_slices, HYPRE_MEMORY_HOST);
+   perm        = hypre_TAlloc(HYPRE_Int, num_slices * chunk_size, HYPRE_MEMORY_HOST);
+   keys        = hypre_TAlloc(HYPRE_Int, hypre_min(sigma, num_rows), HYPRE_MEMORY_HOST);
+
+   /* Sort rows by decreasing length inside each sigma window */
+   for (w = 0; w < num_rows; w += sigma)
+   {
+      w_end = hypre_min(w + sigma, num_rows);
+      for (i = w; i < w_end; i++)
+      {
+         perm[i] = i;
+         keys[i - w] = -(A_i[i + 1] - A_i[i]);
+      }
+      hypre_qsort2i(keys, perm + w, 0, w_end - w - 1);
+   }
+   for (i = num_rows; i < num_slices * chunk_size; i++)
+   {
+      perm[i] = -1;
+   }
+
+   /* Compute slice widths and offsets */
+   for (s = 0; s < num_slices; s++)
+   {
+      width = 0;
+      for (i = s * chunk_size; i < (s + 1) * chunk_size; i++)
+      {
+         if (perm[i] >= 0)
+         {
+            width = hypre_max(width, A_i[perm[i] + 1] - A_i[perm[i]]);
+         }
+      }
+      slice_width[s]   = width;
+      slice_ptr[s + 1] = slice_ptr[s] + width * chunk_size;
+   }
+
+   sell = hypre_CTAlloc(hypre_CSRSellData, 1, HYPRE_MEMORY_HOST);
+
+   hypre_CSRSellDataChunkSize(sell)   = chunk_size;
+   hypre_CSRSellDataSigma(sell)       = sigma;
+   hypre_CSRSellDataNumRows(sell)     = num_rows;
+   hypre_CSRSellDataNumSlices(sell)   = num_slices;
+   hypre_CSRSellDataNumNonzeros(sell) = slice_ptr[num_slices];
+   hypre_CSRSellDataSlicePtr(sell)    = slice_ptr;
+   hypre_CSRSellDataSliceWidth(sell)  = slice_width;
+   hypre_CSRSellDataPerm(sell)        = perm;
+   hypre_CSRSellDataJ(sell)           = hypre_TAlloc(HYPRE_Int, slice_ptr[num_slices],
+                                                     HYPRE_MEMORY_HOST);
+   hypre_CSRSellDataData(sell)        = hypre_TAlloc(HYPRE_Complex, slice_ptr[num_slices],
+                                                     HYPRE_MEMORY_HOST);
+
+   hypre_CSRMatrixSellData(A) = sell;
+
+   /* Fill in column indices and values */
+   hypre_CSRMatrixSellUpdate(A, 1);
+
+   hypre_TFree(keys, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellUpdate
+ *
+ * Copies the values (and the column indices if update_j != 0) of the CSR
+ * matrix into its existing SELL-C-sigma copy. The sparsity pattern of A
+ * must not have changed since hypre_CSRMatrixSellCreate.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellUpdate( hypre_CSRMatrix *A,
+                           HYPRE_Int        update_j )
+{
+   hypre_CSRSellData *sell        = hypre_CSRMatrixSellData(A);
+   HYPRE_Int         *A_i         = hypre_CSRMatrixI(A);
+   HYPRE_Int         *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Complex     *A_data      = hypre_CSRMatrixData(A);
+
+   HYPRE_Int          C, num_slices;
+   HYPRE_Int         *slice_ptr, *slice_width, *perm;
+   HYPRE_Int         *S_j;
+   HYPRE_Complex     *S_data;
+   HYPRE_Int          s, r, k, row, len;
+
+   if (!sell)
+   {
+      return hypre_error_flag;
+   }
+
+   C           = hypre_CSRSellDataChunkSize(sell);
+   num_slices  = hypre_CSRSellDataNumSlices(sell);
+   slice_ptr   = hypre_CSRSellDataSlicePtr(sell);
+   slice_width = hypre_CSRSellDataSliceWidth(sell);
+   perm        = hypre_CSRSellDataPerm(sell);
+   S_j         = hypre_CSRSellDataJ(sell);
+   S_data      = hypre_CSRSellDataData(sell);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(s,r,k,row,len) HYPRE_SMP_SCHEDULE
+#endif
+   for (s = 0; s < num_slices; s++)
+   {
+      HYPRE_Int      *s_j    = S_j + slice_ptr[s];
+      HYPRE_Complex  *s_data = S_data + slice_ptr[s];
+
+      for (r = 0; r < C; r++)
+      {
+         row = perm[s * C + r];
+         len = (row >= 0) ? A_i[row + 1] - A_i[row] : 0;
+
+         for (k = 0; k < len; k++)
+         {
+            s_data[k * C + r] = A_data[A_i[row] + k];
+         }
+         for (k = len; k < slice_width[s]; k++)
+         {
+            s_data[k * C + r] = 0.0;
+         }
+
+         if (update_j)
+         {
+            for (k = 0; k < len; k++)
+            {
+               s_j[k * C + r] = A_j[A_i[row] + k];
+            }
+
+            /* the kernels skip padding, so that x is not read for it */
+            for (k = len; k < slice_width[s]; k++)
+            {
+               s_j[k * C + r] = -1;
+            }
+         }
+      }
+   }
+
+   hypre_CSRSellDataCSRData(sell) = A_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellDestroy( hypre_CSRMatrix *A )
+{
+   hypre_CSRSellData *sell = hypre_CSRMatrixSellData(A);
+
+   if (sell)
+   {
+      hypre_TFree(hypre_CSRSellDataSlicePtr(sell),   HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataSliceWidth(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataPerm(sell),       HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataJ(sell),          HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataData(sell),       HYPRE_MEMORY_HOST);
+      hypre_TFree(sell, HYPRE_MEMORY_HOST);
+
+      hypre_CSRMatrixSellData(A) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellSetup
+ *
+ * Makes sure the SELL-C-sigma copy of A exists and matches the current
+ * parameters in the hypre handle. The copy is rebuilt if the CSR arrays
+ * have been reallocated since it was created. It is a snapshot of the
+ * values: code that writes the values or the pattern of A in place must
+ * call hypre_CSRMatrixSellDestroy (or hypre_CSRMatrixSellUpdate).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellSetup( hypre_CSRMatrix *A )
+{
+   hypre_CSRSellData *sell       = hypre_CSRMatrixSellData(A);
+   HYPRE_Int          chunk_size = hypre_HandleSellChunkSize(hypre_handle());
+   HYPRE_Int          sigma      = hypre_HandleSellSigma(hypre_handle());
+
+   if ( sell &&
+        hypre_CSRSellDataChunkSize(sell) == chunk_size &&
+        hypre_CSRSellDataSigma(sell)     == sigma      &&
+        hypre_CSRSellDataNumRows(sell)   == hypre_CSRMatrixNumRows(A) &&
+        hypre_CSRSellDataCSRData(sell)   == hypre_CSRMatrixData(A) )
+   {
+      return hypre_error_flag;
+   }
+
+   return hypre_CSRMatrixSellCreate(A, chunk_size, sigma);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellIsUsable
+ *
+ * Returns 1 if the host matvec with A and x can go through the SELL path.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellIsUsable( hypre_CSRMatrix *A,
+                             hypre_Vector    *x,
+                             HYPRE_Int        offset )
+{
+   return ( hypre_HandleSpMVUseSell(hypre_handle()) &&
+            offset == 0 &&
+            hypre_VectorNumVectors(x) == 1 &&
+            hypre_CSRMatrixNumRows(A) > 0 &&
+            hypre_CSRMatrixNumCols(A) > 0 &&
+            !hypre_CSRMatrixPatternOnly(A) &&
+            hypre_CSRMatrixI(A) && hypre_CSRMatrixJ(A) && hypre_CSRMatrixData(A) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRSellSliceMatvec
+ *
+ * sum[0:C] = S*x for one slice S of width w. Padding (column -1) is
+ * masked out of the loads of x.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_CSRSellSliceMatvec( HYPRE_Int             C,
+                          HYPRE_Int             w,
+                          const HYPRE_Int      *s_j,
+                          const HYPRE_Complex  *s_data,
+                          const HYPRE_Complex  *x_data,
+                          HYPRE_Complex        *sum )
+{
+   HYPRE_Int r = 0, k;
+
+#if defined(HYPRE_SELL_USING_AVX512)
+   for (; r + 8 <= C; r += 8)
+   {
+      __m512d acc = _mm512_setzero_pd();
+      for (k = 0; k < w; k++)
+      {
+         __m256i idx = _mm256_loadu_si256((const __m256i *) (s_j + k * C + r));
+         __mmask8 m  = (__mmask8) _mm512_mask_cmpge_epi32_mask(0xFF, _mm512_castsi256_si512(idx),
+                                                                _mm512_setzero_si512());
+         __m512d xv  = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), m, idx, x_data, 8);
+         __m512d av  = _mm512_loadu_pd(s_data + k * C + r);
+         acc = _mm512_fmadd_pd(av, xv, acc);
+      }
+      _mm512_storeu_pd(sum + r, acc);
+   }
+#endif
+
+#if defined(HYPRE_SELL_USING_AVX2)
+   for (; r + 4 <= C; r += 4)
+   {
+      __m256d acc = _mm256_setzero_pd();
+      for (k = 0; k < w; k++)
+      {
+         __m128i idx = _mm_loadu_si128((const __m128i *) (s_j + k * C + r));
+         __m256d m   = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(
+                                              _mm_cmpgt_epi32(idx, _mm_set1_epi32(-1))));
+         __m256d xv  = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x_data, idx, m, 8);
+         __m256d av  = _mm256_loadu_pd(s_data + k * C + r);
+#if defined(__FMA__)
+         acc = _mm256_fmadd_pd(av, xv, acc);
+#else
+         acc = _mm256_add_pd(acc, _mm256_mul_pd(av, xv));
+#endif
+      }
+      _mm256_storeu_pd(sum + r, acc);
+   }
+#endif
+
+   if (r < C)
+   {
+      HYPRE_Int rr, r0 = r;
+
+      for (rr = r0; rr < C; rr++)
+      {
+         sum[rr] = 0.0;
+      }
+      for (k = 0; k < w; k++)
+      {
+         for (rr = r0; rr < C; rr++)
+         {
+            if (s_j[k * C + rr] >= 0)
+            {
+               sum[rr] += s_data[k * C + rr] * x_data[s_j[k * C + rr]];
+            }
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRSellSliceScale
+ *
+ * prod[0:C] = S[k,0:C] .* xs[0:C] for the k-th column of one slice S
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_CSRSellSliceScale( HYPRE_Int             C,
+                         const HYPRE_Complex  *s_data,
+                         const HYPRE_Complex  *xs,
+                         HYPRE_Complex        *prod )
+{
+   HYPRE_Int r = 0;
+
+#if defined(HYPRE_SELL_USING_AVX512)
+   for (; r + 8 <= C; r += 8)
+   {
+      _mm512_storeu_pd(prod + r, _mm512_mul_pd(_mm512_loadu_pd(s_data + r),
+                                               _mm512_loadu_pd(xs + r)));
+   }
+#endif
+
+#if defined(HYPRE_SELL_USING_AVX2)
+   for (; r + 4 <= C; r += 4)
+   {
+      _mm256_storeu_pd(prod + r, _mm256_mul_pd(_mm256_loadu_pd(s_data + r),
+                                               _mm256_loadu_pd(xs + r)));
+   }
+#endif
+
+   for (; r < C; r++)
+   {
+      prod[r] = s_data[r] * xs[r];
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSellHost
+ *
+ * y = alpha*A*x + beta*b using the SELL-C-sigma copy of A (built if needed).
+ * Only single vectors are supported.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSellHost( HYPRE_Complex    alpha,
+                               hypre_CSRMatrix *A,
+                               hypre_Vector    *x,
+                               HYPRE_Complex    beta,
+                               hypre_Vector    *b,
+                               hypre_Vector    *y )
+{
+   HYPRE_Int          num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int          num_cols = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex     *x_data   = hypre_VectorData(x);
+   HYPRE_Complex     *b_data   = hypre_VectorData(b);
+   HYPRE_Complex     *y_data   = hypre_VectorData(y);
+   HYPRE_Int          x_size   = hypre_VectorSize(x);
+   HYPRE_Int          b_size   = hypre_VectorSize(b);
+   HYPRE_Int          y_size   = hypre_VectorSize(y);
+
+   hypre_CSRSellData *sell;
+   HYPRE_Int          C, num_slices;
+   HYPRE_Int         *slice_ptr, *slice_width, *perm;
+   HYPRE_Int         *S_j;
+   HYPRE_Complex     *S_data;
+   HYPRE_Int          s, r, row, ierr = 0;
+   hypre_Vector      *x_tmp = NULL;
+
+   hypre_assert(hypre_VectorNumVectors(x) == 1);
+
+   if (num_cols != x_size)
+   {
+      ierr = 1;
+   }
+
+   if (num_rows != y_size || num_rows != b_size)
+   {
+      ierr = 2;
+   }
+
+   if (num_cols != x_size && (num_rows != y_size || num_rows != b_size))
+   {
+      ierr = 3;
+   }
+
+   hypre_CSRMatrixSellSetup(A);
+
+   sell        = hypre_CSRMatrixSellData(A);
+   C           = hypre_CSRSellDataChunkSize(sell);
+   num_slices  = hypre_CSRSellDataNumSlices(sell);
+   slice_ptr   = hypre_CSRSellDataSlicePtr(sell);
+   slice_width = hypre_CSRSellDataSliceWidth(sell);
+   perm        = hypre_CSRSellDataPerm(sell);
+   S_j         = hypre_CSRSellDataJ(sell);
+   S_data      = hypre_CSRSellDataData(sell);
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(s,r,row) HYPRE_SMP_SCHEDULE
+#endif
+   for (s = 0; s < num_slices; s++)
+   {
+      HYPRE_Complex sum[HYPRE_SELL_MAX_CHUNK_SIZE];
+
+      hypre_CSRSellSliceMatvec(C, slice_width[s], S_j + slice_ptr[s], S_data + slice_ptr[s],
+                               x_data, sum);
+
+      if (beta == 0.0)
+      {
+         for (r = 0; r < C; r++)
+         {
+            row = perm[s * C + r];
+            if (row >= 0)
+            {
+               y_data[row] = alpha * sum[r];
+            }
+         }
+      }
+      else
+      {
+         for (r = 0; r < C; r++)
+         {
+            row = perm[s * C + r];
+            if (row >= 0)
+            {
+               y_data[row] = alpha * sum[r] + beta * b_data[row];
+            }
+         }
+      }
+   }
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTSellHost
+ *
+ * y = alpha*A^T*x + beta*y using the SELL-C-sigma copy of A (built if
+ * needed). Only single vectors are supported. As in
+ * hypre_CSRMatrixMatvecTHost, each thread accumulates into its own copy of y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTSellHost( HYPRE_Complex    alpha,
+                                hypre_CSRMatrix *A,
+                                hypre_Vector    *x,
+                                HYPRE_Complex    beta,
+                                hypre_Vector    *y )
+{
+   HYPRE_Int          num_rows    = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int          num_cols    = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex     *x_data      = hypre_VectorData(x);
+   HYPRE_Complex     *y_data      = hypre_VectorData(y);
+   HYPRE_Int          x_size      = hypre_VectorSize(x);
+   HYPRE_Int          y_size      = hypre_VectorSize(y);
+   HYPRE_Int          num_threads = hypre_NumThreads();
+
+   hypre_CSRSellData *sell;
+   HYPRE_Int          C, num_slices;
+   HYPRE_Int         *slice_ptr, *slice_width, *perm;
+   HYPRE_Int         *S_j;
+   HYPRE_Complex     *S_data;
+   HYPRE_Complex     *y_data_expand = NULL;
+   HYPRE_Int          i, ierr = 0;
+   hypre_Vector      *x_tmp = NULL;
+
+   hypre_assert(hypre_VectorNumVectors(x) == 1);
+
+   if (num_rows != x_size)
+   {
+      ierr = 1;
+   }
+
+   if (num_cols != y_size)
+   {
+      ierr = 2;
+   }
+
+   if (num_rows != x_size && num_cols != y_size)
+   {
+      ierr = 3;
+   }
+
+   hypre_CSRMatrixSellSetup(A);
+
+   sell        = hypre_CSRMatrixSellData(A);
+   C           = hypre_CSRSellDataChunkSize(sell);
+   num_slices  = hypre_CSRSellDataNumSlices(sell);
+   slice_ptr   = hypre_CSRSellDataSlicePtr(sell);
+   slice_width = hypre_CSRSellDataSliceWidth(sell);
+   perm        = hypre_CSRSellDataPerm(sell);
+   S_j         = hypre_CSRSellDataJ(sell);
+   S_data      = hypre_CSRSellDataData(sell);
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   /*-----------------------------------------------------------------------
+    * y = beta*y
+    *-----------------------------------------------------------------------*/
+
+   if (beta != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols; i++)
+      {
+         y_data[i] = (beta == 0.0) ? 0.0 : beta * y_data[i];
+      }
+   }
+
+   if (num_threads > 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads * y_size, HYPRE_MEMORY_HOST);
+   }
+
+   /*-----------------------------------------------------------------------
+    * y += alpha*A^T*x
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i)
+#endif
+   {
+      HYPRE_Complex  xs[HYPRE_SELL_MAX_CHUNK_SIZE];
+      HYPRE_Complex  prod[HYPRE_SELL_MAX_CHUNK_SIZE];
+      HYPRE_Complex *y_local = y_data;
+      HYPRE_Int      s, r, k, row;
+
+      if (num_threads > 1)
+      {
+         y_local = y_data_expand + hypre_GetThreadNum() * y_size;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (s = 0; s < num_slices; s++)
+      {
+         HYPRE_Int     *s_j    = S_j + slice_ptr[s];
+         HYPRE_Complex *s_data = S_data + slice_ptr[s];
+
+         for (r = 0; r < C; r++)
+         {
+            row   = perm[s * C + r];
+            xs[r] = (row >= 0) ? alpha * x_data[row] : 0.0;
+         }
+
+         for (k = 0; k < slice_width[s]; k++)
+         {
+            hypre_CSRSellSliceScale(C, s_data + k * C, xs, prod);
+            for (r = 0; r < C; r++)
+            {
+               if (s_j[k * C + r] >= 0)
+               {
+                  y_local[s_j[k * C + r]] += prod[r];
+               }
+            }
+         }
+      }
+
+      if (num_threads > 1)
+      {
+         /* implied barrier */
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < y_size; i++)
+         {
+            HYPRE_Int t;
+            for (t = 0; t < num_threads; t++)
+            {
+               y_data[i] += y_data_expand[t * y_size + i];
+            }
+         }
+      }
+   } /* end parallel threaded region */
+
+   hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
@@ -0,0 +1,244 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Compressed column indices for hypre_CSRMatrix: 16-bit deltas stored in
+ * i_short/j_short, and the host matvec kernel decoding them on the fly.
+ * The format is described next to hypre_CSRShortJNext in csr_matrix.h.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixShortJCreate
+ *
+ * Builds the 16-bit delta copy of the column indices of A, replacing any
+ * existing one.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixShortJCreate( hypre_CSRMatrix *A )
+{
+   HYPRE_Int   *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int   *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int    num_rows = hypre_CSRMatrixNumRows(A);
+
+   HYPRE_Int   *i_short;
+   short       *j_short;
+   HYPRE_Int    i, jj, pos, d;
+
+   hypre_CSRMatrixShortJDestroy(A);
+
+   /* count the length of each row in the delta stream */
+   i_short = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   i_short[0] = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      pos = i_short[i];
+      for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+      {
+         d    = A_j[jj] - i;
+         pos += (d > HYPRE_SHORT_J_ESCAPE && d <= 32767) ? 1 : 3;
+      }
+      i_short[i + 1] = pos;
+   }
+
+   /* write the deltas */
+   j_short = hypre_TAlloc(short, i_short[num_rows], HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, jj, pos, d) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      pos = i_short[i];
+      for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+      {
+         d = A_j[jj] - i;
+         if (d > HYPRE_SHORT_J_ESCAPE && d <= 32767)
+         {
+            j_short[pos++] = (short) d;
+         }
+         else
+         {
+            j_short[pos++] = (short) HYPRE_SHORT_J_ESCAPE;
+            j_short[pos++] = (short) (unsigned short) (A_j[jj] & 0xFFFF);
+            j_short[pos++] = (short) (unsigned short) ((A_j[jj] >> 16) & 0xFFFF);
+         }
+      }
+   }
+
+   hypre_CSRMatrixIShort(A)       = i_short;
+   hypre_CSRMatrixJShort(A)       = j_short;
+   hypre_CSRMatrixShortJCSRI(A)   = A_i;
+   hypre_CSRMatrixShortJCSRJ(A)   = A_j;
+   hypre_CSRMatrixShortJCSRNnz(A) = A_i[num_rows];
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixShortJDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixShortJDestroy( hypre_CSRMatrix *A )
+{
+   hypre_TFree(hypre_CSRMatrixIShort(A), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_CSRMatrixJShort(A), HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixShortJCSRI(A) = NULL;
+   hypre_CSRMatrixShortJCSRJ(A) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixShortJSetup
+ *
+ * Makes sure the 16-bit delta copy of the column indices of A exists and
+ * matches the current pattern, rebuilding it if the i or j arrays or the
+ * number of nonzeros of A changed since it was created. Code that rewrites
+ * the pattern in place must call hypre_CSRMatrixShortJDestroy.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixShortJSetup( hypre_CSRMatrix *A )
+{
+   HYPRE_Int *A_i = hypre_CSRMatrixI(A);
+
+   if ( hypre_CSRMatrixIShort(A) &&
+        hypre_CSRMatrixShortJCSRI(A)   == A_i &&
+        hypre_CSRMatrixShortJCSRJ(A)   == hypre_CSRMatrixJ(A) &&
+        hypre_CSRMatrixShortJCSRNnz(A) == A_i[hypre_CSRMatrixNumRows(A)] )
+   {
+      return hypre_error_flag;
+   }
+
+   return hypre_CSRMatrixShortJCreate(A);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixShortJIsUsable
+ *
+ * Returns 1 if host kernels on A may read the 16-bit column deltas. The
+ * local column indices must fit in 32 bits. The deltas are taken from the
+ * row index, so only diag blocks of ParCSR matrices are stored this way
+ * (see hypre_CSRMatrixMatvecDiagOutOfPlace and the hybrid Gauss-Seidel).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixShortJIsUsable( hypre_CSRMatrix *A )
+{
+   return ( hypre_HandleSpMVUseShortJ(hypre_handle()) &&
+            hypre_CSRMatrixNumRows(A) > 0 &&
+            hypre_CSRMatrixNumCols(A) > 0 &&
+            (HYPRE_BigInt) hypre_CSRMatrixNumCols(A) <= (HYPRE_BigInt) 2147483647 &&
+            !hypre_CSRMatrixPatternOnly(A) &&
+            hypre_CSRMatrixI(A) && hypre_CSRMatrixJ(A) && hypre_CSRMatrixData(A) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecShortJHost
+ *
+ * y = alpha*A*x + beta*b reading the column indices of A from the 16-bit
+ * delta copy (built if needed). Only single vectors are supported.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecShortJHost( HYPRE_Complex    alpha,
+                                 hypre_CSRMatrix *A,
+                                 hypre_Vector    *x,
+                                 HYPRE_Complex    beta,
+                                 hypre_Vector    *b,
+                                 hypre_Vector    *y )
+{
+   HYPRE_Int          num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int          num_cols = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int         *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Complex     *A_data   = hypre_CSRMatrixData(A);
+
+   HYPRE_Complex     *x_data   = hypre_VectorData(x);
+   HYPRE_Complex     *b_data   = hypre_VectorData(b);
+   HYPRE_Complex     *y_data   = hypre_VectorData(y);
+   HYPRE_Int          x_size   = hypre_VectorSize(x);
+   HYPRE_Int          b_size   = hypre_VectorSize(b);
+   HYPRE_Int          y_size   = hypre_VectorSize(y);
+
+   HYPRE_Int         *i_short;
+   short             *j_short;
+   HYPRE_Int          i, ierr = 0;
+   hypre_Vector      *x_tmp = NULL;
+
+   hypre_assert(hypre_VectorNumVectors(x) == 1);
+
+   if (num_cols != x_size)
+   {
+      ierr = 1;
+   }
+
+   if (num_rows != y_size || num_rows != b_size)
+   {
+      ierr = 2;
+   }
+
+   if (num_cols != x_size && (num_rows != y_size || num_rows != b_size))
+   {
+      ierr = 3;
+   }
+
+   hypre_CSRMatrixShortJSetup(A);
+
+   i_short = hypre_CSRMatrixIShort(A);
+   j_short = hypre_CSRMatrixJShort(A);
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Complex  sum = 0.0;
+      HYPRE_Int      pos = i_short[i];
+      HYPRE_Int      jj;
+
+      if (i_short[i + 1] - pos == A_i[i + 1] - A_i[i])
+      {
+         const short         *js = j_short + pos;
+         const HYPRE_Complex *ad = A_data + A_i[i];
+         const HYPRE_Complex *xi = x_data + i;
+         const HYPRE_Int      nr = A_i[i + 1] - A_i[i];
+
+         for (jj = 0; jj < nr; jj++)
+         {
+            sum += ad[jj] * xi[js[jj]];
+         }
+      }
+      else
+      {
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            sum += A_data[jj] * x_data[hypre_CSRShortJNext(j_short, &pos, i)];
+         }
+      }
+
+      y_data[i] = (beta == 0.0) ? alpha * sum : alpha * sum + beta * b_data[i];
+   }
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
@@ -128,15 +128,48 @@ HYPRE_Int hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows
 // y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end]
 HYPRE_Int hypre_CSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
                                             hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecDiagOutOfPlace ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                                hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
 // y = alpha*A + beta*y
 HYPRE_Int hypre_CSRMatrixMatvec ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
                                   HYPRE_Complex beta, hypre_Vector *y );
+// r = b - A*x, r_norm2 = <r,r>
+HYPRE_Int hypre_CSRMatrixResidualNorm ( hypre_CSRMatrix *A, hypre_Vector *x, hypre_Vector *b,
+                                        hypre_Vector *r, HYPRE_Real *r_norm2 );
 HYPRE_Int hypre_CSRMatrixMatvecT ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
                                    HYPRE_Complex beta, hypre_Vector *y );
 HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
                                      HYPRE_Complex beta, hypre_Vector *y, HYPRE_Int *CF_marker_x, HYPRE_Int *CF_marker_y,
                                      HYPRE_Int fpt );
 
+/* csr_sell.c */
+HYPRE_Int hypre_CSRMatrixSellCreate ( hypre_CSRMatrix *A, HYPRE_Int chunk_size, HYPRE_Int sigma );
+HYPRE_Int hypre_CSRMatrixSellUpdate ( hypre_CSRMatrix *A, HYPRE_Int update_j );
+HYPRE_Int hypre_CSRMatrixSellDestroy ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellSetup ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellIsUsable ( hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecSellHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                          hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecTSellHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                           hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+
+/* csr_float.c */
+HYPRE_Int hypre_CSRMatrixConvertToFloat ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixFloatDestroy ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecFloatHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                           hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y,
+                                           HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTFloatHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                            hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+
+/* csr_short_j.c */
+HYPRE_Int hypre_CSRMatrixShortJCreate ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixShortJDestroy ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixShortJSetup ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixShortJIsUsable ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecShortJHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                            hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+
 /* csr_matvec_device.c */
 HYPRE_Int hypre_CSRMatrixMatvecDevice(HYPRE_Int trans, HYPRE_Complex alpha, hypre_CSRMatrix *A,
                                       hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
@@ -267,6 +300,11 @@ HYPRE_Int hypre_SeqVectorMassAxpy4(HYPRE_Complex *alpha, hypre_Vector **x, hypre
                                    HYPRE_Int k);
 HYPRE_Int hypre_SeqVectorMassAxpy8(HYPRE_Complex *alpha, hypre_Vector **x, hypre_Vector *y,
                                    HYPRE_Int k);
+HYPRE_Int hypre_SeqVectorMultiInnerProd(HYPRE_Int k, hypre_Vector **x, hypre_Vector *y,
+                                        HYPRE_Real *result);
+HYPRE_Int hypre_SeqVectorColumnInnerProd(hypre_Vector *x, hypre_Vector *y, HYPRE_Real *result);
+HYPRE_Int hypre_SeqVectorMultiAxpy(HYPRE_Complex *alpha, hypre_Vector *x, HYPRE_Complex beta,
+                                   hypre_Vector *y);
 HYPRE_Complex hypre_SeqVectorSumElts ( hypre_Vector *vector );
 HYPRE_Int hypre_SeqVectorPrefetch(hypre_Vector *x, HYPRE_MemoryLocation memory_location);
 //HYPRE_Int hypre_SeqVectorMax( HYPRE_Complex alpha, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
@@ -1207,3 +1207,173 @@ HYPRE_Int hypre_SeqVectorMassDotpTwo( hypre_Vector *x, hypre_Vector *y,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorMultiInnerProd
+ *
+ * Inner products of every column of the multivectors x[0], ..., x[k-1]
+ * (all with nx columns) with every column of the multivector y (ny columns):
+ *
+ *    result[j*k*nx + l*nx + i] = <x[l](:,i), y(:,j)>
+ *
+ * Each thread sweeps its rows in chunks of HYPRE_MULTIVEC_CHUNK so that a
+ * chunk of y stays in cache while it is multiplied with all columns of x.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_MULTIVEC_CHUNK 256
+
+HYPRE_Int
+hypre_SeqVectorMultiInnerProd( HYPRE_Int      k,
+                               hypre_Vector **x,
+                               hypre_Vector  *y,
+                               HYPRE_Real    *result )
+{
+   HYPRE_Int       size       = hypre_VectorSize(y);
+   HYPRE_Int       nx         = hypre_VectorNumVectors(x[0]);
+   HYPRE_Int       ny         = hypre_VectorNumVectors(y);
+   HYPRE_Int       x_vstride  = hypre_VectorVectorStride(x[0]);
+   HYPRE_Int       x_istride  = hypre_VectorIndexStride(x[0]);
+   HYPRE_Int       y_vstride  = hypre_VectorVectorStride(y);
+   HYPRE_Int       y_istride  = hypre_VectorIndexStride(y);
+   HYPRE_Int       num_result = k * nx * ny;
+   HYPRE_Int       i;
+
+   for (i = 0; i < num_result; i++)
+   {
+      result[i] = 0.0;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int       ns, ne, rs, re, r, i, j, l;
+      HYPRE_Complex  *x_data, *y_data;
+      HYPRE_Real     *local_result, res;
+
+      hypre_partition1D(size, hypre_NumActiveThreads(), hypre_GetThreadNum(), &ns, &ne);
+
+      local_result = hypre_CTAlloc(HYPRE_Real, num_result, HYPRE_MEMORY_HOST);
+
+      for (rs = ns; rs < ne; rs += HYPRE_MULTIVEC_CHUNK)
+      {
+         re = hypre_min(rs + HYPRE_MULTIVEC_CHUNK, ne);
+         for (j = 0; j < ny; j++)
+         {
+            y_data = hypre_VectorData(y) + j * y_vstride;
+            for (l = 0; l < k; l++)
+            {
+               for (i = 0; i < nx; i++)
+               {
+                  x_data = hypre_VectorData(x[l]) + i * x_vstride;
+                  res = 0.0;
+                  for (r = rs; r < re; r++)
+                  {
+                     res += hypre_conj(y_data[r * y_istride]) * x_data[r * x_istride];
+                  }
+                  local_result[(j * k + l) * nx + i] += res;
+               }
+            }
+         }
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp critical
+#endif
+      {
+         for (i = 0; i < num_result; i++)
+         {
+            result[i] += local_result[i];
+         }
+      }
+
+      hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+   } /* end of parallel region */
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorColumnInnerProd
+ *
+ * result[j] = <x(:,j), y(:,j)> for every column j of the multivectors x, y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorColumnInnerProd( hypre_Vector *x,
+                                hypre_Vector *y,
+                                HYPRE_Real   *result )
+{
+   HYPRE_Int       size      = hypre_VectorSize(x);
+   HYPRE_Int       nv        = hypre_VectorNumVectors(x);
+   HYPRE_Int       x_istride = hypre_VectorIndexStride(x);
+   HYPRE_Int       y_istride = hypre_VectorIndexStride(y);
+   HYPRE_Complex  *x_data, *y_data;
+   HYPRE_Real      res;
+   HYPRE_Int       i, j;
+
+   for (j = 0; j < nv; j++)
+   {
+      x_data = hypre_VectorData(x) + j * hypre_VectorVectorStride(x);
+      y_data = hypre_VectorData(y) + j * hypre_VectorVectorStride(y);
+      res = 0.0;
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(i) reduction(+:res) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         res += hypre_conj(y_data[i * y_istride]) * x_data[i * x_istride];
+      }
+      result[j] = res;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorMultiAxpy
+ *
+ * y = beta*y + x*alpha for multivectors x (nx columns) and y (ny columns),
+ * where alpha is a column-major nx x ny matrix:
+ *
+ *    y(:,j) = beta*y(:,j) + sum_i alpha[j*nx+i] * x(:,i)
+ *
+ * x and y must not share data.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorMultiAxpy( HYPRE_Complex *alpha,
+                          hypre_Vector  *x,
+                          HYPRE_Complex  beta,
+                          hypre_Vector  *y )
+{
+   HYPRE_Complex  *x_data    = hypre_VectorData(x);
+   HYPRE_Complex  *y_data    = hypre_VectorData(y);
+   HYPRE_Int       size      = hypre_VectorSize(y);
+   HYPRE_Int       nx        = hypre_VectorNumVectors(x);
+   HYPRE_Int       ny        = hypre_VectorNumVectors(y);
+   HYPRE_Int       x_vstride = hypre_VectorVectorStride(x);
+   HYPRE_Int       x_istride = hypre_VectorIndexStride(x);
+   HYPRE_Int       y_vstride = hypre_VectorVectorStride(y);
+   HYPRE_Int       y_istride = hypre_VectorIndexStride(y);
+   HYPRE_Complex   res;
+   HYPRE_Int       r, i, j;
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(r, i, j, res) HYPRE_SMP_SCHEDULE
+#endif
+   for (r = 0; r < size; r++)
+   {
+      for (j = 0; j < ny; j++)
+      {
+         res = (beta == 0.0) ? 0.0 : beta * y_data[j * y_vstride + r * y_istride];
+         for (i = 0; i < nx; i++)
+         {
+            res += alpha[j * nx + i] * x_data[i * x_vstride + r * x_istride];
+         }
+         y_data[j * y_vstride + r * y_istride] = res;
+      }
+   }
+
+   return hypre_error_flag;
+}
@@ -32,6 +32,23 @@ tail -17 ${TNAME}.out.200 | head -6 > ${TNAME}.mgr_testdata
 tail -17 ${TNAME}.out.202 | head -6 > ${TNAME}.mgr_testdata.temp
 diff ${TNAME}.mgr_testdata ${TNAME}.mgr_testdata.temp >&2
 
+#=============================================================================
+# IJ: agglomerated AMG-PCG with neighborhood collectives should match the
+#                    point-to-point run
+#=============================================================================
+
+tail -3 ${TNAME}.out.33 | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.39 | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# IJ: single precision levels have to shrink the stored matrix values
+#=============================================================================
+
+awk '/Mixed precision levels/ {n++; if ($9 >= $7) bad++}
+     END {if (n == 0 || bad) print "Matrix values not reduced by the mixed precision levels"}' \
+   ${TNAME}.out.28 >&2
+
 #=============================================================================
 tail -3 ${TNAME}.out.400.p | head -2 > ${TNAME}.testdata
 tail -3 ${TNAME}.out.400.n | head -2 > ${TNAME}.testdata.temp
@@ -89,6 +106,27 @@ FILES="\
  ${TNAME}.out.16\
  ${TNAME}.out.17\
  ${TNAME}.out.18\
+ ${TNAME}.out.19\
+ ${TNAME}.out.20\
+ ${TNAME}.out.21\
+ ${TNAME}.out.22\
+ ${TNAME}.out.23\
+ ${TNAME}.out.24\
+ ${TNAME}.out.25\
+ ${TNAME}.out.26\
+ ${TNAME}.out.27\
+ ${TNAME}.out.28\
+ ${TNAME}.out.29\
+ ${TNAME}.out.30\
+ ${TNAME}.out.31\
+ ${TNAME}.out.32\
+ ${TNAME}.out.33\
+ ${TNAME}.out.34\
+ ${TNAME}.out.35\
+ ${TNAME}.out.36\
+ ${TNAME}.out.37\
+ ${TNAME}.out.38\
+ ${TNAME}.out.39\
 "
 
 for i in $FILES
@@ -241,4 +279,5 @@ cat ${TNAME}.out.[a-z] > ${TNAME}.out
 #=============================================================================
 
 rm -f ${TNAME}.testdata*
+rm -f ${TNAME}.profile*
 rm -r ${TNAME}.mgr_testdata*
@@ -62,6 +62,8 @@ HYPRE_Int BuildParDifConv (HYPRE_Int argc, char *argv [], HYPRE_Int arg_index,
                            HYPRE_ParCSRMatrix *A_ptr);
 HYPRE_Int BuildParFromOneFile (HYPRE_Int argc, char *argv [], HYPRE_Int arg_index,
                                HYPRE_Int num_functions, HYPRE_ParCSRMatrix *A_ptr );
+HYPRE_Int BuildParFromBinaryMap (HYPRE_Int argc, char *argv [], HYPRE_Int arg_index,
+                                 HYPRE_ParCSRMatrix *A_ptr );
 HYPRE_Int BuildFuncsFromFiles (HYPRE_Int argc, char *argv [], HYPRE_Int arg_index,
                                HYPRE_ParCSRMatrix A, HYPRE_Int **dof_func_ptr );
 HYPRE_Int BuildFuncsFromOneFile (HYPRE_Int argc, char *argv [], HYPRE_Int arg_index,
@@ -91,6 +93,8 @@ HYPRE_Int SetSysVcoefValues(HYPRE_Int num_fun, HYPRE_BigInt nx, HYPRE_BigInt ny,
 
 HYPRE_Int BuildParCoordinates (HYPRE_Int argc, char *argv [], HYPRE_Int arg_index,
                                HYPRE_Int *coorddim_ptr, float **coord_ptr );
+HYPRE_Int PerturbParCSRDiagonal (HYPRE_ParCSRMatrix A);
+HYPRE_Real ParCSRRelativeResidual (HYPRE_ParCSRMatrix A, HYPRE_ParVector b, HYPRE_ParVector x);
 
 extern HYPRE_Int hypre_FlexGMRESModifyPCAMGExample(void *precond_data, HYPRE_Int iterations,
                                                    HYPRE_Real rel_residual_norm);
@@ -113,6 +117,11 @@ main( hypre_int argc,
    HYPRE_Int           off_proc = 0;
    HYPRE_Int           chunk = 0;
    HYPRE_Int           omp_flag = 0;
+   HYPRE_Int           assembly_mode = 0;
+   HYPRE_Int           reuse_off_proc = 0;
+   HYPRE_Int           num_reassembles = 0;
+   HYPRE_Int           num_map_updates = 0;
+   HYPRE_Int           num_element_assembles = 0;
    HYPRE_Int           build_matrix_type;
    HYPRE_Int           build_matrix_arg_index;
    HYPRE_Int           build_matrix_M;
@@ -132,6 +141,7 @@ main( hypre_int argc,
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type = 1;
    HYPRE_Int           recompute_res = 0;   /* What should be the default here? */
+   HYPRE_Int           pipelined_pcg = 0;
    HYPRE_Int           ioutdat;
    HYPRE_Int           poutdat;
    HYPRE_Int           poutusr = 0; /* if user selects pout */
@@ -243,6 +253,7 @@ main( hypre_int argc,
    HYPRE_Int      relax_up = -1;
    HYPRE_Int      relax_down = -1;
    HYPRE_Int      relax_order = 0;
+   HYPRE_Int      relax_cache_block = 0;
    HYPRE_Int      level_w = -1;
    HYPRE_Int      level_ow = -1;
    /* HYPRE_Int    smooth_lev; */
@@ -265,6 +276,13 @@ main( hypre_int argc,
    HYPRE_Int    rap2     = 0;
    HYPRE_Int    mod_rap2 = 0;
    HYPRE_Int    keepTranspose = 0;
+   HYPRE_Int    mp_level = -1;
+   HYPRE_Int    setup_reuse = 0;
+   HYPRE_Int    agglom_threshold = 0;
+   HYPRE_Int    spmv_use_sell = 0;
+   HYPRE_Int    spmv_use_short_j = 0;
+   HYPRE_Int    persistent_comm = -1;
+   HYPRE_Int    neighbor_coll = 0;
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int    dslu_threshold = -1;
 #endif
@@ -283,6 +301,7 @@ main( hypre_int argc,
    HYPRE_Int  cheby_variant = 0;
    HYPRE_Int  cheby_scale = 1;
    HYPRE_Real cheby_fraction = .3;
+   HYPRE_Int  cheby_eig_refine = 0;
 
 #if defined(HYPRE_USING_GPU)
    keepTranspose = 1;
@@ -308,6 +327,7 @@ main( hypre_int argc,
    HYPRE_Int      coord_dim  = 3;
    float         *coordinates = NULL;
    char           plot_file_name[256];
+   char          *amg_profile_file = NULL;
 
    /* parameters for ParaSAILS */
    HYPRE_Real   sai_threshold = 0.1;
@@ -331,6 +351,8 @@ main( hypre_int argc,
    /* parameters for COGMRES */
    HYPRE_Int    cgs = 1;
    HYPRE_Int    unroll = 0;
+   HYPRE_Int    s_step = 1;
+   HYPRE_Int    s_step_basis = 0;
    /* parameters for LGMRES */
    HYPRE_Int    aug_dim;
    /* parameters for GSMG */
@@ -348,6 +370,8 @@ main( hypre_int argc,
    HYPRE_Real   agg_P12_trunc_factor  = 0; /* default value */
 
    HYPRE_Int    print_system = 0;
+   char        *print_binary_file = NULL;
+   HYPRE_Int    binary_compress = 1;
    HYPRE_Int    rel_change = 0;
    HYPRE_Int    second_time = 0;
    HYPRE_Int    benchmark = 0;
@@ -530,6 +554,18 @@ main( hypre_int argc,
          build_matrix_M           = 1;
          build_matrix_M_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-frombinaryfile") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = 8;
+         build_matrix_arg_index = arg_index;
+      }
+      else if ( strcmp(argv[arg_index], "-frombinarymap") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = 9;
+         build_matrix_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-fromparcsrfile") == 0 )
       {
          arg_index++;
@@ -630,6 +666,31 @@ main( hypre_int argc,
          arg_index++;
          omp_flag = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-assembly_mode") == 0 )
+      {
+         arg_index++;
+         assembly_mode = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-reuse_off_proc") == 0 )
+      {
+         arg_index++;
+         reuse_off_proc = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-reassemble") == 0 )
+      {
+         arg_index++;
+         num_reassembles = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-value_map") == 0 )
+      {
+         arg_index++;
+         num_map_updates = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-element_assemble") == 0 )
+      {
+         arg_index++;
+         num_element_assembles = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_constant") == 0 )
       {
          arg_index++;
@@ -684,6 +745,12 @@ main( hypre_int argc,
          build_rhs_type      = 7;
          build_rhs_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-rhsfrombinaryfile") == 0 )
+      {
+         arg_index++;
+         build_rhs_type      = 8;
+         build_rhs_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-rhsisone") == 0 )
       {
          arg_index++;
@@ -813,6 +880,11 @@ main( hypre_int argc,
          arg_index++;
          coarsen_type      = 9;
       }
+      else if ( strcmp(argv[arg_index], "-mis2agg") == 0 )
+      {
+         arg_index++;
+         coarsen_type      = 12;
+      }
       else if ( strcmp(argv[arg_index], "-cr1") == 0 )
       {
          arg_index++;
@@ -898,6 +970,11 @@ main( hypre_int argc,
          arg_index++;
          relax_type = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-rlx_cache_block") == 0 )
+      {
+         arg_index++;
+         relax_cache_block = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-rlx_coarse") == 0 )
       {
          arg_index++;
@@ -1419,6 +1496,16 @@ main( hypre_int argc,
          arg_index++;
          unroll = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-sstep") == 0 )
+      {
+         arg_index++;
+         s_step = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-sstep_basis") == 0 )
+      {
+         arg_index++;
+         s_step_basis = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_residual") == 0 )
       {
          arg_index++;
@@ -1636,6 +1723,11 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pipelined_pcg") == 0 )
+      {
+         arg_index++;
+         pipelined_pcg = 1;
+      }
       else if ( strcmp(argv[arg_index], "-iout") == 0 )
       {
          arg_index++;
@@ -1770,6 +1862,11 @@ main( hypre_int argc,
          arg_index++;
          cheby_fraction = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-cheby_eig_refine") == 0 )
+      {
+         arg_index++;
+         cheby_eig_refine = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-additive") == 0 )
       {
          arg_index++;
@@ -1825,6 +1922,41 @@ main( hypre_int argc,
          arg_index++;
          keepTranspose  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-mp_level") == 0 )
+      {
+         arg_index++;
+         mp_level  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-setup_reuse") == 0 )
+      {
+         arg_index++;
+         setup_reuse  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-agglom") == 0 )
+      {
+         arg_index++;
+         agglom_threshold  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mv_sell") == 0 )
+      {
+         arg_index++;
+         spmv_use_sell  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mv_short_j") == 0 )
+      {
+         arg_index++;
+         spmv_use_short_j  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-persistent_comm") == 0 )
+      {
+         arg_index++;
+         persistent_comm = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-neighbor_coll") == 0 )
+      {
+         arg_index++;
+         neighbor_coll = atoi(argv[arg_index++]);
+      }
 #ifdef HYPRE_USING_DSUPERLU
       else if ( strcmp(argv[arg_index], "-dslu_th") == 0 )
       {
@@ -1847,6 +1979,16 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-print_binary") == 0 )
+      {
+         arg_index++;
+         print_binary_file = argv[arg_index++];
+      }
+      else if ( strcmp(argv[arg_index], "-binary_compress") == 0 )
+      {
+         arg_index++;
+         binary_compress = atoi(argv[arg_index++]);
+      }
       /* BM Oct 23, 2006 */
       else if ( strcmp(argv[arg_index], "-plot_grids") == 0 )
       {
@@ -1858,6 +2000,11 @@ main( hypre_int argc,
          arg_index++;
          hypre_sprintf (plot_file_name, "%s", argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-amg_profile") == 0 )
+      {
+         arg_index++;
+         amg_profile_file = argv[arg_index++];
+      }
       else if ( strcmp(argv[arg_index], "-AIR") == 0 )
       {
          arg_index++;
@@ -1966,6 +2113,10 @@ main( hypre_int argc,
          hypre_printf("matrix read from multiple files (IJ format)\n");
          hypre_printf("  -fromparcsrfile <filename> : ");
          hypre_printf("matrix read from multiple files (ParCSR format)\n");
+         hypre_printf("  -frombinaryfile <filename> : ");
+         hypre_printf("matrix read from binary files (any number of processes)\n");
+         hypre_printf("  -frombinarymap <filename>  : ");
+         hypre_printf("matrix mapped from binary files (one per process)\n");
          hypre_printf("  -fromonecsrfile <filename> : ");
          hypre_printf("matrix read from a single file (CSR format)\n");
          hypre_printf("\n");
@@ -1994,6 +2145,8 @@ main( hypre_int argc,
          hypre_printf("rhs read from a single file (CSR format)\n");
          hypre_printf("  -rhsparcsrfile        :  ");
          hypre_printf("rhs read from multiple files (ParCSR format)\n");
+         hypre_printf("  -rhsfrombinaryfile     : ");
+         hypre_printf("rhs read from binary files (any number of processes)\n");
          hypre_printf("  -Ffromonefile          : ");
          hypre_printf("list of F points from a single file\n");
          hypre_printf("  -SFfromonefile          : ");
@@ -2056,6 +2209,7 @@ main( hypre_int argc,
          hypre_printf("  -ruge3                : third pass on boundary\n");
          hypre_printf("  -ruge3c               : third pass on boundary, keep c-points\n");
          hypre_printf("  -falgout              : local Ruge_Stueben followed by CLJP\n");
+         hypre_printf("  -mis2agg              : distance-2 MIS aggregation (with interptype 25/26)\n");
          hypre_printf("  -gm                   : use global measures\n");
          hypre_printf("\n");
          hypre_printf("  -interptype  <val>    : set interpolation type\n");
@@ -2085,6 +2239,8 @@ main( hypre_int argc,
          hypre_printf("      22=classical block interpolation w/Ruge's variant for nodal systems AMG \n");
          hypre_printf("      23=same as 22, but use row sums for diag scaling matrices,for nodal systems AMG \n");
          hypre_printf("      24=direct block interpolation for nodal systems AMG\n");
+         hypre_printf("      25=tentative aggregation interpolation (with -mis2agg) \n");
+         hypre_printf("      26=smoothed aggregation interpolation (with -mis2agg) \n");
          hypre_printf("     100=One point interpolation [a Boolean matrix]\n");
          hypre_printf("\n");
 
@@ -2107,6 +2263,8 @@ main( hypre_int argc,
          hypre_printf("       16=Chebyshev  \n");
          hypre_printf("       17=FCF-Jacobi  \n");
          hypre_printf("       18=L1-Jacobi (may be used with -CF) \n");
+         hypre_printf("       31=Multicolor Gauss-Seidel  \n");
+         hypre_printf("       32=Multicolor symmetric Gauss-Seidel  \n");
          hypre_printf("       9=Gauss elimination (use for coarsest grid only)  \n");
          hypre_printf("       99=Gauss elimination with pivoting (use for coarsest grid only)  \n");
          hypre_printf("       20= Nodal Weighted Jacobi (for systems only) \n");
@@ -2116,8 +2274,11 @@ main( hypre_int argc,
          hypre_printf("  -rlx_coarse  <val>       : set relaxation type for coarsest grid\n");
          hypre_printf("  -rlx_down    <val>       : set relaxation type for down cycle\n");
          hypre_printf("  -rlx_up      <val>       : set relaxation type for up cycle\n");
+         hypre_printf("  -rlx_cache_block <val>   : relax hybrid GS in colored blocks of <val> KB\n");
          hypre_printf("  -cheby_order  <val> : set order (1-4) for Chebyshev poly. smoother (default is 2)\n");
+         hypre_printf("  -cheby_variant <val> : 0,1 = first kind, 2 = fourth kind, 3 = opt. fourth kind (order 1-16)\n");
          hypre_printf("  -cheby_fraction <val> : fraction of the spectrum for Chebyshev poly. smoother (default is .3)\n");
+         hypre_printf("  -cheby_eig_refine <val> : reuse Chebyshev eig. bounds across setups, <val> refinement its.\n");
          hypre_printf("  -nodal  <val>            : nodal system type\n");
          hypre_printf("       0 = Unknown approach \n");
          hypre_printf("       1 = Frobenius norm  \n");
@@ -2158,6 +2319,9 @@ main( hypre_int argc,
 
          hypre_printf("  -w   <val>             : set Jacobi relax weight = val\n");
          hypre_printf("  -k   <val>             : dimension Krylov space for GMRES\n");
+         hypre_printf("  -pipelined_pcg         : use the pipelined variant of PCG\n");
+         hypre_printf("  -sstep <val>           : block size of s-step COGMRES (1 = classical)\n");
+         hypre_printf("  -sstep_basis <val>     : s-step COGMRES basis, 0 = Newton, 1 = Chebyshev\n");
          hypre_printf("  -aug   <val>           : number of augmentation vectors for LGMRES (-k indicates total approx space size)\n");
 
          hypre_printf("  -mxl  <val>            : maximum number of levels (AMG, ParaSAILS)\n");
@@ -2167,6 +2331,11 @@ main( hypre_int argc,
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
+         hypre_printf("  -mp_level  <val>       : store AMG levels >= val in single precision (default:-1)\n");
+         hypre_printf("  -setup_reuse  <val>    : reuse the AMG hierarchy on a new setup (default:0);\n");
+         hypre_printf("                           with -second_time, the diagonal of A is changed\n");
+         hypre_printf("                           before the second setup\n");
+         hypre_printf("  -agglom  <val>         : min. avg. rows per proc on coarse levels (default:0)\n");
          hypre_printf("\n");
          hypre_printf("  -sai_th   <val>        : set ParaSAILS threshold = val \n");
          hypre_printf("  -sai_filt <val>        : set ParaSAILS filter = val \n");
@@ -2189,6 +2358,15 @@ main( hypre_int argc,
          hypre_printf("       0=no debugging\n       1=internal timing\n       2=interpolation truncation\n       3=more detailed timing in coarsening routine\n");
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
+         hypre_printf("  -print_binary <file>   : write the matrix to binary files, and the rhs\n");
+         hypre_printf("                           to binary files <file>.rhs\n");
+         hypre_printf("  -binary_compress <val> : compress column indices of binary files (0/1)\n");
+         hypre_printf("\n");
+         hypre_printf("  -mv_sell <val>         : use SELL-C-sigma format for host SpMV (0/1)\n");
+         hypre_printf("  -mv_short_j <val>      : 16-bit column deltas in host SpMV and hybrid G-S (0/1)\n");
+         hypre_printf("  -persistent_comm <val> : persistent halo exchange in matvecs (0/1)\n");
+         hypre_printf("  -neighbor_coll <val>   : neighborhood collectives for halo exchange of A\n");
+         hypre_printf("                           and the AMG coarse levels (0/1)\n");
          hypre_printf("\n");
          /* begin lobpcg */
 
@@ -2255,6 +2433,7 @@ main( hypre_int argc,
 
          hypre_printf("  -plot_grids            : print out information for plotting the grids\n");
          hypre_printf("  -plot_file_name <val>  : file name for plotting output\n");
+         hypre_printf("  -amg_profile <val>     : write per-level AMG profile (JSON, CSV if *.csv)\n");
          hypre_printf("\n");
          hypre_printf("  -smtype <val>      :smooth type\n");
          hypre_printf("  -smlv <val>        :smooth num levels\n");
@@ -2391,6 +2570,16 @@ main( hypre_int argc,
    /* default execution policy */
    HYPRE_SetExecutionPolicy(default_exec_policy);
 
+   /* host SpMV format */
+   HYPRE_SetSpMVUseSell(spmv_use_sell);
+   HYPRE_SetSpMVUseShortJ(spmv_use_short_j);
+
+   /* matvec halo exchange (library default if not given) */
+   if (persistent_comm > -1)
+   {
+      HYPRE_SetUsePersistentComm(persistent_comm);
+   }
+
 #if defined(HYPRE_USING_GPU)
    ierr = HYPRE_SetSpMVUseVendor(spmv_use_vendor); hypre_assert(ierr == 0);
    /* use vendor implementation for SpGEMM */
@@ -2463,6 +2652,23 @@ main( hypre_int argc,
    {
       BuildParRotate7pt(argc, argv, build_matrix_arg_index, &parcsr_A);
    }
+   else if ( build_matrix_type == 8 )
+   {
+      if (myid == 0)
+      {
+         hypre_printf("  FromBinaryFile: %s\n", argv[build_matrix_arg_index]);
+      }
+      ierr = HYPRE_ParCSRMatrixReadBinary(comm, argv[build_matrix_arg_index], &parcsr_A);
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the system matrix!\n");
+         exit(1);
+      }
+   }
+   else if ( build_matrix_type == 9 )
+   {
+      BuildParFromBinaryMap(argc, argv, build_matrix_arg_index, &parcsr_A);
+   }
 
    else
    {
@@ -2672,6 +2878,15 @@ main( hypre_int argc,
          ierr = HYPRE_IJMatrixSetRowSizes ( ij_A, (const HYPRE_Int *) row_sizes );
       }
 
+      if (assembly_mode)
+      {
+         HYPRE_IJMatrixSetAssemblyMode(ij_A, assembly_mode);
+      }
+      if (reuse_off_proc)
+      {
+         HYPRE_IJMatrixSetReuseOffProc(ij_A, reuse_off_proc);
+      }
+
       ierr += HYPRE_IJMatrixInitialize_v2( ij_A, memory_location );
 
       if (omp_flag)
@@ -2736,18 +2951,6 @@ main( hypre_int argc,
             j_indx += num_cols_h[i];
          }
       }
-      hypre_TFree(num_cols_h, HYPRE_MEMORY_HOST);
-      hypre_TFree(row_nums_h, HYPRE_MEMORY_HOST);
-      hypre_TFree(col_nums_h, HYPRE_MEMORY_HOST);
-      hypre_TFree(data_h,     HYPRE_MEMORY_HOST);
-      if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
-      {
-         hypre_TFree(col_nums, memory_location);
-         hypre_TFree(data,     memory_location);
-         hypre_TFree(row_nums, memory_location);
-         hypre_TFree(num_cols, memory_location);
-      }
-
       if (sparsity_known == 1)
       {
          hypre_TFree(diag_sizes,    HYPRE_MEMORY_HOST);
@@ -2765,6 +2968,155 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      /* Repeat the assembly with the same pattern, as done in time stepping:
+         zero the assembled matrix and add all values again, including the
+         off processor ones. The result is the matrix built with -add 1. */
+      if (num_reassembles > 0)
+      {
+         time_index = hypre_InitializeTiming("IJ Matrix Reassemble");
+         hypre_BeginTiming(time_index);
+
+         for (i = 0; i < num_reassembles; i++)
+         {
+            ierr += HYPRE_IJMatrixSetConstantValues(ij_A, 0.0);
+            ierr += HYPRE_IJMatrixAddToValues(ij_A, num_rows, num_cols, row_nums,
+                                              (const HYPRE_BigInt *) col_nums,
+                                              (const HYPRE_Real *) data);
+            ierr += HYPRE_IJMatrixAssemble(ij_A);
+         }
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("IJ Matrix Reassemble", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+      }
+
+      /* The same with the values of the sequence set in place through a value
+         map. The result is the matrix built with -add 1. */
+      if (num_map_updates > 0)
+      {
+         time_index = hypre_InitializeTiming("IJ Matrix Build Value Map");
+         hypre_BeginTiming(time_index);
+
+         ierr += HYPRE_IJMatrixBuildValueMap(ij_A, num_rows, num_cols, row_nums,
+                                             (const HYPRE_BigInt *) col_nums);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("IJ Matrix Build Value Map", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         time_index = hypre_InitializeTiming("IJ Matrix Set Values By Map");
+         hypre_BeginTiming(time_index);
+
+         for (i = 0; i < num_map_updates; i++)
+         {
+            ierr += HYPRE_IJMatrixSetValuesByMap(ij_A, (const HYPRE_Real *) data);
+         }
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("IJ Matrix Set Values By Map", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+      }
+
+      /* Repeat the assembly from two-node elements [0 a_ij; a_ij 0], i < j,
+         and one-node elements [a_ii], as done in finite element codes. The
+         two-node elements are added in two identical halves, so that the same
+         connectivity is passed twice in a row as well as in alternation with
+         the one-node elements. For the symmetric test matrices, the result is
+         the matrix itself. */
+      if (num_element_assembles > 0)
+      {
+         HYPRE_Int     num_edges = 0, num_diags = 0;
+         HYPRE_BigInt *edge_nodes, *diag_nodes;
+         HYPRE_Real   *edge_matrices, *diag_matrices;
+
+         j_indx = 0;
+         for (i = 0; i < num_rows; i++)
+         {
+            if (row_nums_h[i] >= first_local_row && row_nums_h[i] <= last_local_row)
+            {
+               for (j = 0; j < num_cols_h[i]; j++)
+               {
+                  num_edges += (col_nums_h[j_indx + j] > row_nums_h[i]);
+                  num_diags += (col_nums_h[j_indx + j] == row_nums_h[i]);
+               }
+            }
+            j_indx += num_cols_h[i];
+         }
+
+         edge_nodes    = hypre_CTAlloc(HYPRE_BigInt, 2 * num_edges, HYPRE_MEMORY_HOST);
+         edge_matrices = hypre_CTAlloc(HYPRE_Real,   4 * num_edges, HYPRE_MEMORY_HOST);
+         diag_nodes    = hypre_CTAlloc(HYPRE_BigInt, num_diags,     HYPRE_MEMORY_HOST);
+         diag_matrices = hypre_CTAlloc(HYPRE_Real,   num_diags,     HYPRE_MEMORY_HOST);
+
+         num_edges = 0;
+         num_diags = 0;
+         j_indx = 0;
+         for (i = 0; i < num_rows; i++)
+         {
+            if (row_nums_h[i] >= first_local_row && row_nums_h[i] <= last_local_row)
+            {
+               for (j = 0; j < num_cols_h[i]; j++)
+               {
+                  if (col_nums_h[j_indx + j] > row_nums_h[i])
+                  {
+                     edge_nodes[2 * num_edges]        = row_nums_h[i];
+                     edge_nodes[2 * num_edges + 1]    = col_nums_h[j_indx + j];
+                     edge_matrices[4 * num_edges + 1] = 0.5 * data_h[j_indx + j];
+                     edge_matrices[4 * num_edges + 2] = 0.5 * data_h[j_indx + j];
+                     num_edges++;
+                  }
+                  else if (col_nums_h[j_indx + j] == row_nums_h[i])
+                  {
+                     diag_nodes[num_diags]    = row_nums_h[i];
+                     diag_matrices[num_diags] = data_h[j_indx + j];
+                     num_diags++;
+                  }
+               }
+            }
+            j_indx += num_cols_h[i];
+         }
+
+         time_index = hypre_InitializeTiming("IJ Matrix Element Assemble");
+         hypre_BeginTiming(time_index);
+
+         for (i = 0; i < num_element_assembles; i++)
+         {
+            ierr += HYPRE_IJMatrixSetConstantValues(ij_A, 0.0);
+            ierr += HYPRE_IJMatrixAddElementMatrices(ij_A, num_edges, 2, edge_nodes,
+                                                     (const HYPRE_Real *) edge_matrices);
+            ierr += HYPRE_IJMatrixAddElementMatrices(ij_A, num_edges, 2, edge_nodes,
+                                                     (const HYPRE_Real *) edge_matrices);
+            ierr += HYPRE_IJMatrixAddElementMatrices(ij_A, num_diags, 1, diag_nodes,
+                                                     (const HYPRE_Real *) diag_matrices);
+            ierr += HYPRE_IJMatrixAssemble(ij_A);
+         }
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("IJ Matrix Element Assemble", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         hypre_TFree(edge_nodes,    HYPRE_MEMORY_HOST);
+         hypre_TFree(edge_matrices, HYPRE_MEMORY_HOST);
+         hypre_TFree(diag_nodes,    HYPRE_MEMORY_HOST);
+         hypre_TFree(diag_matrices, HYPRE_MEMORY_HOST);
+      }
+
+      hypre_TFree(num_cols_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_nums_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(col_nums_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(data_h,     HYPRE_MEMORY_HOST);
+      if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+      {
+         hypre_TFree(col_nums, memory_location);
+         hypre_TFree(data,     memory_location);
+         hypre_TFree(row_nums, memory_location);
+         hypre_TFree(num_cols, memory_location);
+      }
+
       if (ierr)
       {
          hypre_printf("Error in driver building IJMatrix from parcsr matrix. \n");
@@ -3187,6 +3539,32 @@ main( hypre_int argc,
       ierr = HYPRE_IJVectorGetObject( ij_x, &object );
       x = (HYPRE_ParVector) object;
    }
+   else if (build_rhs_type == 8)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("  RHS vector read from binary file %s\n", argv[build_rhs_arg_index]);
+         hypre_printf("  Initial guess is 0\n");
+      }
+
+      ij_b = NULL;
+      ierr = HYPRE_ParVectorReadBinary(hypre_MPI_COMM_WORLD, argv[build_rhs_arg_index], &b);
+      if (ierr || hypre_ParVectorFirstIndex((hypre_ParVector *) b) != first_local_row ||
+          hypre_ParVectorLastIndex((hypre_ParVector *) b) != last_local_row)
+      {
+         hypre_printf("ERROR: Problem reading in the right-hand-side!\n");
+         exit(1);
+      }
+
+      /* initial guess */
+      HYPRE_IJVectorCreate(hypre_MPI_COMM_WORLD, first_local_col, last_local_col, &ij_x);
+      HYPRE_IJVectorSetObjectType(ij_x, HYPRE_PARCSR);
+      HYPRE_IJVectorInitialize(ij_x);
+      HYPRE_IJVectorAssemble(ij_x);
+
+      ierr = HYPRE_IJVectorGetObject( ij_x, &object );
+      x = (HYPRE_ParVector) object;
+   }
    else
    {
       if (build_rhs_type != -1)
@@ -3528,6 +3906,11 @@ main( hypre_int argc,
       hypre_ParCSRMatrixScale(parcsr_A, -1);
    }
 
+   if (neighbor_coll > 0)
+   {
+      HYPRE_ParCSRMatrixSetNeighborColl(parcsr_A, neighbor_coll);
+   }
+
    if (print_system)
    {
       if (ij_A)
@@ -3572,6 +3955,18 @@ main( hypre_int argc,
       HYPRE_IJVectorPrint(ij_x, "IJ.out.x0");
    }
 
+   if (print_binary_file)
+   {
+      HYPRE_ParCSRMatrixPrintBinary(parcsr_A, print_binary_file, binary_compress);
+      if (b)
+      {
+         char rhs_file[1024];
+
+         hypre_sprintf(rhs_file, "%s.rhs", print_binary_file);
+         HYPRE_ParVectorPrintBinary(b, rhs_file);
+      }
+   }
+
    /*-----------------------------------------------------------
     * Migrate the system to the wanted memory space
     *-----------------------------------------------------------*/
@@ -3937,6 +4332,10 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
+      HYPRE_BoomerAMGSetChebyEigRefine(amg_solver, cheby_eig_refine);
+      HYPRE_BoomerAMGSetNeighborColl(amg_solver, neighbor_coll);
+      HYPRE_BoomerAMGSetRelaxCacheBlock(amg_solver, relax_cache_block);
+      HYPRE_BoomerAMGSetProfileFile(amg_solver, amg_profile_file);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
       HYPRE_BoomerAMGSetOuterWt(amg_solver, outer_wt);
@@ -4009,6 +4408,9 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetMixedPrecisionLevel(amg_solver, mp_level);
+      HYPRE_BoomerAMGSetSetupReuse(amg_solver, setup_reuse);
+      HYPRE_BoomerAMGSetAgglomThreshold(amg_solver, agglom_threshold);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -4104,6 +4506,12 @@ main( hypre_int argc,
          cudaProfilerStart();
 #endif
 
+         if (setup_reuse)
+         {
+            /* new values on the same pattern, as in a time or Newton step */
+            PerturbParCSRDiagonal(parcsr_M);
+         }
+
          time_index = hypre_InitializeTiming("BoomerAMG/AMG-DD Setup2");
          hypre_BeginTiming(time_index);
 
@@ -4157,6 +4565,16 @@ main( hypre_int argc,
 #if defined(HYPRE_USING_CUDA)
          cudaProfilerStop();
 #endif
+
+         if (setup_reuse)
+         {
+            HYPRE_Real reuse_res_norm = ParCSRRelativeResidual(parcsr_A, b, x);
+
+            if (myid == 0)
+            {
+               hypre_printf("\n||b - A x|| / ||b|| after the reused setup = %e\n", reuse_res_norm);
+            }
+         }
       }
 
       if (solver_id == 0)
@@ -4187,6 +4605,7 @@ main( hypre_int argc,
 
       if (solver_id == 0)
       {
+         HYPRE_BoomerAMGWriteProfile(amg_solver);
          HYPRE_BoomerAMGDestroy(amg_solver);
       }
       else if (solver_id == 90)
@@ -4259,6 +4678,10 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
+      HYPRE_BoomerAMGSetChebyEigRefine(amg_solver, cheby_eig_refine);
+      HYPRE_BoomerAMGSetNeighborColl(amg_solver, neighbor_coll);
+      HYPRE_BoomerAMGSetRelaxCacheBlock(amg_solver, relax_cache_block);
+      HYPRE_BoomerAMGSetProfileFile(amg_solver, amg_profile_file);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
       HYPRE_BoomerAMGSetOuterWt(amg_solver, outer_wt);
@@ -4312,6 +4735,9 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetMixedPrecisionLevel(amg_solver, mp_level);
+      HYPRE_BoomerAMGSetSetupReuse(amg_solver, setup_reuse);
+      HYPRE_BoomerAMGSetAgglomThreshold(amg_solver, agglom_threshold);
       if (nongalerk_tol)
       {
          HYPRE_BoomerAMGSetNonGalerkinTol(amg_solver, nongalerk_tol[nongalerk_num_tol - 1]);
@@ -4347,10 +4773,26 @@ main( hypre_int argc,
 #endif
          hypre_ParVectorCopy(x0_save, x);
 
+         if (setup_reuse)
+         {
+            PerturbParCSRDiagonal(parcsr_M);
+         }
+
          HYPRE_BoomerAMGSetup(amg_solver, parcsr_M, b, x);
          HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, b, x);
+
+         if (setup_reuse)
+         {
+            HYPRE_Real reuse_res_norm = ParCSRRelativeResidual(parcsr_A, b, x);
+
+            if (myid == 0)
+            {
+               hypre_printf("\n||b - A x|| / ||b|| after the reused setup = %e\n", reuse_res_norm);
+            }
+         }
       }
 
+      HYPRE_BoomerAMGWriteProfile(amg_solver);
       HYPRE_BoomerAMGDestroy(amg_solver);
    }
 
@@ -4392,7 +4834,14 @@ main( hypre_int argc,
       time_index = hypre_InitializeTiming("PCG Setup");
       hypre_BeginTiming(time_index);
 
-      HYPRE_ParCSRPCGCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
+      if (pipelined_pcg)
+      {
+         HYPRE_ParCSRPipelinedPCGCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
+      }
+      else
+      {
+         HYPRE_ParCSRPCGCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
+      }
       HYPRE_PCGSetMaxIter(pcg_solver, max_iter);
       HYPRE_PCGSetTol(pcg_solver, tol);
       HYPRE_PCGSetTwoNorm(pcg_solver, 1);
@@ -4458,6 +4907,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefine(pcg_precond, cheby_eig_refine);
+         HYPRE_BoomerAMGSetNeighborColl(pcg_precond, neighbor_coll);
+         HYPRE_BoomerAMGSetRelaxCacheBlock(pcg_precond, relax_cache_block);
+         HYPRE_BoomerAMGSetProfileFile(pcg_precond, amg_profile_file);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -4513,6 +4966,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -4645,6 +5101,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefine(pcg_precond, cheby_eig_refine);
+         HYPRE_BoomerAMGSetNeighborColl(pcg_precond, neighbor_coll);
+         HYPRE_BoomerAMGSetRelaxCacheBlock(pcg_precond, relax_cache_block);
+         HYPRE_BoomerAMGSetProfileFile(pcg_precond, amg_profile_file);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
          if (level_w > -1)
@@ -4697,6 +5157,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -4919,6 +5382,12 @@ main( hypre_int argc,
          cudaProfilerStart();
 #endif
 
+         if (setup_reuse)
+         {
+            /* new values on the same pattern, as in a time or Newton step */
+            PerturbParCSRDiagonal(parcsr_M);
+         }
+
          time_index = hypre_InitializeTiming("PCG Setup");
          hypre_BeginTiming(time_index);
 
@@ -4960,6 +5429,16 @@ main( hypre_int argc,
 #if defined(HYPRE_USING_CUDA)
          cudaProfilerStop();
 #endif
+
+         if (setup_reuse)
+         {
+            HYPRE_Real reuse_res_norm = ParCSRRelativeResidual(parcsr_A, b, x);
+
+            if (myid == 0)
+            {
+               hypre_printf("\n||b - A x|| / ||b|| after the reused setup = %e\n", reuse_res_norm);
+            }
+         }
       }
 
       HYPRE_PCGGetNumIterations(pcg_solver, &num_iterations);
@@ -4969,6 +5448,7 @@ main( hypre_int argc,
 
       if (solver_id == 1)
       {
+         HYPRE_BoomerAMGWriteProfile(pcg_precond);
          HYPRE_BoomerAMGDestroy(pcg_precond);
       }
       else if (solver_id == 8)
@@ -6139,6 +6619,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(amg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(amg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(amg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefine(amg_precond, cheby_eig_refine);
+         HYPRE_BoomerAMGSetNeighborColl(amg_precond, neighbor_coll);
+         HYPRE_BoomerAMGSetRelaxCacheBlock(amg_precond, relax_cache_block);
+         HYPRE_BoomerAMGSetProfileFile(amg_precond, amg_profile_file);
          HYPRE_BoomerAMGSetRelaxOrder(amg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(amg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(amg_precond, outer_wt);
@@ -6201,6 +6685,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(amg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(amg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(amg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(amg_precond, mp_level);
+         HYPRE_BoomerAMGSetSetupReuse(amg_precond, setup_reuse);
+         HYPRE_BoomerAMGSetAgglomThreshold(amg_precond, agglom_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(amg_precond, dslu_threshold);
 #endif
@@ -6334,6 +6821,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefine(pcg_precond, cheby_eig_refine);
+         HYPRE_BoomerAMGSetNeighborColl(pcg_precond, neighbor_coll);
+         HYPRE_BoomerAMGSetRelaxCacheBlock(pcg_precond, relax_cache_block);
+         HYPRE_BoomerAMGSetProfileFile(pcg_precond, amg_profile_file);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -6388,6 +6879,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6570,6 +7064,7 @@ main( hypre_int argc,
 
       if (solver_id == 3)
       {
+         HYPRE_BoomerAMGWriteProfile(amg_precond);
          HYPRE_BoomerAMGDestroy(amg_precond);
       }
       else if (solver_id == 15)
@@ -6680,6 +7175,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefine(pcg_precond, cheby_eig_refine);
+         HYPRE_BoomerAMGSetNeighborColl(pcg_precond, neighbor_coll);
+         HYPRE_BoomerAMGSetRelaxCacheBlock(pcg_precond, relax_cache_block);
+         HYPRE_BoomerAMGSetProfileFile(pcg_precond, amg_profile_file);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -6734,6 +7233,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6799,6 +7301,7 @@ main( hypre_int argc,
 
       if (solver_id == 51)
       {
+         HYPRE_BoomerAMGWriteProfile(pcg_precond);
          HYPRE_BoomerAMGDestroy(pcg_precond);
       }
 
@@ -6885,6 +7388,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefine(pcg_precond, cheby_eig_refine);
+         HYPRE_BoomerAMGSetNeighborColl(pcg_precond, neighbor_coll);
+         HYPRE_BoomerAMGSetRelaxCacheBlock(pcg_precond, relax_cache_block);
+         HYPRE_BoomerAMGSetProfileFile(pcg_precond, amg_profile_file);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -6939,6 +7446,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7166,6 +7676,7 @@ main( hypre_int argc,
 
       if (solver_id == 61)
       {
+         HYPRE_BoomerAMGWriteProfile(pcg_precond);
          HYPRE_BoomerAMGDestroy(pcg_precond);
       }
       else if (solver_id == 72)
@@ -7288,6 +7799,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefine(pcg_precond, cheby_eig_refine);
+         HYPRE_BoomerAMGSetNeighborColl(pcg_precond, neighbor_coll);
+         HYPRE_BoomerAMGSetRelaxCacheBlock(pcg_precond, relax_cache_block);
+         HYPRE_BoomerAMGSetProfileFile(pcg_precond, amg_profile_file);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -7343,6 +7858,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7559,6 +8077,7 @@ main( hypre_int argc,
 
       if (solver_id == 9)
       {
+         HYPRE_BoomerAMGWriteProfile(pcg_precond);
          HYPRE_BoomerAMGDestroy(pcg_precond);
       }
 
@@ -7623,6 +8142,8 @@ main( hypre_int argc,
       HYPRE_COGMRESSetKDim(pcg_solver, k_dim);
       HYPRE_COGMRESSetUnroll(pcg_solver, unroll);
       HYPRE_COGMRESSetCGS(pcg_solver, cgs);
+      HYPRE_COGMRESSetSStep(pcg_solver, s_step);
+      HYPRE_COGMRESSetSStepBasis(pcg_solver, s_step_basis);
       HYPRE_COGMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_COGMRESSetTol(pcg_solver, tol);
       HYPRE_COGMRESSetAbsoluteTol(pcg_solver, atol);
@@ -7685,6 +8206,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefine(pcg_precond, cheby_eig_refine);
+         HYPRE_BoomerAMGSetNeighborColl(pcg_precond, neighbor_coll);
+         HYPRE_BoomerAMGSetRelaxCacheBlock(pcg_precond, relax_cache_block);
+         HYPRE_BoomerAMGSetProfileFile(pcg_precond, amg_profile_file);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -7740,6 +8265,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7919,6 +8447,7 @@ main( hypre_int argc,
 
       if (solver_id == 16)
       {
+         HYPRE_BoomerAMGWriteProfile(pcg_precond);
          HYPRE_BoomerAMGDestroy(pcg_precond);
       }
       else if (solver_id == 46)
@@ -8029,6 +8558,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefine(pcg_precond, cheby_eig_refine);
+         HYPRE_BoomerAMGSetNeighborColl(pcg_precond, neighbor_coll);
+         HYPRE_BoomerAMGSetRelaxCacheBlock(pcg_precond, relax_cache_block);
+         HYPRE_BoomerAMGSetProfileFile(pcg_precond, amg_profile_file);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -8072,6 +8605,9 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8153,6 +8689,7 @@ main( hypre_int argc,
 
       if (solver_id == 5)
       {
+         HYPRE_BoomerAMGWriteProfile(pcg_precond);
          HYPRE_BoomerAMGDestroy(pcg_precond);
       }
       if (myid == 0 /* begin lobpcg */ && !lobpcgFlag /* end lobpcg */)
@@ -8463,8 +9000,8 @@ final:
       HYPRE_IJMatrixDestroy(ij_M);
    }
 
-   /* for build_rhs_type = 1, 6 or 7, we did not create ij_b  - just b*/
-   if (build_rhs_type == 1 || build_rhs_type == 6 || build_rhs_type == 7)
+   /* for build_rhs_type = 1, 6, 7 or 8, we did not create ij_b  - just b*/
+   if (build_rhs_type == 1 || build_rhs_type == 6 || build_rhs_type == 7 || build_rhs_type == 8)
    {
       HYPRE_ParVectorDestroy(b);
    }
@@ -9511,6 +10048,94 @@ BuildParFromOneFile( HYPRE_Int                  argc,
    return (0);
 }
 
+/*----------------------------------------------------------------------
+ * Build the matrix from binary files written by as many processes as
+ * are running now. Each process maps its own file into memory with
+ * hypre_ParCSRMatrixMapBinary and passes the rows to the IJ interface.
+ *----------------------------------------------------------------------*/
+
+HYPRE_Int
+BuildParFromBinaryMap( HYPRE_Int                  argc,
+                       char                      *argv[],
+                       HYPRE_Int                  arg_index,
+                       HYPRE_ParCSRMatrix        *A_ptr     )
+{
+   char                    *filename;
+   hypre_ParCSRBinaryView  *view = NULL;
+   hypre_CSRMatrix         *local;
+   HYPRE_IJMatrix           ij_A;
+   HYPRE_BigInt             first_row, last_row, local_rows, global_rows;
+   HYPRE_BigInt            *rows;
+   HYPRE_Int               *ncols, *a_i;
+   HYPRE_Int                num_rows, i, myid, ierr, ierr_global;
+   void                    *object;
+
+   hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &myid );
+
+   if (arg_index < argc)
+   {
+      filename = argv[arg_index];
+   }
+   else
+   {
+      hypre_printf("Error: No filename specified \n");
+      exit(1);
+   }
+
+   if (myid == 0)
+   {
+      hypre_printf("  FromBinaryMap: %s\n", filename);
+   }
+
+   /* the files have to cover the matrix with one file per process */
+   ierr = hypre_ParCSRMatrixMapBinary(filename, myid, &view);
+   local_rows = view ? (HYPRE_BigInt) hypre_CSRMatrixNumRows(view -> matrix) : 0;
+   hypre_MPI_Allreduce(&ierr, &ierr_global, 1, HYPRE_MPI_INT, hypre_MPI_MAX,
+                       hypre_MPI_COMM_WORLD);
+   hypre_MPI_Allreduce(&local_rows, &global_rows, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM,
+                       hypre_MPI_COMM_WORLD);
+   if (ierr_global || global_rows != view -> global_num_rows ||
+       view -> global_num_rows != view -> global_num_cols)
+   {
+      hypre_printf("ERROR: Problem mapping the system matrix!\n");
+      exit(1);
+   }
+
+   local     = view -> matrix;
+   num_rows  = hypre_CSRMatrixNumRows(local);
+   a_i       = hypre_CSRMatrixI(local);
+   first_row = view -> first_row;
+   last_row  = first_row + num_rows - 1;
+
+   rows  = hypre_TAlloc(HYPRE_BigInt, num_rows, HYPRE_MEMORY_HOST);
+   ncols = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      rows[i]  = first_row + i;
+      ncols[i] = a_i[i + 1] - a_i[i];
+   }
+
+   HYPRE_IJMatrixCreate(hypre_MPI_COMM_WORLD, first_row, last_row, first_row, last_row, &ij_A);
+   HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixInitialize_v2(ij_A, HYPRE_MEMORY_HOST);
+   HYPRE_IJMatrixSetValues(ij_A, num_rows, ncols, rows,
+                           hypre_CSRMatrixBigJ(local) + a_i[0],
+                           hypre_CSRMatrixData(local) + a_i[0]);
+   HYPRE_IJMatrixAssemble(ij_A);
+
+   /* keep the ParCSR matrix and drop the IJ wrapper */
+   HYPRE_IJMatrixGetObject(ij_A, &object);
+   *A_ptr = (HYPRE_ParCSRMatrix) object;
+   hypre_IJMatrixObject((hypre_IJMatrix *) ij_A) = NULL;
+   HYPRE_IJMatrixDestroy(ij_A);
+
+   hypre_TFree(rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(ncols, HYPRE_MEMORY_HOST);
+   hypre_ParCSRBinaryViewDestroy(view);
+
+   return (0);
+}
+
 /*----------------------------------------------------------------------
  * Build Function array from files on different processors
  *----------------------------------------------------------------------*/
@@ -10469,6 +11094,74 @@ BuildParCoordinates( HYPRE_Int            argc,
    return (0);
 }
 
+/*----------------------------------------------------------------------
+ * Scale the diagonal entries of A by 1, 1.1 or 1.2, depending on the
+ * global row. The values change, but the sparsity pattern does not, so a
+ * following BoomerAMG setup may reuse the previous hierarchy.
+ *----------------------------------------------------------------------*/
+
+HYPRE_Int
+PerturbParCSRDiagonal( HYPRE_ParCSRMatrix A )
+{
+   hypre_CSRMatrix      *A_diag          = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int             num_rows        = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int             num_nonzeros    = hypre_CSRMatrixNumNonzeros(A_diag);
+   HYPRE_BigInt          first_row       = hypre_ParCSRMatrixFirstRowIndex(A);
+   HYPRE_MemoryLocation  memory_location = hypre_CSRMatrixMemoryLocation(A_diag);
+   HYPRE_Int            *A_i;
+   HYPRE_Real           *A_data;
+   HYPRE_Int             i;
+
+   A_i    = hypre_TAlloc(HYPRE_Int,  num_rows + 1, HYPRE_MEMORY_HOST);
+   A_data = hypre_TAlloc(HYPRE_Real, num_nonzeros, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(A_i, hypre_CSRMatrixI(A_diag), HYPRE_Int, num_rows + 1,
+                 HYPRE_MEMORY_HOST, memory_location);
+   hypre_TMemcpy(A_data, hypre_CSRMatrixData(A_diag), HYPRE_Real, num_nonzeros,
+                 HYPRE_MEMORY_HOST, memory_location);
+
+   /* the diagonal entry is the first one of each row of the diag part */
+   for (i = 0; i < num_rows; i++)
+   {
+      if (A_i[i] < A_i[i + 1])
+      {
+         A_data[A_i[i]] *= 1.0 + 0.1 * (HYPRE_Real) ((first_row + i) % 3);
+      }
+   }
+
+   hypre_TMemcpy(hypre_CSRMatrixData(A_diag), A_data, HYPRE_Real, num_nonzeros,
+                 memory_location, HYPRE_MEMORY_HOST);
+   hypre_TFree(A_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(A_data, HYPRE_MEMORY_HOST);
+
+   /* drop the copies of the old values used by the host SpMV */
+   hypre_CSRMatrixSellDestroy(A_diag);
+   hypre_CSRMatrixFloatDestroy(A_diag);
+
+   return (0);
+}
+
+/*----------------------------------------------------------------------
+ * Return ||b - A x|| / ||b||.
+ *----------------------------------------------------------------------*/
+
+HYPRE_Real
+ParCSRRelativeResidual( HYPRE_ParCSRMatrix A,
+                        HYPRE_ParVector    b,
+                        HYPRE_ParVector    x )
+{
+   hypre_ParVector *r;
+   HYPRE_Real       r_dot_r, b_dot_b;
+
+   r = hypre_ParVectorCloneDeep_v2((hypre_ParVector *) b,
+                                   hypre_ParVectorMemoryLocation((hypre_ParVector *) b));
+   HYPRE_ParCSRMatrixMatvec(-1.0, A, x, 1.0, (HYPRE_ParVector) r);
+   HYPRE_ParVectorInnerProd((HYPRE_ParVector) r, (HYPRE_ParVector) r, &r_dot_r);
+   HYPRE_ParVectorInnerProd(b, b, &b_dot_b);
+   hypre_ParVectorDestroy(r);
+
+   return (b_dot_b > 0.0) ? sqrt(r_dot_r / b_dot_b) : sqrt(r_dot_r);
+}
+
 
 /* begin lobpcg */
 
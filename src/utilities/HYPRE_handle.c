@@ -31,6 +31,43 @@ HYPRE_SetSpMVUseVendor( HYPRE_Int use_vendor )
    return hypre_SetSpMVUseVendor(use_vendor);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_SetSpMVUseSell
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetSpMVUseSell( HYPRE_Int use_sell )
+{
+   return hypre_SetSpMVUseSell(use_sell);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetSellParams
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetSellParams( HYPRE_Int chunk_size,
+                     HYPRE_Int sigma )
+{
+   return hypre_SetSellParams(chunk_size, sigma);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetSpMVUseShortJ
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetSpMVUseShortJ( HYPRE_Int use_short_j )
+{
+   return hypre_SetSpMVUseShortJ(use_short_j);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetUsePersistentComm
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetUsePersistentComm( HYPRE_Int use_persistent_comm )
+{
+   return hypre_SetUsePersistentComm(use_persistent_comm);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_SetSpGemmUseVendor
  *--------------------------------------------------------------------------*/
@@ -231,6 +231,14 @@ HYPRE_Int HYPRE_SetGPUMemoryPoolSize(HYPRE_Int bin_growth, HYPRE_Int min_bin, HY
 
 HYPRE_Int HYPRE_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int HYPRE_SetSpMVUseVendor( HYPRE_Int use_vendor );
+/* Host SpMV: use the SELL-C-sigma companion format of CSR matrices (off by default) */
+HYPRE_Int HYPRE_SetSpMVUseSell( HYPRE_Int use_sell );
+HYPRE_Int HYPRE_SetSellParams( HYPRE_Int chunk_size, HYPRE_Int sigma );
+/* Host SpMV and hybrid Gauss-Seidel: read column indices of CSR matrices as
+   16-bit deltas (off by default) */
+HYPRE_Int HYPRE_SetSpMVUseShortJ( HYPRE_Int use_short_j );
+/* ParCSR matvec halo exchange with persistent MPI requests (on by default in host builds) */
+HYPRE_Int HYPRE_SetUsePersistentComm( HYPRE_Int use_persistent_comm );
 /* Backwards compatibility with HYPRE_SetSpGemmUseCusparse() */
 #define HYPRE_SetSpGemmUseCusparse(use_vendor) HYPRE_SetSpGemmUseVendor(use_vendor)
 HYPRE_Int HYPRE_SetSpGemmUseVendor( HYPRE_Int use_vendor );
@@ -196,6 +196,7 @@ extern "C" {
 #define MPI_COMM_TYPE_SHARED hypre_MPI_COMM_TYPE_SHARED
 
 #define MPI_BOTTOM          hypre_MPI_BOTTOM
+#define MPI_IN_PLACE        hypre_MPI_IN_PLACE
 
 #define MPI_FLOAT           hypre_MPI_FLOAT
 #define MPI_DOUBLE          hypre_MPI_DOUBLE
@@ -266,6 +267,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -279,6 +281,8 @@ extern "C" {
 #define MPI_Op_create       hypre_MPI_Op_create
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
+#define MPI_Dist_graph_create_adjacent hypre_MPI_Dist_graph_create_adjacent
+#define MPI_Ineighbor_alltoallv        hypre_MPI_Ineighbor_alltoallv
 
 /*--------------------------------------------------------------------------
  * Types, etc.
@@ -308,6 +312,7 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_COMM_TYPE_SHARED 0
 
 #define  hypre_MPI_BOTTOM  0x0
+#define  hypre_MPI_IN_PLACE  ((void *) -1)
 
 #define  hypre_MPI_FLOAT 0
 #define  hypre_MPI_DOUBLE 1
@@ -353,6 +358,7 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
 #define  hypre_MPI_COMM_NULL          MPI_COMM_NULL
 #define  hypre_MPI_BOTTOM             MPI_BOTTOM
+#define  hypre_MPI_IN_PLACE           MPI_IN_PLACE
 #define  hypre_MPI_COMM_SELF          MPI_COMM_SELF
 #define  hypre_MPI_COMM_TYPE_SHARED   MPI_COMM_TYPE_SHARED
 
@@ -468,6 +474,9 @@ HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count, hypre_MPI_Request *array_of_reques
                              HYPRE_Int *index, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
+                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm,
+                                hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                             hypre_MPI_Datatype datatype, hypre_MPI_Op op, HYPRE_Int root, hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf, void *recvbuf, HYPRE_Int count,
@@ -487,6 +496,15 @@ HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute,
                                hypre_MPI_Op *op );
+HYPRE_Int hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm_old, HYPRE_Int indegree,
+                                                HYPRE_Int *sources, HYPRE_Int outdegree,
+                                                HYPRE_Int *destinations, HYPRE_Int reorder,
+                                                hypre_MPI_Comm *comm_dist_graph );
+HYPRE_Int hypre_MPI_Ineighbor_alltoallv( void *sendbuf, hypre_int *sendcounts, hypre_int *sdispls,
+                                         hypre_MPI_Datatype sendtype, void *recvbuf,
+                                         hypre_int *recvcounts, hypre_int *rdispls,
+                                         hypre_MPI_Datatype recvtype, hypre_MPI_Comm comm,
+                                         hypre_MPI_Request *request );
 #if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                     hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
@@ -1105,6 +1123,64 @@ HYPRE_Int hypre_PrintTiming( const char *heading, MPI_Comm comm );
 
 #endif
 
+/*--------------------------------------------------------------------------
+ * Operation counters
+ *
+ * Running totals of the point-to-point messages and bytes sent through the
+ * hypre_MPI wrappers and of the floating point operations reported by the
+ * counting kernels (ParCSR matvecs, sparse matrix products and relaxation).
+ * The totals are only updated while a profiler has turned them on with
+ * hypre_OpCountsActivate; profilers take differences of the totals around a
+ * code region.  The comm_pkg_* totals are the time, messages and bytes spent
+ * building communication packages (also included in the plain totals) and
+ * the number of packages built.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Real   messages;
+   HYPRE_Real   bytes;
+   HYPRE_Real   flops;
+
+   HYPRE_Real   comm_pkg_time;
+   HYPRE_Real   comm_pkg_messages;
+   HYPRE_Real   comm_pkg_bytes;
+   HYPRE_Real   comm_pkg_calls;
+
+   HYPRE_Int    comm_pkg_depth;      /* comm pkg creation may nest */
+   HYPRE_Real   comm_pkg_start[3];
+
+   HYPRE_Int    active;              /* number of profilers counting */
+
+} hypre_OpCounts;
+
+#ifdef HYPRE_TIMING_GLOBALS
+hypre_OpCounts hypre_global_op_counts = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0, { 0.0, 0.0, 0.0 }, 0 };
+#else
+extern hypre_OpCounts hypre_global_op_counts;
+#endif
+
+#define hypre_OpCountsMessages()         (hypre_global_op_counts.messages)
+#define hypre_OpCountsBytes()            (hypre_global_op_counts.bytes)
+#define hypre_OpCountsFlops()            (hypre_global_op_counts.flops)
+#define hypre_OpCountsCommPkgTime()      (hypre_global_op_counts.comm_pkg_time)
+#define hypre_OpCountsCommPkgMessages()  (hypre_global_op_counts.comm_pkg_messages)
+#define hypre_OpCountsCommPkgBytes()     (hypre_global_op_counts.comm_pkg_bytes)
+#define hypre_OpCountsCommPkgCalls()     (hypre_global_op_counts.comm_pkg_calls)
+#define hypre_OpCountsActive()           (hypre_global_op_counts.active > 0)
+
+/* the increments are not evaluated unless the counters are on */
+#define hypre_OpCountsAddFlops(inc) \
+   do { if (hypre_OpCountsActive()) { hypre_OpCountsAdd(0.0, 0.0, (HYPRE_Real) (inc)); } } while (0)
+#define hypre_OpCountsAddMessages(num, nbytes) \
+   do { if (hypre_OpCountsActive()) { hypre_OpCountsAdd((HYPRE_Real) (num), (HYPRE_Real) (nbytes), 0.0); } } while (0)
+
+/* timing.c */
+void hypre_OpCountsActivate( HYPRE_Int increment );
+void hypre_OpCountsAdd( HYPRE_Real messages, HYPRE_Real bytes, HYPRE_Real flops );
+void hypre_OpCountsCommPkgBegin( void );
+void hypre_OpCountsCommPkgEnd( void );
+
 #ifdef __cplusplus
 }
 #endif
@@ -1299,6 +1375,9 @@ static char hypre__markname[1024];
 #ifndef HYPRE_HANDLE_H
 #define HYPRE_HANDLE_H
 
+/* largest SELL-C-sigma chunk size supported by the host SpMV kernels */
+#define HYPRE_SELL_MAX_CHUNK_SIZE 32
+
 struct hypre_DeviceData;
 typedef struct hypre_DeviceData hypre_DeviceData;
 
@@ -1313,6 +1392,13 @@ typedef struct
    /* device G-S options */
    HYPRE_Int              device_gs_method;
 #endif
+   /* host SpMV options */
+   HYPRE_Int              spmv_use_sell;       /* use the SELL-C-sigma companion of hypre_CSRMatrix */
+   HYPRE_Int              sell_chunk_size;     /* C: number of rows per SELL slice */
+   HYPRE_Int              sell_sigma;          /* sigma: row sorting window of SELL-C-sigma */
+   HYPRE_Int              spmv_use_short_j;    /* use 16-bit column deltas of hypre_CSRMatrix */
+   /* communication options */
+   HYPRE_Int              use_persistent_comm; /* persistent halo exchange in ParCSR matvecs */
 #if defined(HYPRE_USING_UMPIRE)
    char                   umpire_device_pool_name[HYPRE_UMPIRE_POOL_NAME_MAX_LEN];
    char                   umpire_um_pool_name[HYPRE_UMPIRE_POOL_NAME_MAX_LEN];
@@ -1340,6 +1426,11 @@ typedef struct
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
 #define hypre_HandleDeviceData(hypre_handle)                     ((hypre_handle) -> device_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
+#define hypre_HandleSpMVUseSell(hypre_handle)                    ((hypre_handle) -> spmv_use_sell)
+#define hypre_HandleSellChunkSize(hypre_handle)                  ((hypre_handle) -> sell_chunk_size)
+#define hypre_HandleSellSigma(hypre_handle)                      ((hypre_handle) -> sell_sigma)
+#define hypre_HandleSpMVUseShortJ(hypre_handle)                  ((hypre_handle) -> spmv_use_short_j)
+#define hypre_HandleUsePersistentComm(hypre_handle)              ((hypre_handle) -> use_persistent_comm)
 
 #define hypre_HandleCurandGenerator(hypre_handle)                hypre_DeviceDataCurandGenerator(hypre_HandleDeviceData(hypre_handle))
 #define hypre_HandleCublasHandle(hypre_handle)                   hypre_DeviceDataCublasHandle(hypre_HandleDeviceData(hypre_handle))
@@ -1854,6 +1945,10 @@ HYPRE_Int hypre_ForceSyncComputeStream(hypre_Handle *hypre_handle);
 /* handle.c */
 HYPRE_Int hypre_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpMVUseVendor( HYPRE_Int use_vendor );
+HYPRE_Int hypre_SetSpMVUseSell( HYPRE_Int use_sell );
+HYPRE_Int hypre_SetSellParams( HYPRE_Int chunk_size, HYPRE_Int sigma );
+HYPRE_Int hypre_SetSpMVUseShortJ( HYPRE_Int use_short_j );
+HYPRE_Int hypre_SetUsePersistentComm( HYPRE_Int use_persistent_comm );
 HYPRE_Int hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpGemmAlgorithm( HYPRE_Int value );
 HYPRE_Int hypre_SetSpGemmBinned( HYPRE_Int value );
@@ -48,6 +48,20 @@ hypre_HandleCreate()
 
    hypre_HandleMemoryLocation(hypre_handle_) = HYPRE_MEMORY_DEVICE;
 
+   /* host SpMV: plain CSR by default */
+   hypre_HandleSpMVUseSell(hypre_handle_)   = 0;
+   hypre_HandleSellChunkSize(hypre_handle_) = 8;
+   hypre_HandleSellSigma(hypre_handle_)     = 256;
+   hypre_HandleSpMVUseShortJ(hypre_handle_) = 0;
+
+   /* halo exchange: persistent requests on host, per-call requests on device
+      unless configured with persistent communication */
+#if defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_PERSISTENT_COMM)
+   hypre_HandleUsePersistentComm(hypre_handle_) = 0;
+#else
+   hypre_HandleUsePersistentComm(hypre_handle_) = 1;
+#endif
+
 #if defined(HYPRE_USING_GPU)
    hypre_HandleDefaultExecPolicy(hypre_handle_) = HYPRE_EXEC_DEVICE;
    hypre_HandleStructExecPolicy(hypre_handle_) = HYPRE_EXEC_DEVICE;
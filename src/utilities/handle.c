@@ -34,6 +34,57 @@ hypre_SetSpMVUseVendor( HYPRE_Int use_vendor )
    return hypre_error_flag;
 }
 
+/* Host SpMV with the SELL-C-sigma format */
+HYPRE_Int
+hypre_SetSpMVUseSell( HYPRE_Int use_sell )
+{
+   hypre_HandleSpMVUseSell(hypre_handle()) = use_sell;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_SetSellParams( HYPRE_Int chunk_size,
+                     HYPRE_Int sigma )
+{
+   /* multiples of the SIMD width (4 doubles with AVX2, 8 with AVX-512) work best */
+   if (chunk_size <= 0 || chunk_size > HYPRE_SELL_MAX_CHUNK_SIZE)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   /* sigma must be a multiple of the chunk size */
+   if (sigma < chunk_size || sigma % chunk_size)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleSellChunkSize(hypre_handle()) = chunk_size;
+   hypre_HandleSellSigma(hypre_handle())     = sigma;
+
+   return hypre_error_flag;
+}
+
+/* Host SpMV and hybrid G-S with 16-bit column deltas */
+HYPRE_Int
+hypre_SetSpMVUseShortJ( HYPRE_Int use_short_j )
+{
+   hypre_HandleSpMVUseShortJ(hypre_handle()) = use_short_j;
+
+   return hypre_error_flag;
+}
+
+/* Persistent halo exchange in ParCSR matvecs */
+HYPRE_Int
+hypre_SetUsePersistentComm( HYPRE_Int use_persistent_comm )
+{
+   hypre_HandleUsePersistentComm(hypre_handle()) = use_persistent_comm;
+
+   return hypre_error_flag;
+}
+
 /* GPU SpGemm */
 HYPRE_Int
 hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor )
@@ -14,6 +14,9 @@
 #ifndef HYPRE_HANDLE_H
 #define HYPRE_HANDLE_H
 
+/* largest SELL-C-sigma chunk size supported by the host SpMV kernels */
+#define HYPRE_SELL_MAX_CHUNK_SIZE 32
+
 struct hypre_DeviceData;
 typedef struct hypre_DeviceData hypre_DeviceData;
 
@@ -28,6 +31,13 @@ typedef struct
    /* device G-S options */
    HYPRE_Int              device_gs_method;
 #endif
+   /* host SpMV options */
+   HYPRE_Int              spmv_use_sell;       /* use the SELL-C-sigma companion of hypre_CSRMatrix */
+   HYPRE_Int              sell_chunk_size;     /* C: number of rows per SELL slice */
+   HYPRE_Int              sell_sigma;          /* sigma: row sorting window of SELL-C-sigma */
+   HYPRE_Int              spmv_use_short_j;    /* use 16-bit column deltas of hypre_CSRMatrix */
+   /* communication options */
+   HYPRE_Int              use_persistent_comm; /* persistent halo exchange in ParCSR matvecs */
 #if defined(HYPRE_USING_UMPIRE)
    char                   umpire_device_pool_name[HYPRE_UMPIRE_POOL_NAME_MAX_LEN];
    char                   umpire_um_pool_name[HYPRE_UMPIRE_POOL_NAME_MAX_LEN];
@@ -55,6 +65,11 @@ typedef struct
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
 #define hypre_HandleDeviceData(hypre_handle)                     ((hypre_handle) -> device_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
+#define hypre_HandleSpMVUseSell(hypre_handle)                    ((hypre_handle) -> spmv_use_sell)
+#define hypre_HandleSellChunkSize(hypre_handle)                  ((hypre_handle) -> sell_chunk_size)
+#define hypre_HandleSellSigma(hypre_handle)                      ((hypre_handle) -> sell_sigma)
+#define hypre_HandleSpMVUseShortJ(hypre_handle)                  ((hypre_handle) -> spmv_use_short_j)
+#define hypre_HandleUsePersistentComm(hypre_handle)              ((hypre_handle) -> use_persistent_comm)
 
 #define hypre_HandleCurandGenerator(hypre_handle)                hypre_DeviceDataCurandGenerator(hypre_HandleDeviceData(hypre_handle))
 #define hypre_HandleCublasHandle(hypre_handle)                   hypre_DeviceDataCublasHandle(hypre_HandleDeviceData(hypre_handle))
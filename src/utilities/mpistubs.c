@@ -531,6 +531,11 @@ hypre_MPI_Allreduce( void              *sendbuf,
 {
    HYPRE_Int i;
 
+   if (sendbuf == hypre_MPI_IN_PLACE)
+   {
+      return 0;
+   }
+
    switch (datatype)
    {
       case hypre_MPI_INT:
@@ -642,6 +647,20 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+   *request = hypre_MPI_REQUEST_NULL;
+
+   return hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -735,6 +754,34 @@ hypre_MPI_Op_free( hypre_MPI_Op *op )
    return (0);
 }
 
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm  comm_old,
+                                      HYPRE_Int       indegree,
+                                      HYPRE_Int      *sources,
+                                      HYPRE_Int       outdegree,
+                                      HYPRE_Int      *destinations,
+                                      HYPRE_Int       reorder,
+                                      hypre_MPI_Comm *comm_dist_graph )
+{
+   *comm_dist_graph = comm_old;
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Ineighbor_alltoallv( void               *sendbuf,
+                               hypre_int          *sendcounts,
+                               hypre_int          *sdispls,
+                               hypre_MPI_Datatype  sendtype,
+                               void               *recvbuf,
+                               hypre_int          *recvcounts,
+                               hypre_int          *rdispls,
+                               hypre_MPI_Datatype  recvtype,
+                               hypre_MPI_Comm      comm,
+                               hypre_MPI_Request  *request )
+{
+   return (0);
+}
+
 #if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                      hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
@@ -1080,6 +1127,22 @@ hypre_MPI_Bcast( void               *buffer,
                                 (hypre_int)root, comm);
 }
 
+/* Charges a point-to-point send to the global operation counters */
+static void
+hypre_MPICountSend( HYPRE_Int           count,
+                    hypre_MPI_Datatype  datatype )
+{
+   hypre_int size;
+
+   if (!hypre_OpCountsActive())
+   {
+      return;
+   }
+
+   MPI_Type_size(datatype, &size);
+   hypre_OpCountsAdd(1.0, (HYPRE_Real) count * (HYPRE_Real) size, 0.0);
+}
+
 HYPRE_Int
 hypre_MPI_Send( void               *buf,
                 HYPRE_Int           count,
@@ -1088,6 +1151,8 @@ hypre_MPI_Send( void               *buf,
                 HYPRE_Int           tag,
                 hypre_MPI_Comm      comm )
 {
+   hypre_MPICountSend(count, datatype);
+
    return (HYPRE_Int) MPI_Send(buf, (hypre_int)count, datatype,
                                (hypre_int)dest, (hypre_int)tag, comm);
 }
@@ -1114,6 +1179,8 @@ hypre_MPI_Isend( void               *buf,
                  hypre_MPI_Comm      comm,
                  hypre_MPI_Request  *request )
 {
+   hypre_MPICountSend(count, datatype);
+
    return (HYPRE_Int) MPI_Isend(buf, (hypre_int)count, datatype,
                                 (hypre_int)dest, (hypre_int)tag, comm, request);
 }
@@ -1168,6 +1235,8 @@ hypre_MPI_Irsend( void               *buf,
                   hypre_MPI_Comm      comm,
                   hypre_MPI_Request  *request )
 {
+   hypre_MPICountSend(count, datatype);
+
    return (HYPRE_Int) MPI_Irsend(buf, (hypre_int)count, datatype,
                                  (hypre_int)dest, (hypre_int)tag, comm, request);
 }
@@ -1281,6 +1350,26 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return result;
 }
 
+/* Falls back to a blocking MPI_Allreduce before MPI-3 */
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+#if MPI_VERSION > 2
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   *request = MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
+                                    datatype, op, comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -1403,6 +1492,98 @@ hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre
    return (HYPRE_Int) MPI_Op_create(function, commute, op);
 }
 
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm  comm_old,
+                                      HYPRE_Int       indegree,
+                                      HYPRE_Int      *sources,
+                                      HYPRE_Int       outdegree,
+                                      HYPRE_Int      *destinations,
+                                      HYPRE_Int       reorder,
+                                      hypre_MPI_Comm *comm_dist_graph )
+{
+#if MPI_VERSION > 2
+   /* Unit weights are passed instead of MPI_UNWEIGHTED, which some MPI
+    * implementations define as a sentinel pointer that compilers flag as an
+    * out-of-bounds read. All arrays have at least one entry. */
+   HYPRE_Int  in_size  = hypre_max(indegree, 1);
+   HYPRE_Int  out_size = hypre_max(outdegree, 1);
+   hypre_int *mpi_sources, *mpi_destinations;
+   hypre_int *mpi_source_weights, *mpi_destination_weights;
+   HYPRE_Int  i;
+   HYPRE_Int  ierr;
+
+   mpi_sources             = hypre_TAlloc(hypre_int, in_size, HYPRE_MEMORY_HOST);
+   mpi_source_weights      = hypre_TAlloc(hypre_int, in_size, HYPRE_MEMORY_HOST);
+   mpi_destinations        = hypre_TAlloc(hypre_int, out_size, HYPRE_MEMORY_HOST);
+   mpi_destination_weights = hypre_TAlloc(hypre_int, out_size, HYPRE_MEMORY_HOST);
+   for (i = 0; i < in_size; i++)
+   {
+      mpi_sources[i]        = (i < indegree) ? (hypre_int) sources[i] : 0;
+      mpi_source_weights[i] = 1;
+   }
+   for (i = 0; i < out_size; i++)
+   {
+      mpi_destinations[i]        = (i < outdegree) ? (hypre_int) destinations[i] : 0;
+      mpi_destination_weights[i] = 1;
+   }
+
+   ierr = (HYPRE_Int) MPI_Dist_graph_create_adjacent(comm_old,
+                                                     (hypre_int) indegree, mpi_sources,
+                                                     mpi_source_weights,
+                                                     (hypre_int) outdegree, mpi_destinations,
+                                                     mpi_destination_weights,
+                                                     MPI_INFO_NULL, (hypre_int) reorder,
+                                                     comm_dist_graph);
+
+   hypre_TFree(mpi_sources, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_source_weights, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_destinations, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_destination_weights, HYPRE_MEMORY_HOST);
+
+   return ierr;
+#else
+   *comm_dist_graph = MPI_COMM_NULL;
+   return (HYPRE_Int) MPI_ERR_OTHER;
+#endif
+}
+
+/* The count and displacement arrays are passed through as hypre_int, since
+ * they must stay valid until the nonblocking collective completes */
+HYPRE_Int
+hypre_MPI_Ineighbor_alltoallv( void               *sendbuf,
+                               hypre_int          *sendcounts,
+                               hypre_int          *sdispls,
+                               hypre_MPI_Datatype  sendtype,
+                               void               *recvbuf,
+                               hypre_int          *recvcounts,
+                               hypre_int          *rdispls,
+                               hypre_MPI_Datatype  recvtype,
+                               hypre_MPI_Comm      comm,
+                               hypre_MPI_Request  *request )
+{
+#if MPI_VERSION > 2
+   hypre_int indegree, outdegree, weighted, i;
+   hypre_int size;
+
+   if (hypre_OpCountsActive())
+   {
+      MPI_Dist_graph_neighbors_count(comm, &indegree, &outdegree, &weighted);
+      MPI_Type_size(sendtype, &size);
+      for (i = 0; i < outdegree; i++)
+      {
+         hypre_OpCountsAdd(1.0, (HYPRE_Real) sendcounts[i] * (HYPRE_Real) size, 0.0);
+      }
+   }
+
+   return (HYPRE_Int) MPI_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype,
+                                              recvbuf, recvcounts, rdispls, recvtype,
+                                              comm, request);
+#else
+   *request = MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_ERR_OTHER;
+#endif
+}
+
 #if defined(HYPRE_USING_GPU)
 HYPRE_Int
 hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
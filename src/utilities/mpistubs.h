@@ -46,6 +46,7 @@ extern "C" {
 #define MPI_COMM_TYPE_SHARED hypre_MPI_COMM_TYPE_SHARED
 
 #define MPI_BOTTOM          hypre_MPI_BOTTOM
+#define MPI_IN_PLACE        hypre_MPI_IN_PLACE
 
 #define MPI_FLOAT           hypre_MPI_FLOAT
 #define MPI_DOUBLE          hypre_MPI_DOUBLE
@@ -116,6 +117,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -129,6 +131,8 @@ extern "C" {
 #define MPI_Op_create       hypre_MPI_Op_create
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
+#define MPI_Dist_graph_create_adjacent hypre_MPI_Dist_graph_create_adjacent
+#define MPI_Ineighbor_alltoallv        hypre_MPI_Ineighbor_alltoallv
 
 /*--------------------------------------------------------------------------
  * Types, etc.
@@ -158,6 +162,7 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_COMM_TYPE_SHARED 0
 
 #define  hypre_MPI_BOTTOM  0x0
+#define  hypre_MPI_IN_PLACE  ((void *) -1)
 
 #define  hypre_MPI_FLOAT 0
 #define  hypre_MPI_DOUBLE 1
@@ -203,6 +208,7 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
 #define  hypre_MPI_COMM_NULL          MPI_COMM_NULL
 #define  hypre_MPI_BOTTOM             MPI_BOTTOM
+#define  hypre_MPI_IN_PLACE           MPI_IN_PLACE
 #define  hypre_MPI_COMM_SELF          MPI_COMM_SELF
 #define  hypre_MPI_COMM_TYPE_SHARED   MPI_COMM_TYPE_SHARED
 
@@ -318,6 +324,9 @@ HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count, hypre_MPI_Request *array_of_reques
                              HYPRE_Int *index, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
+                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm,
+                                hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                             hypre_MPI_Datatype datatype, hypre_MPI_Op op, HYPRE_Int root, hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf, void *recvbuf, HYPRE_Int count,
@@ -337,6 +346,15 @@ HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute,
                                hypre_MPI_Op *op );
+HYPRE_Int hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm_old, HYPRE_Int indegree,
+                                                HYPRE_Int *sources, HYPRE_Int outdegree,
+                                                HYPRE_Int *destinations, HYPRE_Int reorder,
+                                                hypre_MPI_Comm *comm_dist_graph );
+HYPRE_Int hypre_MPI_Ineighbor_alltoallv( void *sendbuf, hypre_int *sendcounts, hypre_int *sdispls,
+                                         hypre_MPI_Datatype sendtype, void *recvbuf,
+                                         hypre_int *recvcounts, hypre_int *rdispls,
+                                         hypre_MPI_Datatype recvtype, hypre_MPI_Comm comm,
+                                         hypre_MPI_Request *request );
 #if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                     hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
@@ -351,6 +351,10 @@ HYPRE_Int hypre_ForceSyncComputeStream(hypre_Handle *hypre_handle);
 /* handle.c */
 HYPRE_Int hypre_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpMVUseVendor( HYPRE_Int use_vendor );
+HYPRE_Int hypre_SetSpMVUseSell( HYPRE_Int use_sell );
+HYPRE_Int hypre_SetSellParams( HYPRE_Int chunk_size, HYPRE_Int sigma );
+HYPRE_Int hypre_SetSpMVUseShortJ( HYPRE_Int use_short_j );
+HYPRE_Int hypre_SetUsePersistentComm( HYPRE_Int use_persistent_comm );
 HYPRE_Int hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpGemmAlgorithm( HYPRE_Int value );
 HYPRE_Int hypre_SetSpGemmBinned( HYPRE_Int value );
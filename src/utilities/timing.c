@@ -396,3 +396,98 @@ hypre_PrintTiming( const char     *heading,
 
    return ierr;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_OpCountsActivate
+ *
+ * Turns the global operation counters on (increment 1) or off (increment
+ * -1).  The counters stay on while any profiler that turned them on is
+ * alive.
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_OpCountsActivate( HYPRE_Int increment )
+{
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp atomic
+#endif
+   hypre_global_op_counts.active += increment;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_OpCountsAdd
+ *
+ * Adds to the totals.  Use the hypre_OpCountsAdd* macros, which skip the
+ * call when the counters are off.
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_OpCountsAdd( HYPRE_Real messages,
+                   HYPRE_Real bytes,
+                   HYPRE_Real flops )
+{
+   hypre_OpCounts *counts = &hypre_global_op_counts;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp atomic
+#endif
+   counts -> messages += messages;
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp atomic
+#endif
+   counts -> bytes += bytes;
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp atomic
+#endif
+   counts -> flops += flops;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_OpCountsCommPkgBegin
+ *
+ * Marks the start of a communication package construction.  The time,
+ * messages and bytes up to the matching hypre_OpCountsCommPkgEnd are added
+ * to the comm_pkg totals.  Nested calls are charged to the outermost one.
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_OpCountsCommPkgBegin( void )
+{
+   hypre_OpCounts *counts = &hypre_global_op_counts;
+
+   if (!hypre_OpCountsActive())
+   {
+      return;
+   }
+
+   if ((counts -> comm_pkg_depth)++ == 0)
+   {
+      counts -> comm_pkg_start[0] = time_getWallclockSeconds();
+      counts -> comm_pkg_start[1] = counts -> messages;
+      counts -> comm_pkg_start[2] = counts -> bytes;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_OpCountsCommPkgEnd
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_OpCountsCommPkgEnd( void )
+{
+   hypre_OpCounts *counts = &hypre_global_op_counts;
+
+   /* a construction that began with the counters off is not charged */
+   if (counts -> comm_pkg_depth == 0)
+   {
+      return;
+   }
+
+   if (--(counts -> comm_pkg_depth) == 0)
+   {
+      counts -> comm_pkg_time     += time_getWallclockSeconds() - counts -> comm_pkg_start[0];
+      counts -> comm_pkg_messages += counts -> messages - counts -> comm_pkg_start[1];
+      counts -> comm_pkg_bytes    += counts -> bytes - counts -> comm_pkg_start[2];
+      counts -> comm_pkg_calls    += 1.0;
+   }
+}
@@ -110,6 +110,64 @@ HYPRE_Int hypre_PrintTiming( const char *heading, MPI_Comm comm );
 
 #endif
 
+/*--------------------------------------------------------------------------
+ * Operation counters
+ *
+ * Running totals of the point-to-point messages and bytes sent through the
+ * hypre_MPI wrappers and of the floating point operations reported by the
+ * counting kernels (ParCSR matvecs, sparse matrix products and relaxation).
+ * The totals are only updated while a profiler has turned them on with
+ * hypre_OpCountsActivate; profilers take differences of the totals around a
+ * code region.  The comm_pkg_* totals are the time, messages and bytes spent
+ * building communication packages (also included in the plain totals) and
+ * the number of packages built.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Real   messages;
+   HYPRE_Real   bytes;
+   HYPRE_Real   flops;
+
+   HYPRE_Real   comm_pkg_time;
+   HYPRE_Real   comm_pkg_messages;
+   HYPRE_Real   comm_pkg_bytes;
+   HYPRE_Real   comm_pkg_calls;
+
+   HYPRE_Int    comm_pkg_depth;      /* comm pkg creation may nest */
+   HYPRE_Real   comm_pkg_start[3];
+
+   HYPRE_Int    active;              /* number of profilers counting */
+
+} hypre_OpCounts;
+
+#ifdef HYPRE_TIMING_GLOBALS
+hypre_OpCounts hypre_global_op_counts = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0, { 0.0, 0.0, 0.0 }, 0 };
+#else
+extern hypre_OpCounts hypre_global_op_counts;
+#endif
+
+#define hypre_OpCountsMessages()         (hypre_global_op_counts.messages)
+#define hypre_OpCountsBytes()            (hypre_global_op_counts.bytes)
+#define hypre_OpCountsFlops()            (hypre_global_op_counts.flops)
+#define hypre_OpCountsCommPkgTime()      (hypre_global_op_counts.comm_pkg_time)
+#define hypre_OpCountsCommPkgMessages()  (hypre_global_op_counts.comm_pkg_messages)
+#define hypre_OpCountsCommPkgBytes()     (hypre_global_op_counts.comm_pkg_bytes)
+#define hypre_OpCountsCommPkgCalls()     (hypre_global_op_counts.comm_pkg_calls)
+#define hypre_OpCountsActive()           (hypre_global_op_counts.active > 0)
+
+/* the increments are not evaluated unless the counters are on */
+#define hypre_OpCountsAddFlops(inc) \
+   do { if (hypre_OpCountsActive()) { hypre_OpCountsAdd(0.0, 0.0, (HYPRE_Real) (inc)); } } while (0)
+#define hypre_OpCountsAddMessages(num, nbytes) \
+   do { if (hypre_OpCountsActive()) { hypre_OpCountsAdd((HYPRE_Real) (num), (HYPRE_Real) (nbytes), 0.0); } } while (0)
+
+/* timing.c */
+void hypre_OpCountsActivate( HYPRE_Int increment );
+void hypre_OpCountsAdd( HYPRE_Real messages, HYPRE_Real bytes, HYPRE_Real flops );
+void hypre_OpCountsCommPkgBegin( void );
+void hypre_OpCountsCommPkgEnd( void );
+
 #ifdef __cplusplus
 }
 #endif